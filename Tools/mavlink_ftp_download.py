@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+
+"""
+Download files with MAVLink FTP burst reads and measure the throughput.
+
+Two modes are supported:
+- burst: one burst at a time, the next one is requested after burst_complete and
+  lost packets restart the burst (the behavior of existing ground stations).
+- window: several burst requests are kept in flight by sliding the window of the
+  active burst, and only the lost ranges are requested again.
+
+Several files (or the same file several times) are downloaded concurrently, each
+in its own session.
+
+SITL over UDP:
+    Tools/mavlink_ftp_download.py udpin:0.0.0.0:14550 /fs/microsd/log/sess001/log001.ulg
+    Tools/mavlink_ftp_download.py udpin:0.0.0.0:14550 --mode burst <file>
+    Tools/mavlink_ftp_download.py udpin:0.0.0.0:14550 --sessions 3 <file>
+"""
+
+import os
+import struct
+import sys
+from argparse import ArgumentParser
+from timeit import default_timer as timer
+
+os.environ['MAVLINK20'] = '1'
+
+try:
+    from pymavlink import mavutil
+except ImportError as e:
+    print("Failed to import pymavlink: " + str(e))
+    print("")
+    print("You may need to install it with:")
+    print("    pip3 install --user pymavlink")
+    print("")
+    sys.exit(1)
+
+
+# opcodes and error codes, see src/modules/mavlink/mavlink_ftp.h
+CMD_TERMINATE_SESSION = 1
+CMD_RESET_SESSIONS = 2
+CMD_OPEN_FILE_RO = 4
+CMD_BURST_READ_FILE = 15
+RSP_ACK = 128
+RSP_NAK = 129
+ERR_EOF = 6
+
+HEADER = struct.Struct('<HBBBBBBI')
+
+
+class FtpReply:
+    def __init__(self, msg):
+        payload = bytes(msg.payload)
+        (self.seq_number, self.session, self.opcode, self.size, self.req_opcode,
+         self.burst_complete, _, self.offset) = HEADER.unpack_from(payload)
+        self.data = payload[HEADER.size:HEADER.size + self.size]
+
+
+class Download:
+    def __init__(self, client, path, mode, window):
+        self.client = client
+        self.path = path
+        self.mode = mode
+        self.window = window
+        self.session = None
+        self.file_size = 0
+        self.data = None
+        self.next_offset = 0      # end of the data received in order
+        self.requested_end = 0    # end of the requested window
+        self.gaps = []            # lost ranges [start, end) requested again
+        self.received_bytes = 0   # including duplicates
+        self.restarted = False    # burst mode: waiting for the restarted burst
+        self.last_activity = timer()
+
+    def open(self):
+        reply = self.client.request(CMD_OPEN_FILE_RO, 0, 0, self.path.encode('ascii') + b'\0')
+
+        if reply.opcode != RSP_ACK:
+            raise RuntimeError('failed to open {:}: error {:}'.format(self.path, reply.data[0]))
+
+        self.session = reply.session
+        self.file_size = struct.unpack('<I', reply.data[:4])[0]
+        self.data = bytearray(self.file_size)
+
+    def done(self):
+        return self.next_offset >= self.file_size and not self.gaps
+
+    def start(self):
+        if self.mode == 'window':
+            self.burst(0, self.window)
+
+        else:
+            self.burst(0)
+
+        self.last_activity = timer()
+
+    def burst(self, offset, length=None):
+        data = struct.pack('<I', length) if length is not None else b''
+        self.client.send(CMD_BURST_READ_FILE, self.session, offset, data)
+
+        if length is not None:
+            self.requested_end = max(self.requested_end, offset + length)
+
+    def handle(self, reply):
+        self.last_activity = timer()
+
+        if reply.opcode == RSP_NAK:
+            if reply.data[0] != ERR_EOF:
+                raise RuntimeError('{:}: burst failed with error {:}'.format(self.path, reply.data[0]))
+
+            return
+
+        if self.restarted:
+            if reply.offset != self.next_offset:
+                # remainder of the previous burst
+                return
+
+            self.restarted = False
+
+        end = reply.offset + len(reply.data)
+        self.data[reply.offset:end] = reply.data
+        self.received_bytes += len(reply.data)
+
+        if reply.offset < self.next_offset:
+            self._fill_gap(reply.offset, end)
+            self.next_offset = max(self.next_offset, end)
+
+        else:
+            if reply.offset > self.next_offset:
+                self._lost(self.next_offset, reply.offset)
+
+            self.next_offset = end
+
+        if self.mode == 'window':
+            # slide the window when half of it was received
+            if self.requested_end < self.file_size and self.requested_end - self.next_offset < self.window // 2:
+                self.burst(self.requested_end, self.window // 2)
+
+        elif reply.burst_complete and not self.done():
+            self.burst(self.next_offset)
+
+    def timeout(self):
+        """ nothing received for a while: request the lost ranges and the rest of the window again """
+        if self.mode == 'window':
+            for start, end in self.gaps:
+                self.burst(start, end - start)
+
+            if self.next_offset < self.file_size:
+                self.requested_end = 0
+                self.burst(self.next_offset, self.window)
+
+        else:
+            self.restarted = True
+            self.burst(self.next_offset)
+
+        self.last_activity = timer()
+
+    def _lost(self, start, end):
+        if self.mode == 'window':
+            self.gaps.append([start, end])
+            self.burst(start, end - start)
+
+        else:
+            # restart the burst at the first lost byte
+            self.next_offset = start
+            self.restarted = True
+            self.burst(start)
+
+    def _fill_gap(self, start, end):
+        gaps = []
+
+        for gap_start, gap_end in self.gaps:
+            if end <= gap_start or start >= gap_end:
+                gaps.append([gap_start, gap_end])
+                continue
+
+            if gap_start < start:
+                gaps.append([gap_start, start])
+
+            if end < gap_end:
+                gaps.append([end, gap_end])
+
+        self.gaps = gaps
+
+
+class FtpClient:
+    def __init__(self, device, baudrate, target_component):
+        self.mav = mavutil.mavlink_connection(device, autoreconnect=True, baud=baudrate)
+        self.mav.wait_heartbeat()
+        self.target_component = target_component
+        self.seq_number = 0
+
+    def send(self, opcode, session, offset, data=b''):
+        payload = HEADER.pack(self.seq_number, session, opcode, len(data), 0, 0, 0, offset) + data
+        payload = payload.ljust(251, b'\0')
+        self.seq_number = (self.seq_number + 1) & 0xffff
+        self.mav.mav.file_transfer_protocol_send(0, self.mav.target_system, self.target_component, payload)
+
+    def recv(self, timeout):
+        msg = self.mav.recv_match(type='FILE_TRANSFER_PROTOCOL', blocking=True, timeout=timeout)
+        return FtpReply(msg) if msg is not None else None
+
+    def request(self, opcode, session, offset, data=b'', timeout=1.0, retries=5):
+        """ send a command and wait for its (n)ack """
+        for _ in range(retries):
+            self.send(opcode, session, offset, data)
+
+            while True:
+                reply = self.recv(timeout)
+
+                if reply is None:
+                    break
+
+                if reply.req_opcode == opcode and reply.opcode in (RSP_ACK, RSP_NAK):
+                    return reply
+
+        raise RuntimeError('no reply to opcode {:}'.format(opcode))
+
+
+def main():
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument('device', help='MAVLink connection, e.g. udpin:0.0.0.0:14550 or /dev/ttyUSB0')
+    parser.add_argument('files', nargs='+', help='files on the vehicle to download')
+    parser.add_argument('--baudrate', '-b', type=int, default=57600, help='serial baudrate')
+    parser.add_argument('--mode', choices=['window', 'burst'], default='window', help='download mode')
+    parser.add_argument('--window', type=int, default=64 * 1024, help='window length in bytes (window mode)')
+    parser.add_argument('--sessions', type=int, default=1, help='number of concurrent downloads of each file')
+    parser.add_argument('--target-component', type=int, default=1, help='component id of the FTP server')
+    parser.add_argument('--timeout', type=float, default=0.5, help='retransmission timeout in seconds')
+    parser.add_argument('--output', '-o', help='output directory (the files are not stored by default)')
+    args = parser.parse_args()
+
+    client = FtpClient(args.device, args.baudrate, args.target_component)
+    client.request(CMD_RESET_SESSIONS, 0, 0)
+
+    downloads = [Download(client, path, args.mode, args.window) for path in args.files for _ in range(args.sessions)]
+
+    for download in downloads:
+        download.open()
+
+    sessions = {download.session: download for download in downloads}
+
+    start = timer()
+
+    for download in downloads:
+        download.start()
+
+    while not all(download.done() for download in downloads):
+        reply = client.recv(args.timeout)
+        now = timer()
+
+        if reply is not None and reply.req_opcode == CMD_BURST_READ_FILE and reply.session in sessions:
+            sessions[reply.session].handle(reply)
+
+        for download in downloads:
+            if not download.done() and now - download.last_activity > args.timeout:
+                download.timeout()
+
+    elapsed = timer() - start
+
+    for download in downloads:
+        client.request(CMD_TERMINATE_SESSION, download.session, 0)
+
+    total = sum(download.file_size for download in downloads)
+    received = sum(download.received_bytes for download in downloads)
+
+    for download in downloads:
+        print('{:} (session {:}): {:} bytes'.format(download.path, download.session, download.file_size))
+
+        if args.output:
+            name = '{:}_{:}'.format(download.session, os.path.basename(download.path))
+
+            with open(os.path.join(args.output, name), 'wb') as f:
+                f.write(download.data)
+
+    print('{:} mode: {:} bytes in {:.2f} s, {:.1f} KB/s ({:.1f}% retransmitted)'.format(
+        args.mode, total, elapsed, total / elapsed / 1024 if elapsed > 0 else 0,
+        100. * (received - total) / total if total > 0 else 0))
+
+
+if __name__ == '__main__':
+    main()
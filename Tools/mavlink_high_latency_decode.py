@@ -0,0 +1,324 @@
+#!/usr/bin/env python3
+
+"""
+Decode the compact high latency telemetry and compare its data volume with HIGH_LATENCY2.
+
+The compact reports (MAV_HL_ENCODING) are HIGH_LATENCY_COMPACT messages of the development
+dialect, see src/modules/mavlink/HighLatencyCodec.hpp for the format. The HIGH_LATENCY2 messages
+of a log are also encoded with the same encoder, to estimate the savings from existing logs.
+
+Telemetry log (e.g. recorded by the ground station, MAV_HL_ENCODING set to 2 for both):
+    Tools/mavlink_high_latency_decode.py flight.tlog
+
+Live, acknowledging the decoded reports:
+    Tools/mavlink_high_latency_decode.py udpin:0.0.0.0:14550 --ack --verbose
+"""
+
+import os
+import sys
+from argparse import ArgumentParser
+
+os.environ['MAVLINK20'] = '1'
+os.environ.setdefault('MAVLINK_DIALECT', 'development')
+
+try:
+    from pymavlink import mavutil
+except ImportError as e:
+    print("Failed to import pymavlink: " + str(e))
+    print("")
+    print("You may need to install it with:")
+    print("    pip3 install --user pymavlink")
+    print("")
+    sys.exit(1)
+
+
+# same order as high_latency::Field
+FIELDS = ['timestamp', 'latitude', 'longitude', 'altitude', 'target_altitude', 'target_distance', 'heading',
+          'target_heading', 'wp_num', 'custom_mode', 'failure_flags', 'type', 'autopilot', 'airspeed', 'airspeed_sp',
+          'groundspeed', 'windspeed', 'wind_heading', 'eph', 'epv', 'temperature_air', 'climb_rate', 'throttle',
+          'battery', 'mode_changes', 'failure_events']
+
+ABSOLUTE = {FIELDS.index('mode_changes'), FIELDS.index('failure_events')}
+POSITION = {FIELDS.index('latitude'), FIELDS.index('longitude'), FIELDS.index('altitude')}
+
+KEYFRAME_FLAG = 0x80
+SEQ_MASK = 0x7f
+TIMESTAMP_SHIFT = 10
+MAX_HORIZONTAL_SHIFT = 10
+MAX_VERTICAL_SHIFT = 4
+HISTORY_SIZE = 8
+
+# MAVLink 2 header and checksum, HIGH_LATENCY_COMPACT length field
+COMPACT_OVERHEAD = 10 + 2 + 1
+
+
+def to_int32(value):
+    value &= 0xffffffff
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def field_shift(field, horizontal_shift, vertical_shift):
+    if field == 0:
+        return TIMESTAMP_SHIFT
+
+    if field in (1, 2):
+        return horizontal_shift
+
+    if field == 3:
+        return vertical_shift
+
+    return 0
+
+
+def quantize(value, reference, shift):
+    diff = to_int32(value - reference)
+
+    if shift == 0:
+        return diff
+
+    half = 1 << (shift - 1)
+    return (diff + half) >> shift if diff >= 0 else -((-diff + half) >> shift)
+
+
+def reconstruct(reference, q, shift):
+    return to_int32(reference + (q << shift))
+
+
+def put_varint(buffer, value):
+    while value >= 0x80:
+        buffer.append((value & 0x7f) | 0x80)
+        value >>= 7
+
+    buffer.append(value)
+
+
+def get_varint(data, offset):
+    value = 0
+
+    for shift in range(0, 35, 7):
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7f) << shift
+
+        if not byte & 0x80:
+            return value, offset
+
+    raise ValueError('invalid varint')
+
+
+def floor_log2(value):
+    return value.bit_length() - 1 if value > 1 else 0
+
+
+class Encoder:
+    """ port of high_latency::Encoder """
+
+    def __init__(self, keyframe_interval=10):
+        self.keyframe_interval = keyframe_interval
+        self.history = {}
+        self.reference = None
+        self.reference_count = 0
+        self.count = 0
+        self.keyframes = 0
+
+    def encode(self, report):
+        keyframe = self.reference is None or self.count - self.reference_count >= self.keyframe_interval
+        reference = [0] * len(FIELDS) if keyframe else self.reference
+
+        horizontal_shift = min(floor_log2(max(report[FIELDS.index('eph')], 0) * 9 // 8), MAX_HORIZONTAL_SHIFT)
+        vertical_shift = min(floor_log2(max(report[FIELDS.index('epv')], 0) // 80), MAX_VERTICAL_SHIFT)
+
+        quantized = []
+        state = []
+        bitmap = 0
+
+        for i, value in enumerate(report):
+            ref = 0 if i in ABSOLUTE else reference[i]
+            shift = field_shift(i, horizontal_shift, vertical_shift)
+            q = quantize(value, ref, shift)
+            quantized.append(q)
+            state.append(reconstruct(ref, q, shift))
+
+            if q != 0:
+                bitmap |= 1 << i
+
+        buffer = bytearray([(self.count & SEQ_MASK) | (KEYFRAME_FLAG if keyframe else 0)])
+
+        if not keyframe:
+            buffer.append(self.reference_count & SEQ_MASK)
+
+        put_varint(buffer, bitmap)
+
+        if any(bitmap & (1 << i) for i in POSITION):
+            buffer.append(horizontal_shift | (vertical_shift << 4))
+
+        for i, q in enumerate(quantized):
+            if bitmap & (1 << i):
+                put_varint(buffer, ((q << 1) ^ (q >> 31)) & 0xffffffff)
+
+        self.history[self.count] = state
+        self.history.pop(self.count - HISTORY_SIZE, None)
+
+        if keyframe:
+            self.reference = state
+            self.reference_count = self.count
+            self.keyframes += 1
+
+        self.count += 1
+        return bytes(buffer)
+
+    def acknowledge(self, seq):
+        for count, state in self.history.items():
+            if (count & SEQ_MASK) == seq and count > self.reference_count and self.reference is not None:
+                self.reference = state
+                self.reference_count = count
+
+
+class Decoder:
+    """ port of high_latency::Decoder, returns (seq, list of field values) or None """
+
+    def __init__(self):
+        self.history = {}
+
+    def decode(self, data):
+        try:
+            header = data[0]
+            offset = 1
+            reference = [0] * len(FIELDS)
+
+            if not header & KEYFRAME_FLAG:
+                reference = self.history.get(data[1])
+                offset = 2
+
+                if reference is None:
+                    return None
+
+            bitmap, offset = get_varint(data, offset)
+            horizontal_shift = 0
+            vertical_shift = 0
+
+            if any(bitmap & (1 << i) for i in POSITION):
+                horizontal_shift = data[offset] & 0xf
+                vertical_shift = data[offset] >> 4
+                offset += 1
+
+            state = []
+
+            for i in range(len(FIELDS)):
+                ref = 0 if i in ABSOLUTE else reference[i]
+                q = 0
+
+                if bitmap & (1 << i):
+                    value, offset = get_varint(data, offset)
+                    q = (value >> 1) ^ -(value & 1)
+
+                state.append(reconstruct(ref, q, field_shift(i, horizontal_shift, vertical_shift)))
+
+        except (IndexError, ValueError):
+            return None
+
+        if offset != len(data):
+            return None
+
+        seq = header & SEQ_MASK
+        self.history[seq] = state
+        return seq, state
+
+
+def high_latency2_report(msg):
+    return [to_int32(getattr(msg, name)) for name in FIELDS[:-2]] + [0, 0]
+
+
+class Statistics:
+    def __init__(self, name):
+        self.name = name
+        self.messages = 0
+        self.bytes = 0
+        self.first_time = None
+        self.last_time = None
+
+    def add(self, length, time_s):
+        self.messages += 1
+        self.bytes += length
+
+        if self.first_time is None:
+            self.first_time = time_s
+
+        self.last_time = time_s
+
+    def print(self):
+        if self.messages == 0:
+            return
+
+        duration = self.last_time - self.first_time
+        per_hour = self.bytes * 3600. / duration if duration > 0 else 0
+        print('{:}: {:} messages, {:} bytes, {:.1f} bytes/message, {:.0f} bytes/hour'.format(
+            self.name, self.messages, self.bytes, self.bytes / self.messages, per_hour))
+
+
+def main():
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument('device', help='telemetry log (.tlog) or MAVLink connection, e.g. udpin:0.0.0.0:14550')
+    parser.add_argument('--ack', action='store_true', help='acknowledge the decoded reports (live connection)')
+    parser.add_argument('--keyframe-interval', type=int, default=10, help='keyframe interval of the re-encoding')
+    parser.add_argument('--verbose', '-v', action='store_true', help='print the decoded reports')
+    args = parser.parse_args()
+
+    mav = mavutil.mavlink_connection(args.device)
+
+    decoder = Decoder()
+    stats_hl2 = Statistics('HIGH_LATENCY2')
+    stats_compact = Statistics('compact (received)')
+    stats_reencoded = Statistics('compact (HIGH_LATENCY2 re-encoded, no ack)')
+    stats_reencoded_ack = Statistics('compact (HIGH_LATENCY2 re-encoded, all acknowledged)')
+    encoder = Encoder(args.keyframe_interval)
+    encoder_ack = Encoder(args.keyframe_interval)
+    undecoded = 0
+
+    while True:
+        msg = mav.recv_match(type=['HIGH_LATENCY2', 'HIGH_LATENCY_COMPACT'], blocking=True)
+
+        if msg is None:
+            break
+
+        time_s = getattr(msg, '_timestamp', 0)
+        length = len(msg.get_msgbuf())
+
+        if msg.get_type() == 'HIGH_LATENCY2':
+            stats_hl2.add(length, time_s)
+            report = high_latency2_report(msg)
+            stats_reencoded.add(COMPACT_OVERHEAD + len(encoder.encode(report)), time_s)
+            stats_reencoded_ack.add(COMPACT_OVERHEAD + len(encoder_ack.encode(report)), time_s)
+            encoder_ack.acknowledge((encoder_ack.count - 1) & SEQ_MASK)
+            continue
+
+        if msg.get_srcSystem() == mav.source_system:
+            continue
+
+        stats_compact.add(length, time_s)
+        decoded = decoder.decode(bytes(msg.data[:msg.length]))
+
+        if decoded is None:
+            undecoded += 1
+            continue
+
+        seq, state = decoded
+
+        if args.verbose:
+            print('{:3}: '.format(seq) + ', '.join('{:}={:}'.format(name, value)
+                                                   for name, value in zip(FIELDS, state) if value != 0))
+
+        if args.ack:
+            mav.mav.high_latency_compact_ack_send(msg.get_srcSystem(), msg.get_srcComponent(), seq)
+
+    for stats in [stats_hl2, stats_compact, stats_reencoded, stats_reencoded_ack]:
+        stats.print()
+
+    if undecoded > 0:
+        print('{:} compact reports could not be decoded (lost reference)'.format(undecoded))
+
+    print('re-encoding: {:} keyframes without ack, {:} with ack'.format(encoder.keyframes, encoder_ack.keyframes))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+
+"""
+Upload and download a large survey mission and measure the transfer times.
+
+The vehicle requests MAV_MIS_WINDOW items ahead during the upload, this script
+answers every MISSION_REQUEST_INT it receives. The download requests the same
+number of items ahead (--window), set it to 1 for a one item at a time download.
+
+SITL over UDP, compare with MAV_MIS_WINDOW set to 1:
+    Tools/mavlink_mission_transfer.py udpin:0.0.0.0:14550 --items 2000
+
+Emulated 57600 baud radio, e.g. a second SITL instance limited to the radio data rate:
+    mavlink start -x -u 14558 -r 5760 -o 14559
+    Tools/mavlink_mission_transfer.py udpin:0.0.0.0:14559
+"""
+
+import math
+import os
+import sys
+from argparse import ArgumentParser
+from timeit import default_timer as timer
+
+os.environ['MAVLINK20'] = '1'
+
+try:
+    from pymavlink import mavutil
+except ImportError as e:
+    print("Failed to import pymavlink: " + str(e))
+    print("")
+    print("You may need to install it with:")
+    print("    pip3 install --user pymavlink")
+    print("")
+    sys.exit(1)
+
+
+MISSION_TYPE = 0  # MAV_MISSION_TYPE_MISSION
+
+
+def survey(count, lat, lon, alt, spacing):
+    """ @return list of (lat, lon, alt) of a lawnmower pattern with count waypoints """
+    dlat = spacing / 6378137.0 * 180.0 / math.pi
+    dlon = dlat / math.cos(math.radians(lat))
+    per_leg = 10
+    items = []
+
+    for i in range(count):
+        leg, index = divmod(i, per_leg)
+
+        if leg % 2:
+            index = per_leg - 1 - index
+
+        items.append((lat + leg * dlat, lon + index * dlon, alt))
+
+    return items
+
+
+class MissionTransfer:
+    def __init__(self, device, baudrate, timeout):
+        self.mav = mavutil.mavlink_connection(device, autoreconnect=True, baud=baudrate)
+        self.mav.wait_heartbeat()
+        self.timeout = timeout
+        self.sent_items = 0
+
+    def send_item(self, seq, item):
+        lat, lon, alt = item
+        self.mav.mav.mission_item_int_send(self.mav.target_system, self.mav.target_component, seq,
+                                           mavutil.mavlink.MAV_FRAME_GLOBAL_RELATIVE_ALT_INT,
+                                           mavutil.mavlink.MAV_CMD_NAV_WAYPOINT, 0, 1, 0, 0, 0, float('nan'),
+                                           int(lat * 1e7), int(lon * 1e7), alt, MISSION_TYPE)
+        self.sent_items += 1
+
+    def upload(self, items):
+        self.sent_items = 0
+        self.mav.mav.mission_count_send(self.mav.target_system, self.mav.target_component, len(items), MISSION_TYPE)
+
+        while True:
+            msg = self.mav.recv_match(type=['MISSION_REQUEST_INT', 'MISSION_REQUEST', 'MISSION_ACK'], blocking=True,
+                                      timeout=self.timeout)
+
+            if msg is None:
+                raise RuntimeError('upload timed out')
+
+            if msg.get_type() == 'MISSION_ACK':
+                if msg.type != mavutil.mavlink.MAV_MISSION_ACCEPTED:
+                    raise RuntimeError('upload failed with result {:}'.format(msg.type))
+
+                return
+
+            if msg.seq < len(items):
+                self.send_item(msg.seq, items[msg.seq])
+
+    def download(self, window):
+        self.mav.mav.mission_request_list_send(self.mav.target_system, self.mav.target_component, MISSION_TYPE)
+        msg = self.mav.recv_match(type='MISSION_COUNT', blocking=True, timeout=self.timeout)
+
+        if msg is None:
+            raise RuntimeError('no MISSION_COUNT received')
+
+        count = msg.count
+        items = {}
+        next_request = 0
+        lowest_missing = 0
+
+        while lowest_missing < count:
+            # keep the window of requests full
+            while next_request < count and next_request < lowest_missing + window:
+                if next_request not in items:
+                    self.mav.mav.mission_request_int_send(self.mav.target_system, self.mav.target_component, next_request,
+                                                          MISSION_TYPE)
+
+                next_request += 1
+
+            msg = self.mav.recv_match(type='MISSION_ITEM_INT', blocking=True, timeout=self.timeout)
+
+            if msg is None:
+                # request the missing items again
+                next_request = lowest_missing
+                continue
+
+            items[msg.seq] = (msg.x / 1e7, msg.y / 1e7, msg.z)
+
+            while lowest_missing in items:
+                lowest_missing += 1
+
+        self.mav.mav.mission_ack_send(self.mav.target_system, self.mav.target_component,
+                                      mavutil.mavlink.MAV_MISSION_ACCEPTED, MISSION_TYPE)
+
+        return [items[seq] for seq in range(count)]
+
+
+def main():
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument('device', help='MAVLink connection, e.g. udpin:0.0.0.0:14550 or /dev/ttyUSB0')
+    parser.add_argument('--baudrate', '-b', type=int, default=57600, help='serial baudrate')
+    parser.add_argument('--items', type=int, default=2000, help='number of mission items')
+    parser.add_argument('--window', type=int, default=8, help='number of items requested ahead during the download')
+    parser.add_argument('--timeout', type=float, default=5.0, help='receive timeout in seconds')
+    parser.add_argument('--lat', type=float, default=47.397742, help='latitude of the first waypoint')
+    parser.add_argument('--lon', type=float, default=8.545594, help='longitude of the first waypoint')
+    args = parser.parse_args()
+
+    transfer = MissionTransfer(args.device, args.baudrate, args.timeout)
+    items = survey(args.items, args.lat, args.lon, 30.0, 20.0)
+
+    start = timer()
+    transfer.upload(items)
+    upload_time = timer() - start
+    print('upload: {:} items in {:.2f} s ({:.1f} items/s, {:} items sent)'.format(
+        len(items), upload_time, len(items) / upload_time, transfer.sent_items))
+
+    start = timer()
+    downloaded = transfer.download(args.window)
+    download_time = timer() - start
+    print('download: {:} items in {:.2f} s ({:.1f} items/s)'.format(len(downloaded), download_time,
+                                                                    len(downloaded) / download_time))
+
+    for seq, (expected, received) in enumerate(zip(items, downloaded)):
+        if abs(expected[0] - received[0]) > 1e-6 or abs(expected[1] - received[1]) > 1e-6:
+            print('error: item {:} differs after the download'.format(seq))
+            sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
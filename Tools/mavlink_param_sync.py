@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+
+"""
+Compare a full parameter download with the hash based chunk synchronization.
+
+The full download uses PARAM_REQUEST_LIST. The chunk synchronization requests the
+chunk hashes (_HASH_CHUNKS), compares them with the hashes of the cached set and
+only requests the chunks that differ (PARAM_SET of _HASH_CHUNK).
+
+SITL over UDP:
+    Tools/mavlink_param_sync.py udpin:0.0.0.0:14550
+
+Emulated 57600 baud radio, e.g. a second SITL instance limited to the radio data rate:
+    mavlink start -x -u 14558 -r 5760 -o 14559
+    Tools/mavlink_param_sync.py udpin:0.0.0.0:14559
+
+Or a serial link:
+    Tools/mavlink_param_sync.py /dev/ttyUSB0 --baudrate 57600
+"""
+
+import os
+import struct
+import sys
+import zlib
+from argparse import ArgumentParser
+from timeit import default_timer as timer
+
+os.environ['MAVLINK20'] = '1'
+
+try:
+    from pymavlink import mavutil
+except ImportError as e:
+    print("Failed to import pymavlink: " + str(e))
+    print("")
+    print("You may need to install it with:")
+    print("    pip3 install --user pymavlink")
+    print("")
+    sys.exit(1)
+
+
+HASH_CHUNKS_PARAM = '_HASH_CHUNKS'
+HASH_CHUNK_PARAM = '_HASH_CHUNK'
+
+
+def crc32part(data, crc):
+    """ same as crc32part() of PX4: no initial or final inversion """
+    return zlib.crc32(data, crc ^ 0xffffffff) ^ 0xffffffff
+
+
+def param_id(msg):
+    name = msg.param_id
+    return name.decode('ascii') if isinstance(name, bytes) else name
+
+
+def value_bytes(msg):
+    return struct.pack('<f', msg.param_value)
+
+
+def chunk_hashes(params, chunk_ends):
+    """
+    params: list of (name, value bytes) ordered by index
+    chunk_ends: index of the end of each chunk, as reported by the vehicle. The vehicle splits the
+    parameters into chunks by their index in the full (not only used) parameter set, which the
+    client can't know, so the chunk boundaries are taken from the _HASH_CHUNK messages.
+    """
+    hashes = []
+    start = 0
+
+    for end in chunk_ends:
+        chunk_hash = 0
+
+        for name, value in params[start:end]:
+            chunk_hash = crc32part(name.encode('ascii'), chunk_hash)
+            chunk_hash = crc32part(value, chunk_hash)
+
+        hashes.append(chunk_hash)
+        start = end
+
+    return hashes
+
+
+class ParamSync:
+    def __init__(self, device, baudrate, timeout):
+        self.mav = mavutil.mavlink_connection(device, autoreconnect=True, baud=baudrate)
+        self.mav.wait_heartbeat()
+        self.timeout = timeout
+        self.received_messages = 0
+
+    def recv_param_value(self):
+        msg = self.mav.recv_match(type='PARAM_VALUE', blocking=True, timeout=self.timeout)
+
+        if msg is not None:
+            self.received_messages += 1
+
+        return msg
+
+    def download_all(self):
+        """ @return list of (name, value bytes) ordered by index """
+        params = {}
+        count = None
+        self.mav.mav.param_request_list_send(self.mav.target_system, self.mav.target_component)
+
+        while count is None or len(params) < count:
+            msg = self.recv_param_value()
+
+            if msg is None:
+                if count is None:
+                    raise RuntimeError('no PARAM_VALUE received')
+
+                # request the missing ones
+                for index in range(count):
+                    if index not in params:
+                        self.mav.mav.param_request_read_send(self.mav.target_system, self.mav.target_component,
+                                                             b'', index)
+
+                continue
+
+            if msg.param_index >= 0xffff or param_id(msg).startswith('_HASH'):
+                continue
+
+            count = msg.param_count
+            params[msg.param_index] = (param_id(msg), value_bytes(msg))
+
+        return [params[i] for i in range(count)]
+
+    def sync(self, cached):
+        """ @return updated list of (name, value bytes) and the number of requested chunks """
+        self.mav.mav.param_request_read_send(self.mav.target_system, self.mav.target_component,
+                                             HASH_CHUNKS_PARAM.encode('ascii'), -1)
+        num_chunks = None
+        remote_hashes = {}
+        chunk_ends = {}
+
+        while num_chunks is None or len(remote_hashes) < num_chunks:
+            msg = self.recv_param_value()
+
+            if msg is None:
+                raise RuntimeError('chunk hashes not received, not supported by the vehicle?')
+
+            value = struct.unpack('<I', value_bytes(msg))[0]
+
+            if param_id(msg) == HASH_CHUNKS_PARAM:
+                num_chunks = msg.param_count
+
+            elif param_id(msg) == HASH_CHUNK_PARAM:
+                remote_hashes[msg.param_index] = value
+                chunk_ends[msg.param_index] = msg.param_count
+
+        chunk_ends = [chunk_ends[chunk] for chunk in range(num_chunks)]
+        count = chunk_ends[-1] if chunk_ends else 0
+
+        if len(cached) != count:
+            return self.download_all(), num_chunks
+
+        local_hashes = chunk_hashes(cached, chunk_ends)
+        stale = [chunk for chunk in range(num_chunks) if local_hashes[chunk] != remote_hashes[chunk]]
+
+        if not stale:
+            return cached, 0
+
+        params = list(cached)
+        missing = set()
+
+        for chunk in stale:
+            self.mav.mav.param_set_send(self.mav.target_system, self.mav.target_component,
+                                        HASH_CHUNK_PARAM.encode('ascii'), struct.unpack('<f', struct.pack('<I', chunk))[0],
+                                        mavutil.mavlink.MAV_PARAM_TYPE_UINT32)
+            missing.update(range(chunk_ends[chunk - 1] if chunk > 0 else 0, chunk_ends[chunk]))
+
+        while missing:
+            msg = self.recv_param_value()
+
+            if msg is None:
+                for index in missing:
+                    self.mav.mav.param_request_read_send(self.mav.target_system, self.mav.target_component,
+                                                         b'', index)
+
+                continue
+
+            if msg.param_index in missing:
+                params[msg.param_index] = (param_id(msg), value_bytes(msg))
+                missing.discard(msg.param_index)
+
+        return params, len(stale)
+
+
+def main():
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument('device', help='MAVLink connection, e.g. udpin:0.0.0.0:14550 or /dev/ttyUSB0')
+    parser.add_argument('--baudrate', '-b', type=int, default=57600, help='serial baudrate')
+    parser.add_argument('--stale', type=int, default=3, help='number of cached values to modify before the sync')
+    parser.add_argument('--timeout', type=float, default=1.0, help='receive timeout in seconds')
+    args = parser.parse_args()
+
+    sync = ParamSync(args.device, args.baudrate, args.timeout)
+
+    start = timer()
+    params = sync.download_all()
+    full_time = timer() - start
+    full_messages = sync.received_messages
+    print('full download: {:} params, {:} messages in {:.2f} s'.format(len(params), full_messages, full_time))
+
+    # outdated cache: modify some values, spread over the parameter set
+    cached = list(params)
+
+    for i in range(args.stale):
+        index = (i * len(cached)) // max(args.stale, 1)
+        name, value = cached[index]
+        cached[index] = (name, bytes([value[0] ^ 0xff]) + value[1:])
+
+    sync.received_messages = 0
+    start = timer()
+    synced, stale_chunks = sync.sync(cached)
+    sync_time = timer() - start
+    print('hash sync: {:} stale chunks, {:} messages in {:.2f} s'.format(stale_chunks, sync.received_messages,
+                                                                         sync_time))
+
+    if synced != params:
+        print('error: synchronized parameters differ from the full download')
+        sys.exit(1)
+
+    print('speedup: {:.1f}x'.format(full_time / sync_time if sync_time > 0 else float('inf')))
+
+
+if __name__ == '__main__':
+    main()
@@ -47,7 +47,8 @@ class ModuleParams : public ListNode<ModuleParams *>
 {
 public:
 
-	ModuleParams(ModuleParams *parent)
+	ModuleParams(ModuleParams *parent) :
+		_param_generation(param_generation())
 	{
 		setParent(parent);
 	}
@@ -80,14 +81,19 @@ protected:
 	/**
 	 * @brief Call this method whenever the module gets a parameter change notification.
 	 *        It will automatically call updateParams() for all children, which then call updateParamsImpl().
+	 *        Only the parameters that changed since the previous update are read again.
 	 */
 	virtual void updateParams()
 	{
+		const uint32_t generation = param_generation();
+
 		for (const auto &child : _children) {
 			child->updateParams();
 		}
 
 		updateParamsImpl();
+
+		_param_generation = generation;
 	}
 
 	/**
@@ -95,8 +101,15 @@ protected:
 	 */
 	virtual void updateParamsImpl() {}
 
+	/**
+	 * @return parameter generation of the last update, the parameters changed after it are read by updateParamsImpl()
+	 */
+	uint32_t paramGeneration() const { return _param_generation; }
+
 private:
 	/** @list _children The module parameter list of inheriting classes. */
 	List<ModuleParams *> _children;
 	ModuleParams *_parent{nullptr};
+
+	uint32_t _param_generation;
 };
@@ -59,14 +59,16 @@ inline static param_t param_handle(px4::params p)
 #define _DEFINE_SINGLE_PARAMETER(x) \
 	do_not_explicitly_use_this_namespace::PAIR(x);
 
+// only read the parameters that changed since the last update
 #define _CALL_UPDATE(x) \
-	STRIP(x).update();
+	if (param_changed_since(STRIP(x).handle(), param_update_generation)) { STRIP(x).update(); }
 
 // define the parameter update method, which will update all parameters.
 // It is marked as 'final', so that wrong usages lead to a compile error (see below)
 #define _DEFINE_PARAMETER_UPDATE_METHOD(...) \
 	protected: \
 	void updateParamsImpl() final { \
+		const uint32_t param_update_generation = paramGeneration(); \
 		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
 	} \
 	private:
@@ -86,6 +88,7 @@ inline static param_t param_handle(px4::params p)
 	protected: \
 	void updateParamsImpl() override { \
 		parent_class::updateParamsImpl(); \
+		const uint32_t param_update_generation = paramGeneration(); \
 		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
 	} \
 	private:
@@ -144,7 +147,12 @@ public:
 		return false;
 	}
 
-	void set(float val) { _val = val; }
+	/// Set the local value, it is replaced by the stored value on the next update unless committed
+	void set(float val)
+	{
+		_val = val;
+		param_mark_changed(handle());
+	}
 
 	void reset()
 	{
@@ -196,7 +204,12 @@ public:
 		return false;
 	}
 
-	void set(float val) { _val = val; }
+	/// Set the local value, it is replaced by the stored value on the next update unless committed
+	void set(float val)
+	{
+		_val = val;
+		param_mark_changed(handle());
+	}
 
 	void reset()
 	{
@@ -246,7 +259,12 @@ public:
 		return false;
 	}
 
-	void set(int32_t val) { _val = val; }
+	/// Set the local value, it is replaced by the stored value on the next update unless committed
+	void set(int32_t val)
+	{
+		_val = val;
+		param_mark_changed(handle());
+	}
 
 	void reset()
 	{
@@ -298,7 +316,12 @@ public:
 		return false;
 	}
 
-	void set(int32_t val) { _val = val; }
+	/// Set the local value, it is replaced by the stored value on the next update unless committed
+	void set(int32_t val)
+	{
+		_val = val;
+		param_mark_changed(handle());
+	}
 
 	void reset()
 	{
@@ -356,7 +379,12 @@ public:
 		return false;
 	}
 
-	void set(bool val) { _val = val; }
+	/// Set the local value, it is replaced by the stored value on the next update unless committed
+	void set(bool val)
+	{
+		_val = val;
+		param_mark_changed(handle());
+	}
 
 	void reset()
 	{
@@ -54,6 +54,25 @@ public:
 
 	bool advertised() const { return _handle != nullptr; }
 
+	/**
+	 * Number of local subscriptions to the published topic instance (0 if not advertised).
+	 */
+	int8_t subscriber_count() const { return advertised() ? Manager::orb_get_subscriber_count(_handle) : 0; }
+
+	/**
+	 * Check if there is demand for the topic, allowing publishers to skip filling optional messages.
+	 * Subscribers can only attach to an existing topic, so this is true until the first publication advertised it.
+	 * Subscriptions from a remote processor are not counted, so this is always true with the uORB communicator.
+	 */
+	bool has_subscribers() const
+	{
+#ifdef CONFIG_ORB_COMMUNICATOR
+		return true;
+#else
+		return !advertised() || (subscriber_count() > 0);
+#endif /* CONFIG_ORB_COMMUNICATOR */
+	}
+
 	bool unadvertise() { return (Manager::orb_unadvertise(_handle) == PX4_OK); }
 
 	orb_id_t get_topic() const { return get_orb_meta(_orb_id); }
@@ -229,6 +229,12 @@ int	uORB::Manager::orb_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case ORBIOCDEVSUBSCRIBERCOUNT: {
+			orbiocdevsubscribercount_t *data = (orbiocdevsubscribercount_t *)arg;
+			data->count = uORB::Manager::orb_get_subscriber_count(data->handle);
+		}
+		break;
+
 	default:
 		ret = -ENOTTY;
 	}
@@ -479,6 +485,15 @@ uint8_t uORB::Manager::orb_get_instance(const void *node_handle)
 	return -1;
 }
 
+int8_t uORB::Manager::orb_get_subscriber_count(const void *node_handle)
+{
+	if (node_handle) {
+		return static_cast<const uORB::DeviceNode *>(node_handle)->subscriber_count();
+	}
+
+	return 0;
+}
+
 /* These are optimized by inlining in NuttX Flat build */
 #if !defined(CONFIG_BUILD_FLAT)
 unsigned uORB::Manager::updates_available(const void *node_handle, unsigned last_generation)
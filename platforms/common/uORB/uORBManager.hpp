@@ -147,6 +147,12 @@ typedef struct {
 	bool ret;
 } orbiocdevisadvertised_t;
 
+#define ORBIOCDEVSUBSCRIBERCOUNT	_ORBIOCDEV(43)
+typedef struct {
+	const void *handle;
+	int8_t count;
+} orbiocdevsubscribercount_t;
+
 typedef enum {
 	ORB_DEVMASTER_STATUS = 0,
 	ORB_DEVMASTER_TOP = 1
@@ -448,6 +454,8 @@ public:
 
 	static uint8_t orb_get_instance(const void *node_handle);
 
+	static int8_t orb_get_subscriber_count(const void *node_handle);
+
 #if defined(CONFIG_BUILD_FLAT)
 	/* These are optimized by inlining in NuttX Flat build */
 	static unsigned updates_available(const void *node_handle, unsigned last_generation) { return is_advertised(node_handle) ? static_cast<const DeviceNode *>(node_handle)->updates_available(last_generation) : 0; }
@@ -219,6 +219,57 @@ bool DatamanClient::writeSync(dm_item_t item, uint32_t index, uint8_t *buffer, u
 	return success;
 }
 
+bool DatamanClient::writeBulkSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, uint32_t count,
+				  hrt_abstime timeout)
+{
+	if (length > g_per_item_size[item]) {
+		PX4_ERR("Length  %" PRIu32 " can't fit in data size for item  %" PRIi8, length, static_cast<uint8_t>(item));
+		return false;
+	}
+
+	bool success = true;
+
+	dataman_request_s request;
+	request.client_id = _client_id;
+	request.item = static_cast<uint8_t>(item);
+	request.data_length = length;
+
+	dataman_response_s response{};
+
+	for (uint32_t i = 0; (i < count) && success; ++i) {
+		hrt_abstime timestamp = hrt_absolute_time();
+		request.timestamp = timestamp;
+		request.index = index + i;
+		request.request_type = DM_WRITE_DEFERRED;
+
+		memcpy(request.data, buffer + i * length, length);
+
+		success = syncHandler(request, response, timestamp, timeout);
+
+		if (success && (response.status != dataman_response_s::STATUS_SUCCESS)) {
+			success = false;
+			PX4_ERR("writeBulkSync failed! status=%" PRIu8 ", item=%" PRIu8 ", index=%" PRIu32 ", length=%" PRIu32,
+				response.status, static_cast<uint8_t>(item), index + i, length);
+		}
+	}
+
+	// flush the written indices (also after a failure, the storage must not keep a partial write pending)
+	hrt_abstime timestamp = hrt_absolute_time();
+	request.timestamp = timestamp;
+	request.index = index;
+	request.request_type = DM_SYNC;
+
+	if (!syncHandler(request, response, timestamp, timeout)) {
+		success = false;
+
+	} else if (response.status != dataman_response_s::STATUS_SUCCESS) {
+		success = false;
+		PX4_ERR("writeBulkSync flush failed! status=%" PRIu8 ", item=%" PRIu8, response.status, static_cast<uint8_t>(item));
+	}
+
+	return success;
+}
+
 bool DatamanClient::clearSync(dm_item_t item, hrt_abstime timeout)
 {
 	bool success = false;
@@ -77,6 +77,23 @@ public:
 	 */
 	bool writeSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout = 5000_ms);
 
+	/**
+	 * @brief Write consecutive indices of an item to the dataman synchronously.
+	 *
+	 * The storage is only flushed once after all the writes, instead of after every index.
+	 *
+	 * @param[in] item The data item type to write.
+	 * @param[in] index The index of the first data item.
+	 * @param[in] buffer The buffer that contains the data of all the indices, each at a stride of length bytes.
+	 * @param[in] length The length of the data of a single index.
+	 * @param[in] count The number of indices to write.
+	 * @param[in] timeout The maximum time in microseconds to wait for each response.
+	 *
+	 * @return True if all the write operations and the flush succeeded, false otherwise.
+	 */
+	bool writeBulkSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, uint32_t count,
+			   hrt_abstime timeout = 5000_ms);
+
 	/**
 	 * @brief Clears the data in the specified dataman item.
 	 *
@@ -0,0 +1,436 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file EllipsoidFit.hpp
+ *
+ * Allocation free Levenberg-Marquardt sphere and ellipsoid fit with incremental updates,
+ * used for the magnetometer calibration.
+ *
+ * The residual of a sample x is e = |S (x - offset)|^2 - radius^2, which is a quadratic polynomial in x:
+ * e = phi(x)^T theta(params) with phi = [x^2, y^2, z^2, xy, xz, yz, x, y, z, 1].
+ * The cost sum(e^2) = theta^T D theta, as well as J^T J and J^T e, therefore only depend on the
+ * moment matrix D = sum(phi phi^T), which is updated as the samples arrive.
+ * The memory footprint and the cost of an iteration don't depend on the number of samples.
+ *
+ * With a forgetting factor < 1 the fit tracks slowly changing parameters (e.g. in flight).
+ */
+
+#pragma once
+
+#include <matrix/matrix/math.hpp>
+#include <px4_platform_common/defines.h>
+
+class EllipsoidFit
+{
+public:
+	struct Params {
+		matrix::Vector3f offset;
+		matrix::Vector3f diag{1.f, 1.f, 1.f};
+		matrix::Vector3f offdiag;
+		float radius{0.2f};
+	};
+
+	EllipsoidFit() = default;
+	~EllipsoidFit() = default;
+
+	/**
+	 * Remove all samples and reset the solver
+	 */
+	void reset()
+	{
+		for (float &moment : _moments) { moment = 0.f; }
+
+		_samples = 0.f;
+		_origin_set = false;
+		resetSolver();
+	}
+
+	/**
+	 * Restart the Levenberg-Marquardt iterations, keeping the samples
+	 */
+	void resetSolver()
+	{
+		_damping = 1.f;
+		_cost = INFINITY;
+	}
+
+	/**
+	 * @param forgetting_factor weight of the previous samples applied at each update, 1 (default) keeps all samples
+	 */
+	void setForgettingFactor(float forgetting_factor) { _forgetting_factor = forgetting_factor; }
+
+	void update(const matrix::Vector3f &sample)
+	{
+		if (!_origin_set) {
+			// the moments are computed relative to the first sample to limit the loss of precision
+			_origin = sample;
+			_origin_set = true;
+		}
+
+		const matrix::Vector3f x = sample - _origin;
+		const float phi[N] {x(0) *x(0), x(1) *x(1), x(2) *x(2), x(0) *x(1), x(0) *x(2), x(1) *x(2), x(0), x(1), x(2), 1.f};
+
+		int k = 0;
+
+		if (_forgetting_factor < 1.f) {
+			for (int i = 0; i < N; i++) {
+				for (int j = i; j < N; j++) {
+					_moments[k] = _forgetting_factor * _moments[k] + phi[i] * phi[j];
+					k++;
+				}
+			}
+
+			_samples = _forgetting_factor * _samples + 1.f;
+
+		} else {
+			for (int i = 0; i < N; i++) {
+				for (int j = i; j < N; j++) {
+					_moments[k++] += phi[i] * phi[j];
+				}
+			}
+
+			_samples += 1.f;
+		}
+	}
+
+	/**
+	 * Number of samples (effective number with a forgetting factor)
+	 */
+	float samples() const { return _samples; }
+
+	/**
+	 * Algebraic cost of the last accepted iteration, an approximation of the geometric
+	 * residual which only holds close to the surface
+	 */
+	float cost() const { return _cost; }
+	float damping() const { return _damping; }
+
+	/**
+	 * Fit cost of a set of parameters, comparable to the RMS of the
+	 * distance to the surface divided by the square root of the number of samples.
+	 */
+	float cost(const Params &params) const
+	{
+		float theta[N];
+		computeTheta(params, theta);
+
+		float Dtheta[N];
+		multiply(theta, Dtheta);
+
+		const float sum_squares = dot(theta, Dtheta);
+
+		if ((_samples < 1.f) || (params.radius < FLT_EPSILON)) {
+			return INFINITY;
+		}
+
+		// e ~= 2 radius (|S (x - offset)| - radius) close to the surface
+		return sqrtf(fmaxf(sum_squares, 0.f)) / (_samples * 2.f * params.radius);
+	}
+
+	/**
+	 * Run a single Levenberg-Marquardt iteration
+	 *
+	 * @param params the values to be optimized
+	 * @param full_ellipsoid false: fit radius and offset, keeping the scale.
+	 *                       true: fit offset and scale (diag, offdiag), keeping the radius.
+	 * @return true if the iteration succeeded, false if it didn't improve the cost
+	 */
+	bool iterate(Params &params, bool full_ellipsoid)
+	{
+		if (full_ellipsoid) {
+			return lmIteration<9>(params, true);
+		}
+
+		return lmIteration<4>(params, false);
+	}
+
+private:
+	static constexpr int N = 10;
+	static constexpr float LMA_DAMPING = 10.f;
+
+	template<int P>
+	bool lmIteration(Params &params, bool full_ellipsoid)
+	{
+		float theta[N];
+		computeTheta(params, theta);
+
+		// dtheta/dparams
+		float G[P][N];
+		computeJacobian<P>(params, full_ellipsoid, G);
+
+		float Dtheta[N];
+		multiply(theta, Dtheta);
+
+		float DG[P][N];
+
+		for (int p = 0; p < P; p++) {
+			multiply(G[p], DG[p]);
+		}
+
+		matrix::SquareMatrix<float, P> JTJ;
+		matrix::Vector<float, P> JTe;
+
+		for (int p = 0; p < P; p++) {
+			for (int q = p; q < P; q++) {
+				JTJ(p, q) = dot(G[p], DG[q]);
+				JTJ(q, p) = JTJ(p, q);
+			}
+
+			JTe(p) = dot(G[p], Dtheta);
+		}
+
+		//------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
+		// refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
+		matrix::SquareMatrix<float, P> JTJ1 = JTJ;
+		matrix::SquareMatrix<float, P> JTJ2 = JTJ;
+
+		for (int i = 0; i < P; i++) {
+			JTJ1(i, i) += _damping;
+			JTJ2(i, i) += _damping / LMA_DAMPING;
+		}
+
+		if (!JTJ1.I(JTJ1) || !JTJ2.I(JTJ2)) {
+			return false;
+		}
+
+		const matrix::Vector<float, P> x = pack<P>(params, full_ellipsoid);
+
+		Params fit1_params = unpack<P>(params, x - JTJ1 * JTe, full_ellipsoid);
+		Params fit2_params = unpack<P>(params, x - JTJ2 * JTe, full_ellipsoid);
+
+		const float fit1 = cost(fit1_params);
+		const float fit2 = cost(fit2_params);
+
+		float fitness = _cost;
+
+		if (!(fit1 < _cost) && !(fit2 < _cost)) {
+			_damping *= LMA_DAMPING;
+
+		} else if (fit2 < _cost && fit2 < fit1) {
+			_damping /= LMA_DAMPING;
+			fit1_params = fit2_params;
+			fitness = fit2;
+
+		} else if (fit1 < _cost) {
+			fitness = fit1;
+		}
+
+		//--------------------Levenberg-Marquardt-part-ends-here--------------------------------//
+
+		if (PX4_ISFINITE(fitness) && fitness <= _cost) {
+			_cost = fitness;
+			params = fit1_params;
+			return true;
+		}
+
+		return false;
+	}
+
+	template<int P>
+	static matrix::Vector<float, P> pack(const Params &params, bool full_ellipsoid)
+	{
+		matrix::Vector<float, P> x;
+
+		if (full_ellipsoid) {
+			for (int i = 0; i < 3; i++) {
+				x(i) = params.offset(i);
+				x(3 + i) = params.diag(i);
+				x(6 + i) = params.offdiag(i);
+			}
+
+		} else {
+			x(0) = params.radius;
+
+			for (int i = 0; i < 3; i++) {
+				x(1 + i) = params.offset(i);
+			}
+		}
+
+		return x;
+	}
+
+	template<int P>
+	static Params unpack(const Params &params, const matrix::Vector<float, P> &x, bool full_ellipsoid)
+	{
+		Params result = params;
+
+		if (full_ellipsoid) {
+			for (int i = 0; i < 3; i++) {
+				result.offset(i) = x(i);
+				result.diag(i) = x(3 + i);
+				result.offdiag(i) = x(6 + i);
+			}
+
+		} else {
+			// only the squared radius is observable
+			result.radius = fabsf(x(0));
+
+			for (int i = 0; i < 3; i++) {
+				result.offset(i) = x(1 + i);
+			}
+		}
+
+		return result;
+	}
+
+	static matrix::SquareMatrix3f scaleMatrix(const matrix::Vector3f &diag, const matrix::Vector3f &offdiag)
+	{
+		const float data[9] {
+			diag(0),    offdiag(0), offdiag(1),
+			offdiag(0), diag(1),    offdiag(2),
+			offdiag(1), offdiag(2), diag(2)
+		};
+
+		return matrix::SquareMatrix3f{data};
+	}
+
+	// theta = [Q00, Q11, Q22, 2 Q01, 2 Q02, 2 Q12, -2 Q c, c^T Q c - r^2] with Q = S^2 and c the offset from the origin
+	void computeTheta(const Params &params, float theta[N]) const
+	{
+		const matrix::SquareMatrix3f S = scaleMatrix(params.diag, params.offdiag);
+		const matrix::SquareMatrix3f Q = S * S;
+		const matrix::Vector3f c = params.offset - _origin;
+		const matrix::Vector3f Qc = Q * c;
+
+		theta[0] = Q(0, 0);
+		theta[1] = Q(1, 1);
+		theta[2] = Q(2, 2);
+		theta[3] = 2.f * Q(0, 1);
+		theta[4] = 2.f * Q(0, 2);
+		theta[5] = 2.f * Q(1, 2);
+		theta[6] = -2.f * Qc(0);
+		theta[7] = -2.f * Qc(1);
+		theta[8] = -2.f * Qc(2);
+		theta[9] = c.dot(Qc) - params.radius * params.radius;
+	}
+
+	template<int P>
+	void computeJacobian(const Params &params, bool full_ellipsoid, float G[P][N]) const
+	{
+		const matrix::SquareMatrix3f S = scaleMatrix(params.diag, params.offdiag);
+		const matrix::SquareMatrix3f Q = S * S;
+		const matrix::Vector3f c = params.offset - _origin;
+		const matrix::Vector3f Qc = Q * c;
+
+		// derivative of theta for a change of Q, the offset and the radius
+		auto dtheta = [&](const matrix::SquareMatrix3f & dQ, const matrix::Vector3f & dc, float dr, float out[N]) {
+			const matrix::Vector3f dQc = dQ * c + Q * dc;
+			out[0] = dQ(0, 0);
+			out[1] = dQ(1, 1);
+			out[2] = dQ(2, 2);
+			out[3] = 2.f * dQ(0, 1);
+			out[4] = 2.f * dQ(0, 2);
+			out[5] = 2.f * dQ(1, 2);
+			out[6] = -2.f * dQc(0);
+			out[7] = -2.f * dQc(1);
+			out[8] = -2.f * dQc(2);
+			out[9] = c.dot(dQ * c) + 2.f * Qc.dot(dc) - 2.f * params.radius * dr;
+		};
+
+		const matrix::SquareMatrix3f zero_matrix{};
+		const matrix::Vector3f zero_vector{};
+
+		if (full_ellipsoid) {
+			for (int i = 0; i < 3; i++) {
+				matrix::Vector3f dc{};
+				dc(i) = 1.f;
+				dtheta(zero_matrix, dc, 0.f, G[i]);
+
+				// diagonal scale
+				matrix::SquareMatrix3f dS{};
+				dS(i, i) = 1.f;
+				dtheta(dS * S + S * dS, zero_vector, 0.f, G[3 + i]);
+
+				// off-diagonal scale (01, 02, 12)
+				const int row = (i == 2) ? 1 : 0;
+				const int col = (i == 0) ? 1 : 2;
+				dS.setZero();
+				dS(row, col) = 1.f;
+				dS(col, row) = 1.f;
+				dtheta(dS * S + S * dS, zero_vector, 0.f, G[6 + i]);
+			}
+
+		} else {
+			dtheta(zero_matrix, zero_vector, 1.f, G[0]);
+
+			for (int i = 0; i < 3; i++) {
+				matrix::Vector3f dc{};
+				dc(i) = 1.f;
+				dtheta(zero_matrix, dc, 0.f, G[1 + i]);
+			}
+		}
+	}
+
+	// out = D v with D the symmetric moment matrix stored as upper triangle
+	void multiply(const float v[N], float out[N]) const
+	{
+		for (int i = 0; i < N; i++) {
+			out[i] = 0.f;
+		}
+
+		int k = 0;
+
+		for (int i = 0; i < N; i++) {
+			out[i] += _moments[k++] * v[i];
+
+			for (int j = i + 1; j < N; j++) {
+				out[i] += _moments[k] * v[j];
+				out[j] += _moments[k] * v[i];
+				k++;
+			}
+		}
+	}
+
+	static float dot(const float a[N], const float b[N])
+	{
+		float sum = 0.f;
+
+		for (int i = 0; i < N; i++) {
+			sum += a[i] * b[i];
+		}
+
+		return sum;
+	}
+
+	float _moments[N * (N + 1) / 2] {}; ///< upper triangle of sum(phi phi^T)
+	float _samples{0.f};
+	float _forgetting_factor{1.f};
+
+	matrix::Vector3f _origin{};
+	bool _origin_set{false};
+
+	float _damping{1.f};
+	float _cost{INFINITY};
+};
@@ -0,0 +1,176 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the incremental ellipsoid fit
+ * Run this test only using make tests TESTFILTER=EllipsoidFit
+ */
+
+#include <gtest/gtest.h>
+#include <matrix/matrix/math.hpp>
+
+#include "EllipsoidFit.hpp"
+
+using matrix::Matrix3f;
+using matrix::Vector3f;
+
+class EllipsoidFitTest : public ::testing::Test
+{
+public:
+	static constexpr float FIELD = 0.45f;
+
+	const Vector3f offset_true{0.12f, -0.31f, 0.2f};
+	const Vector3f diag_true{1.1f, 0.93f, 1.02f};
+	const Vector3f offdiag_true{0.02f, -0.04f, 0.03f};
+
+	// raw sample seen by a magnetometer with hard and soft iron distortion
+	Vector3f sample(int i, const Vector3f &offset) const
+	{
+		// spiral covering the whole sphere
+		const float z = -1.f + 2.f * (i % 500 + 0.5f) / 500.f;
+		const float phi = 2.4f * i;
+		const float r = sqrtf(1.f - z * z);
+		const Vector3f field = FIELD * Vector3f{r * cosf(phi), r * sinf(phi), z};
+
+		// deterministic noise of about 1 mGauss
+		const Vector3f noise = 0.001f * Vector3f{sinf(17.f * i), cosf(23.f * i), sinf(31.f * i)};
+
+		// calibrated = S * (raw - offset)
+		return scale().I() * field + offset + noise;
+	}
+
+	Matrix3f scale() const
+	{
+		const float data[9] {
+			diag_true(0),    offdiag_true(0), offdiag_true(1),
+			offdiag_true(0), diag_true(1),    offdiag_true(2),
+			offdiag_true(1), offdiag_true(2), diag_true(2)
+		};
+
+		return Matrix3f{data};
+	}
+
+	static bool fit(EllipsoidFit &ellipsoid_fit, EllipsoidFit::Params &params, bool full_ellipsoid)
+	{
+		ellipsoid_fit.resetSolver();
+
+		for (int i = 0; i < 50; i++) {
+			ellipsoid_fit.iterate(params, full_ellipsoid);
+		}
+
+		return PX4_ISFINITE(ellipsoid_fit.cost());
+	}
+};
+
+TEST_F(EllipsoidFitTest, fixedFootprint)
+{
+	// the statistics don't grow with the number of samples
+	EXPECT_LE(sizeof(EllipsoidFit), 300u);
+}
+
+TEST_F(EllipsoidFitTest, sphereThenEllipsoid)
+{
+	EllipsoidFit ellipsoid_fit;
+
+	for (int i = 0; i < 1000; i++) {
+		ellipsoid_fit.update(sample(i, offset_true));
+	}
+
+	EXPECT_FLOAT_EQ(ellipsoid_fit.samples(), 1000.f);
+
+	EllipsoidFit::Params params;
+	ASSERT_TRUE(fit(ellipsoid_fit, params, false));
+	EXPECT_NEAR(params.radius, FIELD, 0.05f);
+	EXPECT_LT((params.offset - offset_true).norm(), 0.02f);
+
+	ASSERT_TRUE(fit(ellipsoid_fit, params, true));
+
+	// the scale is only observable relative to the radius
+	const float ratio = params.radius / FIELD;
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_NEAR(params.offset(i), offset_true(i), 0.002f) << i;
+		EXPECT_NEAR(params.diag(i) / ratio, diag_true(i), 0.005f) << i;
+		EXPECT_NEAR(params.offdiag(i) / ratio, offdiag_true(i), 0.005f) << i;
+	}
+}
+
+TEST_F(EllipsoidFitTest, incrementalMatchesBatch)
+{
+	// refit while the samples arrive, the final result must match a fit over all samples
+	EllipsoidFit incremental;
+	EllipsoidFit::Params incremental_params;
+
+	EllipsoidFit batch;
+
+	for (int i = 0; i < 600; i++) {
+		incremental.update(sample(i, offset_true));
+		batch.update(sample(i, offset_true));
+
+		if ((i + 1) % 200 == 0) {
+			fit(incremental, incremental_params, false);
+		}
+	}
+
+	EllipsoidFit::Params batch_params;
+	ASSERT_TRUE(fit(batch, batch_params, false));
+
+	EXPECT_NEAR(incremental_params.radius, batch_params.radius, 1e-4f);
+	EXPECT_LT((incremental_params.offset - batch_params.offset).norm(), 1e-4f);
+}
+
+TEST_F(EllipsoidFitTest, forgettingFactorTracksOffset)
+{
+	const Vector3f offset_changed = offset_true + Vector3f{0.05f, 0.05f, -0.1f};
+
+	EllipsoidFit ellipsoid_fit;
+	ellipsoid_fit.setForgettingFactor(0.99f);
+
+	for (int i = 0; i < 1000; i++) {
+		ellipsoid_fit.update(sample(i, offset_true));
+	}
+
+	// the effective number of samples is bounded
+	EXPECT_NEAR(ellipsoid_fit.samples(), 100.f, 1.f);
+
+	for (int i = 1000; i < 2000; i++) {
+		ellipsoid_fit.update(sample(i, offset_changed));
+	}
+
+	EllipsoidFit::Params params;
+	params.diag = diag_true;
+	params.offdiag = offdiag_true;
+	ASSERT_TRUE(fit(ellipsoid_fit, params, false));
+	EXPECT_LT((params.offset - offset_changed).norm(), 0.005f);
+}
@@ -111,9 +111,22 @@ public:
 	// Filter array of samples in place using the Direct form II.
 	inline void applyArray(T samples[], int num_samples)
 	{
+		// work on a local copy of the state, the samples could alias the filter (e.g. both class members)
+		const float b0 = _b0, b1 = _b1, b2 = _b2, a1 = _a1, a2 = _a2;
+		T d1 = _delay_element_1;
+		T d2 = _delay_element_2;
+
 		for (int n = 0; n < num_samples; n++) {
-			samples[n] = apply(samples[n]);
+			// same as apply()
+			const T d0{samples[n] - d1 * a1 - d2 * a2};
+			samples[n] = d0 * b0 + d1 * b1 + d2 * b2;
+
+			d2 = d1;
+			d1 = d0;
 		}
+
+		_delay_element_1 = d1;
+		_delay_element_2 = d2;
 	}
 
 	// Return the cutoff frequency
@@ -160,6 +173,9 @@ public:
 		_a2 = 0.f;
 	}
 
+	// vectorized over the axes, reads the coefficients and updates the delay elements directly
+	template<int> friend class MultiAxisFilterBank;
+
 protected:
 	T _delay_element_1{}; // buffered sample -1
 	T _delay_element_2{}; // buffered sample -2
@@ -0,0 +1,474 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MultiAxisFilterBank.hpp
+ *
+ * Run a cascade of notch and low-pass filters on the 3 axes of a signal in parallel.
+ *
+ * The samples of a batch are stored interleaved by axis (padded to 4 lanes). Each section
+ * loads the coefficients and state of its per-axis filter objects into 4 lane vectors,
+ * filters the whole batch and writes the state back, so the filter objects keep owning
+ * their parameters and state. Consecutive sections are run two at a time, shifted by one
+ * sample, which hides the latency of the filter recursions.
+ *
+ * NEON and SSE are used when available. Without a floating point vector unit (Cortex-M)
+ * the samples are stored per axis and each section is applied with applyArray() directly.
+ *
+ * The vector kernels are identical to applyArray() on each axis only if the multiply-adds
+ * aren't contracted: with -ffp-contract=fast (the GCC default) the scalar filters are fused
+ * on targets with FMA (aarch64, x86 with -mfma) while the vector kernels may not be. Sources
+ * building the vector kernels (posix targets) are compiled with -ffp-contract=off, the
+ * Cortex-M fallback keeps the default contraction.
+ */
+
+#pragma once
+
+#include "LowPassFilter2p.hpp"
+#include "NotchFilter.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MULTI_AXIS_FILTER_BANK_VECTORIZED
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define MULTI_AXIS_FILTER_BANK_VECTORIZED
+#endif
+
+namespace math
+{
+
+#if defined(MULTI_AXIS_FILTER_BANK_VECTORIZED)
+namespace filter_bank
+{
+
+static constexpr int LANES = 4;
+
+#if defined(__ARM_NEON)
+
+using Vec = float32x4_t;
+using Mask = uint32x4_t;
+
+inline Vec load(const float *p) { return vld1q_f32(p); }
+inline Vec set(float x, float y, float z) { return Vec{x, y, z, 0.f}; }
+inline void store(float *p, Vec v) { vst1q_f32(p, v); }
+inline Vec add(Vec a, Vec b) { return vaddq_f32(a, b); }
+inline Vec sub(Vec a, Vec b) { return vsubq_f32(a, b); }
+inline Vec mul(Vec a, Vec b) { return vmulq_f32(a, b); }
+inline Mask mask(bool x, bool y, bool z) { return Mask{x ? UINT32_MAX : 0, y ? UINT32_MAX : 0, z ? UINT32_MAX : 0, 0}; }
+inline Vec select(Mask m, Vec a, Vec b) { return vbslq_f32(m, a, b); }
+
+#elif defined(__SSE2__)
+
+using Vec = __m128;
+using Mask = __m128;
+
+inline Vec load(const float *p) { return _mm_load_ps(p); }
+inline Vec set(float x, float y, float z) { return _mm_set_ps(0.f, z, y, x); }
+inline void store(float *p, Vec v) { _mm_store_ps(p, v); }
+inline Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+inline Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+inline Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+inline Mask mask(bool x, bool y, bool z) { return _mm_castsi128_ps(_mm_set_epi32(0, -(int)z, -(int)y, -(int)x)); }
+inline Vec select(Mask m, Vec a, Vec b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+#endif
+
+} // namespace filter_bank
+#endif // MULTI_AXIS_FILTER_BANK_VECTORIZED
+
+template<int MAX_SAMPLES>
+class MultiAxisFilterBank
+{
+public:
+	MultiAxisFilterBank() = default;
+	~MultiAxisFilterBank() = default;
+
+	/**
+	 * Start a new batch of samples
+	 * @return false if num_samples is out of range
+	 */
+	bool setSampleCount(int num_samples)
+	{
+#if defined(MULTI_AXIS_FILTER_BANK_VECTORIZED)
+		_pending.type = Section::Type::None;
+#endif
+
+		if ((num_samples <= 0) || (num_samples > MAX_SAMPLES)) {
+			_num_samples = 0;
+			return false;
+		}
+
+		_num_samples = num_samples;
+		return true;
+	}
+
+	int sampleCount() const { return _num_samples; }
+
+#if defined(MULTI_AXIS_FILTER_BANK_VECTORIZED)
+	void setSample(int n, float x, float y, float z)
+	{
+		_data[n][0] = x;
+		_data[n][1] = y;
+		_data[n][2] = z;
+		_data[n][3] = 0.f;
+	}
+
+	float sample(int n, int axis) const { return _data[n][axis]; }
+#else
+	void setSample(int n, float x, float y, float z)
+	{
+		_data[0][n] = x;
+		_data[1][n] = y;
+		_data[2][n] = z;
+	}
+
+	float sample(int n, int axis) const { return _data[axis][n]; }
+#endif
+
+	// last sample of the batch
+	float last(int axis) const { return sample(_num_samples - 1, axis); }
+
+	/**
+	 * Add a notch filter section (direct form I), one filter per axis.
+	 * Axes with a disabled filter (notch frequency 0) are passed through, like
+	 * the callers of NotchFilter::applyArray() skip them.
+	 */
+	void add(NotchFilter<float> &x, NotchFilter<float> &y, NotchFilter<float> &z)
+	{
+#if defined(MULTI_AXIS_FILTER_BANK_VECTORIZED)
+
+		if ((x.getNotchFreq() > 0.f) || (y.getNotchFreq() > 0.f) || (z.getNotchFreq() > 0.f)) {
+			Section section;
+			section.type = Section::Type::Notch;
+			section.notch[0] = &x;
+			section.notch[1] = &y;
+			section.notch[2] = &z;
+			add(section);
+		}
+
+#else
+		NotchFilter<float> *filters[3] {&x, &y, &z};
+
+		for (int axis = 0; axis < 3; axis++) {
+			if ((_num_samples > 0) && (filters[axis]->getNotchFreq() > 0.f)) {
+				filters[axis]->applyArray(_data[axis], _num_samples);
+			}
+		}
+
+#endif
+	}
+
+	void add(NotchFilter<float> (&filters)[3]) { add(filters[0], filters[1], filters[2]); }
+
+	/**
+	 * Add a low-pass filter section (direct form II), one filter per axis
+	 */
+	void add(LowPassFilter2p<float> &x, LowPassFilter2p<float> &y, LowPassFilter2p<float> &z)
+	{
+#if defined(MULTI_AXIS_FILTER_BANK_VECTORIZED)
+		Section section;
+		section.type = Section::Type::LowPass;
+		section.low_pass[0] = &x;
+		section.low_pass[1] = &y;
+		section.low_pass[2] = &z;
+		add(section);
+#else
+
+		if (_num_samples > 0) {
+			x.applyArray(_data[0], _num_samples);
+			y.applyArray(_data[1], _num_samples);
+			z.applyArray(_data[2], _num_samples);
+		}
+
+#endif
+	}
+
+	void add(LowPassFilter2p<float> (&filters)[3]) { add(filters[0], filters[1], filters[2]); }
+
+	/**
+	 * The sections are run two at a time as they are added, this filters
+	 * the remaining one. Must be called before reading the filtered samples.
+	 */
+	void run()
+	{
+#if defined(MULTI_AXIS_FILTER_BANK_VECTORIZED)
+		if (_pending.type == Section::Type::Notch) {
+			NotchKernel kernel;
+			kernel.load(_pending.notch, _data[0]);
+			runSingle(kernel);
+
+		} else if (_pending.type == Section::Type::LowPass) {
+			LowPassKernel kernel;
+			kernel.load(_pending.low_pass, _data[0]);
+			runSingle(kernel);
+		}
+
+		_pending.type = Section::Type::None;
+#endif
+	}
+
+private:
+#if defined(MULTI_AXIS_FILTER_BANK_VECTORIZED)
+	static constexpr int LANES = filter_bank::LANES;
+
+	struct Section {
+		enum class Type : uint8_t {
+			None,
+			Notch,
+			LowPass,
+		} type{Type::None};
+
+		union {
+			NotchFilter<float> *notch[3];
+			LowPassFilter2p<float> *low_pass[3];
+		};
+	};
+
+	struct NotchKernel {
+		filter_bank::Vec b0, b1, b2, a1, a2;
+		filter_bank::Vec x1, x2, y1, y2;
+		filter_bank::Mask active;
+		NotchFilter<float> *const *filters;
+
+		// gather the coefficients and state, uninitialized filters are reset with the first input sample
+		void load(NotchFilter<float> *const notch[3], const float input[LANES])
+		{
+			NotchFilter<float> &x = *notch[0];
+			NotchFilter<float> &y = *notch[1];
+			NotchFilter<float> &z = *notch[2];
+
+			const bool x_enabled = x.getNotchFreq() > 0.f;
+			const bool y_enabled = y.getNotchFreq() > 0.f;
+			const bool z_enabled = z.getNotchFreq() > 0.f;
+
+			if (x_enabled && !x.initialized()) { x.reset(input[0]); }
+
+			if (y_enabled && !y.initialized()) { y.reset(input[1]); }
+
+			if (z_enabled && !z.initialized()) { z.reset(input[2]); }
+
+			// disabled filters are computed as well (with their pass through coefficients) and masked
+			b0 = filter_bank::set(x._b0, y._b0, z._b0);
+			b1 = filter_bank::set(x._b1, y._b1, z._b1);
+			b2 = filter_bank::set(x._b2, y._b2, z._b2);
+			a1 = filter_bank::set(x._a1, y._a1, z._a1);
+			a2 = filter_bank::set(x._a2, y._a2, z._a2);
+			x1 = filter_bank::set(x._delay_element_1, y._delay_element_1, z._delay_element_1);
+			x2 = filter_bank::set(x._delay_element_2, y._delay_element_2, z._delay_element_2);
+			y1 = filter_bank::set(x._delay_element_output_1, y._delay_element_output_1, z._delay_element_output_1);
+			y2 = filter_bank::set(x._delay_element_output_2, y._delay_element_output_2, z._delay_element_output_2);
+			active = filter_bank::mask(x_enabled, y_enabled, z_enabled);
+			filters = notch;
+		}
+
+		inline filter_bank::Vec step(const filter_bank::Vec &input)
+		{
+			using filter_bank::add;
+			using filter_bank::mul;
+			using filter_bank::sub;
+
+			// same operation order as NotchFilter::applyInternal()
+			const filter_bank::Vec output = sub(sub(add(add(mul(b0, input), mul(b1, x1)), mul(b2, x2)), mul(a1, y1)), mul(a2, y2));
+
+			x2 = x1;
+			x1 = input;
+			y2 = y1;
+			y1 = output;
+
+			return filter_bank::select(active, output, input);
+		}
+
+		void store()
+		{
+			alignas(16) float s[4][LANES];
+			filter_bank::store(s[0], x1);
+			filter_bank::store(s[1], x2);
+			filter_bank::store(s[2], y1);
+			filter_bank::store(s[3], y2);
+
+			// a disabled filter is reset before it's used again, its state can be overwritten
+			for (int axis = 0; axis < 3; axis++) {
+				NotchFilter<float> &nf = *filters[axis];
+				nf._delay_element_1 = s[0][axis];
+				nf._delay_element_2 = s[1][axis];
+				nf._delay_element_output_1 = s[2][axis];
+				nf._delay_element_output_2 = s[3][axis];
+			}
+		}
+	};
+
+	struct LowPassKernel {
+		filter_bank::Vec b0, b1, b2, a1, a2;
+		filter_bank::Vec d1, d2;
+		LowPassFilter2p<float> *const *filters;
+
+		void load(LowPassFilter2p<float> *const low_pass[3], const float[LANES])
+		{
+			const LowPassFilter2p<float> &x = *low_pass[0];
+			const LowPassFilter2p<float> &y = *low_pass[1];
+			const LowPassFilter2p<float> &z = *low_pass[2];
+
+			b0 = filter_bank::set(x._b0, y._b0, z._b0);
+			b1 = filter_bank::set(x._b1, y._b1, z._b1);
+			b2 = filter_bank::set(x._b2, y._b2, z._b2);
+			a1 = filter_bank::set(x._a1, y._a1, z._a1);
+			a2 = filter_bank::set(x._a2, y._a2, z._a2);
+			d1 = filter_bank::set(x._delay_element_1, y._delay_element_1, z._delay_element_1);
+			d2 = filter_bank::set(x._delay_element_2, y._delay_element_2, z._delay_element_2);
+			filters = low_pass;
+		}
+
+		inline filter_bank::Vec step(const filter_bank::Vec &input)
+		{
+			using filter_bank::add;
+			using filter_bank::mul;
+			using filter_bank::sub;
+
+			// same operation order as LowPassFilter2p::apply()
+			const filter_bank::Vec d0 = sub(sub(input, mul(d1, a1)), mul(d2, a2));
+			const filter_bank::Vec output = add(add(mul(d0, b0), mul(d1, b1)), mul(d2, b2));
+
+			d2 = d1;
+			d1 = d0;
+
+			return output;
+		}
+
+		void store()
+		{
+			alignas(16) float s[2][LANES];
+			filter_bank::store(s[0], d1);
+			filter_bank::store(s[1], d2);
+
+			for (int axis = 0; axis < 3; axis++) {
+				filters[axis]->_delay_element_1 = s[0][axis];
+				filters[axis]->_delay_element_2 = s[1][axis];
+			}
+		}
+	};
+
+	void add(const Section &section)
+	{
+		if (_num_samples <= 0) {
+			return;
+		}
+
+		if (_pending.type == Section::Type::None) {
+			_pending = section;
+			return;
+		}
+
+		// run the pending and the new section together
+		if (_pending.type == Section::Type::Notch) {
+			NotchKernel first;
+			first.load(_pending.notch, _data[0]);
+			startPair(first, section);
+
+		} else {
+			LowPassKernel first;
+			first.load(_pending.low_pass, _data[0]);
+			startPair(first, section);
+		}
+
+		_pending.type = Section::Type::None;
+	}
+
+	// the kernels are passed by value to keep the filter states in registers
+	template<typename First>
+	void startPair(First first, const Section &section)
+	{
+		// the second section starts one sample later, its input is the output of the first
+		filter_bank::store(_data[0], first.step(filter_bank::load(_data[0])));
+
+		if (section.type == Section::Type::Notch) {
+			NotchKernel second;
+			second.load(section.notch, _data[0]);
+			runPair(first, second);
+
+		} else {
+			LowPassKernel second;
+			second.load(section.low_pass, _data[0]);
+			runPair(first, second);
+		}
+	}
+
+	/**
+	 * Interleave two consecutive sections (the first one has already processed sample 0),
+	 * the recursions of the two sections are independent which hides the latency of each
+	 */
+	template<typename First, typename Second>
+	void runPair(First first, Second second)
+	{
+		using namespace filter_bank;
+
+		const int num_samples = _num_samples;
+
+		for (int n = 1; n < num_samples; n++) {
+			store(_data[n], first.step(load(_data[n])));
+			store(_data[n - 1], second.step(load(_data[n - 1])));
+		}
+
+		store(_data[num_samples - 1], second.step(load(_data[num_samples - 1])));
+
+		first.store();
+		second.store();
+	}
+
+	template<typename Kernel>
+	void runSingle(Kernel kernel)
+	{
+		const int num_samples = _num_samples;
+
+		for (int n = 0; n < num_samples; n++) {
+			filter_bank::store(_data[n], kernel.step(filter_bank::load(_data[n])));
+		}
+
+		kernel.store();
+	}
+
+	alignas(16) float _data[MAX_SAMPLES][LANES] {};
+
+	Section _pending{};
+#else
+	float _data[3][MAX_SAMPLES] {};
+#endif
+
+	int _num_samples{0};
+};
+
+} // namespace math
@@ -82,9 +82,30 @@ public:
 			_initialized = true;
 		}
 
+		// work on a local copy of the state, the samples could alias the filter (e.g. both class members)
+		const float b0 = _b0, b1 = _b1, b2 = _b2, a1 = _a1, a2 = _a2;
+		T x1 = _delay_element_1;
+		T x2 = _delay_element_2;
+		T y1 = _delay_element_output_1;
+		T y2 = _delay_element_output_2;
+
 		for (int n = 0; n < num_samples; n++) {
-			samples[n] = applyInternal(samples[n]);
+			// same as applyInternal()
+			const T sample = samples[n];
+			const T output = b0 * sample + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+
+			x2 = x1;
+			x1 = sample;
+			y2 = y1;
+			y1 = output;
+
+			samples[n] = output;
 		}
+
+		_delay_element_1 = x1;
+		_delay_element_2 = x2;
+		_delay_element_output_1 = y1;
+		_delay_element_output_2 = y2;
 	}
 
 	float getNotchFreq() const { return _notch_freq; }
@@ -163,6 +184,9 @@ public:
 		_initialized = false;
 	}
 
+	// filters the 3 axes with one instance per axis in parallel, directly using the coefficients and state
+	template<int> friend class MultiAxisFilterBank;
+
 protected:
 
 	/**
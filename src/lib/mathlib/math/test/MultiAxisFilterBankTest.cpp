@@ -0,0 +1,286 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the multi axis filter bank
+ * Run this test only using make tests TESTFILTER=MultiAxisFilterBank
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <string.h>
+
+#include <lib/mathlib/math/filter/MultiAxisFilterBank.hpp>
+
+using namespace math;
+
+static constexpr int MAX_SAMPLES = 32;
+static constexpr int NUM_ESCS = 8;
+static constexpr int NUM_HARMONICS = 3;
+static constexpr int NUM_FFT_PEAKS = 3;
+
+// the filter chain of VehicleAngularVelocity, per axis
+struct GyroFilters {
+	NotchFilter<float> esc_rpm[NUM_HARMONICS][3][NUM_ESCS];
+	NotchFilter<float> fft[3][NUM_FFT_PEAKS];
+	NotchFilter<float> notch0[3];
+	NotchFilter<float> notch1[3];
+	LowPassFilter2p<float> lp[3];
+
+	void configure(float sample_freq, float rpm_offset)
+	{
+		for (int harmonic = 0; harmonic < NUM_HARMONICS; harmonic++) {
+			for (int axis = 0; axis < 3; axis++) {
+				for (int esc = 0; esc < NUM_ESCS; esc++) {
+					const float esc_hz = 80.f + 5.f * esc + rpm_offset;
+					esc_rpm[harmonic][axis][esc].setParameters(sample_freq, esc_hz * (harmonic + 1), 15.f);
+				}
+			}
+		}
+
+		for (int axis = 0; axis < 3; axis++) {
+			for (int peak = 0; peak < NUM_FFT_PEAKS; peak++) {
+				fft[axis][peak].setParameters(sample_freq, 150.f + 40.f * peak + 10.f * axis, 20.f);
+			}
+
+			notch0[axis].setParameters(sample_freq, 60.f, 10.f);
+			lp[axis].set_cutoff_frequency(sample_freq, 40.f);
+		}
+
+		// notch 1 only on the x axis, the other axes pass through
+		notch1[0].setParameters(sample_freq, 240.f, 20.f);
+	}
+
+	// reference: each axis filtered separately, like VehicleAngularVelocity::FilterAngularVelocity()
+	void applyPerAxis(int axis, float data[], int N)
+	{
+		for (int esc = 0; esc < NUM_ESCS; esc++) {
+			for (int harmonic = 0; harmonic < NUM_HARMONICS; harmonic++) {
+				if (esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
+					esc_rpm[harmonic][axis][esc].applyArray(data, N);
+				}
+			}
+		}
+
+		for (int peak = NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
+			if (fft[axis][peak].getNotchFreq() > 0.f) {
+				fft[axis][peak].applyArray(data, N);
+			}
+		}
+
+		if (notch0[axis].getNotchFreq() > 0.f) {
+			notch0[axis].applyArray(data, N);
+		}
+
+		if (notch1[axis].getNotchFreq() > 0.f) {
+			notch1[axis].applyArray(data, N);
+		}
+
+		lp[axis].applyArray(data, N);
+	}
+
+	void applyBank(MultiAxisFilterBank<MAX_SAMPLES> &bank)
+	{
+		for (int esc = 0; esc < NUM_ESCS; esc++) {
+			for (int harmonic = 0; harmonic < NUM_HARMONICS; harmonic++) {
+				bank.add(esc_rpm[harmonic][0][esc], esc_rpm[harmonic][1][esc], esc_rpm[harmonic][2][esc]);
+			}
+		}
+
+		for (int peak = NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
+			bank.add(fft[0][peak], fft[1][peak], fft[2][peak]);
+		}
+
+		bank.add(notch0);
+		bank.add(notch1);
+		bank.add(lp);
+		bank.run();
+	}
+};
+
+class MultiAxisFilterBankTest : public ::testing::Test
+{
+public:
+	// fill a batch with noisy gyro data and filter it both ways
+	void runBatch(int N)
+	{
+		float data[3][MAX_SAMPLES];
+
+		ASSERT_TRUE(_bank.setSampleCount(N));
+
+		for (int n = 0; n < N; n++) {
+			for (int axis = 0; axis < 3; axis++) {
+				data[axis][n] = _noise(_generator);
+			}
+
+			_bank.setSample(n, data[0][n], data[1][n], data[2][n]);
+		}
+
+		for (int axis = 0; axis < 3; axis++) {
+			_reference.applyPerAxis(axis, data[axis], N);
+		}
+
+		_filters.applyBank(_bank);
+
+		for (int n = 0; n < N; n++) {
+			for (int axis = 0; axis < 3; axis++) {
+				const float bank_sample = _bank.sample(n, axis);
+				// bit exact
+				ASSERT_EQ(memcmp(&bank_sample, &data[axis][n], sizeof(float)), 0)
+						<< "axis " << axis << " sample " << n << ": " << bank_sample << " != " << data[axis][n];
+			}
+		}
+	}
+
+	const float _sample_freq{8000.f};
+
+	GyroFilters _reference{};
+	GyroFilters _filters{};
+	MultiAxisFilterBank<MAX_SAMPLES> _bank{};
+
+	std::mt19937 _generator{1};
+	std::normal_distribution<float> _noise{0.f, 0.5f};
+};
+
+TEST_F(MultiAxisFilterBankTest, sampleCount)
+{
+	EXPECT_FALSE(_bank.setSampleCount(0));
+	EXPECT_FALSE(_bank.setSampleCount(MAX_SAMPLES + 1));
+	EXPECT_TRUE(_bank.setSampleCount(MAX_SAMPLES));
+	EXPECT_EQ(_bank.sampleCount(), MAX_SAMPLES);
+}
+
+TEST_F(MultiAxisFilterBankTest, bitExactCascade)
+{
+	_reference.configure(_sample_freq, 0.f);
+	_filters.configure(_sample_freq, 0.f);
+
+	for (int i = 0; i < 500; i++) {
+		runBatch(1 + i % MAX_SAMPLES);
+	}
+}
+
+TEST_F(MultiAxisFilterBankTest, bitExactReconfiguration)
+{
+	_reference.configure(_sample_freq, 0.f);
+	_filters.configure(_sample_freq, 0.f);
+
+	for (int i = 0; i < 400; i++) {
+		runBatch(8);
+
+		// RPM changes (small steps keep the state, large steps reinitialize the filters)
+		const float rpm_offset = (i % 50 == 49) ? 100.f : 0.2f * (i % 50);
+		_reference.configure(_sample_freq, rpm_offset);
+		_filters.configure(_sample_freq, rpm_offset);
+
+		// ESC 3 stops on y and z, notch 0 disabled on z
+		if (i == 100) {
+			for (int harmonic = 0; harmonic < NUM_HARMONICS; harmonic++) {
+				for (int axis = 1; axis < 3; axis++) {
+					_reference.esc_rpm[harmonic][axis][3].disable();
+					_filters.esc_rpm[harmonic][axis][3].disable();
+				}
+			}
+		}
+
+		if (i >= 100) {
+			_reference.notch0[2].disable();
+			_filters.notch0[2].disable();
+		}
+	}
+}
+
+TEST_F(MultiAxisFilterBankTest, benchmark)
+{
+	// rate control loop filtering with 8 ESCs x 3 harmonics, the FFT peaks, 2 static notches and the low-pass
+	_reference.configure(_sample_freq, 0.f);
+	_filters.configure(_sample_freq, 0.f);
+
+	static constexpr int N = 8; // 8 kHz gyro, 1 kHz FIFO batches
+	static constexpr int BATCHES = 1000;
+	static constexpr int ROUNDS = 20;
+
+	static float input[BATCHES][3][N];
+
+	for (int i = 0; i < BATCHES; i++) {
+		for (int axis = 0; axis < 3; axis++) {
+			for (int n = 0; n < N; n++) {
+				input[i][axis][n] = _noise(_generator);
+			}
+		}
+	}
+
+	float sum = 0.f;
+	double per_axis_us = INFINITY;
+	double bank_us = INFINITY;
+
+	// best of several rounds to reject scheduling noise
+	for (int round = 0; round < ROUNDS; round++) {
+		const auto per_axis_start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < BATCHES; i++) {
+			for (int axis = 0; axis < 3; axis++) {
+				float data[N];
+				memcpy(data, input[i][axis], sizeof(data));
+				_reference.applyPerAxis(axis, data, N);
+				sum += data[N - 1];
+			}
+		}
+
+		const auto bank_start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < BATCHES; i++) {
+			_bank.setSampleCount(N);
+
+			for (int n = 0; n < N; n++) {
+				_bank.setSample(n, input[i][0][n], input[i][1][n], input[i][2][n]);
+			}
+
+			_filters.applyBank(_bank);
+			sum += _bank.last(0) + _bank.last(1) + _bank.last(2);
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		per_axis_us = fmin(per_axis_us, std::chrono::duration<double, std::micro>(bank_start - per_axis_start).count() / BATCHES);
+		bank_us = fmin(bank_us, std::chrono::duration<double, std::micro>(end - bank_start).count() / BATCHES);
+	}
+
+	printf("gyro filter batch (%d samples, %d notches): per axis %.2f us, filter bank %.2f us\n",
+	       N, NUM_ESCS * NUM_HARMONICS + NUM_FFT_PEAKS + 2, per_axis_us, bank_us);
+
+	EXPECT_TRUE(PX4_ISFINITE(sum));
+}
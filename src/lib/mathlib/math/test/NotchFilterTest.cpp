@@ -347,3 +347,34 @@ TEST_F(NotchFilterTest, setCoefficients)
 		EXPECT_EQ(b[i], b_new[i]);
 	}
 }
+
+TEST_F(NotchFilterTest, applyArrayMatchesApply)
+{
+	NotchFilter<float> notch_array;
+	_notch_float.setParameters(_sample_freq, _notch_freq, _bandwidth);
+	notch_array.setParameters(_sample_freq, _notch_freq, _bandwidth);
+
+	float t = 0.f;
+	const float dt = 1.f / _sample_freq;
+
+	for (int batch = 0; batch < 20; batch++) {
+		float samples[8];
+
+		for (int n = 0; n < 8; n++) {
+			samples[n] = sinf(2.f * M_PI_F * 40.f * t) + 0.5f * sinf(2.f * M_PI_F * _notch_freq * t);
+			t += dt;
+		}
+
+		float expected[8];
+
+		for (int n = 0; n < 8; n++) {
+			expected[n] = _notch_float.apply(samples[n]);
+		}
+
+		notch_array.applyArray(samples, 8);
+
+		for (int n = 0; n < 8; n++) {
+			EXPECT_EQ(samples[n], expected[n]);
+		}
+	}
+}
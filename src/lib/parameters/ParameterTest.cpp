@@ -34,9 +34,11 @@
 #include <px4_platform_common/module_params.h>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/obstacle_distance.h>
+#include <uORB/topics/parameter_update.h>
 #include <uORB/uORBManager.hpp>
 
 #include <gtest/gtest.h>
+#include <math.h>
 
 class ParameterTest : public ::testing::Test
 {
@@ -106,3 +108,138 @@ TEST_F(ParameterTest, testUorbSendReceive)
 	// AND: all the bytes should be equal
 	EXPECT_EQ(0, memcmp(&message, &obstacle_distance, sizeof(message)));
 }
+
+
+TEST_F(ParameterTest, testChangeGeneration)
+{
+	// GIVEN: the current generation
+	const param_t dist = param_handle(px4::params::CP_DIST);
+	const param_t delay = param_handle(px4::params::CP_DELAY);
+	const uint32_t generation = param_generation();
+	EXPECT_FALSE(param_changed_since(dist, generation));
+
+	// WHEN: we set a parameter
+	float value = 5.f;
+	EXPECT_EQ(0, param_set_no_notification(dist, &value));
+
+	// THEN: only this one is changed
+	EXPECT_TRUE(param_changed_since(dist, generation));
+	EXPECT_FALSE(param_changed_since(delay, generation));
+
+	// WHEN: we set the same value again
+	const uint32_t generation2 = param_generation();
+	EXPECT_EQ(0, param_set_no_notification(dist, &value));
+
+	// THEN: it's not changed
+	EXPECT_EQ(generation2, param_generation());
+	EXPECT_FALSE(param_changed_since(dist, generation2));
+}
+
+
+TEST_F(ParameterTest, testChangeBelowNotificationThreshold)
+{
+	// GIVEN: a parameter update subscription
+	uORB::Subscription parameter_update_sub{ORB_ID(parameter_update)};
+	parameter_update_s parameter_update;
+	const param_t delay = param_handle(px4::params::CP_DELAY);
+	float value = 0.1f;
+	param_set(delay, &value);
+	parameter_update_sub.update(&parameter_update);
+	const uint32_t generation = param_generation();
+
+	// WHEN: the value changes by less than FLT_EPSILON
+	value = nextafterf(value, 1.f);
+	EXPECT_EQ(0, param_set(delay, &value));
+
+	// THEN: the change is visible to the modules but no update is sent
+	EXPECT_TRUE(param_changed_since(delay, generation));
+	EXPECT_FALSE(parameter_update_sub.updated());
+
+	float stored = 0.f;
+	param_get(delay, &stored);
+	EXPECT_EQ(value, stored);
+}
+
+
+TEST_F(ParameterTest, testSetBatch)
+{
+	// GIVEN: a parameter update subscription
+	uORB::Subscription parameter_update_sub{ORB_ID(parameter_update)};
+	parameter_update_s parameter_update;
+	parameter_update_sub.update(&parameter_update);
+
+	// WHEN: we set two parameters in a batch
+	const float dist = 3.f;
+	const float delay = 0.1f;
+	const param_batch_entry_t entries[] {
+		{param_handle(px4::params::CP_DIST), &dist},
+		{param_handle(px4::params::CP_DELAY), &delay},
+	};
+	EXPECT_EQ(0, param_set_batch(entries, 2));
+
+	// THEN: both are set and a single notification is sent
+	float value = 0.f;
+	param_get(param_handle(px4::params::CP_DIST), &value);
+	EXPECT_FLOAT_EQ(dist, value);
+	param_get(param_handle(px4::params::CP_DELAY), &value);
+	EXPECT_FLOAT_EQ(delay, value);
+
+	EXPECT_TRUE(parameter_update_sub.update(&parameter_update));
+	EXPECT_FALSE(parameter_update_sub.updated());
+
+	// WHEN: the same values are set again
+	EXPECT_EQ(0, param_set_batch(entries, 2));
+
+	// THEN: nothing is sent
+	EXPECT_FALSE(parameter_update_sub.updated());
+}
+
+
+class ParameterTestModule : public ModuleParams
+{
+public:
+	ParameterTestModule() : ModuleParams(nullptr) {}
+
+	void update() { updateParams(); }
+
+	DEFINE_PARAMETERS(
+		(ParamFloat<px4::params::CP_DIST>) _param_cp_dist,
+		(ParamFloat<px4::params::CP_DELAY>) _param_cp_delay
+	)
+
+public:
+	float dist() const { return _param_cp_dist.get(); }
+	float delay() const { return _param_cp_delay.get(); }
+	void setDist(float value) { _param_cp_dist.set(value); }
+};
+
+
+TEST_F(ParameterTest, testModuleParamsUpdateChanged)
+{
+	// GIVEN: a module with parameters
+	ParameterTestModule module;
+	EXPECT_FLOAT_EQ(-1.f, module.dist());
+
+	// WHEN: a parameter is changed and the module updated
+	float value = 7.f;
+	param_set(param_handle(px4::params::CP_DIST), &value);
+	module.update();
+
+	// THEN: the module has the new value
+	EXPECT_FLOAT_EQ(7.f, module.dist());
+
+	// WHEN: the local value is modified
+	module.setDist(1.f);
+	EXPECT_FLOAT_EQ(1.f, module.dist());
+	module.update();
+
+	// THEN: it's replaced by the stored value on the next update
+	EXPECT_FLOAT_EQ(7.f, module.dist());
+
+	// WHEN: the parameter is reset
+	param_reset(param_handle(px4::params::CP_DIST));
+	module.update();
+
+	// THEN: the module has the default value
+	EXPECT_FLOAT_EQ(-1.f, module.dist());
+}
@@ -285,6 +285,48 @@ __EXPORT int		param_set_no_remote_update(param_t param, const void *val, bool no
  */
 __EXPORT void		param_notify_changes(void);
 
+/**
+ * Parameter value for param_set_batch().
+ */
+typedef struct param_batch_entry {
+	param_t		param;	///< A handle returned by param_find or passed by param_foreach.
+	const void	*val;	///< The value to set; assumed to point to a variable of the parameter type.
+} param_batch_entry_t;
+
+/**
+ * Set the values of several parameters, and notify the system once if any of them changed.
+ *
+ * @param entries	The parameters and values to set.
+ * @param count		Number of entries.
+ * @return		Zero if all values could be set, nonzero otherwise (the others are still set).
+ */
+__EXPORT int		param_set_batch(const param_batch_entry_t *entries, unsigned count);
+
+/**
+ * Get the current parameter generation, it is incremented on every change of a parameter value.
+ *
+ * @return		The generation, to be passed to param_changed_since().
+ */
+__EXPORT uint32_t	param_generation(void);
+
+/**
+ * Check if the value of a parameter changed after a generation returned by param_generation().
+ * A change is never missed, but a parameter can be reported as changed if the generation is old.
+ *
+ * @param param		A handle returned by param_find or passed by param_foreach.
+ * @param generation	The generation at the time the value was last read.
+ * @return		True if the value needs to be read again.
+ */
+__EXPORT bool		param_changed_since(param_t param, uint32_t generation);
+
+/**
+ * Mark a parameter as changed, without notification. Used when a local copy of the
+ * value was modified, so that it gets read again on the next update.
+ *
+ * @param param		A handle returned by param_find or passed by param_foreach.
+ */
+__EXPORT void		param_mark_changed(param_t param);
+
 /**
  * Reset a parameter to its default value.
  *
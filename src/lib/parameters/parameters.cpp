@@ -100,6 +100,10 @@ static ParamAutosave *autosave_instance {nullptr};
 static px4::AtomicBitset<param_info_count> params_active;  // params found
 static px4::AtomicBitset<param_info_count> params_unsaved;
 
+// generation of the latest change of each parameter value (lower 16 bits), see param_changed_since()
+static px4::atomic<uint32_t> param_generation_counter{1};
+static uint16_t params_changed_generation[param_info_count] {};
+
 static ConstLayer firmware_defaults;
 static DynamicSparseLayer runtime_defaults{&firmware_defaults};
 DynamicSparseLayer user_config{&runtime_defaults};
@@ -179,10 +183,78 @@ param_notify_changes()
 #endif
 }
 
+uint32_t
+param_generation()
+{
+	return param_generation_counter.load();
+}
+
+bool
+param_changed_since(param_t param, uint32_t generation)
+{
+	if (!handle_in_range(param)) {
+		return false;
+	}
+
+	const uint32_t current = param_generation_counter.load();
+	const uint32_t elapsed = current - generation;
+
+	if (elapsed >= UINT16_MAX / 2) {
+		// too old to be compared with the truncated generation
+		return true;
+	}
+
+	const uint16_t age = (uint16_t)current - params_changed_generation[param];
+	return age < elapsed;
+}
+
+void
+param_mark_changed(param_t param)
+{
+	if (handle_in_range(param)) {
+		// the value must be stored before the generation is incremented,
+		// so that a reader taking param_generation() before reading the value can't miss it
+		params_changed_generation[param] = (uint16_t)(param_generation_counter.fetch_add(1) + 1);
+	}
+}
+
+#if defined(CONFIG_PARAM_FIND_PERFECT_HASH)
+/**
+ * FNV-1a hash of a parameter name, modified by a seed. Needs to match px_generate_params.py
+ */
+static inline uint32_t param_name_hash(const char *name, uint32_t seed)
+{
+	uint32_t hash = 2166136261u ^ seed;
+
+	for (; *name != '\0'; name++) {
+		hash = (hash ^ (uint8_t)(*name)) * 16777619u;
+	}
+
+	return hash;
+}
+#endif // CONFIG_PARAM_FIND_PERFECT_HASH
+
 static param_t param_find_internal(const char *name, bool notification)
 {
 	perf_count(param_find_perf);
 
+#if defined(CONFIG_PARAM_FIND_PERFECT_HASH)
+	static_assert(sizeof(px4::parameters_hash_displacement) / sizeof(int16_t) == param_info_count, "hash table size mismatch");
+
+	/* the generated perfect hash gives the only candidate */
+	const int16_t displacement = px4::parameters_hash_displacement[param_name_hash(name, 0) % param_info_count];
+	const param_t param = (displacement < 0) ? (param_t)(-displacement - 1) :
+			      px4::parameters_hash_index[param_name_hash(name, displacement) % param_info_count];
+
+	if (handle_in_range(param) && strcmp(name, param_name(param)) == 0) {
+		if (notification) {
+			param_set_used(param);
+		}
+
+		return param;
+	}
+
+#else
 	param_t middle;
 	param_t front = 0;
 	param_t last = param_info_count;
@@ -212,6 +284,8 @@ static param_t param_find_internal(const char *name, bool notification)
 		}
 	}
 
+#endif // CONFIG_PARAM_FIND_PERFECT_HASH
+
 	/* not found */
 	return PARAM_INVALID;
 }
@@ -401,7 +475,8 @@ param_control_autosave(bool enable)
 }
 
 static int
-param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_changes, bool update_remote = true)
+param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_changes, bool update_remote = true,
+		   bool *notify_required = nullptr)
 {
 	if (!handle_in_range(param)) {
 		PX4_ERR("set invalid param %d", param);
@@ -441,6 +516,11 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 		params_unsaved.set(param, !mark_saved);
 		result = PX4_OK;
 
+		// any change of the stored value is visible to param_changed_since(), even below the notification threshold
+		if (user_config_value.i != new_value.i) {
+			param_mark_changed(param);
+		}
+
 	} else {
 		PX4_ERR("param_set failed to store param %s", param_name(param));
 		result = PX4_ERROR;
@@ -470,6 +550,10 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 
 	perf_end(param_set_perf);
 
+	if (notify_required) {
+		*notify_required = (result == PX4_OK) && param_changed;
+	}
+
 	/*
 	 * If we set something, now that we have unlocked, go ahead and advertise that
 	 * a thing has been set.
@@ -508,6 +592,28 @@ int param_set_no_remote_update(param_t param, const void *val, bool notify)
 	return param_set_internal(param, val, false, notify, false);
 }
 
+int param_set_batch(const param_batch_entry_t *entries, unsigned count)
+{
+	bool notify = false;
+	int result = PX4_OK;
+
+	for (unsigned i = 0; i < count; i++) {
+		bool changed = false;
+
+		if (param_set_internal(entries[i].param, entries[i].val, false, false, true, &changed) != PX4_OK) {
+			result = PX4_ERROR;
+		}
+
+		notify |= changed;
+	}
+
+	if (notify) {
+		param_notify_changes();
+	}
+
+	return result;
+}
+
 bool param_used(param_t param)
 {
 	if (handle_in_range(param)) {
@@ -600,6 +706,11 @@ int param_set_default_value(param_t param, const void *val)
 	}
 
 
+	if (result == PX4_OK) {
+		// the value changes if it isn't set in the user config
+		param_mark_changed(param);
+	}
+
 	if ((result == PX4_OK) && param_used(param)) {
 		// send notification if param is already in use
 		param_notify_changes();
@@ -619,6 +730,10 @@ static int param_reset_internal(param_t param, bool notify = true, bool autosave
 
 	if (handle_in_range(param)) {
 		user_config.reset(param);
+
+		if (param_found) {
+			param_mark_changed(param);
+		}
 	}
 
 	if (autosave) {
@@ -190,6 +190,30 @@ int	param_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case PARAMIOCSETBATCH: {
+			paramiocsetbatch_t *data = (paramiocsetbatch_t *)arg;
+			data->ret = param_set_batch(data->entries, data->count);
+		}
+		break;
+
+	case PARAMIOCGENERATION: {
+			paramiocgeneration_t *data = (paramiocgeneration_t *)arg;
+			data->ret = param_generation();
+		}
+		break;
+
+	case PARAMIOCCHANGEDSINCE: {
+			paramiocchangedsince_t *data = (paramiocchangedsince_t *)arg;
+			data->ret = param_changed_since(data->param, data->generation);
+		}
+		break;
+
+	case PARAMIOCMARKCHANGED: {
+			paramiocmarkchanged_t *data = (paramiocmarkchanged_t *)arg;
+			param_mark_changed(data->param);
+		}
+		break;
+
 	default:
 		ret = -ENOTTY;
 		break;
@@ -161,4 +161,28 @@ typedef struct paramiochash {
 	uint32_t ret;
 } paramiochash_t;
 
+#define PARAMIOCSETBATCH	_PARAMIOC(19)
+typedef struct paramiocsetbatch {
+	const param_batch_entry_t *entries;
+	const unsigned count;
+	int ret;
+} paramiocsetbatch_t;
+
+#define PARAMIOCGENERATION	_PARAMIOC(20)
+typedef struct paramiocgeneration {
+	uint32_t ret;
+} paramiocgeneration_t;
+
+#define PARAMIOCCHANGEDSINCE	_PARAMIOC(21)
+typedef struct paramiocchangedsince {
+	const param_t param;
+	const uint32_t generation;
+	bool ret;
+} paramiocchangedsince_t;
+
+#define PARAMIOCMARKCHANGED	_PARAMIOC(22)
+typedef struct paramiocmarkchanged {
+	const param_t param;
+} paramiocmarkchanged_t;
+
 int param_ioctl(unsigned int cmd, unsigned long arg);
@@ -19,6 +19,67 @@ except ImportError as e:
 
 import os
 
+def param_name_hash(name, seed):
+    """
+    FNV-1a hash of a parameter name, modified by a seed.
+    Needs to match param_name_hash() in parameters.cpp.
+    """
+    value = 2166136261 ^ seed
+    for c in name.encode('ascii'):
+        value = ((value ^ c) * 16777619) & 0xffffffff
+    return value
+
+
+def perfect_hash(names):
+    """
+    Minimal perfect hash (hash and displace) of the sorted parameter names.
+
+    The names are distributed into buckets with the seed 0. For a bucket with a single name,
+    the displacement is -(index + 1) of the name. For the other buckets, the displacement is
+    the seed that maps all its names to free slots, and the index table maps the slots to the
+    name indices.
+
+    @return displacement and index tables
+    """
+    size = len(names)
+
+    if size == 0:
+        return [0], [0]
+
+    buckets = [[] for _ in range(size)]
+    for index, name in enumerate(names):
+        buckets[param_name_hash(name, 0) % size].append(index)
+
+    displacement = [0] * size
+    slots = [None] * size
+
+    for bucket in sorted(buckets, key=len, reverse=True):
+        if len(bucket) <= 1:
+            break
+
+        # the displacement is stored as int16
+        seed = 1
+        while True:
+            if seed > 0x7fff:
+                raise RuntimeError('no perfect hash found')
+            bucket_slots = [param_name_hash(names[i], seed) % size for i in bucket]
+            if len(set(bucket_slots)) == len(bucket) and all(slots[slot] is None for slot in bucket_slots):
+                break
+            seed += 1
+
+        for index, slot in zip(bucket, bucket_slots):
+            slots[slot] = index
+
+        displacement[param_name_hash(names[bucket[0]], 0) % size] = seed
+
+    for bucket in buckets:
+        if len(bucket) == 1:
+            displacement[param_name_hash(names[bucket[0]], 0) % size] = -bucket[0] - 1
+
+    index_table = [index if index is not None else 0 for index in slots]
+    return displacement, index_table
+
+
 def generate(xml_file, dest='.'):
     """
     Generate px4 param source from xml.
@@ -39,6 +100,8 @@ def generate(xml_file, dest='.'):
 
     params = sorted(params, key=lambda name: name.attrib["name"])
 
+    hash_displacement, hash_index = perfect_hash([param.attrib["name"] for param in params])
+
     script_path = os.path.dirname(os.path.realpath(__file__))
 
     # for jinja docs see: http://jinja.pocoo.org/docs/2.9/api/
@@ -55,7 +118,8 @@ def generate(xml_file, dest='.'):
         template = env.get_template(template_file)
         with open(os.path.join(
                 dest, template_file.replace('.jinja','')), 'w') as fid:
-            fid.write(template.render(params=params))
+            fid.write(template.render(params=params, hash_displacement=hash_displacement,
+                                      hash_index=hash_index))
 
 if __name__ == "__main__":
     arg_parser = argparse.ArgumentParser()
@@ -132,6 +132,33 @@ int param_set_no_notification(param_t param, const void *val)
 	return data.ret;
 }
 
+int param_set_batch(const param_batch_entry_t *entries, unsigned count)
+{
+	paramiocsetbatch_t data = {entries, count, PX4_ERROR};
+	boardctl(PARAMIOCSETBATCH, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
+
+uint32_t param_generation()
+{
+	paramiocgeneration_t data = {0};
+	boardctl(PARAMIOCGENERATION, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
+
+bool param_changed_since(param_t param, uint32_t generation)
+{
+	paramiocchangedsince_t data = {param, generation, true};
+	boardctl(PARAMIOCCHANGEDSINCE, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
+
+void param_mark_changed(param_t param)
+{
+	paramiocmarkchanged_t data = {param};
+	boardctl(PARAMIOCMARKCHANGED, reinterpret_cast<unsigned long>(&data));
+}
+
 bool param_used(param_t param)
 {
 	paramiocused_t data = {param, false};
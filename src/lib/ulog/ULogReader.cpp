@@ -0,0 +1,407 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "ULogReader.hpp"
+
+#include <cstdlib>
+
+#include "messages.h"
+
+namespace ulog
+{
+
+unsigned ULogReader::typeSize(FieldType type)
+{
+	switch (type) {
+	case FieldType::Int8:
+	case FieldType::UInt8:
+	case FieldType::Bool:
+	case FieldType::Char:
+		return 1;
+
+	case FieldType::Int16:
+	case FieldType::UInt16:
+		return 2;
+
+	case FieldType::Int32:
+	case FieldType::UInt32:
+	case FieldType::Float:
+		return 4;
+
+	case FieldType::Int64:
+	case FieldType::UInt64:
+	case FieldType::Double:
+		return 8;
+
+	default:
+		return 0;
+	}
+}
+
+static ULogReader::FieldType parseType(const std::string &type)
+{
+	using FieldType = ULogReader::FieldType;
+
+	static const std::map<std::string, FieldType> types {
+		{"int8_t", FieldType::Int8},
+		{"uint8_t", FieldType::UInt8},
+		{"int16_t", FieldType::Int16},
+		{"uint16_t", FieldType::UInt16},
+		{"int32_t", FieldType::Int32},
+		{"uint32_t", FieldType::UInt32},
+		{"int64_t", FieldType::Int64},
+		{"uint64_t", FieldType::UInt64},
+		{"float", FieldType::Float},
+		{"double", FieldType::Double},
+		{"bool", FieldType::Bool},
+		{"char", FieldType::Char},
+	};
+
+	const auto it = types.find(type);
+	return (it != types.end()) ? it->second : FieldType::Nested;
+}
+
+bool ULogReader::open(const char *path)
+{
+	_file.open(path, std::ios::in | std::ios::binary);
+
+	if (!_file) {
+		return false;
+	}
+
+	ulog_file_header_s header;
+	_file.read((char *)&header, sizeof(header));
+
+	static constexpr uint8_t magic[] = {'U', 'L', 'o', 'g', 0x01, 0x12, 0x35};
+
+	if (!_file || (memcmp(magic, header.magic, sizeof(magic)) != 0)) {
+		return false;
+	}
+
+	_start_time = header.timestamp;
+
+	// the definitions section ends with the first subscription
+	uint8_t type;
+	uint16_t size;
+
+	while (readMessage(type, size)) {
+		switch (type) {
+		case (uint8_t)ULogMessageType::FLAG_BITS:
+			if (!readFlagBits(size)) {
+				return false;
+			}
+
+			break;
+
+		case (uint8_t)ULogMessageType::FORMAT:
+			readFormat(size);
+			break;
+
+		case (uint8_t)ULogMessageType::PARAMETER:
+			readParameter(size);
+			break;
+
+		case (uint8_t)ULogMessageType::ADD_LOGGED_MSG:
+		case (uint8_t)ULogMessageType::DATA:
+			_pending_message = true;
+			_pending_type = type;
+			_pending_size = size;
+			return true;
+
+		default:
+			// info, default parameters, logged strings
+			break;
+		}
+	}
+
+	// a log without data
+	return true;
+}
+
+bool ULogReader::readMessage(uint8_t &type, uint16_t &size)
+{
+	if ((uint64_t)_file.tellg() + ULOG_MSG_HEADER_LEN > _read_until_file_position) {
+		return false;
+	}
+
+	ulog_message_header_s header;
+	_file.read((char *)&header, ULOG_MSG_HEADER_LEN);
+
+	if (!_file || ((uint64_t)_file.tellg() + header.msg_size > _read_until_file_position)) {
+		return false;
+	}
+
+	_buffer.resize(header.msg_size + 1);
+	_file.read((char *)_buffer.data(), header.msg_size);
+
+	if (!_file) {
+		// truncated log
+		return false;
+	}
+
+	_buffer[header.msg_size] = 0;
+
+	type = header.msg_type;
+	size = header.msg_size;
+	return true;
+}
+
+bool ULogReader::readFlagBits(uint16_t size)
+{
+	if (size != 40) {
+		return false;
+	}
+
+	const uint8_t *incompat_flags = _buffer.data() + 8;
+
+	if (incompat_flags[0] & ~ULOG_INCOMPAT_FLAG0_DATA_APPENDED_MASK) {
+		return false;
+	}
+
+	for (int i = 1; i < 8; i++) {
+		if (incompat_flags[i]) {
+			return false;
+		}
+	}
+
+	if (incompat_flags[0] & ULOG_INCOMPAT_FLAG0_DATA_APPENDED_MASK) {
+		uint64_t appended_offset;
+		memcpy(&appended_offset, _buffer.data() + 16, sizeof(appended_offset));
+
+		// the appended data is only used for hardfault dumps
+		if (appended_offset > 0) {
+			_read_until_file_position = appended_offset;
+		}
+	}
+
+	return true;
+}
+
+void ULogReader::readFormat(uint16_t size)
+{
+	const std::string format((const char *)_buffer.data(), size);
+	const size_t pos = format.find(':');
+
+	if (pos != std::string::npos) {
+		_formats[format.substr(0, pos)].fields = format.substr(pos + 1);
+	}
+}
+
+void ULogReader::readParameter(uint16_t size)
+{
+	const uint8_t key_len = _buffer[0];
+
+	if (key_len + 1u > size) {
+		return;
+	}
+
+	// key: "<type> <name>"
+	const std::string key((const char *)_buffer.data() + 1, key_len);
+	const size_t pos = key.find(' ');
+
+	if (pos == std::string::npos) {
+		return;
+	}
+
+	const std::string type = key.substr(0, pos);
+	const uint8_t *value = _buffer.data() + 1 + key_len;
+	const unsigned value_size = size - 1 - key_len;
+
+	Parameter param{};
+
+	if ((type == "float") && (value_size == sizeof(float))) {
+		param.is_float = true;
+		param.value_float = read<float>(value);
+
+	} else if ((type == "int32_t") && (value_size == sizeof(int32_t))) {
+		param.value_int = read<int32_t>(value);
+
+	} else {
+		return;
+	}
+
+	_parameters[key.substr(pos + 1)] = param;
+}
+
+void ULogReader::readAddLogged(uint16_t size)
+{
+	if (size < 4) {
+		return;
+	}
+
+	const uint8_t multi_id = _buffer[0];
+	const uint16_t msg_id = read<uint16_t>(_buffer.data() + 1);
+	const std::string topic_name((const char *)_buffer.data() + 3);
+
+	// the id of a removed subscription can be reused
+	if (msg_id < _msg_id_to_subscription.size()) {
+		_msg_id_to_subscription[msg_id] = -1;
+	}
+
+	for (size_t i = 0; i < _subscriptions.size(); i++) {
+		if ((_subscriptions[i].multi_id == multi_id) && (_subscriptions[i].topic_name == topic_name)) {
+			if (msg_id >= _msg_id_to_subscription.size()) {
+				_msg_id_to_subscription.resize(msg_id + 1, -1);
+			}
+
+			_msg_id_to_subscription[msg_id] = i;
+			return;
+		}
+	}
+}
+
+bool ULogReader::parseFormat(Format &format, int depth)
+{
+	if (format.parsed) {
+		return true;
+	}
+
+	if (depth > 10) {
+		// recursive definition
+		return false;
+	}
+
+	unsigned offset = 0;
+	size_t start = 0;
+
+	while (start < format.fields.size()) {
+		size_t end = format.fields.find(';', start);
+
+		if (end == std::string::npos) {
+			end = format.fields.size();
+		}
+
+		// "<type>[<array length>] <name>"
+		const std::string definition = format.fields.substr(start, end - start);
+		start = end + 1;
+
+		const size_t space = definition.find(' ');
+
+		if (space == std::string::npos) {
+			continue;
+		}
+
+		std::string type = definition.substr(0, space);
+		const std::string name = definition.substr(space + 1);
+
+		Field field{};
+		field.offset = offset;
+
+		const size_t bracket = type.find('[');
+
+		if (bracket != std::string::npos) {
+			field.array_length = strtoul(type.c_str() + bracket + 1, nullptr, 10);
+			type.resize(bracket);
+		}
+
+		field.type = parseType(type);
+
+		unsigned element_size = typeSize(field.type);
+
+		if (field.type == FieldType::Nested) {
+			auto nested = _formats.find(type);
+
+			if ((nested == _formats.end()) || !parseFormat(nested->second, depth + 1)) {
+				return false;
+			}
+
+			element_size = nested->second.size;
+		}
+
+		offset += element_size * field.array_length;
+		format.lookup[name] = field;
+	}
+
+	format.size = offset;
+	format.parsed = true;
+	return true;
+}
+
+int ULogReader::subscribe(const char *topic_name, uint8_t multi_id)
+{
+	auto format = _formats.find(topic_name);
+
+	if ((format == _formats.end()) || !parseFormat(format->second)) {
+		return -1;
+	}
+
+	_subscriptions.push_back({topic_name, multi_id, &format->second});
+	return _subscriptions.size() - 1;
+}
+
+ULogReader::Field ULogReader::field(int subscription, const char *field_name) const
+{
+	if ((subscription < 0) || (subscription >= (int)_subscriptions.size())) {
+		return Field{};
+	}
+
+	const Format *format = _subscriptions[subscription].format;
+	const auto it = format->lookup.find(field_name);
+	return (it != format->lookup.end()) ? it->second : Field{};
+}
+
+bool ULogReader::next(Message &message)
+{
+	uint8_t type;
+	uint16_t size;
+
+	while (true) {
+		if (_pending_message) {
+			type = _pending_type;
+			size = _pending_size;
+			_pending_message = false;
+
+		} else if (!readMessage(type, size)) {
+			return false;
+		}
+
+		if (type == (uint8_t)ULogMessageType::ADD_LOGGED_MSG) {
+			readAddLogged(size);
+
+		} else if ((type == (uint8_t)ULogMessageType::DATA) && (size > sizeof(uint16_t))) {
+			const uint16_t msg_id = read<uint16_t>(_buffer.data());
+
+			if ((msg_id < _msg_id_to_subscription.size()) && (_msg_id_to_subscription[msg_id] >= 0)) {
+				message.subscription = _msg_id_to_subscription[msg_id];
+				message.data = _buffer.data() + sizeof(uint16_t);
+				message.size = size - sizeof(uint16_t);
+
+				// the timestamp is the first field of every topic
+				message.timestamp = (message.size >= sizeof(uint64_t)) ? read<uint64_t>(message.data) : 0;
+				return true;
+			}
+		}
+	}
+}
+
+} // namespace ulog
@@ -0,0 +1,249 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ULogReader.hpp
+ * Minimal streaming ULog reader for host side tools and tests.
+ *
+ * Unlike the replay module the topics are not mapped onto uORB structs: the fields are
+ * looked up by name in the formats stored in the log, so that logs written by older or
+ * newer firmware versions can be read as long as the used fields still exist.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ulog
+{
+
+class ULogReader
+{
+public:
+	enum class FieldType : uint8_t {
+		Invalid,
+		Int8,
+		UInt8,
+		Int16,
+		UInt16,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Float,
+		Double,
+		Bool,
+		Char,
+		Nested,
+	};
+
+	struct Field {
+		FieldType type{FieldType::Invalid};
+		uint16_t offset{0};
+		uint16_t array_length{1};
+
+		bool valid() const { return type != FieldType::Invalid && type != FieldType::Nested; }
+	};
+
+	struct Message {
+		int subscription{-1};
+		const uint8_t *data{nullptr};
+		uint16_t size{0};
+		uint64_t timestamp{0};
+	};
+
+	ULogReader() = default;
+	~ULogReader() = default;
+
+	/**
+	 * Open a log file and read the definitions section (formats and parameters)
+	 * @return false if the file is not a valid ULog file
+	 */
+	bool open(const char *path);
+
+	/**
+	 * Request the data of a topic instance, must be called after open() and before the first call to next()
+	 * @return subscription handle, or -1 if the topic is not defined in the log
+	 */
+	int subscribe(const char *topic_name, uint8_t multi_id = 0);
+
+	/**
+	 * Lookup a field of a subscribed topic by name, nested types are not supported
+	 */
+	Field field(int subscription, const char *field_name) const;
+
+	/**
+	 * Read the next data message of any subscribed topic, in file order
+	 * @return false at the end of the log
+	 */
+	bool next(Message &message);
+
+	/**
+	 * Get the value of a field (converted to T), or fallback if the field isn't available in the message
+	 */
+	template<typename T>
+	static T get(const Message &message, const Field &field, T fallback = T{}, unsigned index = 0)
+	{
+		const unsigned size = typeSize(field.type);
+		const unsigned offset = field.offset + index * size;
+
+		if (!field.valid() || (index >= field.array_length) || (offset + size > message.size)) {
+			return fallback;
+		}
+
+		const uint8_t *p = message.data + offset;
+
+		switch (field.type) {
+		case FieldType::Int8: return static_cast<T>(read<int8_t>(p));
+
+		case FieldType::UInt8: return static_cast<T>(read<uint8_t>(p));
+
+		case FieldType::Int16: return static_cast<T>(read<int16_t>(p));
+
+		case FieldType::UInt16: return static_cast<T>(read<uint16_t>(p));
+
+		case FieldType::Int32: return static_cast<T>(read<int32_t>(p));
+
+		case FieldType::UInt32: return static_cast<T>(read<uint32_t>(p));
+
+		case FieldType::Int64: return static_cast<T>(read<int64_t>(p));
+
+		case FieldType::UInt64: return static_cast<T>(read<uint64_t>(p));
+
+		case FieldType::Float: return fromFloat<T>(read<float>(p));
+
+		case FieldType::Double: return fromFloat<T>(read<double>(p));
+
+		case FieldType::Bool: return static_cast<T>(read<uint8_t>(p) != 0);
+
+		case FieldType::Char: return static_cast<T>(read<char>(p));
+
+		default: return fallback;
+		}
+	}
+
+	/**
+	 * Copy a field into a struct member, the member is left unchanged if the field isn't available in the message
+	 */
+	template<typename T>
+	static void copy(const Message &message, const Field &field, T &value)
+	{
+		value = get<T>(message, field, value);
+	}
+
+	template<typename T, size_t N>
+	static void copy(const Message &message, const Field &field, T(&value)[N])
+	{
+		for (unsigned i = 0; i < N; i++) {
+			value[i] = get<T>(message, field, value[i], i);
+		}
+	}
+
+	struct Parameter {
+		bool is_float{false};
+		float value_float{0.f};
+		int32_t value_int{0};
+	};
+
+	// parameters stored in the definitions section (initial values)
+	const std::map<std::string, Parameter> &parameters() const { return _parameters; }
+
+	uint64_t start_time() const { return _start_time; }
+
+	static unsigned typeSize(FieldType type);
+
+private:
+	struct Format {
+		std::string fields;                  ///< field definitions as stored in the log
+		std::map<std::string, Field> lookup; ///< parsed fields, filled on first use
+		unsigned size{0};
+		bool parsed{false};
+	};
+
+	struct Subscription {
+		std::string topic_name;
+		uint8_t multi_id{0};
+		Format *format{nullptr};
+	};
+
+	template<typename T, typename F>
+	static T fromFloat(F value)
+	{
+		if constexpr (std::is_same_v<T, bool>) {
+			return std::fpclassify(value) != FP_ZERO;
+
+		} else {
+			return static_cast<T>(value);
+		}
+	}
+
+	template<typename T>
+	static T read(const uint8_t *p)
+	{
+		T value;
+		memcpy(&value, p, sizeof(T));
+		return value;
+	}
+
+	bool readMessage(uint8_t &type, uint16_t &size);
+	bool readFlagBits(uint16_t size);
+	void readFormat(uint16_t size);
+	void readParameter(uint16_t size);
+	void readAddLogged(uint16_t size);
+
+	bool parseFormat(Format &format, int depth = 0);
+
+	std::ifstream _file;
+	std::vector<uint8_t> _buffer;
+
+	std::map<std::string, Format> _formats;
+	std::map<std::string, Parameter> _parameters;
+	std::vector<Subscription> _subscriptions;
+	std::vector<int> _msg_id_to_subscription;
+
+	uint64_t _start_time{0};
+	uint64_t _read_until_file_position{UINT64_MAX}; ///< appended data is ignored
+
+	bool _pending_message{false}; ///< first message of the data section was read by open()
+	uint8_t _pending_type{0};
+	uint16_t _pending_size{0};
+};
+
+} // namespace ulog
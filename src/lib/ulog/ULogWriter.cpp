@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "ULogWriter.hpp"
+
+#include <cstring>
+
+#include "messages.h"
+
+namespace ulog
+{
+
+static constexpr size_t kBufferSize = 64 * 1024;
+
+bool ULogWriter::open(const char *path, uint64_t start_time)
+{
+	close();
+
+	_file = fopen(path, "wb");
+
+	if (_file == nullptr) {
+		return false;
+	}
+
+	_buffer.reserve(kBufferSize);
+	_next_msg_id = 0;
+	_error = false;
+
+	ulog_file_header_s header{};
+	header.magic[0] = 'U';
+	header.magic[1] = 'L';
+	header.magic[2] = 'o';
+	header.magic[3] = 'g';
+	header.magic[4] = 0x01;
+	header.magic[5] = 0x12;
+	header.magic[6] = 0x35;
+	header.magic[7] = 0x01; // file version 1
+	header.timestamp = start_time;
+
+	const uint8_t *bytes = (const uint8_t *)&header;
+	_buffer.insert(_buffer.end(), bytes, bytes + sizeof(header));
+
+	// no compat or incompat flags and no appended data
+	uint8_t flag_bits[40] {};
+	writeMessage((uint8_t)ULogMessageType::FLAG_BITS, flag_bits, sizeof(flag_bits));
+
+	return true;
+}
+
+bool ULogWriter::close()
+{
+	if (_file == nullptr) {
+		return false;
+	}
+
+	flush();
+
+	const bool success = (fclose(_file) == 0) && !_error;
+	_file = nullptr;
+	return success;
+}
+
+void ULogWriter::addFormat(const char *format)
+{
+	writeMessage((uint8_t)ULogMessageType::FORMAT, format, strlen(format));
+}
+
+void ULogWriter::addInfo(const char *key, const char *value)
+{
+	char key_str[128];
+	const int key_len = snprintf(key_str, sizeof(key_str), "char[%zu] %s", strlen(value), key);
+
+	if ((key_len <= 0) || (key_len >= (int)sizeof(key_str))) {
+		return;
+	}
+
+	const uint8_t len = key_len;
+	uint8_t prefix[1 + sizeof(key_str)];
+	prefix[0] = len;
+	memcpy(prefix + 1, key_str, len);
+	writeMessage((uint8_t)ULogMessageType::INFO, prefix, 1 + len, value, strlen(value));
+}
+
+void ULogWriter::addParameter(const char *name, float value)
+{
+	char key[64];
+	const int key_len = snprintf(key, sizeof(key), "float %s", name);
+
+	if ((key_len > 0) && (key_len < (int)sizeof(key))) {
+		uint8_t prefix[1 + sizeof(key)];
+		prefix[0] = key_len;
+		memcpy(prefix + 1, key, key_len);
+		writeMessage((uint8_t)ULogMessageType::PARAMETER, prefix, 1 + key_len, &value, sizeof(value));
+	}
+}
+
+void ULogWriter::addParameter(const char *name, int32_t value)
+{
+	char key[64];
+	const int key_len = snprintf(key, sizeof(key), "int32_t %s", name);
+
+	if ((key_len > 0) && (key_len < (int)sizeof(key))) {
+		uint8_t prefix[1 + sizeof(key)];
+		prefix[0] = key_len;
+		memcpy(prefix + 1, key, key_len);
+		writeMessage((uint8_t)ULogMessageType::PARAMETER, prefix, 1 + key_len, &value, sizeof(value));
+	}
+}
+
+uint16_t ULogWriter::addLoggedMessage(const char *topic_name, uint8_t multi_id)
+{
+	const uint16_t msg_id = _next_msg_id++;
+
+	uint8_t prefix[3];
+	prefix[0] = multi_id;
+	memcpy(prefix + 1, &msg_id, sizeof(msg_id));
+	writeMessage((uint8_t)ULogMessageType::ADD_LOGGED_MSG, prefix, sizeof(prefix), topic_name, strlen(topic_name));
+
+	return msg_id;
+}
+
+void ULogWriter::writeData(uint16_t msg_id, const void *data, uint16_t size)
+{
+	writeMessage((uint8_t)ULogMessageType::DATA, &msg_id, sizeof(msg_id), data, size);
+}
+
+void ULogWriter::writeMessage(uint8_t type, const void *data, uint16_t size)
+{
+	writeMessage(type, nullptr, 0, data, size);
+}
+
+void ULogWriter::writeMessage(uint8_t type, const void *prefix, uint16_t prefix_size, const void *data, uint16_t size)
+{
+	if (_file == nullptr) {
+		return;
+	}
+
+	const size_t msg_size = prefix_size + size;
+
+	if (msg_size > UINT16_MAX) {
+		_error = true;
+		return;
+	}
+
+	if (_buffer.size() + ULOG_MSG_HEADER_LEN + msg_size > kBufferSize) {
+		flush();
+	}
+
+	ulog_message_header_s header;
+	header.msg_size = msg_size;
+	header.msg_type = type;
+
+	const uint8_t *header_bytes = (const uint8_t *)&header;
+	_buffer.insert(_buffer.end(), header_bytes, header_bytes + ULOG_MSG_HEADER_LEN);
+
+	if (prefix_size > 0) {
+		_buffer.insert(_buffer.end(), (const uint8_t *)prefix, (const uint8_t *)prefix + prefix_size);
+	}
+
+	if (size > 0) {
+		_buffer.insert(_buffer.end(), (const uint8_t *)data, (const uint8_t *)data + size);
+	}
+}
+
+void ULogWriter::flush()
+{
+	if ((_file != nullptr) && !_buffer.empty()) {
+		if (fwrite(_buffer.data(), 1, _buffer.size(), _file) != _buffer.size()) {
+			_error = true;
+		}
+
+		_buffer.clear();
+	}
+}
+
+} // namespace ulog
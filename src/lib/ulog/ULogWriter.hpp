@@ -0,0 +1,93 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ULogWriter.hpp
+ * Minimal ULog writer for host side tools and tests.
+ *
+ * The definitions (formats, info and parameters) must be added before the first subscription.
+ * Data is buffered and written in large blocks.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace ulog
+{
+
+class ULogWriter
+{
+public:
+	ULogWriter() = default;
+	~ULogWriter() { close(); }
+
+	// no copy, assignment, move, move assignment
+	ULogWriter(const ULogWriter &) = delete;
+	ULogWriter &operator=(const ULogWriter &) = delete;
+	ULogWriter(ULogWriter &&) = delete;
+	ULogWriter &operator=(ULogWriter &&) = delete;
+
+	bool open(const char *path, uint64_t start_time);
+	bool close();
+
+	bool is_open() const { return _file != nullptr; }
+
+	// "message_name:type0 field0;type1 field1;"
+	void addFormat(const char *format);
+
+	void addInfo(const char *key, const char *value);
+
+	void addParameter(const char *name, float value);
+	void addParameter(const char *name, int32_t value);
+
+	// @return the msg_id to use for writeData()
+	uint16_t addLoggedMessage(const char *topic_name, uint8_t multi_id = 0);
+
+	void writeData(uint16_t msg_id, const void *data, uint16_t size);
+
+private:
+	void writeMessage(uint8_t type, const void *data, uint16_t size);
+	void writeMessage(uint8_t type, const void *prefix, uint16_t prefix_size, const void *data, uint16_t size);
+	void flush();
+
+	FILE *_file{nullptr};
+	std::vector<uint8_t> _buffer;
+
+	uint16_t _next_msg_id{0};
+	bool _error{false};
+};
+
+} // namespace ulog
@@ -35,13 +35,11 @@
 
 #include <stdint.h>
 
+#include <lib/ellipsoid_fit/EllipsoidFit.hpp>
 #include <matrix/matrix/math.hpp>
 #include <px4_platform_common/defines.h>
 
-struct sphere_params {
-	matrix::Vector3f offset, diag{1.f, 1.f, 1.f}, offdiag;
-	float radius{0.2f};
-};
+using sphere_params = EllipsoidFit::Params;
 
 
 /**
@@ -53,7 +51,6 @@ struct sphere_params {
  * @param y point coordinates on the Y axis
  * @param z point coordinates on the Z axis
  * @param samples_collected number of points
- * @param max_iterations abort if maximum number of iterations have been reached. If unsure, set to 100.
  * @param params the values to be optimized
  * @param full_ellipsoid whether to just optimize a sphere, or do an ellipsoid optimization
  *
@@ -63,3 +60,17 @@ struct sphere_params {
  */
 int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int samples_collected, sphere_params &params,
 	       bool full_ellipsoid);
+
+/**
+ * Least-squares fit of a sphere to the points collected incrementally in an EllipsoidFit.
+ *
+ * The iterations and the residual only use the moments of the points, the cost and
+ * the memory don't depend on the number of points.
+ *
+ * @param fit the moments of the points
+ * @param params the values to be optimized
+ * @param full_ellipsoid whether to just optimize a sphere, or do an ellipsoid optimization
+ *
+ * @return 0 on success, 1 on failure
+ */
+int lm_mag_fit(EllipsoidFit &fit, sphere_params &params, bool full_ellipsoid);
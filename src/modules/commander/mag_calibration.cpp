@@ -77,6 +77,17 @@ static constexpr unsigned int calibraton_duration_s = 42; 	///< The total durati
 
 calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_mask);
 
+/// Fit and rotation detection statistics for a single mag, the samples themselves are not kept
+struct mag_sample_data_t {
+	EllipsoidFit fit{};	///< statistics for the sphere and ellipsoid fit
+	Vector3f last{};	///< last accepted sample
+
+	// statistics for the rotation detection relative to the first internal mag
+	Vector3f sum{};		///< sum of the samples
+	Matrix3f sum_outer{};	///< sum of sample * sample^T
+	Matrix3f sum_cross{};	///< sum of sample * (first internal mag sample)^T
+};
+
 /// Data passed to calibration worker routine
 struct mag_worker_data_t {
 	orb_advert_t	*mavlink_log_pub;
@@ -90,9 +101,8 @@ struct mag_worker_data_t {
 	uint64_t	calibration_interval_perside_us;
 	unsigned int	calibration_counter_total[MAX_MAGS];
 
-	float		*x[MAX_MAGS];
-	float		*y[MAX_MAGS];
-	float		*z[MAX_MAGS];
+	mag_sample_data_t *samples[MAX_MAGS];
+	int		internal_index;			///< first internal mag, reference for the rotation detection
 
 	calibration::Magnetometer calibration[MAX_MAGS] {};
 };
@@ -139,23 +149,31 @@ int do_mag_calibration(orb_advert_t *mavlink_log_pub)
 	return result;
 }
 
-static bool reject_sample(float sx, float sy, float sz, float x[], float y[], float z[], unsigned count,
+static Matrix3f outer_product(const Vector3f &a, const Vector3f &b)
+{
+	return Matrix<float, 3, 1>(a) * b.transpose();
+}
+
+// only the last accepted sample is compared, the vehicle has to rotate between two samples
+static bool reject_sample(float sx, float sy, float sz, const Vector3f &last, unsigned count,
 			  unsigned max_count, float mag_sphere_radius)
 {
+	if (count == 0) {
+		return false;
+	}
+
 	float min_sample_dist = fabsf(5.4f * mag_sphere_radius / sqrtf(max_count)) / 3.0f;
 
-	for (size_t i = 0; i < count; i++) {
-		float dx = sx - x[i];
-		float dy = sy - y[i];
-		float dz = sz - z[i];
-		float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+	float dx = sx - last(0);
+	float dy = sy - last(1);
+	float dz = sz - last(2);
+	float dist = sqrtf(dx * dx + dy * dy + dz * dz);
 
-		if (dist < min_sample_dist) {
-			PX4_DEBUG("rejected X: %.3f Y: %.3f Z: %.3f (%.3f < %.3f) (%u/%u) ", (double)sx, (double)sy, (double)sz, (double)dist,
-				  (double)min_sample_dist, count, max_count);
+	if (dist < min_sample_dist) {
+		PX4_DEBUG("rejected X: %.3f Y: %.3f Z: %.3f (%.3f < %.3f) (%u/%u) ", (double)sx, (double)sy, (double)sz, (double)dist,
+			  (double)min_sample_dist, count, max_count);
 
-			return true;
-		}
+		return true;
 	}
 
 	return false;
@@ -357,8 +375,7 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 						}
 
 						// Check if this measurement is good to go in
-						bool reject = reject_sample(mag.x, mag.y, mag.z,
-									    worker_data->x[cur_mag], worker_data->y[cur_mag], worker_data->z[cur_mag],
+						bool reject = reject_sample(mag.x, mag.y, mag.z, worker_data->samples[cur_mag]->last,
 									    worker_data->calibration_counter_total[cur_mag],
 									    worker_data->calibration_sides * worker_data->calibration_points_perside,
 									    mag_sphere_radius);
@@ -381,9 +398,19 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 			if (!rejected) {
 				for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 					if (worker_data->calibration[cur_mag].device_id() != 0) {
-						worker_data->x[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](0);
-						worker_data->y[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](1);
-						worker_data->z[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](2);
+						mag_sample_data_t &data = *worker_data->samples[cur_mag];
+						const Vector3f &sample = new_samples[cur_mag];
+
+						data.fit.update(sample);
+
+						data.sum += sample;
+						data.sum_outer += outer_product(sample, sample);
+
+						if (worker_data->internal_index >= 0) {
+							data.sum_cross += outer_product(sample, new_samples[worker_data->internal_index]);
+						}
+
+						data.last = sample;
 
 						worker_data->calibration_counter_total[cur_mag]++;
 					}
@@ -402,10 +429,10 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 					status.side_data_collected[cur_mag] = worker_data->side_data_collected[cur_mag];
 
 					if (worker_data->calibration[cur_mag].device_id() != 0) {
-						const unsigned int sample = worker_data->calibration_counter_total[cur_mag] - 1;
-						status.x[cur_mag] = worker_data->x[cur_mag][sample];
-						status.y[cur_mag] = worker_data->y[cur_mag][sample];
-						status.z[cur_mag] = worker_data->z[cur_mag][sample];
+						const Vector3f &sample = worker_data->samples[cur_mag]->last;
+						status.x[cur_mag] = sample(0);
+						status.y[cur_mag] = sample(1);
+						status.z[cur_mag] = sample(2);
 
 					} else {
 						status.x[cur_mag] = 0.f;
@@ -512,13 +539,11 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 
 	for (size_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 		// Initialize to no memory allocated
-		worker_data.x[cur_mag] = nullptr;
-		worker_data.y[cur_mag] = nullptr;
-		worker_data.z[cur_mag] = nullptr;
+		worker_data.samples[cur_mag] = nullptr;
 		worker_data.calibration_counter_total[cur_mag] = 0;
 	}
 
-	const unsigned int calibration_points_maxcount = worker_data.calibration_sides * worker_data.calibration_points_perside;
+	worker_data.internal_index = -1;
 
 	for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 
@@ -532,16 +557,19 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 		worker_data.calibration[cur_mag].set_calibration_index(cur_mag);
 
 		if (worker_data.calibration[cur_mag].device_id() != 0) {
-			worker_data.x[cur_mag] = static_cast<float *>(malloc(sizeof(float) * calibration_points_maxcount));
-			worker_data.y[cur_mag] = static_cast<float *>(malloc(sizeof(float) * calibration_points_maxcount));
-			worker_data.z[cur_mag] = static_cast<float *>(malloc(sizeof(float) * calibration_points_maxcount));
+			worker_data.samples[cur_mag] = new mag_sample_data_t{};
 
-			if (worker_data.x[cur_mag] == nullptr || worker_data.y[cur_mag] == nullptr || worker_data.z[cur_mag] == nullptr) {
+			if (worker_data.samples[cur_mag] == nullptr) {
 				calibration_log_critical(mavlink_log_pub, "ERROR: out of memory");
 				result = calibrate_return_error;
 				break;
 			}
 
+			// first internal mag to use as reference for the rotation detection
+			if (!worker_data.calibration[cur_mag].external() && (worker_data.internal_index < 0)) {
+				worker_data.internal_index = cur_mag;
+			}
+
 		} else {
 			break;
 		}
@@ -589,16 +617,14 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 
 				bool sphere_fit_success = false;
 				bool ellipsoid_fit_success = false;
-				int ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
-						     worker_data.calibration_counter_total[cur_mag], sphere_data, false);
+				int ret = lm_mag_fit(worker_data.samples[cur_mag]->fit, sphere_data, false);
 
 				if (ret == PX4_OK) {
 					sphere_fit_success = true;
 					PX4_INFO("Mag: %" PRIu8 " sphere radius: %.4f", cur_mag, (double)sphere_data.radius);
 
 					if (!sphere_fit_only) {
-						int ellipsoid_ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
-									       worker_data.calibration_counter_total[cur_mag], sphere_data, true);
+						int ellipsoid_ret = lm_mag_fit(worker_data.samples[cur_mag]->fit, sphere_data, true);
 
 						if (ellipsoid_ret == PX4_OK) {
 							ellipsoid_fit_success = true;
@@ -653,14 +679,13 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 
 	// DO NOT REMOVE! Critical validation data!
 	if (result == calibrate_return_ok) {
-		// Print uncalibrated data points
+		// Print the statistics of the data points, they aren't kept
 		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 			if (worker_data.calibration_counter_total[cur_mag] == 0) {
 				continue;
 			}
 
 			printf("MAG %" PRIu8 " with %u samples:\n", cur_mag, worker_data.calibration_counter_total[cur_mag]);
-			printf("RAW -> CALIBRATED\n");
 
 			float scale_data[9] {
 				diag[cur_mag](0),    offdiag[cur_mag](0), offdiag[cur_mag](1),
@@ -671,19 +696,18 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 			const Matrix3f scale{scale_data};
 			const Vector3f &offset = sphere[cur_mag];
 
-			for (size_t i = 0; i < worker_data.calibration_counter_total[cur_mag]; i++) {
-				float x = worker_data.x[cur_mag][i];
-				float y = worker_data.y[cur_mag][i];
-				float z = worker_data.z[cur_mag][i];
+			const mag_sample_data_t &data = *worker_data.samples[cur_mag];
+			const float n = worker_data.calibration_counter_total[cur_mag];
+			const Vector3f mean = data.sum / n;
 
-				// apply calibration
-				const Vector3f cal{scale *(Vector3f{x, y, z} - offset)};
-
-				printf("[%.3f, %.3f, %.3f] -> [%.3f, %.3f, %.3f]\n",
-				       (double)x, (double)y, (double)z,
-				       (double)cal(0), (double)cal(1), (double)cal(2));
-			}
+			// sum(|m|^2) = trace(T C T^T) with C = sum((x - c) (x - c)^T), as for the rotation detection
+			const Matrix3f cov = data.sum_outer - outer_product(offset, data.sum)
+					     - outer_product(data.sum, offset) + outer_product(offset, offset) * n;
+			const float rms_length = sqrtf(Matrix3f(scale * cov * scale.transpose()).trace() / n);
 
+			printf("RAW MEAN: [%.3f, %.3f, %.3f]\n", (double)mean(0), (double)mean(1), (double)mean(2));
+			printf("CALIBRATED RMS LENGTH: %8.4f\n", (double)rms_length);
+			printf("FIT COST: %8.4f\n", (double)data.fit.cost());
 			printf("SPHERE RADIUS: %8.4f\n", (double)sphere_radius[cur_mag]);
 		}
 	}
@@ -698,22 +722,21 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 
 		if ((worker_data.calibration_sides >= 3) && (param_sens_mag_autorot == 1)) {
 
-			// find first internal mag to use as reference
-			int internal_index = -1;
-
-			for (unsigned cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
-				if (!worker_data.calibration[cur_mag].external() && (worker_data.calibration[cur_mag].device_id() != 0)) {
-					internal_index = cur_mag;
-					break;
-				}
-			}
+			// first internal mag used as reference
+			const int internal_index = worker_data.internal_index;
 
 			// only proceed if there's a valid internal
 			if (internal_index >= 0) {
 
 				const Dcmf board_rotation = calibration::GetBoardRotationMatrix();
 
-				// apply new calibrations to all raw sensor data before comparison
+				// The new calibrations are applied to the collected sample statistics, with T the calibration scale
+				// (rotated to board for internal mags) and c the offset: m = T (x - c)
+				//  sum(|m|^2)      = trace(T C T^T)        with C = sum((x - c) (x - c)^T)
+				//  sum(m_e^T m_i)  = trace(T_e C_ei T_i^T) with C_ei = sum((x_e - c_e) (x_i - c_i)^T)
+				// so the error of every rotation is computed without iterating over the samples.
+				Matrix3f transform[MAX_MAGS] {};
+
 				for (unsigned cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 					if (worker_data.calibration[cur_mag].device_id() != 0) {
 
@@ -722,36 +745,40 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 							offdiag[cur_mag](0),    diag[cur_mag](1), offdiag[cur_mag](2),
 							offdiag[cur_mag](1), offdiag[cur_mag](2),    diag[cur_mag](2)
 						};
-						const Matrix3f scale{scale_data};
-
-						const Vector3f &offset{sphere[cur_mag]};
-
-						for (unsigned i = 0; i < worker_data.calibration_counter_total[cur_mag]; i++) {
-
-							const Vector3f sample{worker_data.x[cur_mag][i], worker_data.y[cur_mag][i], worker_data.z[cur_mag][i]};
-
-							// apply calibration
-							Vector3f m{scale *(sample - offset)};
-
-							if (!worker_data.calibration[cur_mag].external()) {
-								// rotate internal mag data to board
-								m = board_rotation * m;
-							}
+						transform[cur_mag] = Matrix3f{scale_data};
 
-							// store back in worker_data
-							worker_data.x[cur_mag][i] = m(0);
-							worker_data.y[cur_mag][i] = m(1);
-							worker_data.z[cur_mag][i] = m(2);
+						if (!worker_data.calibration[cur_mag].external()) {
+							// rotate internal mag data to board
+							transform[cur_mag] = board_rotation * transform[cur_mag];
 						}
 					}
 				}
 
+				const mag_sample_data_t &internal = *worker_data.samples[internal_index];
+				const Vector3f &offset_internal{sphere[internal_index]};
+
 				// external mags try all rotations and compute mean square error (MSE) compared with first internal mag
 				for (int cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 					if ((worker_data.calibration[cur_mag].device_id() != 0) && (cur_mag != internal_index)) {
 
+						// all mags are sampled together, the sample counts are the same
 						const int last_sample_index = math::min(worker_data.calibration_counter_total[internal_index],
 											worker_data.calibration_counter_total[cur_mag]);
+						const float n = last_sample_index;
+
+						const mag_sample_data_t &data = *worker_data.samples[cur_mag];
+						const Vector3f &offset{sphere[cur_mag]};
+
+						const Matrix3f cov_internal = internal.sum_outer - outer_product(offset_internal, internal.sum)
+									      - outer_product(internal.sum, offset_internal) + outer_product(offset_internal, offset_internal) * n;
+						const Matrix3f cov = data.sum_outer - outer_product(offset, data.sum)
+								     - outer_product(data.sum, offset) + outer_product(offset, offset) * n;
+						const Matrix3f cov_cross = data.sum_cross - outer_product(offset, internal.sum)
+									   - outer_product(data.sum, offset_internal) + outer_product(offset, offset_internal) * n;
+
+						const float sum_sq_internal = Matrix3f(transform[internal_index] * cov_internal * transform[internal_index].transpose()).trace();
+						const float sum_sq = Matrix3f(transform[cur_mag] * cov * transform[cur_mag].transpose()).trace();
+						const Matrix3f cross = transform[cur_mag] * cov_cross * transform[internal_index].transpose();
 
 						float MSE[ROTATION_MAX] {}; // mean square error for each rotation
 
@@ -776,21 +803,12 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 								break;
 
 							default:
-								float diff_sum = 0.f;
-
-								for (int i = 0; i < last_sample_index; i++) {
-									float x = worker_data.x[cur_mag][i];
-									float y = worker_data.y[cur_mag][i];
-									float z = worker_data.z[cur_mag][i];
-									rotate_3f((enum Rotation)r, x, y, z);
-
-									Vector3f diff = Vector3f{x, y, z} - Vector3f{worker_data.x[internal_index][i], worker_data.y[internal_index][i], worker_data.z[internal_index][i]};
-
-									diff_sum += diff.norm_squared();
-								}
+								// sum(|R m_e - m_i|^2) = sum(|m_e|^2) + sum(|m_i|^2) - 2 trace(R sum(m_e m_i^T))
+								const float diff_sum = sum_sq + sum_sq_internal
+										       - 2.f * Matrix3f(get_rot_matrix((enum Rotation)r) * cross).trace();
 
 								// compute mean squared error
-								MSE[r] = diff_sum / last_sample_index;
+								MSE[r] = math::max(diff_sum, 0.f) / n;
 
 								if (MSE[r] < min_mse) {
 									min_mse = MSE[r];
@@ -887,9 +905,8 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 
 	// Data points are no longer needed
 	for (size_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
-		free(worker_data.x[cur_mag]);
-		free(worker_data.y[cur_mag]);
-		free(worker_data.z[cur_mag]);
+		delete worker_data.samples[cur_mag];
+		worker_data.samples[cur_mag] = nullptr;
 	}
 
 	FactoryCalibrationStorage factory_storage;
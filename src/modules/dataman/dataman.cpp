@@ -67,24 +67,27 @@ static constexpr int TASK_STACK_SIZE = 1420;
 
 #ifdef CONFIG_DATAMAN_PERSISTENT_STORAGE
 /* Private File based Operations */
-static ssize_t _file_write(dm_item_t item, unsigned index, const void *buf, size_t count);
+static ssize_t _file_write(dm_item_t item, unsigned index, const void *buf, size_t count, bool sync);
 static ssize_t _file_read(dm_item_t item, unsigned index, void *buf, size_t count);
 static int  _file_clear(dm_item_t item);
+static int _file_sync();
 static int _file_initialize(unsigned max_offset);
 static void _file_shutdown();
 #endif
 
 /* Private Ram based Operations */
-static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count);
+static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count, bool sync);
 static ssize_t _ram_read(dm_item_t item, unsigned index, void *buf, size_t count);
 static int  _ram_clear(dm_item_t item);
+static int _ram_sync();
 static int _ram_initialize(unsigned max_offset);
 static void _ram_shutdown();
 
 typedef struct dm_operations_t {
-	ssize_t (*write)(dm_item_t item, unsigned index, const void *buf, size_t count);
+	ssize_t (*write)(dm_item_t item, unsigned index, const void *buf, size_t count, bool sync);
 	ssize_t (*read)(dm_item_t item, unsigned index, void *buf, size_t count);
 	int (*clear)(dm_item_t item);
+	int (*sync)();
 	int (*initialize)(unsigned max_offset);
 	void (*shutdown)();
 	int (*wait)(px4_sem_t *sem);
@@ -95,6 +98,7 @@ static constexpr dm_operations_t dm_file_operations = {
 	.write   = _file_write,
 	.read    = _file_read,
 	.clear   = _file_clear,
+	.sync    = _file_sync,
 	.initialize = _file_initialize,
 	.shutdown = _file_shutdown,
 	.wait = px4_sem_wait,
@@ -105,6 +109,7 @@ static constexpr dm_operations_t dm_ram_operations = {
 	.write   = _ram_write,
 	.read    = _ram_read,
 	.clear   = _ram_clear,
+	.sync    = _ram_sync,
 	.initialize = _ram_initialize,
 	.shutdown = _ram_shutdown,
 	.wait = px4_sem_wait,
@@ -208,7 +213,7 @@ calculate_offset(dm_item_t item, unsigned index)
  */
 
 /* write to the data manager RAM buffer  */
-static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count)
+static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count, bool sync)
 {
 	if (item >= DM_KEY_NUM_KEYS) {
 		return -1;
@@ -250,7 +255,7 @@ static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_
 #ifdef CONFIG_DATAMAN_PERSISTENT_STORAGE
 /* write to the data manager file */
 static ssize_t
-_file_write(dm_item_t item, unsigned index, const void *buf, size_t count)
+_file_write(dm_item_t item, unsigned index, const void *buf, size_t count, bool sync)
 {
 	if (item >= DM_KEY_NUM_KEYS) {
 		return -1;
@@ -319,8 +324,10 @@ _file_write(dm_item_t item, unsigned index, const void *buf, size_t count)
 		return -1;
 	}
 
-	/* Make sure data is written to physical media */
-	fsync(dm_operations_data.file.fd);
+	/* Make sure data is written to physical media, unless the caller flushes a batch of writes later */
+	if (sync) {
+		fsync(dm_operations_data.file.fd);
+	}
 
 	/* All is well... return the number of user data written */
 	return count - DM_SECTOR_HDR_SIZE;
@@ -485,6 +492,12 @@ static int  _ram_clear(dm_item_t item)
 	return result;
 }
 
+static int _ram_sync()
+{
+	/* nothing to flush */
+	return 0;
+}
+
 #ifdef CONFIG_DATAMAN_PERSISTENT_STORAGE
 static int
 _file_clear(dm_item_t item)
@@ -539,6 +552,13 @@ _file_clear(dm_item_t item)
 	fsync(dm_operations_data.file.fd);
 	return result;
 }
+
+/* flush the deferred writes to the physical media */
+static int
+_file_sync()
+{
+	return fsync(dm_operations_data.file.fd);
+}
 #endif
 
 #ifdef CONFIG_DATAMAN_PERSISTENT_STORAGE
@@ -575,7 +595,7 @@ _file_initialize(unsigned max_offset)
 
 		/* Write current compat info */
 		compat_state.key = DM_COMPAT_KEY;
-		int ret = g_dm_ops->write(DM_KEY_COMPAT, 0, &compat_state, sizeof(compat_state));
+		int ret = g_dm_ops->write(DM_KEY_COMPAT, 0, &compat_state, sizeof(compat_state), true);
 
 		if (ret != sizeof(compat_state)) {
 			PX4_ERR("Failed writing compat: %d", ret);
@@ -598,9 +618,9 @@ _file_initialize(unsigned max_offset)
 		stats.num_items = 0;
 		stats.opaque_id = 0;
 
-		g_dm_ops->write(DM_KEY_MISSION_STATE, 0, reinterpret_cast<uint8_t *>(&mission), sizeof(mission_s));
-		g_dm_ops->write(DM_KEY_FENCE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
-		g_dm_ops->write(DM_KEY_SAFE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
+		g_dm_ops->write(DM_KEY_MISSION_STATE, 0, reinterpret_cast<uint8_t *>(&mission), sizeof(mission_s), true);
+		g_dm_ops->write(DM_KEY_FENCE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s), true);
+		g_dm_ops->write(DM_KEY_SAFE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s), true);
 	}
 
 	dm_operations_data.running = true;
@@ -766,7 +786,7 @@ task_main(int argc, char *argv[])
 					g_func_counts[DM_WRITE]++;
 					perf_begin(_dm_write_perf);
 					result = g_dm_ops->write(static_cast<dm_item_t>(request.item), request.index,
-								 &(request.data), request.data_length);
+								 &(request.data), request.data_length, true);
 					perf_end(_dm_write_perf);
 
 					if (result > 0) {
@@ -778,6 +798,37 @@ task_main(int argc, char *argv[])
 
 					break;
 
+				case DM_WRITE_DEFERRED:
+
+					g_func_counts[DM_WRITE_DEFERRED]++;
+					perf_begin(_dm_write_perf);
+					result = g_dm_ops->write(static_cast<dm_item_t>(request.item), request.index,
+								 &(request.data), request.data_length, false);
+					perf_end(_dm_write_perf);
+
+					if (result > 0) {
+						response.status = dataman_response_s::STATUS_SUCCESS;
+
+					} else {
+						response.status = dataman_response_s::STATUS_FAILURE_WRITE_FAILED;
+					}
+
+					break;
+
+				case DM_SYNC:
+
+					g_func_counts[DM_SYNC]++;
+					result = g_dm_ops->sync();
+
+					if (result == 0) {
+						response.status = dataman_response_s::STATUS_SUCCESS;
+
+					} else {
+						response.status = dataman_response_s::STATUS_FAILURE_WRITE_FAILED;
+					}
+
+					break;
+
 				case DM_READ:
 
 					g_func_counts[DM_READ]++;
@@ -874,6 +925,7 @@ status()
 	PX4_INFO("Writes   %u", g_func_counts[DM_WRITE]);
 	PX4_INFO("Reads    %u", g_func_counts[DM_READ]);
 	PX4_INFO("Clears   %u", g_func_counts[DM_CLEAR]);
+	PX4_INFO("Deferred writes %u, syncs %u", g_func_counts[DM_WRITE_DEFERRED], g_func_counts[DM_SYNC]);
 
 	perf_print_counter(_dm_read_perf);
 	perf_print_counter(_dm_write_perf);
@@ -63,6 +63,8 @@ typedef enum {
 	DM_WRITE,			///< Write index for given item
 	DM_READ,			///< Read index for given item
 	DM_CLEAR,			///< Clear all index for given item
+	DM_WRITE_DEFERRED,		///< Write index for given item, without flushing it to the storage
+	DM_SYNC,			///< Flush the deferred writes to the storage
 	DM_NUMBER_OF_FUNCS
 } dm_function_t;
 
@@ -192,4 +192,113 @@ private:
 	bool _first_write{true};
 };
 
+/*
+ * Fixed capacity variant of RingBuffer for timestamped samples.
+ * The storage is part of the object, so the heap is never touched, and the samples are kept
+ * in increasing time_us order, which allows pop_first_older_than() to do a binary search
+ * instead of a linear scan. Meant for buffers with a size known at compile time.
+ */
+template <typename data_type, uint16_t kCapacity>
+class TimestampedRingBuffer
+{
+public:
+	static_assert(kCapacity > 1, "capacity must be at least 2");
+
+	TimestampedRingBuffer() = default;
+	~TimestampedRingBuffer() = default;
+
+	// no copy, assignment, move, move assignment
+	TimestampedRingBuffer(const TimestampedRingBuffer &) = delete;
+	TimestampedRingBuffer &operator=(const TimestampedRingBuffer &) = delete;
+	TimestampedRingBuffer(TimestampedRingBuffer &&) = delete;
+	TimestampedRingBuffer &operator=(TimestampedRingBuffer &&) = delete;
+
+	void push(const data_type &sample)
+	{
+		// keep the samples ordered if the time goes backwards (e.g. a delay change)
+		while ((_count > 0) && (get_newest().time_us > sample.time_us)) {
+			_count--;
+		}
+
+		if (_count == kCapacity) {
+			// overwrite the oldest sample
+			_tail = wrap(_tail + 1);
+			_count--;
+		}
+
+		_buffer[wrap(_tail + _count)] = sample;
+		_count++;
+	}
+
+	uint16_t get_length() const { return kCapacity; }
+	uint16_t entries() const { return _count; }
+	bool empty() const { return _count == 0; }
+
+	// index 0 is the oldest sample
+	const data_type &operator[](const uint16_t index) const { return _buffer[wrap(_tail + index)]; }
+
+	const data_type &get_newest() const { return _buffer[wrap(_tail + (_count > 0 ? _count - 1 : 0))]; }
+	const data_type &get_oldest() const { return _buffer[_tail]; }
+
+	// same semantics as RingBuffer::pop_first_older_than()
+	bool pop_first_older_than(const uint64_t &timestamp, data_type *sample)
+	{
+		// find the first sample newer than timestamp
+		uint16_t low = 0;
+		uint16_t high = _count;
+
+		while (low < high) {
+			const uint16_t mid = low + (high - low) / 2;
+
+			if ((*this)[mid].time_us <= timestamp) {
+				low = mid + 1;
+
+			} else {
+				high = mid;
+			}
+		}
+
+		if (low == 0) {
+			// all samples are newer than timestamp
+			return false;
+		}
+
+		const uint16_t index = low - 1;
+		const data_type &found = (*this)[index];
+
+		if (timestamp >= found.time_us + (uint64_t)1e5) {
+			return false;
+		}
+
+		*sample = found;
+
+		// drop the sample and everything older
+		_tail = wrap(_tail + index + 1);
+		_count -= index + 1;
+
+		return true;
+	}
+
+	int get_used_size() const { return sizeof(*this) - sizeof(data_type) * (kCapacity - _count); }
+	int get_total_size() const { return sizeof(*this); }
+
+	void reset()
+	{
+		for (uint16_t i = 0; i < kCapacity; i++) {
+			_buffer[i] = {};
+		}
+
+		_tail = 0;
+		_count = 0;
+	}
+
+private:
+	static uint16_t wrap(uint32_t index) { return (index >= kCapacity) ? index - kCapacity : index; }
+
+	data_type _buffer[kCapacity] {};
+
+	uint16_t _tail{0};
+	uint16_t _count{0};
+};
+
 #endif // !EKF_RINGBUFFER_H
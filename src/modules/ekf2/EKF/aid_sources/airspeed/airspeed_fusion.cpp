@@ -154,10 +154,10 @@ void Ekf::updateAirspeed(const airspeedSample &airspeed_sample, estimator_aid_so
 	const float R = sq(math::constrain(_params.eas_noise, 0.5f, 5.0f) *
 			   math::constrain(airspeed_sample.eas2tas, 0.9f, 10.0f));
 
-	float innov = 0.f;
-	float innov_var = 0.f;
-	sym::ComputeAirspeedInnovAndInnovVar(_state.vector(), P, airspeed_sample.true_airspeed, R, FLT_EPSILON,
-					     &innov, &innov_var);
+	StateScalar innov = 0.f;
+	StateScalar innov_var = 0.f;
+	sym::ComputeAirspeedInnovAndInnovVar<StateScalar>(_state.vector(), P, airspeed_sample.true_airspeed, R, FLT_EPSILON,
+			&innov, &innov_var);
 
 	updateAidSourceStatus(aid_src,
 			      airspeed_sample.time_us,                 // sample timestamp
@@ -203,11 +203,11 @@ void Ekf::fuseAirspeed(const airspeedSample &airspeed_sample, estimator_aid_sour
 
 	_fault_status.flags.bad_airspeed = false;
 
-	const VectorState H = sym::ComputeAirspeedH(_state.vector(), FLT_EPSILON);
+	const VectorState H = sym::ComputeAirspeedH<StateScalar>(_state.vector(), FLT_EPSILON);
 	VectorState K = P * H / aid_src.innovation_variance;
 
 	if (update_wind_only) {
-		const Vector2f K_wind = K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0);
+		const matrix::Vector2<StateScalar> K_wind = K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0);
 		K.setZero();
 		K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0) = K_wind;
 	}
@@ -242,9 +242,9 @@ void Ekf::resetWindUsingAirspeed(const airspeedSample &airspeed_sample)
 	const float airspeed_var = sq(math::constrain(_params.eas_noise, 0.5f, 5.0f)
 				      * math::constrain(airspeed_sample.eas2tas, 0.9f, 10.0f));
 
-	matrix::SquareMatrix<float, State::wind_vel.dof> P_wind;
-	sym::ComputeWindInitAndCovFromAirspeed(_state.vel, euler_yaw, airspeed_sample.true_airspeed, getVelocityVariance(),
-					       getYawVar(), sideslip_var, airspeed_var, &_state.wind_vel, &P_wind);
+	matrix::SquareMatrix<StateScalar, State::wind_vel.dof> P_wind;
+	sym::ComputeWindInitAndCovFromAirspeed<StateScalar>(_state.vel, euler_yaw, airspeed_sample.true_airspeed,
+			getVelocityVariance(), getYawVar(), sideslip_var, airspeed_var, &_state.wind_vel, &P_wind);
 
 	resetStateCovariance<State::wind_vel>(P_wind);
 
@@ -259,8 +259,8 @@ void Ekf::resetVelUsingAirspeed(const airspeedSample &airspeed_sample)
 
 	// Estimate velocity using zero sideslip assumption and airspeed measurement
 	Vector2f horizontal_velocity;
-	horizontal_velocity(0) = _state.wind_vel(0) + airspeed_sample.true_airspeed * cosf(euler_yaw);
-	horizontal_velocity(1) = _state.wind_vel(1) + airspeed_sample.true_airspeed * sinf(euler_yaw);
+	horizontal_velocity(0) = static_cast<float>(_state.wind_vel(0)) + airspeed_sample.true_airspeed * cosf(euler_yaw);
+	horizontal_velocity(1) = static_cast<float>(_state.wind_vel(1)) + airspeed_sample.true_airspeed * sinf(euler_yaw);
 
 	float vel_var = NAN; // Do not reset the velocity variance as wind variance estimate is most likely not correct
 	resetHorizontalVelocityTo(horizontal_velocity, vel_var);
@@ -93,7 +93,7 @@ private:
 	};
 
 	estimator_aid_source2d_s _aid_src_aux_global_position{};
-	RingBuffer<AuxGlobalPositionSample> _aux_global_position_buffer{20}; // TODO: size with _obs_buffer_length and actual publication rate
+	TimestampedRingBuffer<AuxGlobalPositionSample, 20> _aux_global_position_buffer{}; // TODO: size with _obs_buffer_length and actual publication rate
 	uint64_t _time_last_buffer_push{0};
 
 	enum class Ctrl : uint8_t {
@@ -44,7 +44,7 @@ void Ekf::controlAuxVelFusion(const imuSample &imu_sample)
 					      sample.time_us,                                           // sample timestamp
 					      sample.vel,                                               // observation
 					      sample.velVar,                                            // observation variance
-					      Vector2f(_state.vel.xy()) - sample.vel,                   // innovation
+					      Vector2f(Vector3f(_state.vel).xy()) - sample.vel,         // innovation
 					      Vector2f(getStateVariance<State::vel>()) + sample.velVar, // innovation variance
 					      math::max(_params.auxvel_gate, 1.f));                     // innovation gate
 
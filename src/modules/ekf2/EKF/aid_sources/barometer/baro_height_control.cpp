@@ -107,7 +107,8 @@ void Ekf::controlBaroHeightFusion(const imuSample &imu_sample)
 		if (measurement_valid) {
 			bias_est.setMaxStateNoise(sqrtf(measurement_var));
 			bias_est.setProcessNoiseSpectralDensity(_params.baro_bias_nsd);
-			bias_est.fuseBias(measurement - _gpos.altitude(), measurement_var + P(State::pos.idx + 2, State::pos.idx + 2));
+			bias_est.fuseBias(measurement - _gpos.altitude(),
+					  measurement_var + static_cast<float>(P(State::pos.idx + 2, State::pos.idx + 2)));
 		}
 
 		// determine if we should use height aiding
@@ -211,15 +212,15 @@ float Ekf::compensateBaroForDynamicPressure(const imuSample &imu_sample, const f
 		// negative X and Y directions. Used to correct baro data for positional errors
 
 		// Calculate airspeed in body frame
-		const Vector3f angular_velocity = (imu_sample.delta_ang / imu_sample.delta_ang_dt) - _state.gyro_bias;
+		const Vector3f angular_velocity = (imu_sample.delta_ang / imu_sample.delta_ang_dt) - getGyroBias();
 		const Vector3f vel_imu_rel_body_ned = _R_to_earth * (angular_velocity % _params.imu_pos_body);
-		const Vector3f velocity_earth = _state.vel - vel_imu_rel_body_ned;
+		const Vector3f velocity_earth = Vector3f(_state.vel) - vel_imu_rel_body_ned;
 
 		const Vector3f wind_velocity_earth(_state.wind_vel(0), _state.wind_vel(1), 0.0f);
 
 		const Vector3f airspeed_earth = velocity_earth - wind_velocity_earth;
 
-		const Vector3f airspeed_body = _state.quat_nominal.rotateVectorInverse(airspeed_earth);
+		const Vector3f airspeed_body = Quatf(_state.quat_nominal).rotateVectorInverse(airspeed_earth);
 
 		const Vector3f K_pstatic_coef(
 			airspeed_body(0) >= 0.f ? _params.static_pressure_coef_xp : _params.static_pressure_coef_xn,
@@ -85,7 +85,7 @@ void Ekf::fuseDrag(const dragSample &drag_sample)
 	const Vector3f rel_wind_earth(_state.vel(0) - _state.wind_vel(0),
 				      _state.vel(1) - _state.wind_vel(1),
 				      _state.vel(2));
-	const Vector3f rel_wind_body = _state.quat_nominal.rotateVectorInverse(rel_wind_earth);
+	const Vector3f rel_wind_body = Quatf(_state.quat_nominal).rotateVectorInverse(rel_wind_earth);
 	const float rel_wind_speed = rel_wind_body.norm();
 	const auto state_vector_prev = _state.vector();
 
@@ -120,7 +120,7 @@ void Ekf::fuseDrag(const dragSample &drag_sample)
 	// perform sequential fusion of XY specific forces
 	for (uint8_t axis_index = 0; axis_index < 2; axis_index++) {
 		// measured drag acceleration corrected for sensor bias
-		const float mea_acc = drag_sample.accelXY(axis_index) - _state.accel_bias(axis_index);
+		const float mea_acc = drag_sample.accelXY(axis_index) - static_cast<float>(_state.accel_bias(axis_index));
 
 		// Drag is modelled as an arbitrary combination of bluff body drag that proportional to
 		// equivalent airspeed squared, and rotor momentum drag that is proportional to true airspeed
@@ -132,16 +132,20 @@ void Ekf::fuseDrag(const dragSample &drag_sample)
 		innovation(axis_index) = pred_acc - mea_acc;
 
 		if (axis_index == 0) {
-			sym::ComputeDragXInnovVarAndH(state_vector_prev, P, rho, bcoef_inv(axis_index), mcoef_corrrected, R_ACC, FLT_EPSILON,
-						      &innovation_variance(axis_index), &H);
+			StateScalar innov_var;
+			sym::ComputeDragXInnovVarAndH<StateScalar>(state_vector_prev, P, rho, bcoef_inv(axis_index), mcoef_corrrected, R_ACC,
+					FLT_EPSILON, &innov_var, &H);
+			innovation_variance(axis_index) = innov_var;
 
 			if (!using_bcoef_x && !using_mcoef) {
 				continue;
 			}
 
 		} else if (axis_index == 1) {
-			sym::ComputeDragYInnovVarAndH(state_vector_prev, P, rho, bcoef_inv(axis_index), mcoef_corrrected, R_ACC, FLT_EPSILON,
-						      &innovation_variance(axis_index), &H);
+			StateScalar innov_var;
+			sym::ComputeDragYInnovVarAndH<StateScalar>(state_vector_prev, P, rho, bcoef_inv(axis_index), mcoef_corrrected, R_ACC,
+					FLT_EPSILON, &innov_var, &H);
+			innovation_variance(axis_index) = innov_var;
 
 			if (!using_bcoef_y && !using_mcoef) {
 				continue;
@@ -115,7 +115,7 @@ void Ekf::controlExternalVisionFusion(const imuSample &imu_sample)
 
 void Ekf::updateEvAttitudeErrorFilter(extVisionSample &ev_sample, bool ev_reset)
 {
-	const Quatf q_error((_state.quat_nominal * ev_sample.quat.inversed()).normalized());
+	const Quatf q_error((Quatf(_state.quat_nominal) * ev_sample.quat.inversed()).normalized());
 
 	if (!q_error.isAllFinite()) {
 		return;
@@ -159,7 +159,7 @@ void Ekf::fuseLocalFrameVelocity(estimator_aid_source3d_s &aid_src, const uint64
 			      timestamp,				// sample timestamp
 			      measurement,				// observation
 			      measurement_var,				// observation variance
-			      _state.vel - measurement,			// innovation
+			      Vector3f(_state.vel) - measurement,	// innovation
 			      getVelocityVariance() + measurement_var,	// innovation variance
 			      innovation_gate);				// innovation gate
 	fuseVelocity(aid_src);
@@ -169,29 +169,33 @@ void Ekf::fuseBodyFrameVelocity(estimator_aid_source3d_s &aid_src, const uint64_
 				const Vector3f &measurement, const Vector3f &measurement_var, const float &innovation_gate)
 {
 	VectorState H[3];
-	Vector3f innov_var;
-	Vector3f innov = _R_to_earth.transpose() * _state.vel - measurement;
+	matrix::Vector3<StateScalar> innov_var;
+	Vector3f innov = _R_to_earth.transpose() * Vector3f(_state.vel) - measurement;
 	const auto state_vector = _state.vector();
-	sym::ComputeBodyVelInnovVarH(state_vector, P, measurement_var, &innov_var, &H[0], &H[1], &H[2]);
+	sym::ComputeBodyVelInnovVarH<StateScalar>(state_vector, P, measurement_var, &innov_var, &H[0], &H[1], &H[2]);
 
 	updateAidSourceStatus(aid_src,
 			      timestamp,				// sample timestamp
 			      measurement,				// observation
 			      measurement_var,				// observation variance
 			      innov,					// innovation
-			      innov_var,				// innovation variance
+			      Vector3f(innov_var),			// innovation variance
 			      innovation_gate);				// innovation gate
 
 	if (!aid_src.innovation_rejected) {
 		for (uint8_t index = 0; index <= 2; index++) {
 			if (index == 1) {
-				sym::ComputeBodyVelYInnovVar(state_vector, P, measurement_var(index), &aid_src.innovation_variance[index]);
+				StateScalar innov_var_y;
+				sym::ComputeBodyVelYInnovVar<StateScalar>(state_vector, P, measurement_var(index), &innov_var_y);
+				aid_src.innovation_variance[index] = innov_var_y;
 
 			} else if (index == 2) {
-				sym::ComputeBodyVelZInnovVar(state_vector, P, measurement_var(index), &aid_src.innovation_variance[index]);
+				StateScalar innov_var_z;
+				sym::ComputeBodyVelZInnovVar<StateScalar>(state_vector, P, measurement_var(index), &innov_var_z);
+				aid_src.innovation_variance[index] = innov_var_z;
 			}
 
-			aid_src.innovation[index] = Vector3f(_R_to_earth.transpose().row(index)) * _state.vel - measurement(index);
+			aid_src.innovation[index] = Vector3f(_R_to_earth.transpose().row(index)) * Vector3f(_state.vel) - measurement(index);
 
 			VectorState Kfusion = P * H[index] / aid_src.innovation_variance[index];
 			measurementUpdate(Kfusion, H[index], aid_src.observation_variance[index], aid_src.innovation[index]);
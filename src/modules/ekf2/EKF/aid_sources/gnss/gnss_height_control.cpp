@@ -81,7 +81,8 @@ void Ekf::controlGnssHeightFusion(const gnssSample &gps_sample)
 		if (measurement_valid) {
 			bias_est.setMaxStateNoise(sqrtf(measurement_var));
 			bias_est.setProcessNoiseSpectralDensity(_params.gps_hgt_bias_nsd);
-			bias_est.fuseBias(measurement - _gpos.altitude(), measurement_var + P(State::pos.idx + 2, State::pos.idx + 2));
+			bias_est.fuseBias(measurement - _gpos.altitude(),
+					  measurement_var + static_cast<float>(P(State::pos.idx + 2, State::pos.idx + 2)));
 		}
 
 		// determine if we should use height aiding
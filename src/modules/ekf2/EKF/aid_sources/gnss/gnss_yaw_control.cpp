@@ -138,18 +138,18 @@ void Ekf::updateGnssYaw(const gnssSample &gnss_sample)
 	const float yaw_acc = PX4_ISFINITE(gnss_sample.yaw_acc) ? gnss_sample.yaw_acc : 0.f;
 	const float R_YAW = sq(fmaxf(yaw_acc, _params.gnss_heading_noise));
 
-	float heading_pred;
-	float heading_innov_var;
+	StateScalar heading_pred;
+	StateScalar heading_innov_var;
 
 	VectorState H;
-	sym::ComputeGnssYawPredInnovVarAndH(_state.vector(), P, gnss_sample.yaw_offset, R_YAW, FLT_EPSILON,
-					    &heading_pred, &heading_innov_var, &H);
+	sym::ComputeGnssYawPredInnovVarAndH<StateScalar>(_state.vector(), P, gnss_sample.yaw_offset, R_YAW, FLT_EPSILON,
+			&heading_pred, &heading_innov_var, &H);
 
 	updateAidSourceStatus(_aid_src_gnss_yaw,
 			      gnss_sample.time_us,                          // sample timestamp
 			      measured_hdg,                                // observation
 			      R_YAW,                                       // observation variance
-			      wrap_pi(heading_pred - measured_hdg),        // innovation
+			      wrap_pi(heading_pred - static_cast<StateScalar>(measured_hdg)), // innovation
 			      heading_innov_var,                           // innovation variance
 			      math::max(_params.heading_innov_gate, 1.f)); // innovation gate
 }
@@ -167,14 +167,14 @@ void Ekf::fuseGnssYaw(float antenna_yaw_offset)
 		antenna_yaw_offset = 0.f;
 	}
 
-	float heading_pred;
-	float heading_innov_var;
+	StateScalar heading_pred;
+	StateScalar heading_innov_var;
 	VectorState H;
 
 	// Note: we recompute innov and innov_var because it doesn't cost much more than just computing H
 	// making a separate function just for H uses more flash space without reducing CPU load significantly
-	sym::ComputeGnssYawPredInnovVarAndH(_state.vector(), P, antenna_yaw_offset, aid_src.observation_variance, FLT_EPSILON,
-					    &heading_pred, &heading_innov_var, &H);
+	sym::ComputeGnssYawPredInnovVarAndH<StateScalar>(_state.vector(), P, antenna_yaw_offset, aid_src.observation_variance,
+			FLT_EPSILON, &heading_pred, &heading_innov_var, &H);
 
 	// check if the innovation variance calculation is badly conditioned
 	if (aid_src.innovation_variance < aid_src.observation_variance) {
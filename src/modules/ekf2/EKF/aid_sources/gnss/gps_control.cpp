@@ -225,7 +225,7 @@ void Ekf::updateGnssVel(const imuSample &imu_sample, const gnssSample &gnss_samp
 			      gnss_sample.time_us,                  // sample timestamp
 			      velocity,                             // observation
 			      vel_obs_var,                          // observation variance
-			      _state.vel - velocity,                // innovation
+			      Vector3f(_state.vel) - velocity,      // innovation
 			      getVelocityVariance() + vel_obs_var,  // innovation variance
 			      innovation_gate);                     // innovation gate
 
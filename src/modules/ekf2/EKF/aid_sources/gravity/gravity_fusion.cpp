@@ -63,11 +63,11 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 					       && !isHorizontalAidingActive();
 
 	// calculate kalman gains and innovation variances
-	Vector3f innovation = _state.quat_nominal.rotateVectorInverse(Vector3f(0.f, 0.f, -1.f)) - measurement;
-	Vector3f innovation_variance;
+	Vector3f innovation = Quatf(_state.quat_nominal).rotateVectorInverse(Vector3f(0.f, 0.f, -1.f)) - measurement;
+	matrix::Vector3<StateScalar> innovation_variance;
 	const auto state_vector = _state.vector();
 	VectorState H;
-	sym::ComputeGravityXyzInnovVarAndHx(state_vector, P, measurement_var, &innovation_variance, &H);
+	sym::ComputeGravityXyzInnovVarAndHx<StateScalar>(state_vector, P, measurement_var, &innovation_variance, &H);
 
 	// fill estimator aid source status
 	updateAidSourceStatus(_aid_src_gravity,
@@ -75,7 +75,7 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 			      measurement,                                                 // observation
 			      Vector3f{measurement_var, measurement_var, measurement_var}, // observation variance
 			      innovation,                                                  // innovation
-			      innovation_variance,                                         // innovation variance
+			      Vector3f(innovation_variance),                               // innovation variance
 			      0.25f);                                                      // innovation gate
 
 	// update the states and covariance using sequential fusion
@@ -86,18 +86,22 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 
 		} else if (index == 1) {
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeGravityYInnovVarAndH(state_vector, P, measurement_var, &_aid_src_gravity.innovation_variance[index], &H);
+			StateScalar innov_var;
+			sym::ComputeGravityYInnovVarAndH<StateScalar>(state_vector, P, measurement_var, &innov_var, &H);
+			_aid_src_gravity.innovation_variance[index] = innov_var;
 
 			// recalculate innovation using the updated state
-			_aid_src_gravity.innovation[index] = _state.quat_nominal.rotateVectorInverse(Vector3f(0.f, 0.f,
+			_aid_src_gravity.innovation[index] = Quatf(_state.quat_nominal).rotateVectorInverse(Vector3f(0.f, 0.f,
 							     -1.f))(index) - measurement(index);
 
 		} else if (index == 2) {
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeGravityZInnovVarAndH(state_vector, P, measurement_var, &_aid_src_gravity.innovation_variance[index], &H);
+			StateScalar innov_var;
+			sym::ComputeGravityZInnovVarAndH<StateScalar>(state_vector, P, measurement_var, &innov_var, &H);
+			_aid_src_gravity.innovation_variance[index] = innov_var;
 
 			// recalculate innovation using the updated state
-			_aid_src_gravity.innovation[index] = _state.quat_nominal.rotateVectorInverse(Vector3f(0.f, 0.f,
+			_aid_src_gravity.innovation[index] = Quatf(_state.quat_nominal).rotateVectorInverse(Vector3f(0.f, 0.f,
 							     -1.f))(index) - measurement(index);
 		}
 
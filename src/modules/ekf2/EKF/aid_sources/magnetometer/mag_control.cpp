@@ -134,19 +134,20 @@ void Ekf::controlMagFusion(const imuSample &imu_sample)
 		const float R_MAG = math::max(sq(_params.mag_noise), sq(0.01f));
 
 		// calculate intermediate variables used for X axis innovation variance, observation Jacobians and Kalman gains
-		Vector3f mag_innov;
-		Vector3f innov_var;
+		matrix::Vector3<StateScalar> mag_innov;
+		matrix::Vector3<StateScalar> innov_var;
 
 		// Observation jacobian and Kalman gain vectors
 		VectorState H;
-		sym::ComputeMagInnovInnovVarAndHx(_state.vector(), P, mag_sample.mag, R_MAG, FLT_EPSILON, &mag_innov, &innov_var, &H);
+		sym::ComputeMagInnovInnovVarAndHx<StateScalar>(_state.vector(), P, mag_sample.mag, R_MAG, FLT_EPSILON, &mag_innov,
+				&innov_var, &H);
 
 		updateAidSourceStatus(aid_src,
 				      mag_sample.time_us,                      // sample timestamp
 				      mag_sample.mag,                          // observation
 				      Vector3f(R_MAG, R_MAG, R_MAG),           // observation variance
-				      mag_innov,                               // innovation
-				      innov_var,                               // innovation variance
+				      Vector3f(mag_innov),                     // innovation
+				      Vector3f(innov_var),                     // innovation variance
 				      math::max(_params.mag_innov_gate, 1.f)); // innovation gate
 
 		// Perform an innovation consistency check and report the result
@@ -377,8 +378,8 @@ bool Ekf::checkHaglYawResetReq() const
 void Ekf::resetMagStates(const Vector3f &mag, bool reset_heading)
 {
 	// reinit mag states
-	const Vector3f mag_I_before_reset = _state.mag_I;
-	const Vector3f mag_B_before_reset = _state.mag_B;
+	const Vector3f mag_I_before_reset = getMagEarthField();
+	const Vector3f mag_B_before_reset = getMagBias();
 
 	static constexpr float kMagEarthMinGauss = 0.01f; // minimum difference in mag earth field strength for reset (Gauss)
 
@@ -390,8 +391,8 @@ void Ekf::resetMagStates(const Vector3f &mag, bool reset_heading)
 		const Vector3f mag_I = _wmm_earth_field_gauss;
 		bool mag_I_reset = false;
 
-		if ((_state.mag_I - mag_I).longerThan(kMagEarthMinGauss)) {
-			_state.mag_I = mag_I;
+		if ((getMagEarthField() - mag_I).longerThan(kMagEarthMinGauss)) {
+			_state.mag_I = matrix::Vector3<StateScalar>(mag_I);
 			resetMagEarthCov();
 			mag_I_reset = true;
 		}
@@ -400,8 +401,8 @@ void Ekf::resetMagStates(const Vector3f &mag, bool reset_heading)
 		if (!reset_heading && _control_status.flags.yaw_align) {
 			if (mag_I_reset) {
 				// mag_B: reset using WMM
-				const Dcmf R_to_body = quatToInverseRotMat(_state.quat_nominal);
-				_state.mag_B = mag - (R_to_body * _wmm_earth_field_gauss);
+				const Dcmf R_to_body = quatToInverseRotMat(Quatf(_state.quat_nominal));
+				_state.mag_B = matrix::Vector3<StateScalar>(mag - (R_to_body * _wmm_earth_field_gauss));
 				resetMagBiasCov();
 			} // otherwise keep existing mag_B state (!mag_I_reset)
 
@@ -427,19 +428,19 @@ void Ekf::resetMagStates(const Vector3f &mag, bool reset_heading)
 		// mag_I: use the last magnetometer measurement to reset the field states
 		const Vector3f mag_I = _R_to_earth * mag;
 
-		if ((_state.mag_I - mag_I).longerThan(kMagEarthMinGauss)) {
-			_state.mag_I = mag_I;
+		if ((getMagEarthField() - mag_I).longerThan(kMagEarthMinGauss)) {
+			_state.mag_I = matrix::Vector3<StateScalar>(mag_I);
 			resetMagEarthCov();
 		}
 	}
 
-	if ((_state.mag_I - mag_I_before_reset).longerThan(0.f)) {
+	if ((getMagEarthField() - mag_I_before_reset).longerThan(0.f)) {
 		ECL_INFO("resetting mag I [%.3f, %.3f, %.3f] -> [%.3f, %.3f, %.3f]",
 			 (double)mag_I_before_reset(0), (double)mag_I_before_reset(1), (double)mag_I_before_reset(2),
 			 (double)_state.mag_I(0), (double)_state.mag_I(1), (double)_state.mag_I(2));
 	}
 
-	if ((_state.mag_B - mag_B_before_reset).longerThan(0.f)) {
+	if ((getMagBias() - mag_B_before_reset).longerThan(0.f)) {
 		ECL_INFO("resetting mag B [%.3f, %.3f, %.3f] -> [%.3f, %.3f, %.3f]",
 			 (double)mag_B_before_reset(0), (double)mag_B_before_reset(1), (double)mag_B_before_reset(2),
 			 (double)_state.mag_B(0), (double)_state.mag_B(1), (double)_state.mag_B(2));
@@ -459,7 +460,7 @@ void Ekf::checkMagHeadingConsistency(const magSample &mag_sample)
 	const Vector3f mag_bias_var = getMagBiasVariance();
 
 	if ((mag_bias_var.min() > 0.f) && (mag_bias_var.max() <= sq(_params.mag_noise))) {
-		mag_bias = _state.mag_B;
+		mag_bias = getMagBias();
 	}
 
 	// calculate mag heading
@@ -568,7 +569,7 @@ void Ekf::resetMagHeading(const Vector3f &mag)
 	const Vector3f mag_bias_var = getMagBiasVariance();
 
 	if ((mag_bias_var.min() > 0.f) && (mag_bias_var.max() <= sq(_params.mag_noise))) {
-		mag_bias = _state.mag_B;
+		mag_bias = getMagBias();
 	}
 
 	// calculate mag heading
@@ -68,11 +68,13 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 
 		} else if (index == 1) {
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeMagYInnovVarAndH(state_vector, P, R_MAG, FLT_EPSILON, &aid_src.innovation_variance[index], &H);
+			StateScalar innov_var;
+			sym::ComputeMagYInnovVarAndH<StateScalar>(state_vector, P, R_MAG, FLT_EPSILON, &innov_var, &H);
+			aid_src.innovation_variance[index] = innov_var;
 
 			// recalculate innovation using the updated state
-			aid_src.innovation[index] = _state.quat_nominal.rotateVectorInverse(_state.mag_I)(index) + _state.mag_B(index) - mag(
-							    index);
+			aid_src.innovation[index] = _state.quat_nominal.rotateVectorInverse(_state.mag_I)(index) + _state.mag_B(index)
+						    - static_cast<StateScalar>(mag(index));
 
 		} else if (index == 2) {
 			// we do not fuse synthesized magnetomter measurements when doing 3D fusion
@@ -81,11 +83,13 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 			}
 
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeMagZInnovVarAndH(state_vector, P, R_MAG, FLT_EPSILON, &aid_src.innovation_variance[index], &H);
+			StateScalar innov_var;
+			sym::ComputeMagZInnovVarAndH<StateScalar>(state_vector, P, R_MAG, FLT_EPSILON, &innov_var, &H);
+			aid_src.innovation_variance[index] = innov_var;
 
 			// recalculate innovation using the updated state
-			aid_src.innovation[index] = _state.quat_nominal.rotateVectorInverse(_state.mag_I)(index) + _state.mag_B(index) - mag(
-							    index);
+			aid_src.innovation[index] = _state.quat_nominal.rotateVectorInverse(_state.mag_I)(index) + _state.mag_B(index)
+						    - static_cast<StateScalar>(mag(index));
 		}
 
 		if (aid_src.innovation_variance[index] < R_MAG) {
@@ -114,8 +118,8 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 			// zero non-mag Kalman gains if not updating all states
 
 			// copy mag_I and mag_B Kalman gains
-			const Vector3f K_mag_I = Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0);
-			const Vector3f K_mag_B = Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0);
+			const matrix::Vector3<StateScalar> K_mag_I = Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0);
+			const matrix::Vector3<StateScalar> K_mag_B = Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0);
 
 			// zero all Kalman gains, then restore mag
 			Kfusion.setZero();
@@ -143,15 +147,15 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 bool Ekf::fuseDeclination(float decl_measurement_rad, float R, bool update_all_states)
 {
 	VectorState H;
-	float decl_pred;
-	float innovation_variance;
+	StateScalar decl_pred;
+	StateScalar innovation_variance;
 
-	sym::ComputeMagDeclinationPredInnovVarAndH(_state.vector(), P, R, FLT_EPSILON,
+	sym::ComputeMagDeclinationPredInnovVarAndH<StateScalar>(_state.vector(), P, R, FLT_EPSILON,
 			&decl_pred, &innovation_variance, &H);
 
-	const float innovation = wrap_pi(decl_pred - decl_measurement_rad);
+	const float innovation = wrap_pi(decl_pred - static_cast<StateScalar>(decl_measurement_rad));
 
-	if (innovation_variance < R) {
+	if (innovation_variance < static_cast<StateScalar>(R)) {
 		// variance calculation is badly conditioned
 		_fault_status.flags.bad_mag_decl = true;
 		return false;
@@ -164,8 +168,8 @@ bool Ekf::fuseDeclination(float decl_measurement_rad, float R, bool update_all_s
 		// zero non-mag Kalman gains if not updating all states
 
 		// copy mag_I and mag_B Kalman gains
-		const Vector3f K_mag_I = Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0);
-		const Vector3f K_mag_B = Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0);
+		const matrix::Vector3<StateScalar> K_mag_I = Kfusion.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0);
+		const matrix::Vector3<StateScalar> K_mag_B = Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0);
 
 		// zero all Kalman gains, then restore mag
 		Kfusion.setZero();
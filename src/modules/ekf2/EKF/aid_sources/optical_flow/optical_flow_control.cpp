@@ -103,8 +103,8 @@ void Ekf::controlOpticalFlowFusion(const imuSample &imu_delayed)
 		const float R_LOS = calcOptFlowMeasVar(flow_sample);
 
 		const float epsilon = 1e-3f;
-		Vector2f innov_var;
-		sym::ComputeFlowXyInnovVarAndHx(_state.vector(), P, R_LOS, epsilon, &innov_var, &H);
+		matrix::Vector2<StateScalar> innov_var;
+		sym::ComputeFlowXyInnovVarAndHx<StateScalar>(_state.vector(), P, R_LOS, epsilon, &innov_var, &H);
 
 		// run the innovation consistency check and record result
 		updateAidSourceStatus(_aid_src_optical_flow,
@@ -112,7 +112,7 @@ void Ekf::controlOpticalFlowFusion(const imuSample &imu_delayed)
 				      flow_compensated,                                    // observation
 				      Vector2f{R_LOS, R_LOS},                              // observation variance
 				      predictFlow(flow_gyro_corrected) - flow_compensated, // innovation
-				      innov_var,                                           // innovation variance
+				      Vector2f(innov_var),                                 // innovation variance
 				      math::max(_params.flow_innov_gate, 1.f));            // innovation gate
 
 		// logging
@@ -242,7 +242,7 @@ void Ekf::resetTerrainToFlow()
 
 	// TODO: use the flow data
 	const float new_terrain = -_gpos.altitude() + _params.rng_gnd_clearance;
-	const float delta_terrain = new_terrain - _state.terrain;
+	const float delta_terrain = new_terrain - static_cast<float>(_state.terrain);
 	_state.terrain = new_terrain;
 	P.uncorrelateCovarianceSetVariance<State::terrain.dof>(State::terrain.idx, 100.f);
 
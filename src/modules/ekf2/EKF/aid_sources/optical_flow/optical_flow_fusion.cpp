@@ -62,7 +62,9 @@ bool Ekf::fuseOptFlow(VectorState &H, const bool update_terrain)
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
 			const float R_LOS = _aid_src_optical_flow.observation_variance[1];
 			const float epsilon = 1e-3f;
-			sym::ComputeFlowYInnovVarAndH(state_vector, P, R_LOS, epsilon, &_aid_src_optical_flow.innovation_variance[1], &H);
+			StateScalar innov_var;
+			sym::ComputeFlowYInnovVarAndH<StateScalar>(state_vector, P, R_LOS, epsilon, &innov_var, &H);
+			_aid_src_optical_flow.innovation_variance[1] = innov_var;
 
 			// recalculate the innovation using the updated state
 			const Vector3f flow_gyro_corrected = _flow_sample_delayed.gyro_rate - _flow_gyro_bias;
@@ -150,10 +152,10 @@ Vector2f Ekf::predictFlow(const Vector3f &flow_gyro) const
 	const Vector3f vel_rel_imu_body = -flow_gyro % pos_offset_body;
 
 	// calculate the velocity of the sensor in the earth frame
-	const Vector3f vel_rel_earth = _state.vel + _R_to_earth * vel_rel_imu_body;
+	const Vector3f vel_rel_earth = Vector3f(_state.vel) + _R_to_earth * vel_rel_imu_body;
 
 	// rotate into body frame
-	const Vector2f vel_body = _state.quat_nominal.rotateVectorInverse(vel_rel_earth).xy();
+	const Vector2f vel_body = Quatf(_state.quat_nominal).rotateVectorInverse(vel_rel_earth).xy();
 
 	// calculate range from focal point to centre of image
 	const float scale = _R_to_earth(2, 2) / predictFlowHagl();
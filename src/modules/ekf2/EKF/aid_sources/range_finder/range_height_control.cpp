@@ -67,7 +67,8 @@ void Ekf::controlRangeHaglFusion(const imuSample &imu_sample)
 
 			if (_control_status.flags.in_air) {
 				const bool horizontal_motion = _control_status.flags.fixed_wing
-							       || (sq(_state.vel(0)) + sq(_state.vel(1)) > fmaxf(P.trace<2>(State::vel.idx), 0.1f));
+							       || (sq(_state.vel(0)) + sq(_state.vel(1))
+								   > static_cast<StateScalar>(fmaxf(P.trace<2>(State::vel.idx), 0.1f)));
 
 				const float dist_dependant_var = sq(_params.range_noise_scaler * _range_sensor.getDistBottom());
 				const float var = sq(_params.range_noise) + dist_dependant_var;
@@ -183,7 +184,7 @@ void Ekf::controlRangeHaglFusion(const imuSample &imu_sample)
 					ECL_WARN("%s height fusion reset required, all height sources failing", HGT_SRC_NAME);
 
 					_information_events.flags.reset_hgt_to_rng = true;
-					resetAltitudeTo(aid_src.observation - _state.terrain);
+					resetAltitudeTo(aid_src.observation - static_cast<float>(_state.terrain));
 					resetAidSourceStatusZeroInnovation(aid_src);
 
 					// reset vertical velocity if no valid sources available
@@ -245,8 +246,8 @@ void Ekf::updateRangeHagl(estimator_aid_source1d_s &aid_src)
 	const float measurement = math::max(_range_sensor.getDistBottom(), _params.rng_gnd_clearance);
 	const float measurement_variance = getRngVar();
 
-	float innovation_variance;
-	sym::ComputeHaglInnovVar(P, measurement_variance, &innovation_variance);
+	StateScalar innovation_variance;
+	sym::ComputeHaglInnovVar<StateScalar>(P, measurement_variance, &innovation_variance);
 
 	const float innov_gate = math::max(_params.range_innov_gate, 1.f);
 	updateAidSourceStatus(aid_src,
@@ -269,7 +270,7 @@ void Ekf::updateRangeHagl(estimator_aid_source1d_s &aid_src)
 float Ekf::getRngVar() const
 {
 	return fmaxf(
-		       P(State::pos.idx + 2, State::pos.idx + 2)
+		       static_cast<float>(P(State::pos.idx + 2, State::pos.idx + 2))
 		       + sq(_params.range_noise)
 		       + sq(_params.range_noise_scaler * _range_sensor.getRange()),
 		       0.f);
@@ -283,7 +284,7 @@ void Ekf::resetTerrainToRng(estimator_aid_source1d_s &aid_src)
 	// and create the correct correlation with the terrain state with a covariance update.
 	P.uncorrelateCovarianceSetVariance<State::terrain.dof>(State::terrain.idx, 0.f);
 
-	const float old_terrain = _state.terrain;
+	const StateScalar old_terrain = _state.terrain;
 
 	VectorState H;
 	sym::ComputeHaglH(&H);
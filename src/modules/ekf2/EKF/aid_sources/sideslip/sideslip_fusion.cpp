@@ -79,9 +79,9 @@ void Ekf::updateSideslip(estimator_aid_source1d_s &aid_src) const
 	float observation = 0.f;
 	const float R = math::max(sq(_params.beta_noise), sq(0.01f)); // observation noise variance
 	const float epsilon = 1e-3f;
-	float innov;
-	float innov_var;
-	sym::ComputeSideslipInnovAndInnovVar(_state.vector(), P, R, epsilon, &innov, &innov_var);
+	StateScalar innov;
+	StateScalar innov_var;
+	sym::ComputeSideslipInnovAndInnovVar<StateScalar>(_state.vector(), P, R, epsilon, &innov, &innov_var);
 
 	updateAidSourceStatus(aid_src,
 			      _time_delayed_us,                         // sample timestamp
@@ -128,11 +128,11 @@ bool Ekf::fuseSideslip(estimator_aid_source1d_s &sideslip)
 
 	const float epsilon = 1e-3f;
 
-	const VectorState H = sym::ComputeSideslipH(_state.vector(), epsilon);
+	const VectorState H = sym::ComputeSideslipH<StateScalar>(_state.vector(), epsilon);
 	VectorState K = P * H / sideslip.innovation_variance;
 
 	if (update_wind_only) {
-		const Vector2f K_wind = K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0);
+		const matrix::Vector2<StateScalar> K_wind = K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0);
 		K.setZero();
 		K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0) = K_wind;
 	}
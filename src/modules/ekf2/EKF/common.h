@@ -272,6 +272,10 @@ struct parameters {
 
 	float velocity_limit{100.f};           ///< velocity state limit (m/s)
 
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+	int32_t fls_length{0};                 ///< number of filter updates in the fixed-lag smoother window, 0 to disable
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
 	// measurement source control
 	int32_t height_sensor_ref{static_cast<int32_t>(HeightSensor::BARO)};
 	int32_t position_sensor_ref{static_cast<int32_t>(PositionSensor::GNSS)};
@@ -343,6 +347,7 @@ struct parameters {
 	float req_pdop{2.0f};                   ///< maximum acceptable position dilution of precision
 	float req_hdrift{0.3f};                 ///< maximum acceptable horizontal drift speed (m/s)
 	float req_vdrift{0.5f};                 ///< maximum acceptable vertical drift speed (m/s)
+	float req_gps_health{10.0f};            ///< minimum continuous period without GPS failure required to mark a healthy GPS (s)
 
 # if defined(CONFIG_EKF2_GNSS_YAW)
 	// GNSS heading fusion
@@ -467,6 +472,10 @@ struct parameters {
 	// XYZ offset of sensors in body axes (m)
 	Vector3f imu_pos_body{};                ///< xyz position of IMU in body frame (m)
 
+	// output predictor filter time constants
+	float vel_tau{0.25f};                   ///< velocity state correction time constant (sec)
+	float pos_tau{0.25f};                   ///< position state correction time constant (sec)
+
 	// accel bias learning control
 	float acc_bias_lim{0.4f};               ///< maximum accel bias magnitude (m/sec**2)
 	float acc_bias_learn_acc_lim{25.0f};    ///< learning is disabled if the magnitude of the IMU acceleration vector is greater than this (m/sec**2)
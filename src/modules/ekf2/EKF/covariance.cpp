@@ -61,7 +61,8 @@ void Ekf::initialiseCovariance()
 #else
 	const float vel_var = sq(0.5f);
 #endif
-	P.uncorrelateCovarianceSetVariance<State::vel.dof>(State::vel.idx, Vector3f(vel_var, vel_var, sq(1.5f) * vel_var));
+	P.uncorrelateCovarianceSetVariance<State::vel.dof>(State::vel.idx,
+			matrix::Vector3<StateScalar>(vel_var, vel_var, sq(1.5f) * vel_var));
 
 	// position
 #if defined(CONFIG_EKF2_BAROMETER)
@@ -89,7 +90,8 @@ void Ekf::initialiseCovariance()
 
 #endif // CONFIG_EKF2_RANGE_FINDER
 
-	P.uncorrelateCovarianceSetVariance<State::pos.dof>(State::pos.idx, Vector3f(xy_pos_var, xy_pos_var, z_pos_var));
+	P.uncorrelateCovarianceSetVariance<State::pos.dof>(State::pos.idx,
+			matrix::Vector3<StateScalar>(xy_pos_var, xy_pos_var, z_pos_var));
 
 	resetGyroBiasCov();
 
@@ -134,10 +136,10 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 	}
 
 	// calculate variances and upper diagonal covariances for quaternion, velocity, position and gyro bias states
-	P = sym::PredictCovariance(_state.vector(), P,
-				   imu_delayed.delta_vel / imu_delayed.delta_vel_dt, accel_var,
-				   imu_delayed.delta_ang / imu_delayed.delta_ang_dt, gyro_var,
-				   dt);
+	P = sym::PredictCovariance<StateScalar>(_state.vector(), P,
+						imu_delayed.delta_vel / imu_delayed.delta_vel_dt, accel_var,
+						imu_delayed.delta_ang / imu_delayed.delta_ang_dt, gyro_var,
+						dt);
 
 	// Construct the process noise variance diagonal for those states with a stationary process model
 	// These are kinematic states and their error growth is controlled separately by the IMU noise variances
@@ -145,12 +147,12 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 	// gyro bias: add process noise
 	{
 		const float gyro_bias_sig = dt * _params.gyro_bias_p_noise;
-		const float gyro_bias_process_noise = sq(gyro_bias_sig);
+		const StateScalar gyro_bias_process_noise = sq(gyro_bias_sig);
 
 		for (unsigned index = 0; index < State::gyro_bias.dof; index++) {
 			const unsigned i = State::gyro_bias.idx + index;
 
-			if (P(i, i) < gyro_var) {
+			if (P(i, i) < static_cast<StateScalar>(gyro_var)) {
 				P(i, i) += gyro_bias_process_noise;
 			}
 		}
@@ -159,12 +161,12 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 	// accel bias: add process noise
 	{
 		const float accel_bias_sig = dt * _params.accel_bias_p_noise;
-		const float accel_bias_process_noise = sq(accel_bias_sig);
+		const StateScalar accel_bias_process_noise = sq(accel_bias_sig);
 
 		for (unsigned index = 0; index < State::accel_bias.dof; index++) {
 			const unsigned i = State::accel_bias.idx + index;
 
-			if (P(i, i) < accel_var(index)) {
+			if (P(i, i) < static_cast<StateScalar>(accel_var(index))) {
 				P(i, i) += accel_bias_process_noise;
 			}
 		}
@@ -174,24 +176,25 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 	// mag_I: add process noise
 	float mag_I_sig = dt * _params.mage_p_noise;
-	float mag_I_process_noise = sq(mag_I_sig);
+	StateScalar mag_I_process_noise = sq(mag_I_sig);
+	const StateScalar mag_var = sq(_params.mag_noise);
 
 	for (unsigned index = 0; index < State::mag_I.dof; index++) {
 		const unsigned i = State::mag_I.idx + index;
 
-		if (P(i, i) < sq(_params.mag_noise)) {
+		if (P(i, i) < mag_var) {
 			P(i, i) += mag_I_process_noise;
 		}
 	}
 
 	// mag_B: add process noise
 	float mag_B_sig = dt * _params.magb_p_noise;
-	float mag_B_process_noise = sq(mag_B_sig);
+	StateScalar mag_B_process_noise = sq(mag_B_sig);
 
 	for (unsigned index = 0; index < State::mag_B.dof; index++) {
 		const unsigned i = State::mag_B.idx + index;
 
-		if (P(i, i) < sq(_params.mag_noise)) {
+		if (P(i, i) < mag_var) {
 			P(i, i) += mag_B_process_noise;
 		}
 	}
@@ -204,12 +207,13 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 	// wind vel: add process noise
 	const float height_rate = _height_rate_lpf.update(_state.vel(2), imu_delayed.delta_vel_dt);
 	const float wind_vel_nsd_scaled = _params.wind_vel_nsd * (1.f + _params.wind_vel_nsd_scaler * fabsf(height_rate));
-	const float wind_vel_process_noise = sq(wind_vel_nsd_scaled) * dt;
+	const StateScalar wind_vel_process_noise = sq(wind_vel_nsd_scaled) * dt;
+	const StateScalar wind_vel_var_max = sq(_params.initial_wind_uncertainty);
 
 	for (unsigned index = 0; index < State::wind_vel.dof; index++) {
 		const unsigned i = State::wind_vel.idx + index;
 
-		if (P(i, i) < sq(_params.initial_wind_uncertainty)) {
+		if (P(i, i) < wind_vel_var_max) {
 			P(i, i) += wind_vel_process_noise;
 		}
 	}
@@ -221,11 +225,11 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 	if (_height_sensor_ref != HeightSensor::RANGE) {
 		// predict the state variance growth where the state is the vertical position of the terrain underneath the vehicle
 		// process noise due to errors in vehicle height estimate
-		float terrain_process_noise = sq(imu_delayed.delta_vel_dt * _params.terrain_p_noise);
+		StateScalar terrain_process_noise = sq(imu_delayed.delta_vel_dt * _params.terrain_p_noise);
 
 		// process noise due to terrain gradient
-		terrain_process_noise += sq(imu_delayed.delta_vel_dt * _params.terrain_gradient) * (sq(_state.vel(0)) + sq(_state.vel(
-						 1)));
+		terrain_process_noise += static_cast<StateScalar>(sq(imu_delayed.delta_vel_dt * _params.terrain_gradient))
+					 * (sq(_state.vel(0)) + sq(_state.vel(1)));
 		P(State::terrain.idx, State::terrain.idx) += terrain_process_noise;
 	}
 
@@ -277,7 +281,7 @@ void Ekf::constrainStateVariances()
 #endif // CONFIG_EKF2_TERRAIN
 }
 
-void Ekf::constrainStateVar(const IdxDof &state, float min, float max)
+void Ekf::constrainStateVar(const IdxDof &state, StateScalar min, StateScalar max)
 {
 	for (unsigned i = state.idx; i < (state.idx + state.dof); i++) {
 		if (P(i, i) < min) {
@@ -287,8 +291,8 @@ void Ekf::constrainStateVar(const IdxDof &state, float min, float max)
 			// Constrain the variance growth by fusing zero innovation as clipping the variance
 			// would artifically increase the correlation between states and destabilize the filter.
 			const float innov = 0.f;
-			const float R = 10.f * P(i, i); // This reduces the variance by ~10% as K = P / (P + R)
-			const float innov_var = P(i, i) + R;
+			const float R = 10.f * static_cast<float>(P(i, i)); // This reduces the variance by ~10% as K = P / (P + R)
+			const float innov_var = static_cast<float>(P(i, i)) + R;
 			fuseDirectStateMeasurement(innov, innov_var, R, i);
 		}
 	}
@@ -297,7 +301,7 @@ void Ekf::constrainStateVar(const IdxDof &state, float min, float max)
 void Ekf::constrainStateVarLimitRatio(const IdxDof &state, float min, float max, float max_ratio)
 {
 	// the ratio of a max and min variance must not exceed max_ratio
-	float state_var_max = 0.f;
+	StateScalar state_var_max = 0.f;
 
 	for (unsigned i = state.idx; i < (state.idx + state.dof); i++) {
 		if (P(i, i) > state_var_max) {
@@ -305,8 +309,9 @@ void Ekf::constrainStateVarLimitRatio(const IdxDof &state, float min, float max,
 		}
 	}
 
-	float limited_max = math::constrain(state_var_max, min, max);
-	float limited_min = math::constrain(limited_max / max_ratio, min, max);
+	// keep the limits in the state precision, a rounded down limit would trigger the variance constraint again
+	StateScalar limited_max = math::constrain<StateScalar>(state_var_max, min, max);
+	StateScalar limited_min = math::constrain<StateScalar>(limited_max / static_cast<StateScalar>(max_ratio), min, max);
 
 	constrainStateVar(state, limited_min, limited_max);
 }
@@ -327,7 +332,8 @@ void Ekf::resetQuatCov(const float yaw_noise)
 
 void Ekf::resetQuatCov(const Vector3f &rot_var_ned)
 {
-	P.uncorrelateCovarianceSetVariance<State::quat_nominal.dof>(State::quat_nominal.idx, rot_var_ned);
+	P.uncorrelateCovarianceSetVariance<State::quat_nominal.dof>(State::quat_nominal.idx,
+			matrix::Vector3<StateScalar>(rot_var_ned));
 }
 
 void Ekf::resetGyroBiasCov()
@@ -165,11 +165,23 @@ bool Ekf::update()
 		predictCovariance(imu_sample_delayed);
 		predictState(imu_sample_delayed);
 
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+
+		if (_fixed_lag_smoother.valid()) {
+			_fixed_lag_smoother.setPrior(getFixedLagSmootherState(), getFixedLagSmootherCovariance());
+		}
+
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
 		// control fusion of observation data
 		controlFusionModes(imu_sample_delayed);
 
-		_output_predictor.correctOutputStates(imu_sample_delayed.time_us, _state.quat_nominal, _state.vel, _gpos,
-						      _state.gyro_bias, _state.accel_bias);
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+		updateFixedLagSmoother(imu_sample_delayed);
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
+		_output_predictor.correctOutputStates(imu_sample_delayed.time_us, Quatf(_state.quat_nominal), Vector3f(_state.vel),
+						      _gpos, getGyroBias(), getAccelBias());
 
 		return true;
 	}
@@ -205,7 +217,7 @@ bool Ekf::initialiseFilter()
 	initialiseCovariance();
 
 	// reset the output predictor state history to match the EKF initial values
-	_output_predictor.alignOutputFilter(_state.quat_nominal, _state.vel, _gpos);
+	_output_predictor.alignOutputFilter(Quatf(_state.quat_nominal), Vector3f(_state.vel), _gpos);
 
 	return true;
 }
@@ -222,8 +234,9 @@ bool Ekf::initialiseTilt()
 	}
 
 	// get initial tilt estimate from delta velocity vector, assuming vehicle is static
-	_state.quat_nominal = Quatf(_accel_lpf.getState(), Vector3f(0.f, 0.f, -1.f));
-	_R_to_earth = Dcmf(_state.quat_nominal);
+	const Quatf q(_accel_lpf.getState(), Vector3f(0.f, 0.f, -1.f));
+	_state.quat_nominal = matrix::Quaternion<StateScalar>(q);
+	_R_to_earth = Dcmf(q);
 
 	return true;
 }
@@ -242,11 +255,11 @@ void Ekf::predictState(const imuSample &imu_delayed)
 	// subtract component of angular rate due to earth rotation
 	corrected_delta_ang -= _R_to_earth.transpose() * _earth_rate_NED * imu_delayed.delta_ang_dt;
 
-	const Quatf dq(AxisAnglef{corrected_delta_ang});
+	const matrix::Quaternion<StateScalar> dq(matrix::AxisAngle<StateScalar> {corrected_delta_ang});
 
 	// rotate the previous quaternion by the delta quaternion using a quaternion multiplication
 	_state.quat_nominal = (_state.quat_nominal * dq).normalized();
-	_R_to_earth = Dcmf(_state.quat_nominal);
+	_R_to_earth = Dcmf(Quatf(_state.quat_nominal));
 
 	// Calculate an earth frame delta velocity
 	const Vector3f delta_vel_bias_scaled = getAccelBias() * imu_delayed.delta_vel_dt;
@@ -254,7 +267,7 @@ void Ekf::predictState(const imuSample &imu_delayed)
 	const Vector3f corrected_delta_vel_ef = _R_to_earth * corrected_delta_vel;
 
 	// save the previous value of velocity so we can use trapzoidal integration
-	const Vector3f vel_last = _state.vel;
+	const matrix::Vector3<StateScalar> vel_last = _state.vel;
 
 	// calculate the increment in velocity using the current orientation
 	_state.vel += corrected_delta_vel_ef;
@@ -262,15 +275,15 @@ void Ekf::predictState(const imuSample &imu_delayed)
 	// compensate for acceleration due to gravity, Coriolis and transport rate
 	const Vector3f gravity_acceleration(0.f, 0.f, CONSTANTS_ONE_G); // simplistic model
 	const Vector3f coriolis_acceleration = -2.f * _earth_rate_NED.cross(vel_last);
-	const Vector3f transport_rate = -_gpos.computeAngularRateNavFrame(vel_last).cross(vel_last);
+	const Vector3f transport_rate = -_gpos.computeAngularRateNavFrame(Vector3f(vel_last)).cross(vel_last);
 	_state.vel += (gravity_acceleration + coriolis_acceleration + transport_rate) * imu_delayed.delta_vel_dt;
 
 	// predict position states via trapezoidal integration of velocity
-	_gpos += (vel_last + _state.vel) * imu_delayed.delta_vel_dt * 0.5f;
+	_gpos += Vector3f((vel_last + _state.vel) * imu_delayed.delta_vel_dt * 0.5f);
 	_state.pos(2) = -_gpos.altitude();
 
 	// constrain states
-	_state.vel = matrix::constrain(_state.vel, -_params.velocity_limit, _params.velocity_limit);
+	_state.vel = matrix::constrain<StateScalar>(_state.vel, -_params.velocity_limit, _params.velocity_limit);
 
 	// calculate a filtered horizontal acceleration this are used for manoeuvre detection elsewhere
 	_accel_horiz_lpf.update(corrected_delta_vel_ef.xy() / imu_delayed.delta_vel_dt, imu_delayed.delta_vel_dt);
@@ -311,7 +324,7 @@ bool Ekf::resetGlobalPosToExternalObservation(const double latitude, const doubl
 		}
 
 		const float dt_s = dt_us * 1e-6f;
-		pos_correction = _state.vel * dt_s;
+		pos_correction = Vector3f(_state.vel * dt_s);
 	}
 
 	LatLonAlt gpos(latitude, longitude, altitude);
@@ -387,11 +400,74 @@ void Ekf::updateParameters()
 	_params.wind_vel_nsd = math::constrain(_params.wind_vel_nsd, 0.f, 1.f);
 #endif // CONFIG_EKF2_WIND
 
+#if defined(CONFIG_EKF2_GNSS)
+	_min_gps_health_time_us = static_cast<uint32_t>(math::max(_params.req_gps_health, 0.f) * 1e6f);
+#endif // CONFIG_EKF2_GNSS
+
+	_output_predictor.set_imu_offset(_params.imu_pos_body);
+	_output_predictor.set_pos_correction_tc(_params.pos_tau);
+	_output_predictor.set_vel_correction_tc(_params.vel_tau);
+
 #if defined(CONFIG_EKF2_AUX_GLOBAL_POSITION) && defined(MODULE_NAME)
 	_aux_global_position.updateParameters();
 #endif // CONFIG_EKF2_AUX_GLOBAL_POSITION
+
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+	_params.fls_length = math::constrain(_params.fls_length, (int32_t)0, (int32_t)FixedLagSmoother::kMaxLength);
+	_fixed_lag_smoother.allocate(_params.fls_length);
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+}
+
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+FixedLagSmoother::VectorSmoother Ekf::getFixedLagSmootherState() const
+{
+	const Vector2f pos_ne = getLocalHorizontalPosition();
+
+	FixedLagSmoother::VectorSmoother x;
+	x(0) = pos_ne(0);
+	x(1) = pos_ne(1);
+	x(2) = static_cast<float>(_state.pos(2)) + getEkfGlobalOriginAltitude();
+	x(3) = _state.vel(0);
+	x(4) = _state.vel(1);
+	x(5) = _state.vel(2);
+	return x;
 }
 
+FixedLagSmoother::SquareMatrixSmoother Ekf::getFixedLagSmootherCovariance() const
+{
+	FixedLagSmoother::SquareMatrixSmoother cov;
+	cov.slice<3, 3>(0, 0) = Matrix3f(matrix::SquareMatrix<StateScalar, 3>(P.slice<3, 3>(State::pos.idx, State::pos.idx)));
+	cov.slice<3, 3>(0, 3) = Matrix3f(matrix::SquareMatrix<StateScalar, 3>(P.slice<3, 3>(State::pos.idx, State::vel.idx)));
+	cov.slice<3, 3>(3, 0) = Matrix3f(matrix::SquareMatrix<StateScalar, 3>(P.slice<3, 3>(State::vel.idx, State::pos.idx)));
+	cov.slice<3, 3>(3, 3) = Matrix3f(matrix::SquareMatrix<StateScalar, 3>(P.slice<3, 3>(State::vel.idx, State::vel.idx)));
+	return cov;
+}
+
+void Ekf::updateFixedLagSmoother(const imuSample &imu_delayed)
+{
+	if (!_fixed_lag_smoother.valid()) {
+		return;
+	}
+
+	const StateResetCounts &reset_count = _state_reset_status.reset_count;
+
+	// the history is not consistent across position or velocity discontinuities
+	if ((reset_count.posNE != _fixed_lag_smoother_reset_count.posNE)
+	    || (reset_count.posD != _fixed_lag_smoother_reset_count.posD)
+	    || (reset_count.velNE != _fixed_lag_smoother_reset_count.velNE)
+	    || (reset_count.velD != _fixed_lag_smoother_reset_count.velD)
+	    || !_local_origin_lat_lon.isInitialized()) {
+
+		_fixed_lag_smoother.reset();
+		_fixed_lag_smoother_reset_count = reset_count;
+		return;
+	}
+
+	_fixed_lag_smoother.push(imu_delayed.time_us, imu_delayed.delta_vel_dt,
+				 getFixedLagSmootherState(), getFixedLagSmootherCovariance());
+}
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
 template<typename T>
 static void printRingBuffer(const char *name, RingBuffer<T> *rb)
 {
@@ -410,9 +486,9 @@ void Ekf::print_status()
 	       State::quat_nominal.idx, State::quat_nominal.idx + State::quat_nominal.dof - 1,
 	       (double)_state.quat_nominal(0), (double)_state.quat_nominal(1), (double)_state.quat_nominal(2),
 	       (double)_state.quat_nominal(3),
-	       (double)math::degrees(matrix::Eulerf(_state.quat_nominal).phi()),
-	       (double)math::degrees(matrix::Eulerf(_state.quat_nominal).theta()),
-	       (double)math::degrees(matrix::Eulerf(_state.quat_nominal).psi()),
+	       (double)math::degrees(matrix::Eulerf(Quatf(_state.quat_nominal)).phi()),
+	       (double)math::degrees(matrix::Eulerf(Quatf(_state.quat_nominal)).theta()),
+	       (double)math::degrees(matrix::Eulerf(Quatf(_state.quat_nominal)).psi()),
 	       (double)getStateVariance<State::quat_nominal>()(0), (double)getStateVariance<State::quat_nominal>()(1),
 	       (double)getStateVariance<State::quat_nominal>()(2)
 	      );
@@ -525,4 +601,8 @@ void Ekf::print_status()
 
 
 	_output_predictor.print_status();
+
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+	_fixed_lag_smoother.print_status();
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
 }
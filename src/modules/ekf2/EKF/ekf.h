@@ -66,14 +66,30 @@
 # include "aid_sources/aux_global_position/aux_global_position.hpp"
 #endif // CONFIG_EKF2_AUX_GLOBAL_POSITION
 
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+# include "fixed_lag_smoother/fixed_lag_smoother.h"
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
+namespace estimator
+{
+// scalar type of the state and covariance
+#if defined(CONFIG_EKF2_DOUBLE_PRECISION)
+typedef double StateScalar;
+#else
+typedef float StateScalar;
+#endif // CONFIG_EKF2_DOUBLE_PRECISION
+
+typedef StateSampleT<StateScalar> StateSample;
+}
+
 enum class Likelihood { LOW, MEDIUM, HIGH };
 class ExternalVisionVel;
 
 class Ekf final : public EstimatorInterface
 {
 public:
-	typedef matrix::Vector<float, State::size> VectorState;
-	typedef matrix::SquareMatrix<float, State::size> SquareMatrixState;
+	typedef matrix::Vector<StateScalar, State::size> VectorState;
+	typedef matrix::SquareMatrix<StateScalar, State::size> SquareMatrixState;
 
 	Ekf()
 	{
@@ -92,6 +108,13 @@ public:
 
 	const StateSample &state() const { return _state; }
 
+	// get the state vector in single precision (for publication and logging)
+	matrix::Vector<float, sizeof(StateSample) / sizeof(StateScalar)> getStateVector() const { return matrix::Vector<float, sizeof(StateSample) / sizeof(StateScalar)>(_state.vector()); }
+
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+	FixedLagSmoother &fixed_lag_smoother() { return _fixed_lag_smoother; }
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
 #if defined(CONFIG_EKF2_BAROMETER)
 	const auto &aid_src_baro_hgt() const { return _aid_src_baro_hgt; }
 	const BiasEstimator::status &getBaroBiasEstimatorStatus() const { return _baro_b_est.getStatus(); }
@@ -102,8 +125,8 @@ public:
 	bool isTerrainEstimateValid() const { return _terrain_valid; }
 
 	// get the estimated terrain vertical position relative to the NED origin
-	float getTerrainVertPos() const { return _state.terrain + getEkfGlobalOriginAltitude(); };
-	float getHagl() const { return _state.terrain + _gpos.altitude(); }
+	float getTerrainVertPos() const { return static_cast<float>(_state.terrain) + getEkfGlobalOriginAltitude(); };
+	float getHagl() const { return static_cast<float>(_state.terrain) + _gpos.altitude(); }
 
 	// get the terrain variance
 	float getTerrainVariance() const { return P(State::terrain.idx, State::terrain.idx); }
@@ -150,7 +173,7 @@ public:
 
 #if defined(CONFIG_EKF2_WIND)
 	// get the wind velocity in m/s
-	const Vector2f &getWindVelocity() const { return _state.wind_vel; };
+	Vector2f getWindVelocity() const { return Vector2f(_state.wind_vel); };
 	Vector2f getWindVelocityVariance() const { return getStateVariance<State::wind_vel>(); }
 
 	/**
@@ -166,17 +189,17 @@ public:
 #endif // CONFIG_EKF2_WIND
 
 	template <const IdxDof &S>
-	matrix::Vector<float, S.dof>getStateVariance() const { return P.slice<S.dof, S.dof>(S.idx, S.idx).diag(); } // calling getStateCovariance().diag() uses more flash space
+	matrix::Vector<float, S.dof>getStateVariance() const { return matrix::Vector<float, S.dof>(P.slice<S.dof, S.dof>(S.idx, S.idx).diag()); } // calling getStateCovariance().diag() uses more flash space
 
 	template <const IdxDof &S>
-	matrix::SquareMatrix<float, S.dof>getStateCovariance() const { return P.slice<S.dof, S.dof>(S.idx, S.idx); }
+	matrix::SquareMatrix<float, S.dof>getStateCovariance() const { return matrix::SquareMatrix<float, S.dof>(matrix::SquareMatrix<StateScalar, S.dof>(P.slice<S.dof, S.dof>(S.idx, S.idx))); }
 
 	// get the full covariance matrix
-	const matrix::SquareMatrix<float, State::size> &covariances() const { return P; }
+	const SquareMatrixState &covariances() const { return P; }
 	float stateCovariance(unsigned r, unsigned c) const { return P(r, c); }
 
 	// get the diagonal elements of the covariance matrix
-	matrix::Vector<float, State::size> covariances_diagonal() const { return P.diag(); }
+	matrix::Vector<float, State::size> covariances_diagonal() const { return matrix::Vector<float, State::size>(P.diag()); }
 
 	matrix::Vector3f getRotVarBody() const;
 	matrix::Vector3f getRotVarNed() const;
@@ -263,20 +286,20 @@ public:
 	bool measurementUpdate(VectorState &K, const VectorState &H, const float R, const float innovation);
 
 	// gyro bias
-	const Vector3f &getGyroBias() const { return _state.gyro_bias; } // get the gyroscope bias in rad/s
+	Vector3f getGyroBias() const { return Vector3f(_state.gyro_bias); } // get the gyroscope bias in rad/s
 	Vector3f getGyroBiasVariance() const { return getStateVariance<State::gyro_bias>(); } // get the gyroscope bias variance in rad/s
 	float getGyroBiasLimit() const { return _params.gyro_bias_lim; }
 	float getGyroNoise() const { return _params.gyro_noise; }
 
 	// accel bias
-	const Vector3f &getAccelBias() const { return _state.accel_bias; } // get the accelerometer bias in m/s**2
+	Vector3f getAccelBias() const { return Vector3f(_state.accel_bias); } // get the accelerometer bias in m/s**2
 	Vector3f getAccelBiasVariance() const { return getStateVariance<State::accel_bias>(); } // get the accelerometer bias variance in m/s**2
 	float getAccelBiasLimit() const { return _params.acc_bias_lim; }
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
-	const Vector3f &getMagEarthField() const { return _state.mag_I; }
+	Vector3f getMagEarthField() const { return Vector3f(_state.mag_I); }
 
-	const Vector3f &getMagBias() const { return _state.mag_B; }
+	Vector3f getMagBias() const { return Vector3f(_state.mag_B); }
 	Vector3f getMagBiasVariance() const { return getStateVariance<State::mag_B>(); } // get the mag bias variance in Gauss
 	float getMagBiasLimit() const { return 0.5f; } // 0.5 Gauss
 #endif // CONFIG_EKF2_MAGNETOMETER
@@ -467,6 +490,17 @@ private:
 	StateResets _state_reset_status{};	///< reset event monitoring structure containing velocity, position, height and yaw reset information
 	StateResetCounts _state_reset_count_prev{};
 
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+	FixedLagSmoother _fixed_lag_smoother{};
+	StateResetCounts _fixed_lag_smoother_reset_count{}; ///< reset counts at the last smoother update
+
+	// NED position and velocity at the delayed time horizon and their covariance, smoother ordering
+	FixedLagSmoother::VectorSmoother getFixedLagSmootherState() const;
+	FixedLagSmoother::SquareMatrixSmoother getFixedLagSmootherCovariance() const;
+
+	void updateFixedLagSmoother(const imuSample &imu_delayed);
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
 	StateSample _state{};		///< state struct of the ekf running at the delayed time horizon
 
 	LatLonAlt _gpos{0.0, 0.0, 0.f};
@@ -643,7 +677,7 @@ private:
 	void predictCovariance(const imuSample &imu_delayed);
 
 	template <const IdxDof &S>
-	void resetStateCovariance(const matrix::SquareMatrix<float, S.dof> &cov)
+	void resetStateCovariance(const matrix::SquareMatrix<StateScalar, S.dof> &cov)
 	{
 		P.uncorrelateCovarianceSetVariance<S.dof>(S.idx, 0.0f);
 		P.slice<S.dof, S.dof>(S.idx, S.idx) = cov;
@@ -748,7 +782,11 @@ private:
 
 #if defined(CONFIG_EKF2_TERRAIN)
 	void initTerrain();
-	float getTerrainVPos() const { return isTerrainEstimateValid() ? _state.terrain : _last_on_ground_posD; }
+	float getTerrainVPos() const
+	{
+		return isTerrainEstimateValid() ? static_cast<float>(_state.terrain) : _last_on_ground_posD;
+	}
+
 	void controlTerrainFakeFusion();
 
 	void updateTerrainValidity();
@@ -810,7 +848,7 @@ private:
 	// limit the diagonal of the covariance matrix
 	void constrainStateVariances();
 
-	void constrainStateVar(const IdxDof &state, float min, float max);
+	void constrainStateVar(const IdxDof &state, StateScalar min, StateScalar max);
 	void constrainStateVarLimitRatio(const IdxDof &state, float min, float max, float max_ratio = 1.e6f);
 
 	// generic function which will perform a fusion step given a kalman gain K
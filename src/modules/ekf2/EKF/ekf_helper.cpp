@@ -736,17 +736,18 @@ uint16_t Ekf::get_ekf_soln_status() const
 void Ekf::fuse(const VectorState &K, float innovation)
 {
 	// quat_nominal
-	Quatf delta_quat(matrix::AxisAnglef(K.slice<State::quat_nominal.dof, 1>(State::quat_nominal.idx,
-					    0) * (-1.f * innovation)));
+	matrix::Quaternion<StateScalar> delta_quat(matrix::AxisAngle<StateScalar>(K.slice<State::quat_nominal.dof, 1>
+			(State::quat_nominal.idx, 0) * (-1.f * innovation)));
 	_state.quat_nominal = delta_quat * _state.quat_nominal;
 	_state.quat_nominal.normalize();
-	_R_to_earth = Dcmf(_state.quat_nominal);
+	_R_to_earth = Dcmf(Quatf(_state.quat_nominal));
 
 	// vel
-	_state.vel = matrix::constrain(_state.vel - K.slice<State::vel.dof, 1>(State::vel.idx, 0) * innovation, -1.e3f, 1.e3f);
+	_state.vel = matrix::constrain<StateScalar>(_state.vel - K.slice<State::vel.dof, 1>(State::vel.idx, 0) * innovation,
+			-1.e3f, 1.e3f);
 
 	// pos
-	const Vector3f pos_correction = K.slice<State::pos.dof, 1>(State::pos.idx, 0) * (-innovation);
+	const Vector3f pos_correction(K.slice<State::pos.dof, 1>(State::pos.idx, 0) * (-innovation));
 
 	// Accumulate position in global coordinates
 	_gpos += pos_correction;
@@ -755,12 +756,12 @@ void Ekf::fuse(const VectorState &K, float innovation)
 	_state.pos(2) = -_gpos.altitude();
 
 	// gyro_bias
-	_state.gyro_bias = matrix::constrain(_state.gyro_bias - K.slice<State::gyro_bias.dof, 1>(State::gyro_bias.idx,
+	_state.gyro_bias = matrix::constrain<StateScalar>(_state.gyro_bias - K.slice<State::gyro_bias.dof, 1>(State::gyro_bias.idx,
 					     0) * innovation,
 					     -getGyroBiasLimit(), getGyroBiasLimit());
 
 	// accel_bias
-	_state.accel_bias = matrix::constrain(_state.accel_bias - K.slice<State::accel_bias.dof, 1>(State::accel_bias.idx,
+	_state.accel_bias = matrix::constrain<StateScalar>(_state.accel_bias - K.slice<State::accel_bias.dof, 1>(State::accel_bias.idx,
 					      0) * innovation,
 					      -getAccelBiasLimit(), getAccelBiasLimit());
 
@@ -768,9 +769,9 @@ void Ekf::fuse(const VectorState &K, float innovation)
 
 	// mag_I, mag_B
 	if (_control_status.flags.mag) {
-		_state.mag_I = matrix::constrain(_state.mag_I - K.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0) * innovation, -1.f,
+		_state.mag_I = matrix::constrain<StateScalar>(_state.mag_I - K.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0) * innovation, -1.f,
 						 1.f);
-		_state.mag_B = matrix::constrain(_state.mag_B - K.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0) * innovation,
+		_state.mag_B = matrix::constrain<StateScalar>(_state.mag_B - K.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0) * innovation,
 						 -getMagBiasLimit(), getMagBiasLimit());
 	}
 
@@ -780,14 +781,15 @@ void Ekf::fuse(const VectorState &K, float innovation)
 
 	// wind_vel
 	if (_control_status.flags.wind) {
-		_state.wind_vel = matrix::constrain(_state.wind_vel - K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx,
+		_state.wind_vel = matrix::constrain<StateScalar>(_state.wind_vel - K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx,
 						    0) * innovation, -1.e2f, 1.e2f);
 	}
 
 #endif // CONFIG_EKF2_WIND
 
 #if defined(CONFIG_EKF2_TERRAIN)
-	_state.terrain = math::constrain(_state.terrain - K(State::terrain.idx) * innovation, -1e4f, 1e4f);
+	const StateScalar terrain_correction = K(State::terrain.idx) * static_cast<StateScalar>(innovation);
+	_state.terrain = math::constrain<StateScalar>(_state.terrain - terrain_correction, -1e4f, 1e4f);
 #endif // CONFIG_EKF2_TERRAIN
 }
 
@@ -1032,7 +1034,7 @@ void Ekf::fuseDirectStateMeasurement(const float innov, const float innov_var, c
 
 	// calculate kalman gain K = PHS, where S = 1/innovation variance
 	for (int row = 0; row < State::size; row++) {
-		K(row) = P(row, state_index) / innov_var;
+		K(row) = P(row, state_index) / static_cast<StateScalar>(innov_var);
 	}
 
 	clearInhibitedStateKalmanGains(K);
@@ -1040,7 +1042,7 @@ void Ekf::fuseDirectStateMeasurement(const float innov, const float innov_var, c
 #if false
 	// Matrix implementation of the Joseph stabilized covariance update
 	// This is extremely expensive to compute. Use for debugging purposes only.
-	auto A = matrix::eye<float, State::size>();
+	auto A = matrix::eye<StateScalar, State::size>();
 	VectorState H;
 	H(state_index) = 1.f;
 	A -= K.multiplyByTranspose(H);
@@ -1073,7 +1075,7 @@ void Ekf::fuseDirectStateMeasurement(const float innov, const float innov_var, c
 
 	for (unsigned i = 0; i < State::size; i++) {
 		for (unsigned j = 0; j <= i; j++) {
-			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
+			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * static_cast<StateScalar>(R) * K(j);
 			P(j, i) = P(i, j);
 		}
 	}
@@ -1093,7 +1095,7 @@ bool Ekf::measurementUpdate(VectorState &K, const VectorState &H, const float R,
 #if false
 	// Matrix implementation of the Joseph stabilized covariance update
 	// This is extremely expensive to compute. Use for debugging purposes only.
-	auto A = matrix::eye<float, State::size>();
+	auto A = matrix::eye<StateScalar, State::size>();
 	A -= K.multiplyByTranspose(H);
 	P = A * P;
 	P = P.multiplyByTranspose(A);
@@ -1123,7 +1125,7 @@ bool Ekf::measurementUpdate(VectorState &K, const VectorState &H, const float R,
 
 	for (unsigned i = 0; i < State::size; i++) {
 		for (unsigned j = 0; j <= i; j++) {
-			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
+			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * static_cast<StateScalar>(R) * K(j);
 			P(j, i) = P(i, j);
 		}
 	}
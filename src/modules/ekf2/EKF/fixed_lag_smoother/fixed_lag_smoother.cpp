@@ -0,0 +1,221 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "fixed_lag_smoother.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+bool FixedLagSmoother::allocate(uint8_t lag_length)
+{
+	if (lag_length > kMaxLength) {
+		lag_length = kMaxLength;
+	}
+
+	if ((lag_length == _lag_length) && (valid() || (lag_length == 0))) {
+		// no change
+		return true;
+	}
+
+	delete[] _buffer;
+	_buffer = nullptr;
+	_size = 0;
+	_lag_length = 0;
+
+	if (lag_length < 2) {
+		// disabled
+		reset();
+		return lag_length == 0;
+	}
+
+	// one entry is pushed per filter update while a pass is running, which takes
+	// (lag_length - 1) / kStepsPerUpdate updates to complete
+	const uint16_t size = lag_length + (lag_length / kStepsPerUpdate) + 2;
+
+	_buffer = new Entry[size] {};
+
+	if (_buffer == nullptr) {
+		return false;
+	}
+
+	_size = size;
+	_lag_length = lag_length;
+
+	reset();
+
+	return true;
+}
+
+void FixedLagSmoother::reset()
+{
+	_first_valid = _count;
+	_prior_pending = false;
+	_new_entry = false;
+	_pass_active = false;
+	_output_updated = false;
+}
+
+void FixedLagSmoother::setPrior(const VectorSmoother &x, const SquareMatrixSmoother &P)
+{
+	_x_prior_pending = x;
+	_P_prior_pending = P;
+	_prior_pending = true;
+}
+
+void FixedLagSmoother::push(uint64_t time_us, float dt, const VectorSmoother &x, const SquareMatrixSmoother &P)
+{
+	if (!valid()) {
+		return;
+	}
+
+	Entry &e = entry(_count);
+	e.time_us = time_us;
+	e.dt = dt;
+	e.x_post = x;
+	e.P_post = P;
+
+	if (_prior_pending) {
+		e.x_prior = _x_prior_pending;
+		e.P_prior = _P_prior_pending;
+
+	} else {
+		// only the first entry after a reset, its prior is never used
+		e.x_prior = x;
+		e.P_prior = P;
+	}
+
+	_prior_pending = false;
+
+	_count++;
+	_new_entry = true;
+}
+
+void FixedLagSmoother::startPass()
+{
+	if (!_new_entry || (_count - _first_valid < _lag_length)) {
+		return;
+	}
+
+	_pass_index = _count - 1;
+	_pass_last = _count - _lag_length;
+
+	const Entry &newest = entry(_pass_index);
+	_x_smooth = newest.x_post;
+	_P_smooth = newest.P_post;
+
+	_pass_active = true;
+	_new_entry = false;
+}
+
+void FixedLagSmoother::update()
+{
+	if (!valid()) {
+		return;
+	}
+
+	if (!_pass_active) {
+		startPass();
+
+		if (!_pass_active) {
+			return;
+		}
+	}
+
+	for (uint8_t step = 0; (step < kStepsPerUpdate) && (_pass_index > _pass_last); step++) {
+		const uint32_t k = _pass_index - 1;
+
+		// the entry may have been overwritten or invalidated by a reset while the pass was running
+		if (!isAvailable(k)) {
+			_pass_active = false;
+			_pass_aborted_count++;
+			return;
+		}
+
+		const Entry &e = entry(k);
+		const Entry &e_next = entry(k + 1);
+
+		// constant velocity transition from k to k + 1
+		SquareMatrixSmoother F;
+		F.setIdentity();
+		F(0, 3) = e_next.dt;
+		F(1, 4) = e_next.dt;
+		F(2, 5) = e_next.dt;
+
+		SquareMatrixSmoother P_prior_inv;
+
+		if (!matrix::inv(e_next.P_prior, P_prior_inv)) {
+			_pass_active = false;
+			_pass_aborted_count++;
+			return;
+		}
+
+		// smoother gain
+		const SquareMatrixSmoother C = e.P_post * F.transpose() * P_prior_inv;
+
+		_x_smooth = e.x_post + C * (_x_smooth - e_next.x_prior);
+		_P_smooth = e.P_post + C * (_P_smooth - e_next.P_prior) * C.transpose();
+		_P_smooth.makeBlockSymmetric<kStateDim>(0);
+
+		_pass_index = k;
+	}
+
+	if (_pass_index == _pass_last) {
+		const Entry &oldest = entry(_pass_last);
+
+		_output.time_us = oldest.time_us;
+		_output.pos = matrix::Vector3f(_x_smooth(0), _x_smooth(1), _x_smooth(2));
+		_output.vel = matrix::Vector3f(_x_smooth(3), _x_smooth(4), _x_smooth(5));
+		_output.pos_var = matrix::Vector3f(_P_smooth(0, 0), _P_smooth(1, 1), _P_smooth(2, 2));
+		_output.vel_var = matrix::Vector3f(_P_smooth(3, 3), _P_smooth(4, 4), _P_smooth(5, 5));
+		_output_updated = true;
+
+		_pass_active = false;
+	}
+}
+
+bool FixedLagSmoother::getOutput(Output &output)
+{
+	if (_output_updated) {
+		output = _output;
+		_output_updated = false;
+		return true;
+	}
+
+	return false;
+}
+
+void FixedLagSmoother::print_status() const
+{
+	printf("[fixed lag smoother] lag: %d updates, buffer: %d entries (%d Bytes), aborted passes: %" PRIu32 "\n",
+	       _lag_length, _size, get_total_size(), _pass_aborted_count);
+}
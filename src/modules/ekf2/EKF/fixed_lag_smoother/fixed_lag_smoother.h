@@ -0,0 +1,151 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file fixed_lag_smoother.h
+ * Fixed-lag Rauch-Tung-Striebel smoother running behind the EKF delayed time horizon.
+ *
+ * The smoother keeps the prior and posterior NED position and velocity estimates
+ * of the last N filter updates together with their marginal covariances. Once the
+ * history is full, a backward RTS pass is run from the newest to the oldest entry.
+ * The pass is split into a bounded number of steps per call so that its cost is
+ * spread over several work queue cycles and never adds latency to the EKF outputs.
+ *
+ * Only the position/velocity block of the EKF state is smoothed, using the constant
+ * velocity transition between consecutive updates. The coupling to attitude and IMU
+ * bias errors is captured through the EKF prior covariance of that block only.
+ */
+
+#ifndef EKF_FIXED_LAG_SMOOTHER_H
+#define EKF_FIXED_LAG_SMOOTHER_H
+
+#include <inttypes.h>
+#include <matrix/math.hpp>
+
+class FixedLagSmoother
+{
+public:
+	static constexpr uint8_t kStateDim = 6; // NED position (0-2) and velocity (3-5)
+	static constexpr uint8_t kMaxLength = 100;
+	static constexpr uint8_t kStepsPerUpdate = 10; // max backward steps per update() call
+
+	typedef matrix::Vector<float, kStateDim> VectorSmoother;
+	typedef matrix::SquareMatrix<float, kStateDim> SquareMatrixSmoother;
+
+	struct Output {
+		uint64_t time_us{0};
+		matrix::Vector3f pos{};
+		matrix::Vector3f vel{};
+		matrix::Vector3f pos_var{};
+		matrix::Vector3f vel_var{};
+	};
+
+	FixedLagSmoother() = default;
+	~FixedLagSmoother() { delete[] _buffer; }
+
+	// no copy, assignment, move, move assignment
+	FixedLagSmoother(const FixedLagSmoother &) = delete;
+	FixedLagSmoother &operator=(const FixedLagSmoother &) = delete;
+	FixedLagSmoother(FixedLagSmoother &&) = delete;
+	FixedLagSmoother &operator=(FixedLagSmoother &&) = delete;
+
+	/*
+	* Set the number of filter updates covered by the smoothing window.
+	* Storage for the window and for the updates arriving during a backward pass is allocated
+	* here only, a length of 0 disables the smoother and releases the storage.
+	*/
+	bool allocate(uint8_t lag_length);
+
+	bool valid() const { return _buffer != nullptr; }
+
+	// discard the history, e.g. after a state reset
+	void reset();
+
+	// store the predicted (prior) state and covariance of the current filter update
+	void setPrior(const VectorSmoother &x, const SquareMatrixSmoother &P);
+
+	// complete the current filter update with the fused (posterior) state and covariance
+	void push(uint64_t time_us, float dt, const VectorSmoother &x, const SquareMatrixSmoother &P);
+
+	// run at most kStepsPerUpdate steps of the backward pass
+	void update();
+
+	// returns true once for each new smoothed estimate
+	bool getOutput(Output &output);
+
+	uint8_t get_length() const { return _lag_length; }
+	int get_total_size() const { return sizeof(*this) + sizeof(Entry) * _size; }
+
+	void print_status() const;
+
+private:
+	struct Entry {
+		uint64_t time_us{0};
+		float dt{0.f};                 ///< time elapsed since the previous entry (s)
+		VectorSmoother x_prior{};
+		VectorSmoother x_post{};
+		SquareMatrixSmoother P_prior{};
+		SquareMatrixSmoother P_post{};
+	};
+
+	bool isAvailable(uint32_t n) const { return (n >= _first_valid) && (n < _count) && (_count - n <= _size); }
+	Entry &entry(uint32_t n) { return _buffer[n % _size]; }
+
+	void startPass();
+
+	Entry *_buffer{nullptr};
+	uint16_t _size{0};             ///< allocated entries, lag length plus updates pushed during a pass
+	uint8_t _lag_length{0};
+
+	uint32_t _count{0};            ///< total number of entries pushed
+	uint32_t _first_valid{0};      ///< index of the oldest entry since the last reset
+
+	VectorSmoother _x_prior_pending{};
+	SquareMatrixSmoother _P_prior_pending{};
+	bool _prior_pending{false};
+	bool _new_entry{false};        ///< an entry was pushed since the last pass was started
+
+	// backward pass
+	bool _pass_active{false};
+	uint32_t _pass_index{0};       ///< entry holding the current smoothed estimate
+	uint32_t _pass_last{0};        ///< entry at which the pass ends
+	VectorSmoother _x_smooth{};
+	SquareMatrixSmoother _P_smooth{};
+
+	Output _output{};
+	bool _output_updated{false};
+
+	uint32_t _pass_aborted_count{0};
+};
+
+#endif // !EKF_FIXED_LAG_SMOOTHER_H
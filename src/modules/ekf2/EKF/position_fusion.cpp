@@ -212,7 +212,7 @@ void Ekf::resetAltitudeTo(const float new_altitude, float new_vert_pos_var)
 
 #if defined(CONFIG_EKF2_TERRAIN)
 	updateTerrainResetStatus(delta_z);
-	_state.terrain += delta_z;
+	_state.terrain += static_cast<StateScalar>(delta_z);
 #endif // CONFIG_EKF2_TERRAIN
 
 	// Reset the timout timer
@@ -9,37 +9,39 @@
 
 namespace estimator
 {
-struct StateSample {
-	matrix::Quaternion<float> quat_nominal{};
-	matrix::Vector3<float> vel{};
-	matrix::Vector3<float> pos{};
-	matrix::Vector3<float> gyro_bias{};
-	matrix::Vector3<float> accel_bias{};
-	matrix::Vector3<float> mag_I{};
-	matrix::Vector3<float> mag_B{};
-	matrix::Vector2<float> wind_vel{};
-	float terrain{};
+template<typename Scalar>
+struct StateSampleT {
+	matrix::Quaternion<Scalar> quat_nominal{};
+	matrix::Vector3<Scalar> vel{};
+	matrix::Vector3<Scalar> pos{};
+	matrix::Vector3<Scalar> gyro_bias{};
+	matrix::Vector3<Scalar> accel_bias{};
+	matrix::Vector3<Scalar> mag_I{};
+	matrix::Vector3<Scalar> mag_B{};
+	matrix::Vector2<Scalar> wind_vel{};
+	Scalar terrain{};
 
-	matrix::Vector<float, 25> Data() const {
-		matrix::Vector<float, 25> state;
-		state.slice<4, 1>(0, 0) = quat_nominal;
-		state.slice<3, 1>(4, 0) = vel;
-		state.slice<3, 1>(7, 0) = pos;
-		state.slice<3, 1>(10, 0) = gyro_bias;
-		state.slice<3, 1>(13, 0) = accel_bias;
-		state.slice<3, 1>(16, 0) = mag_I;
-		state.slice<3, 1>(19, 0) = mag_B;
-		state.slice<2, 1>(22, 0) = wind_vel;
-		state.slice<1, 1>(24, 0) = terrain;
+	matrix::Vector<Scalar, 25> Data() const {
+		matrix::Vector<Scalar, 25> state;
+		state.template slice<4, 1>(0, 0) = quat_nominal;
+		state.template slice<3, 1>(4, 0) = vel;
+		state.template slice<3, 1>(7, 0) = pos;
+		state.template slice<3, 1>(10, 0) = gyro_bias;
+		state.template slice<3, 1>(13, 0) = accel_bias;
+		state.template slice<3, 1>(16, 0) = mag_I;
+		state.template slice<3, 1>(19, 0) = mag_B;
+		state.template slice<2, 1>(22, 0) = wind_vel;
+		state.template slice<1, 1>(24, 0) = terrain;
 		return state;
 	};
 
-	const matrix::Vector<float, 25>& vector() const {
-		return *reinterpret_cast<matrix::Vector<float, 25>*>(const_cast<float*>(reinterpret_cast<const float*>(&quat_nominal)));
+	const matrix::Vector<Scalar, 25>& vector() const {
+		return *reinterpret_cast<matrix::Vector<Scalar, 25>*>(const_cast<Scalar*>(reinterpret_cast<const Scalar*>(&quat_nominal)));
 	};
 
 };
-static_assert(sizeof(matrix::Vector<float, 25>) == sizeof(StateSample), "state vector doesn't match StateSample size");
+static_assert(sizeof(matrix::Vector<float, 25>) == sizeof(StateSampleT<float>), "state vector doesn't match StateSample size");
+static_assert(sizeof(matrix::Vector<double, 25>) == sizeof(StateSampleT<double>), "state vector doesn't match StateSample size");
 
 struct IdxDof { unsigned idx; unsigned dof; };
 namespace State {
@@ -88,8 +88,9 @@ def generate_python_function(function_name, output_names):
             output_dir="generated",
             skip_directory_nesting=True)
 
-def build_state_struct(state, T="float"):
-    out = "struct StateSample {\n"
+def build_state_struct(state, T="Scalar"):
+    # templated on the scalar type, see CONFIG_EKF2_DOUBLE_PRECISION
+    out = f"template<typename {T}>\nstruct StateSampleT {{\n"
 
     def get_px4_type(obj):
         if isinstance(obj, sf.M11):
@@ -113,7 +114,7 @@ def build_state_struct(state, T="float"):
 
     index = state.index()
     for key in index:
-        out += f"\t\tstate.slice<{index[key].storage_dim}, 1>({index[key].offset}, 0) = {key};\n"
+        out += f"\t\tstate.template slice<{index[key].storage_dim}, 1>({index[key].offset}, 0) = {key};\n"
 
     out += "\t\treturn state;\n"
     out += "\t};\n" # Data
@@ -122,12 +123,13 @@ def build_state_struct(state, T="float"):
     first_field = next(iter(state))
 
     out += f"\n\tconst matrix::Vector<{T}, {state_size}>& vector() const {{\n" \
-        + f"\t\treturn *reinterpret_cast<matrix::Vector<{T}, {state_size}>*>(const_cast<float*>(reinterpret_cast<const {T}*>(&{first_field})));\n" \
+        + f"\t\treturn *reinterpret_cast<matrix::Vector<{T}, {state_size}>*>(const_cast<{T}*>(reinterpret_cast<const {T}*>(&{first_field})));\n" \
         + f"\t}};\n\n"
 
     out += "};\n" # StateSample
 
-    out += f"static_assert(sizeof(matrix::Vector<{T}, {state_size}>) == sizeof(StateSample), \"state vector doesn't match StateSample size\");\n"
+    for scalar in ["float", "double"]:
+        out += f"static_assert(sizeof(matrix::Vector<{scalar}, {state_size}>) == sizeof(StateSampleT<{scalar}>), \"state vector doesn't match StateSample size\");\n"
 
     return out
 
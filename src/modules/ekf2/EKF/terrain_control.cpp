@@ -103,13 +103,13 @@ void Ekf::updateTerrainValidity()
 
 	if (_time_last_terrain_fuse != 0) {
 		// Assume being valid when the uncertainty is small compared to the height above ground
-		float hagl_var = INFINITY;
-		sym::ComputeHaglInnovVar(P, 0.f, &hagl_var);
+		StateScalar hagl_var = INFINITY;
+		sym::ComputeHaglInnovVar<StateScalar>(P, 0.f, &hagl_var);
 
-		positive_hagl_var = hagl_var > 0.f;
+		positive_hagl_var = hagl_var > StateScalar(0);
 
 		if (positive_hagl_var
-		    && (hagl_var < sq(fmaxf(0.1f * getHagl(), 0.5f)))
+		    && (hagl_var < static_cast<StateScalar>(sq(fmaxf(0.1f * getHagl(), 0.5f))))
 		   ) {
 			small_relative_hagl_var = true;
 		}
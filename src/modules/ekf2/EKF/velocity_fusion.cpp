@@ -78,7 +78,7 @@ bool Ekf::fuseVelocity(estimator_aid_source3d_s &aid_src)
 
 void Ekf::resetHorizontalVelocityTo(const Vector2f &new_horz_vel, const Vector2f &new_horz_vel_var)
 {
-	const Vector2f delta_horz_vel = new_horz_vel - Vector2f(_state.vel);
+	const Vector2f delta_horz_vel = new_horz_vel - Vector2f(Vector3f(_state.vel));
 	_state.vel.xy() = new_horz_vel;
 
 	if (PX4_ISFINITE(new_horz_vel_var(0))) {
@@ -111,7 +111,7 @@ void Ekf::resetHorizontalVelocityTo(const Vector2f &new_horz_vel, const Vector2f
 
 void Ekf::resetVerticalVelocityTo(float new_vert_vel, float new_vert_vel_var)
 {
-	const float delta_vert_vel = new_vert_vel - _state.vel(2);
+	const float delta_vert_vel = new_vert_vel - static_cast<float>(_state.vel(2));
 	_state.vel(2) = new_vert_vel;
 
 	if (PX4_ISFINITE(new_vert_vel_var)) {
@@ -65,7 +65,7 @@ void Ekf::resetWindToExternalObservation(float wind_speed, float wind_direction,
 
 void Ekf::resetWindTo(const Vector2f &wind, const Vector2f &wind_var)
 {
-	_state.wind_vel = wind;
+	_state.wind_vel = matrix::Vector2<StateScalar>(wind);
 
 	if (PX4_ISFINITE(wind_var(0))) {
 		P.uncorrelateCovarianceSetVariance<1>(State::wind_vel.idx,
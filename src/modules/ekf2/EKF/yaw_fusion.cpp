@@ -58,7 +58,7 @@ bool Ekf::fuseYaw(estimator_aid_source1d_s &aid_src_status, const VectorState &H
 	// calculate the Kalman gains
 	// only calculate gains for states we are using
 	VectorState Kfusion;
-	const float heading_innov_var_inv = 1.f / aid_src_status.innovation_variance;
+	const StateScalar heading_innov_var_inv = 1.f / aid_src_status.innovation_variance;
 
 	for (uint8_t row = 0; row < State::size; row++) {
 		for (uint8_t col = 0; col <= 3; col++) {
@@ -112,13 +112,15 @@ bool Ekf::fuseYaw(estimator_aid_source1d_s &aid_src_status, const VectorState &H
 
 void Ekf::computeYawInnovVarAndH(float variance, float &innovation_variance, VectorState &H_YAW) const
 {
-	sym::ComputeYawInnovVarAndH(_state.vector(), P, variance, &innovation_variance, &H_YAW);
+	StateScalar innov_var;
+	sym::ComputeYawInnovVarAndH<StateScalar>(_state.vector(), P, variance, &innov_var, &H_YAW);
+	innovation_variance = innov_var;
 }
 
 void Ekf::resetQuatStateYaw(float yaw, float yaw_variance)
 {
 	// save a copy of the quaternion state for later use in calculating the amount of reset change
-	const Quatf quat_before_reset = _state.quat_nominal;
+	const Quatf quat_before_reset(_state.quat_nominal);
 
 	// update the yaw angle variance
 	if (PX4_ISFINITE(yaw_variance) && (yaw_variance > FLT_EPSILON)) {
@@ -127,14 +129,14 @@ void Ekf::resetQuatStateYaw(float yaw, float yaw_variance)
 
 	// update transformation matrix from body to world frame using the current estimate
 	// update the rotation matrix using the new yaw value
-	_R_to_earth = updateYawInRotMat(yaw, Dcmf(_state.quat_nominal));
+	_R_to_earth = updateYawInRotMat(yaw, Dcmf(Quatf(_state.quat_nominal)));
 
 	// calculate the amount that the quaternion has changed by
 	const Quatf quat_after_reset(_R_to_earth);
 	const Quatf q_error((quat_after_reset * quat_before_reset.inversed()).normalized());
 
 	// update quaternion states
-	_state.quat_nominal = quat_after_reset;
+	_state.quat_nominal = matrix::Quaternion<StateScalar>(quat_after_reset);
 
 	// add the reset amount to the output observer buffered data
 	_output_predictor.resetQuaternion(q_error);
@@ -62,160 +62,14 @@ EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
 #if defined(CONFIG_EKF2_WIND)
 	_wind_pub(multi_mode ? ORB_ID(estimator_wind) : ORB_ID(wind)),
 #endif // CONFIG_EKF2_WIND
-	_params(_ekf.getParamHandle()),
-	_param_ekf2_predict_us(_params->filter_update_interval_us),
-	_param_ekf2_delay_max(_params->delay_max_ms),
-	_param_ekf2_imu_ctrl(_params->imu_ctrl),
-	_param_ekf2_vel_lim(_params->velocity_limit),
-#if defined(CONFIG_EKF2_AUXVEL)
-	_param_ekf2_avel_delay(_params->auxvel_delay_ms),
-#endif // CONFIG_EKF2_AUXVEL
-	_param_ekf2_gyr_noise(_params->gyro_noise),
-	_param_ekf2_acc_noise(_params->accel_noise),
-	_param_ekf2_gyr_b_noise(_params->gyro_bias_p_noise),
-	_param_ekf2_acc_b_noise(_params->accel_bias_p_noise),
-#if defined(CONFIG_EKF2_WIND)
-	_param_ekf2_wind_nsd(_params->wind_vel_nsd),
-#endif // CONFIG_EKF2_WIND
-	_param_ekf2_noaid_noise(_params->pos_noaid_noise),
-#if defined(CONFIG_EKF2_GNSS)
-	_param_ekf2_gps_ctrl(_params->gnss_ctrl),
-	_param_ekf2_gps_delay(_params->gps_delay_ms),
-	_param_ekf2_gps_pos_x(_params->gps_pos_body(0)),
-	_param_ekf2_gps_pos_y(_params->gps_pos_body(1)),
-	_param_ekf2_gps_pos_z(_params->gps_pos_body(2)),
-	_param_ekf2_gps_v_noise(_params->gps_vel_noise),
-	_param_ekf2_gps_p_noise(_params->gps_pos_noise),
-	_param_ekf2_gps_p_gate(_params->gps_pos_innov_gate),
-	_param_ekf2_gps_v_gate(_params->gps_vel_innov_gate),
-	_param_ekf2_gps_check(_params->gps_check_mask),
-	_param_ekf2_req_eph(_params->req_hacc),
-	_param_ekf2_req_epv(_params->req_vacc),
-	_param_ekf2_req_sacc(_params->req_sacc),
-	_param_ekf2_req_nsats(_params->req_nsats),
-	_param_ekf2_req_pdop(_params->req_pdop),
-	_param_ekf2_req_hdrift(_params->req_hdrift),
-	_param_ekf2_req_vdrift(_params->req_vdrift),
-	_param_ekf2_gsf_tas_default(_params->EKFGSF_tas_default),
-#endif // CONFIG_EKF2_GNSS
-#if defined(CONFIG_EKF2_BAROMETER)
-	_param_ekf2_baro_ctrl(_params->baro_ctrl),
-	_param_ekf2_baro_delay(_params->baro_delay_ms),
-	_param_ekf2_baro_noise(_params->baro_noise),
-	_param_ekf2_baro_gate(_params->baro_innov_gate),
-	_param_ekf2_gnd_eff_dz(_params->gnd_effect_deadzone),
-	_param_ekf2_gnd_max_hgt(_params->gnd_effect_max_hgt),
-# if defined(CONFIG_EKF2_BARO_COMPENSATION)
-	_param_ekf2_aspd_max(_params->max_correction_airspeed),
-	_param_ekf2_pcoef_xp(_params->static_pressure_coef_xp),
-	_param_ekf2_pcoef_xn(_params->static_pressure_coef_xn),
-	_param_ekf2_pcoef_yp(_params->static_pressure_coef_yp),
-	_param_ekf2_pcoef_yn(_params->static_pressure_coef_yn),
-	_param_ekf2_pcoef_z(_params->static_pressure_coef_z),
-# endif // CONFIG_EKF2_BARO_COMPENSATION
-#endif // CONFIG_EKF2_BAROMETER
-#if defined(CONFIG_EKF2_AIRSPEED)
-	_param_ekf2_asp_delay(_params->airspeed_delay_ms),
-	_param_ekf2_tas_gate(_params->tas_innov_gate),
-	_param_ekf2_eas_noise(_params->eas_noise),
-	_param_ekf2_arsp_thr(_params->arsp_thr),
-#endif // CONFIG_EKF2_AIRSPEED
-#if defined(CONFIG_EKF2_SIDESLIP)
-	_param_ekf2_beta_gate(_params->beta_innov_gate),
-	_param_ekf2_beta_noise(_params->beta_noise),
-	_param_ekf2_fuse_beta(_params->beta_fusion_enabled),
-#endif // CONFIG_EKF2_SIDESLIP
-#if defined(CONFIG_EKF2_MAGNETOMETER)
-	_param_ekf2_mag_delay(_params->mag_delay_ms),
-	_param_ekf2_mag_e_noise(_params->mage_p_noise),
-	_param_ekf2_mag_b_noise(_params->magb_p_noise),
-	_param_ekf2_head_noise(_params->mag_heading_noise),
-	_param_ekf2_mag_noise(_params->mag_noise),
-	_param_ekf2_mag_decl(_params->mag_declination_deg),
-	_param_ekf2_hdg_gate(_params->heading_innov_gate),
-	_param_ekf2_mag_gate(_params->mag_innov_gate),
-	_param_ekf2_decl_type(_params->mag_declination_source),
-	_param_ekf2_mag_type(_params->mag_fusion_type),
-	_param_ekf2_mag_acclim(_params->mag_acc_gate),
-	_param_ekf2_mag_check(_params->mag_check),
-	_param_ekf2_mag_chk_str(_params->mag_check_strength_tolerance_gs),
-	_param_ekf2_mag_chk_inc(_params->mag_check_inclination_tolerance_deg),
-	_param_ekf2_synthetic_mag_z(_params->synthesize_mag_z),
-#endif // CONFIG_EKF2_MAGNETOMETER
-	_param_ekf2_hgt_ref(_params->height_sensor_ref),
-	_param_ekf2_noaid_tout(_params->valid_timeout_max),
-#if defined(CONFIG_EKF2_TERRAIN) || defined(CONFIG_EKF2_OPTICAL_FLOW) || defined(CONFIG_EKF2_RANGE_FINDER)
-	_param_ekf2_min_rng(_params->rng_gnd_clearance),
-#endif // CONFIG_EKF2_TERRAIN || CONFIG_EKF2_OPTICAL_FLOW || CONFIG_EKF2_RANGE_FINDER
-#if defined(CONFIG_EKF2_TERRAIN)
-	_param_ekf2_terr_noise(_params->terrain_p_noise),
-	_param_ekf2_terr_grad(_params->terrain_gradient),
-#endif // CONFIG_EKF2_TERRAIN
-#if defined(CONFIG_EKF2_RANGE_FINDER)
-	_param_ekf2_rng_ctrl(_params->rng_ctrl),
-	_param_ekf2_rng_delay(_params->range_delay_ms),
-	_param_ekf2_rng_noise(_params->range_noise),
-	_param_ekf2_rng_sfe(_params->range_noise_scaler),
-	_param_ekf2_rng_gate(_params->range_innov_gate),
-	_param_ekf2_rng_pitch(_params->rng_sens_pitch),
-	_param_ekf2_rng_a_vmax(_params->max_vel_for_range_aid),
-	_param_ekf2_rng_a_hmax(_params->max_hagl_for_range_aid),
-	_param_ekf2_rng_a_igate(_params->range_aid_innov_gate),
-	_param_ekf2_rng_qlty_t(_params->range_valid_quality_s),
-	_param_ekf2_rng_k_gate(_params->range_kin_consistency_gate),
-	_param_ekf2_rng_fog(_params->rng_fog),
-	_param_ekf2_rng_pos_x(_params->rng_pos_body(0)),
-	_param_ekf2_rng_pos_y(_params->rng_pos_body(1)),
-	_param_ekf2_rng_pos_z(_params->rng_pos_body(2)),
-#endif // CONFIG_EKF2_RANGE_FINDER
-#if defined(CONFIG_EKF2_EXTERNAL_VISION)
-	_param_ekf2_ev_delay(_params->ev_delay_ms),
-	_param_ekf2_ev_ctrl(_params->ev_ctrl),
-	_param_ekf2_ev_qmin(_params->ev_quality_minimum),
-	_param_ekf2_evp_noise(_params->ev_pos_noise),
-	_param_ekf2_evv_noise(_params->ev_vel_noise),
-	_param_ekf2_eva_noise(_params->ev_att_noise),
-	_param_ekf2_evv_gate(_params->ev_vel_innov_gate),
-	_param_ekf2_evp_gate(_params->ev_pos_innov_gate),
-	_param_ekf2_ev_pos_x(_params->ev_pos_body(0)),
-	_param_ekf2_ev_pos_y(_params->ev_pos_body(1)),
-	_param_ekf2_ev_pos_z(_params->ev_pos_body(2)),
-#endif // CONFIG_EKF2_EXTERNAL_VISION
-#if defined(CONFIG_EKF2_OPTICAL_FLOW)
-	_param_ekf2_of_ctrl(_params->flow_ctrl),
-	_param_ekf2_of_gyr_src(_params->flow_gyro_src),
-	_param_ekf2_of_delay(_params->flow_delay_ms),
-	_param_ekf2_of_n_min(_params->flow_noise),
-	_param_ekf2_of_n_max(_params->flow_noise_qual_min),
-	_param_ekf2_of_qmin(_params->flow_qual_min),
-	_param_ekf2_of_qmin_gnd(_params->flow_qual_min_gnd),
-	_param_ekf2_of_gate(_params->flow_innov_gate),
-	_param_ekf2_of_pos_x(_params->flow_pos_body(0)),
-	_param_ekf2_of_pos_y(_params->flow_pos_body(1)),
-	_param_ekf2_of_pos_z(_params->flow_pos_body(2)),
-#endif // CONFIG_EKF2_OPTICAL_FLOW
-#if defined(CONFIG_EKF2_DRAG_FUSION)
-	_param_ekf2_drag_ctrl(_params->drag_ctrl),
-	_param_ekf2_drag_noise(_params->drag_noise),
-	_param_ekf2_bcoef_x(_params->bcoef_x),
-	_param_ekf2_bcoef_y(_params->bcoef_y),
-	_param_ekf2_mcoef(_params->mcoef),
-#endif // CONFIG_EKF2_DRAG_FUSION
-#if defined(CONFIG_EKF2_GRAVITY_FUSION)
-	_param_ekf2_grav_noise(_params->gravity_noise),
-#endif // CONFIG_EKF2_GRAVITY_FUSION
-	_param_ekf2_imu_pos_x(_params->imu_pos_body(0)),
-	_param_ekf2_imu_pos_y(_params->imu_pos_body(1)),
-	_param_ekf2_imu_pos_z(_params->imu_pos_body(2)),
-	_param_ekf2_gbias_init(_params->switch_on_gyro_bias),
-	_param_ekf2_abias_init(_params->switch_on_accel_bias),
-	_param_ekf2_angerr_init(_params->initial_tilt_err),
-	_param_ekf2_abl_lim(_params->acc_bias_lim),
-	_param_ekf2_abl_acclim(_params->acc_bias_learn_acc_lim),
-	_param_ekf2_abl_gyrlim(_params->acc_bias_learn_gyr_lim),
-	_param_ekf2_abl_tau(_params->acc_bias_learn_tc),
-	_param_ekf2_gyr_b_lim(_params->gyro_bias_lim)
+	_params(_ekf.getParamHandle())
 {
+	for (const ekf2::ParamBinding &binding : ekf2::kParamBindings) {
+		param_set_used(param_handle(binding.param));
+	}
+
+	UpdateParamBindings();
+
 	AdvertiseTopics();
 }
 
@@ -247,7 +101,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_GNSS)
 
-	if (_param_ekf2_gps_ctrl.get()) {
+	if (_params->gnss_ctrl) {
 		_estimator_gps_status_pub.advertise();
 		_yaw_est_pub.advertise();
 	}
@@ -263,7 +117,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_AIRSPEED)
 
-		if (_param_ekf2_arsp_thr.get() > 0.f) {
+		if (_params->arsp_thr > 0.f) {
 			_estimator_aid_src_airspeed_pub.advertise();
 		}
 
@@ -271,7 +125,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_BAROMETER)
 
-		if (_param_ekf2_baro_ctrl.get()) {
+		if (_params->baro_ctrl) {
 			_estimator_aid_src_baro_hgt_pub.advertise();
 			_estimator_baro_bias_pub.advertise();
 		}
@@ -280,7 +134,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_DRAG_FUSION)
 
-		if (_param_ekf2_drag_ctrl.get()) {
+		if (_params->drag_ctrl) {
 			_estimator_aid_src_drag_pub.advertise();
 		}
 
@@ -288,21 +142,21 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_EXTERNAL_VISION)
 
-		if (_param_ekf2_ev_ctrl.get() & static_cast<int32_t>(EvCtrl::VPOS)) {
+		if (_params->ev_ctrl & static_cast<int32_t>(EvCtrl::VPOS)) {
 			_estimator_aid_src_ev_hgt_pub.advertise();
 			_estimator_ev_pos_bias_pub.advertise();
 		}
 
-		if (_param_ekf2_ev_ctrl.get() & static_cast<int32_t>(EvCtrl::HPOS)) {
+		if (_params->ev_ctrl & static_cast<int32_t>(EvCtrl::HPOS)) {
 			_estimator_aid_src_ev_pos_pub.advertise();
 			_estimator_ev_pos_bias_pub.advertise();
 		}
 
-		if (_param_ekf2_ev_ctrl.get() & static_cast<int32_t>(EvCtrl::VEL)) {
+		if (_params->ev_ctrl & static_cast<int32_t>(EvCtrl::VEL)) {
 			_estimator_aid_src_ev_vel_pub.advertise();
 		}
 
-		if (_param_ekf2_ev_ctrl.get() & static_cast<int32_t>(EvCtrl::YAW)) {
+		if (_params->ev_ctrl & static_cast<int32_t>(EvCtrl::YAW)) {
 			_estimator_aid_src_ev_yaw_pub.advertise();
 		}
 
@@ -310,23 +164,23 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_GNSS)
 
-		if (_param_ekf2_gps_ctrl.get()) {
-			if (_param_ekf2_gps_ctrl.get() & static_cast<int32_t>(GnssCtrl::VPOS)) {
+		if (_params->gnss_ctrl) {
+			if (_params->gnss_ctrl & static_cast<int32_t>(GnssCtrl::VPOS)) {
 				_estimator_aid_src_gnss_hgt_pub.advertise();
 				_estimator_gnss_hgt_bias_pub.advertise();
 			}
 
-			if (_param_ekf2_gps_ctrl.get() & static_cast<int32_t>(GnssCtrl::HPOS)) {
+			if (_params->gnss_ctrl & static_cast<int32_t>(GnssCtrl::HPOS)) {
 				_estimator_aid_src_gnss_pos_pub.advertise();
 			}
 
-			if (_param_ekf2_gps_ctrl.get() & static_cast<int32_t>(GnssCtrl::VEL)) {
+			if (_params->gnss_ctrl & static_cast<int32_t>(GnssCtrl::VEL)) {
 				_estimator_aid_src_gnss_vel_pub.advertise();
 			}
 
 # if defined(CONFIG_EKF2_GNSS_YAW)
 
-			if (_param_ekf2_gps_ctrl.get() & static_cast<int32_t>(GnssCtrl::YAW)) {
+			if (_params->gnss_ctrl & static_cast<int32_t>(GnssCtrl::YAW)) {
 				_estimator_aid_src_gnss_yaw_pub.advertise();
 			}
 
@@ -337,7 +191,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_GRAVITY_FUSION)
 
-		if (_param_ekf2_imu_ctrl.get() & static_cast<int32_t>(ImuCtrl::GravityVector)) {
+		if (_params->imu_ctrl & static_cast<int32_t>(ImuCtrl::GravityVector)) {
 			_estimator_aid_src_gravity_pub.advertise();
 		}
 
@@ -345,7 +199,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 
-		if (_param_ekf2_mag_type.get() != MagFuseType::NONE) {
+		if (_params->mag_fusion_type != MagFuseType::NONE) {
 			_estimator_aid_src_mag_pub.advertise();
 		}
 
@@ -353,7 +207,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_OPTICAL_FLOW)
 
-		if (_param_ekf2_of_ctrl.get()) {
+		if (_params->flow_ctrl) {
 			_estimator_optical_flow_vel_pub.advertise();
 			_estimator_aid_src_optical_flow_pub.advertise();
 		}
@@ -363,7 +217,7 @@ void EKF2::AdvertiseTopics()
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 
 		// RNG advertise
-		if (_param_ekf2_rng_ctrl.get()) {
+		if (_params->rng_ctrl) {
 			_estimator_aid_src_rng_hgt_pub.advertise();
 		}
 
@@ -371,7 +225,7 @@ void EKF2::AdvertiseTopics()
 
 #if defined(CONFIG_EKF2_SIDESLIP)
 
-		if (_param_ekf2_fuse_beta.get()) {
+		if (_params->beta_fusion_enabled) {
 			_estimator_aid_src_sideslip_pub.advertise();
 		}
 
@@ -448,23 +302,13 @@ void EKF2::Run()
 
 		// update parameters from storage
 		updateParams();
+		UpdateParamBindings();
 
 		VerifyParams();
 
 		// force advertise topics immediately for logging (EKF2_LOG_VERBOSE, per aid source control)
 		AdvertiseTopics();
 
-#if defined(CONFIG_EKF2_GNSS)
-		_ekf.set_min_required_gps_health_time(_param_ekf2_req_gps_h.get() * 1_s);
-#endif // CONFIG_EKF2_GNSS
-
-		const matrix::Vector3f imu_pos_body(_param_ekf2_imu_pos_x.get(),
-						    _param_ekf2_imu_pos_y.get(),
-						    _param_ekf2_imu_pos_z.get());
-		_ekf.output_predictor().set_imu_offset(imu_pos_body);
-		_ekf.output_predictor().set_pos_correction_tc(_param_ekf2_tau_pos.get());
-		_ekf.output_predictor().set_vel_correction_tc(_param_ekf2_tau_vel.get());
-
 #if defined(CONFIG_EKF2_AIRSPEED)
 		// The airspeed scale factor correcton is only available via parameter as used by the airspeed module
 		param_t param_aspd_scale = param_find("ASPD_SCALE_1");
@@ -600,17 +444,7 @@ void EKF2::Run()
 		}
 
 		if (imu_updated) {
-			imu_sample_new.time_us = imu.timestamp_sample;
-			imu_sample_new.delta_ang_dt = imu.delta_angle_dt * 1.e-6f;
-			imu_sample_new.delta_ang = Vector3f{imu.delta_angle};
-			imu_sample_new.delta_vel_dt = imu.delta_velocity_dt * 1.e-6f;
-			imu_sample_new.delta_vel = Vector3f{imu.delta_velocity};
-
-			if (imu.delta_velocity_clipping > 0) {
-				imu_sample_new.delta_vel_clipping[0] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_X;
-				imu_sample_new.delta_vel_clipping[1] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Y;
-				imu_sample_new.delta_vel_clipping[2] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Z;
-			}
+			imu_sample_new = ekf2::imuSampleFromVehicleImu(imu);
 
 			imu_dt = imu.delta_angle_dt;
 
@@ -661,17 +495,7 @@ void EKF2::Run()
 		}
 
 		if (imu_updated) {
-			imu_sample_new.time_us = sensor_combined.timestamp;
-			imu_sample_new.delta_ang_dt = sensor_combined.gyro_integral_dt * 1.e-6f;
-			imu_sample_new.delta_ang = Vector3f{sensor_combined.gyro_rad} * imu_sample_new.delta_ang_dt;
-			imu_sample_new.delta_vel_dt = sensor_combined.accelerometer_integral_dt * 1.e-6f;
-			imu_sample_new.delta_vel = Vector3f{sensor_combined.accelerometer_m_s2} * imu_sample_new.delta_vel_dt;
-
-			if (sensor_combined.accelerometer_clipping > 0) {
-				imu_sample_new.delta_vel_clipping[0] = sensor_combined.accelerometer_clipping & sensor_combined_s::CLIPPING_X;
-				imu_sample_new.delta_vel_clipping[1] = sensor_combined.accelerometer_clipping & sensor_combined_s::CLIPPING_Y;
-				imu_sample_new.delta_vel_clipping[2] = sensor_combined.accelerometer_clipping & sensor_combined_s::CLIPPING_Z;
-			}
+			imu_sample_new = ekf2::imuSampleFromSensorCombined(sensor_combined);
 
 			imu_dt = sensor_combined.gyro_integral_dt;
 
@@ -837,6 +661,12 @@ void EKF2::Run()
 #endif // CONFIG_EKF2_MAGNETOMETER
 		}
 
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+		// backward smoothing pass, spread over several cycles after the control-facing outputs
+		_ekf.fixed_lag_smoother().update();
+		PublishSmoothedOdometry(now);
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
 		// publish ekf2_timestamps
 		_ekf2_timestamps_pub.publish(ekf2_timestamps);
 	}
@@ -845,15 +675,27 @@ void EKF2::Run()
 	ScheduleDelayed(100_ms);
 }
 
+void EKF2::UpdateParamBindings()
+{
+	for (const ekf2::ParamBinding &binding : ekf2::kParamBindings) {
+		if (binding.value_float) {
+			param_get(param_handle(binding.param), binding.value_float(*_params));
+
+		} else {
+			param_get(param_handle(binding.param), binding.value_int(*_params));
+		}
+	}
+}
+
 void EKF2::VerifyParams()
 {
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 
 	// EKF2_MAG_TYPE obsolete options
-	if ((_param_ekf2_mag_type.get() != MagFuseType::AUTO)
-	    && (_param_ekf2_mag_type.get() != MagFuseType::HEADING)
-	    && (_param_ekf2_mag_type.get() != MagFuseType::NONE)
-	    && (_param_ekf2_mag_type.get() != MagFuseType::INIT)
+	if ((_params->mag_fusion_type != MagFuseType::AUTO)
+	    && (_params->mag_fusion_type != MagFuseType::HEADING)
+	    && (_params->mag_fusion_type != MagFuseType::NONE)
+	    && (_params->mag_fusion_type != MagFuseType::INIT)
 	   ) {
 
 		mavlink_log_critical(&_mavlink_log_pub, "EKF2_MAG_TYPE invalid, resetting to default");
@@ -861,88 +703,89 @@ void EKF2::VerifyParams()
 		 * @description <param>EKF2_MAG_TYPE</param> is set to {1:.0}.
 		 */
 		events::send<float>(events::ID("ekf2_mag_type_invalid"), events::Log::Warning,
-				    "EKF2_MAG_TYPE invalid, resetting to default", _param_ekf2_mag_type.get());
+				    "EKF2_MAG_TYPE invalid, resetting to default", _params->mag_fusion_type);
 
-		_param_ekf2_mag_type.set(0);
-		_param_ekf2_mag_type.commit();
+		_params->mag_fusion_type = 0;
+		param_set(param_handle(px4::params::EKF2_MAG_TYPE), &_params->mag_fusion_type);
 	}
 
 #endif // CONFIG_EKF2_MAGNETOMETER
 
-	float delay_max = _param_ekf2_delay_max.get();
+	float delay_max = _params->delay_max_ms;
 
 #if defined(CONFIG_EKF2_AUXVEL)
 
-	if (_param_ekf2_avel_delay.get() > delay_max) {
-		delay_max = _param_ekf2_avel_delay.get();
+	if (_params->auxvel_delay_ms > delay_max) {
+		delay_max = _params->auxvel_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_AUXVEL
 
 #if defined(CONFIG_EKF2_BAROMETER)
 
-	if (_param_ekf2_baro_delay.get() > delay_max) {
-		delay_max = _param_ekf2_baro_delay.get();
+	if (_params->baro_delay_ms > delay_max) {
+		delay_max = _params->baro_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_BAROMETER
 
 #if defined(CONFIG_EKF2_AIRSPEED)
 
-	if (_param_ekf2_asp_delay.get() > delay_max) {
-		delay_max = _param_ekf2_asp_delay.get();
+	if (_params->airspeed_delay_ms > delay_max) {
+		delay_max = _params->airspeed_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_AIRSPEED
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 
-	if (_param_ekf2_mag_delay.get() > delay_max) {
-		delay_max = _param_ekf2_mag_delay.get();
+	if (_params->mag_delay_ms > delay_max) {
+		delay_max = _params->mag_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_MAGNETOMETER
 
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 
-	if (_param_ekf2_rng_delay.get() > delay_max) {
-		delay_max = _param_ekf2_rng_delay.get();
+	if (_params->range_delay_ms > delay_max) {
+		delay_max = _params->range_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_RANGE_FINDER
 
 #if defined(CONFIG_EKF2_GNSS)
 
-	if (_param_ekf2_gps_delay.get() > delay_max) {
-		delay_max = _param_ekf2_gps_delay.get();
+	if (_params->gps_delay_ms > delay_max) {
+		delay_max = _params->gps_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_GNSS
 
 #if defined(CONFIG_EKF2_OPTICAL_FLOW)
 
-	if (_param_ekf2_of_delay.get() > delay_max) {
-		delay_max = _param_ekf2_of_delay.get();
+	if (_params->flow_delay_ms > delay_max) {
+		delay_max = _params->flow_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_OPTICAL_FLOW
 
 #if defined(CONFIG_EKF2_EXTERNAL_VISION)
 
-	if (_param_ekf2_ev_delay.get() > delay_max) {
-		delay_max = _param_ekf2_ev_delay.get();
+	if (_params->ev_delay_ms > delay_max) {
+		delay_max = _params->ev_delay_ms;
 	}
 
 #endif // CONFIG_EKF2_EXTERNAL_VISION
 
-	if (delay_max > _param_ekf2_delay_max.get()) {
+	if (delay_max > _params->delay_max_ms) {
 		/* EVENT
 		 * @description EKF2_DELAY_MAX({1}ms) is too small compared to the maximum sensor delay ({2})
 		 */
 		events::send<float, float>(events::ID("nf_delay_max_too_small"), events::Log::Warning,
-					   "EKF2_DELAY_MAX increased to {2}ms, please reboot", _param_ekf2_delay_max.get(),
+					   "EKF2_DELAY_MAX increased to {2}ms, please reboot", _params->delay_max_ms,
 					   delay_max);
-		_param_ekf2_delay_max.commit_no_notification(delay_max);
+		_params->delay_max_ms = delay_max;
+		param_set_no_notification(param_handle(px4::params::EKF2_DELAY_MAX), &_params->delay_max_ms);
 	}
 }
 
@@ -1037,6 +880,10 @@ void EKF2::PublishAttitude(const hrt_abstime &timestamp)
 #if defined(CONFIG_EKF2_BAROMETER)
 void EKF2::PublishBaroBias(const hrt_abstime &timestamp)
 {
+	if (!_estimator_baro_bias_pub.has_subscribers()) {
+		return;
+	}
+
 	if (_ekf.aid_src_baro_hgt().timestamp_sample != 0) {
 		const BiasEstimator::status &status = _ekf.getBaroBiasEstimatorStatus();
 
@@ -1053,6 +900,10 @@ void EKF2::PublishBaroBias(const hrt_abstime &timestamp)
 #if defined(CONFIG_EKF2_GNSS)
 void EKF2::PublishGnssHgtBias(const hrt_abstime &timestamp)
 {
+	if (!_estimator_gnss_hgt_bias_pub.has_subscribers()) {
+		return;
+	}
+
 	if (_ekf.get_gps_sample_delayed().time_us != 0) {
 		const BiasEstimator::status &status = _ekf.getGpsHgtBiasEstimatorStatus();
 
@@ -1068,6 +919,10 @@ void EKF2::PublishGnssHgtBias(const hrt_abstime &timestamp)
 #if defined(CONFIG_EKF2_EXTERNAL_VISION)
 void EKF2::PublishEvPosBias(const hrt_abstime &timestamp)
 {
+	if (!_estimator_ev_pos_bias_pub.has_subscribers()) {
+		return;
+	}
+
 	if (_ekf.aid_src_ev_hgt().timestamp_sample) {
 
 		estimator_bias3d_s bias{};
@@ -1258,6 +1113,11 @@ void EKF2::PublishGpsStatus(const hrt_abstime &timestamp)
 
 void EKF2::PublishInnovations(const hrt_abstime &timestamp)
 {
+	// diagnostic output, only computed on demand (logger, mavlink or any other subscriber)
+	if (!_estimator_innovations_pub.has_subscribers()) {
+		return;
+	}
+
 	// publish estimator innovation data
 	estimator_innovations_s innovations{};
 	innovations.timestamp_sample = _ekf.time_delayed_us();
@@ -1351,6 +1211,10 @@ void EKF2::PublishInnovations(const hrt_abstime &timestamp)
 
 void EKF2::PublishInnovationTestRatios(const hrt_abstime &timestamp)
 {
+	if (!_estimator_innovation_test_ratios_pub.has_subscribers()) {
+		return;
+	}
+
 	// publish estimator innovation test ratio data
 	estimator_innovations_s test_ratios{};
 	test_ratios.timestamp_sample = _ekf.time_delayed_us();
@@ -1444,6 +1308,10 @@ void EKF2::PublishInnovationTestRatios(const hrt_abstime &timestamp)
 
 void EKF2::PublishInnovationVariances(const hrt_abstime &timestamp)
 {
+	if (!_estimator_innovation_variances_pub.has_subscribers()) {
+		return;
+	}
+
 	// publish estimator innovation variance data
 	estimator_innovations_s variances{};
 	variances.timestamp_sample = _ekf.time_delayed_us();
@@ -1700,6 +1568,51 @@ void EKF2::PublishOdometry(const hrt_abstime &timestamp, const imuSample &imu_sa
 	_odometry_pub.publish(odom);
 }
 
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+void EKF2::PublishSmoothedOdometry(const hrt_abstime &timestamp)
+{
+	FixedLagSmoother::Output smoothed;
+
+	if (!_ekf.fixed_lag_smoother().getOutput(smoothed)) {
+		return;
+	}
+
+	vehicle_odometry_s odom;
+	odom.timestamp_sample = smoothed.time_us;
+
+	odom.pose_frame = vehicle_odometry_s::POSE_FRAME_NED;
+	smoothed.pos.copyTo(odom.position);
+
+	// orientation is not smoothed
+	odom.q[0] = NAN;
+	odom.q[1] = NAN;
+	odom.q[2] = NAN;
+	odom.q[3] = NAN;
+
+	odom.velocity_frame = vehicle_odometry_s::VELOCITY_FRAME_NED;
+	smoothed.vel.copyTo(odom.velocity);
+
+	odom.angular_velocity[0] = NAN;
+	odom.angular_velocity[1] = NAN;
+	odom.angular_velocity[2] = NAN;
+
+	smoothed.pos_var.copyTo(odom.position_variance);
+	smoothed.vel_var.copyTo(odom.velocity_variance);
+
+	odom.orientation_variance[0] = NAN;
+	odom.orientation_variance[1] = NAN;
+	odom.orientation_variance[2] = NAN;
+
+	odom.reset_counter = _ekf.get_velNE_reset_count() + _ekf.get_velD_reset_count()
+			     + _ekf.get_posNE_reset_count() + _ekf.get_posD_reset_count();
+
+	odom.quality = 0;
+
+	odom.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
+	_estimator_smoothed_odometry_pub.publish(odom);
+}
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+
 void EKF2::PublishSensorBias(const hrt_abstime &timestamp)
 {
 	// estimator_sensor_bias
@@ -1722,7 +1635,7 @@ void EKF2::PublishSensorBias(const hrt_abstime &timestamp)
 		bias.timestamp_sample = _ekf.time_delayed_us();
 
 		// take device ids from sensor_selection_s if not using specific vehicle_imu_s
-		if ((_device_id_gyro != 0) && (_param_ekf2_imu_ctrl.get() & static_cast<int32_t>(ImuCtrl::GyroBias))) {
+		if ((_device_id_gyro != 0) && (_params->imu_ctrl & static_cast<int32_t>(ImuCtrl::GyroBias))) {
 			const Vector3f bias_var{_ekf.getGyroBiasVariance()};
 
 			bias.gyro_device_id = _device_id_gyro;
@@ -1734,7 +1647,7 @@ void EKF2::PublishSensorBias(const hrt_abstime &timestamp)
 			_last_gyro_bias_published = gyro_bias;
 		}
 
-		if ((_device_id_accel != 0) && (_param_ekf2_imu_ctrl.get() & static_cast<int32_t>(ImuCtrl::AccelBias))) {
+		if ((_device_id_accel != 0) && (_params->imu_ctrl & static_cast<int32_t>(ImuCtrl::AccelBias))) {
 			const Vector3f bias_var{_ekf.getAccelBiasVariance()};
 
 			bias.accel_device_id = _device_id_accel;
@@ -1771,10 +1684,14 @@ void EKF2::PublishSensorBias(const hrt_abstime &timestamp)
 
 void EKF2::PublishStates(const hrt_abstime &timestamp)
 {
+	if (!_estimator_states_pub.has_subscribers()) {
+		return;
+	}
+
 	// publish estimator states
 	estimator_states_s states;
 	states.timestamp_sample = _ekf.time_delayed_us();
-	const auto state_vector = _ekf.state().vector();
+	const auto state_vector = _ekf.getStateVector();
 	state_vector.copyTo(states.states);
 	states.n_states = state_vector.size();
 	_ekf.covariances_diagonal().copyTo(states.covariances);
@@ -1784,6 +1701,10 @@ void EKF2::PublishStates(const hrt_abstime &timestamp)
 
 void EKF2::PublishStatus(const hrt_abstime &timestamp)
 {
+	if (!_estimator_status_pub.has_subscribers()) {
+		return;
+	}
+
 	estimator_status_s status{};
 	status.timestamp_sample = _ekf.time_delayed_us();
 
@@ -2065,21 +1986,9 @@ void EKF2::UpdateAirspeedSample(ekf2_timestamps_s &ekf2_timestamps)
 
 		if (_airspeed_validated_sub.update(&airspeed_validated)) {
 
-			if (PX4_ISFINITE(airspeed_validated.true_airspeed_m_s)
-			    && (airspeed_validated.selected_airspeed_index > 0)
-			   ) {
-				float cas2tas = 1.f;
-
-				if (PX4_ISFINITE(airspeed_validated.calibrated_airspeed_m_s)
-				    && (airspeed_validated.calibrated_airspeed_m_s > FLT_EPSILON)) {
-					cas2tas = airspeed_validated.true_airspeed_m_s / airspeed_validated.calibrated_airspeed_m_s;
-				}
+			airspeedSample airspeed_sample;
 
-				airspeedSample airspeed_sample {
-					.time_us = airspeed_validated.timestamp,
-					.true_airspeed = airspeed_validated.true_airspeed_m_s,
-					.eas2tas = cas2tas,
-				};
+			if (ekf2::airspeedSampleFromAirspeedValidated(airspeed_validated, airspeed_sample)) {
 				_ekf.setAirspeedData(airspeed_sample);
 			}
 
@@ -2096,17 +2005,9 @@ void EKF2::UpdateAirspeedSample(ekf2_timestamps_s &ekf2_timestamps)
 		if (_airspeed_sub.update(&airspeed)) {
 			// The airspeed measurement received via ORB_ID(airspeed) topic has not been corrected
 			// for scale factor errors and requires the ASPD_SCALE correction to be applied.
-			const float true_airspeed_m_s = airspeed.true_airspeed_m_s * _airspeed_scale_factor;
-
-			if (PX4_ISFINITE(airspeed.true_airspeed_m_s)
-			    && PX4_ISFINITE(airspeed.indicated_airspeed_m_s)
-			    && (airspeed.indicated_airspeed_m_s > 0.f)
-			   ) {
-				airspeedSample airspeed_sample {
-					.time_us = airspeed.timestamp_sample,
-					.true_airspeed = true_airspeed_m_s,
-					.eas2tas = airspeed.true_airspeed_m_s / airspeed.indicated_airspeed_m_s,
-				};
+			airspeedSample airspeed_sample;
+
+			if (ekf2::airspeedSampleFromAirspeed(airspeed, _airspeed_scale_factor, airspeed_sample)) {
 				_ekf.setAirspeedData(airspeed_sample);
 			}
 
@@ -2170,7 +2071,7 @@ void EKF2::UpdateBaroSample(ekf2_timestamps_s &ekf2_timestamps)
 
 		_ekf.set_air_density(airdata.rho);
 
-		_ekf.setBaroData(baroSample{airdata.timestamp_sample, airdata.baro_alt_meter, reset});
+		_ekf.setBaroData(ekf2::baroSampleFromAirData(airdata, reset));
 
 		ekf2_timestamps.vehicle_air_data_timestamp_rel = (int16_t)((int64_t)airdata.timestamp / 100 -
 				(int64_t)ekf2_timestamps.timestamp / 100);
@@ -2220,7 +2121,7 @@ bool EKF2::UpdateExtVisionSample(ekf2_timestamps_s &ekf2_timestamps)
 			if (velocity_frame_valid) {
 				ev_data.vel = ev_odom_vel;
 
-				const float evv_noise_var = sq(_param_ekf2_evv_noise.get());
+				const float evv_noise_var = sq(_params->ev_vel_noise);
 
 				// velocity measurement error from ev_data or parameters
 				if ((_param_ekf2_ev_noise_md.get() == 0) && ev_odom_vel_var.isAllFinite()) {
@@ -2259,7 +2160,7 @@ bool EKF2::UpdateExtVisionSample(ekf2_timestamps_s &ekf2_timestamps)
 			if (position_frame_valid) {
 				ev_data.pos = ev_odom_pos;
 
-				const float evp_noise_var = sq(_param_ekf2_evp_noise.get());
+				const float evp_noise_var = sq(_params->ev_pos_noise);
 
 				// position measurement error from ev_data or parameters
 				if ((_param_ekf2_ev_noise_md.get() == 0) && ev_odom_pos_var.isAllFinite()) {
@@ -2295,7 +2196,7 @@ bool EKF2::UpdateExtVisionSample(ekf2_timestamps_s &ekf2_timestamps)
 			ev_data.quat.normalize();
 
 			// orientation measurement error from ev_data or parameters
-			const float eva_noise_var = sq(_param_ekf2_eva_noise.get());
+			const float eva_noise_var = sq(_params->ev_att_noise);
 
 			if ((_param_ekf2_ev_noise_md.get() == 0) && ev_odom_q_var.isAllFinite()) {
 
@@ -2406,51 +2307,15 @@ void EKF2::UpdateGpsSample(ekf2_timestamps_s &ekf2_timestamps)
 
 	if (_vehicle_gps_position_sub.update(&vehicle_gps_position)) {
 
-		Vector3f vel_ned;
-
-		if (vehicle_gps_position.vel_ned_valid) {
-			vel_ned = Vector3f(vehicle_gps_position.vel_n_m_s,
-					   vehicle_gps_position.vel_e_m_s,
-					   vehicle_gps_position.vel_d_m_s);
+		gnssSample gnss_sample;
 
-		} else {
+		if (!ekf2::gnssSampleFromSensorGps(vehicle_gps_position, _param_ekf2_gps_yaw_off.get(), gnss_sample)) {
 			return; //TODO: change and set to NAN
 		}
 
-		if (fabsf(_param_ekf2_gps_yaw_off.get()) > 0.f) {
-			if (!PX4_ISFINITE(vehicle_gps_position.heading_offset) && PX4_ISFINITE(vehicle_gps_position.heading)) {
-				// Apply offset
-				float yaw_offset = matrix::wrap_pi(math::radians(_param_ekf2_gps_yaw_off.get()));
-				vehicle_gps_position.heading_offset = yaw_offset;
-				vehicle_gps_position.heading = matrix::wrap_pi(vehicle_gps_position.heading - yaw_offset);
-			}
-		}
-
-		const float altitude_amsl = static_cast<float>(vehicle_gps_position.altitude_msl_m);
-		const float altitude_ellipsoid = static_cast<float>(vehicle_gps_position.altitude_ellipsoid_m);
-
-		gnssSample gnss_sample{
-			.time_us = vehicle_gps_position.timestamp,
-			.lat = vehicle_gps_position.latitude_deg,
-			.lon = vehicle_gps_position.longitude_deg,
-			.alt = altitude_amsl,
-			.vel = vel_ned,
-			.hacc = vehicle_gps_position.eph,
-			.vacc = vehicle_gps_position.epv,
-			.sacc = vehicle_gps_position.s_variance_m_s,
-			.fix_type = vehicle_gps_position.fix_type,
-			.nsats = vehicle_gps_position.satellites_used,
-			.pdop = sqrtf(vehicle_gps_position.hdop *vehicle_gps_position.hdop
-				      + vehicle_gps_position.vdop * vehicle_gps_position.vdop),
-			.yaw = vehicle_gps_position.heading, //TODO: move to different message
-			.yaw_acc = vehicle_gps_position.heading_accuracy,
-			.yaw_offset = vehicle_gps_position.heading_offset,
-			.spoofed = vehicle_gps_position.spoofing_state == sensor_gps_s::SPOOFING_STATE_MULTIPLE,
-		};
-
 		_ekf.setGpsData(gnss_sample);
 
-		const float geoid_height = altitude_ellipsoid - altitude_amsl;
+		const float geoid_height = static_cast<float>(vehicle_gps_position.altitude_ellipsoid_m) - gnss_sample.alt;
 
 		if (_last_geoid_height_update_us == 0) {
 			_geoid_height_lpf.reset(geoid_height);
@@ -2508,7 +2373,7 @@ void EKF2::UpdateMagSample(ekf2_timestamps_s &ekf2_timestamps)
 			_mag_cal = {};
 		}
 
-		_ekf.setMagData(magSample{magnetometer.timestamp_sample, Vector3f{magnetometer.magnetometer_ga}, reset});
+		_ekf.setMagData(ekf2::magSampleFromMagnetometer(magnetometer, reset));
 
 		ekf2_timestamps.vehicle_magnetometer_timestamp_rel = (int16_t)((int64_t)magnetometer.timestamp / 100 -
 				(int64_t)ekf2_timestamps.timestamp / 100);
@@ -2587,21 +2452,14 @@ void EKF2::UpdateSystemFlagsSample(ekf2_timestamps_s &ekf2_timestamps)
 		// vehicle_status
 		vehicle_status_s vehicle_status;
 
-		if (_status_sub.copy(&vehicle_status)
-		    && (ekf2_timestamps.timestamp < vehicle_status.timestamp + 3_s)) {
-
-			// initially set in_air from arming_state (will be overridden if land detector is available)
-			flags.in_air = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
-
-			// let the EKF know if the vehicle motion is that of a fixed wing (forward flight only relative to wind)
-			flags.is_fixed_wing = (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING);
+		if (_status_sub.copy(&vehicle_status) && ekf2::updateSystemFlags(flags, vehicle_status)) {
 
 #if defined(CONFIG_EKF2_SIDESLIP)
 
 			if (vehicle_status.is_vtol_tailsitter && _params->beta_fusion_enabled) {
 				PX4_WARN("Disable EKF beta fusion as unsupported for tailsitter");
-				_param_ekf2_fuse_beta.set(0);
-				_param_ekf2_fuse_beta.commit_no_notification();
+				_params->beta_fusion_enabled = 0;
+				param_set_no_notification(param_handle(px4::params::EKF2_FUSE_BETA), &_params->beta_fusion_enabled);
 			}
 
 #endif // CONFIG_EKF2_SIDESLIP
@@ -2610,21 +2468,14 @@ void EKF2::UpdateSystemFlagsSample(ekf2_timestamps_s &ekf2_timestamps)
 		// vehicle_land_detected
 		vehicle_land_detected_s vehicle_land_detected;
 
-		if (_vehicle_land_detected_sub.copy(&vehicle_land_detected)
-		    && (ekf2_timestamps.timestamp < vehicle_land_detected.timestamp + 3_s)) {
-
-			flags.at_rest = vehicle_land_detected.at_rest;
-			flags.in_air = !vehicle_land_detected.landed;
-			flags.gnd_effect = vehicle_land_detected.in_ground_effect;
+		if (_vehicle_land_detected_sub.copy(&vehicle_land_detected)) {
+			ekf2::updateSystemFlags(flags, vehicle_land_detected);
 		}
 
 		launch_detection_status_s launch_detection_status;
 
-		if (_launch_detection_status_sub.copy(&launch_detection_status)
-		    && (ekf2_timestamps.timestamp < launch_detection_status.timestamp + 3_s)) {
-
-			flags.constant_pos = (launch_detection_status.launch_detection_state ==
-					      launch_detection_status_s::STATE_WAITING_FOR_LAUNCH);
+		if (_launch_detection_status_sub.copy(&launch_detection_status)) {
+			ekf2::updateSystemFlags(flags, launch_detection_status);
 		}
 
 		_ekf.setSystemFlagData(flags);
@@ -2685,7 +2536,7 @@ void EKF2::UpdateCalibration(const hrt_abstime &timestamp, InFlightCalibration &
 void EKF2::UpdateAccelCalibration(const hrt_abstime &timestamp)
 {
 	// the EKF is operating in the correct mode and there are no filter faults
-	const bool bias_valid = (_param_ekf2_imu_ctrl.get() & static_cast<int32_t>(ImuCtrl::AccelBias))
+	const bool bias_valid = (_params->imu_ctrl & static_cast<int32_t>(ImuCtrl::AccelBias))
 				&& _ekf.control_status_flags().tilt_align
 				&& (_ekf.fault_status().value == 0)
 				&& !_ekf.fault_status_flags().bad_acc_clipping
@@ -2700,7 +2551,7 @@ void EKF2::UpdateAccelCalibration(const hrt_abstime &timestamp)
 void EKF2::UpdateGyroCalibration(const hrt_abstime &timestamp)
 {
 	// the EKF is operating in the correct mode and there are no filter faults
-	const bool bias_valid = (_param_ekf2_imu_ctrl.get() & static_cast<int32_t>(ImuCtrl::GyroBias))
+	const bool bias_valid = (_params->imu_ctrl & static_cast<int32_t>(ImuCtrl::GyroBias))
 				&& _ekf.control_status_flags().tilt_align
 				&& (_ekf.fault_status().value == 0);
 
@@ -2729,11 +2580,12 @@ void EKF2::UpdateMagCalibration(const hrt_abstime &timestamp)
 		float declination_deg;
 
 		if (_ekf.get_mag_decl_deg(declination_deg)) {
-			_param_ekf2_mag_decl.update();
+			const param_t param_mag_decl = param_handle(px4::params::EKF2_MAG_DECL);
+			param_get(param_mag_decl, &_params->mag_declination_deg);
 
-			if (PX4_ISFINITE(declination_deg) && (fabsf(declination_deg - _param_ekf2_mag_decl.get()) > 0.1f)) {
-				_param_ekf2_mag_decl.set(declination_deg);
-				_param_ekf2_mag_decl.commit_no_notification();
+			if (PX4_ISFINITE(declination_deg) && (fabsf(declination_deg - _params->mag_declination_deg) > 0.1f)) {
+				_params->mag_declination_deg = declination_deg;
+				param_set_no_notification(param_mag_decl, &_params->mag_declination_deg);
 			}
 
 			_mag_decl_saved = true;
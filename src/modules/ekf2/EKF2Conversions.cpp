@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "EKF2Conversions.hpp"
+
+#include <float.h>
+#include <math.h>
+
+#include <lib/mathlib/mathlib.h>
+
+using matrix::Vector3f;
+
+namespace ekf2
+{
+
+// vehicle state older than this is ignored
+static constexpr uint64_t kSystemStateTimeoutUs{3'000'000};
+
+estimator::imuSample imuSampleFromSensorCombined(const sensor_combined_s &sensor_combined)
+{
+	estimator::imuSample imu_sample{};
+	imu_sample.time_us = sensor_combined.timestamp;
+	imu_sample.delta_ang_dt = sensor_combined.gyro_integral_dt * 1.e-6f;
+	imu_sample.delta_ang = Vector3f{sensor_combined.gyro_rad} * imu_sample.delta_ang_dt;
+	imu_sample.delta_vel_dt = sensor_combined.accelerometer_integral_dt * 1.e-6f;
+	imu_sample.delta_vel = Vector3f{sensor_combined.accelerometer_m_s2} * imu_sample.delta_vel_dt;
+
+	if (sensor_combined.accelerometer_clipping > 0) {
+		imu_sample.delta_vel_clipping[0] = sensor_combined.accelerometer_clipping & sensor_combined_s::CLIPPING_X;
+		imu_sample.delta_vel_clipping[1] = sensor_combined.accelerometer_clipping & sensor_combined_s::CLIPPING_Y;
+		imu_sample.delta_vel_clipping[2] = sensor_combined.accelerometer_clipping & sensor_combined_s::CLIPPING_Z;
+	}
+
+	return imu_sample;
+}
+
+estimator::imuSample imuSampleFromVehicleImu(const vehicle_imu_s &imu)
+{
+	estimator::imuSample imu_sample{};
+	imu_sample.time_us = imu.timestamp_sample;
+	imu_sample.delta_ang_dt = imu.delta_angle_dt * 1.e-6f;
+	imu_sample.delta_ang = Vector3f{imu.delta_angle};
+	imu_sample.delta_vel_dt = imu.delta_velocity_dt * 1.e-6f;
+	imu_sample.delta_vel = Vector3f{imu.delta_velocity};
+
+	if (imu.delta_velocity_clipping > 0) {
+		imu_sample.delta_vel_clipping[0] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_X;
+		imu_sample.delta_vel_clipping[1] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Y;
+		imu_sample.delta_vel_clipping[2] = imu.delta_velocity_clipping & vehicle_imu_s::CLIPPING_Z;
+	}
+
+	return imu_sample;
+}
+
+#if defined(CONFIG_EKF2_AIRSPEED)
+bool airspeedSampleFromAirspeedValidated(const airspeed_validated_s &airspeed_validated,
+		estimator::airspeedSample &airspeed_sample)
+{
+	if (!PX4_ISFINITE(airspeed_validated.true_airspeed_m_s) || (airspeed_validated.selected_airspeed_index <= 0)) {
+		return false;
+	}
+
+	float cas2tas = 1.f;
+
+	if (PX4_ISFINITE(airspeed_validated.calibrated_airspeed_m_s)
+	    && (airspeed_validated.calibrated_airspeed_m_s > FLT_EPSILON)) {
+		cas2tas = airspeed_validated.true_airspeed_m_s / airspeed_validated.calibrated_airspeed_m_s;
+	}
+
+	airspeed_sample = estimator::airspeedSample{
+		.time_us = airspeed_validated.timestamp,
+		.true_airspeed = airspeed_validated.true_airspeed_m_s,
+		.eas2tas = cas2tas,
+	};
+
+	return true;
+}
+
+bool airspeedSampleFromAirspeed(const airspeed_s &airspeed, float scale_factor,
+				estimator::airspeedSample &airspeed_sample)
+{
+	if (!PX4_ISFINITE(airspeed.true_airspeed_m_s)
+	    || !PX4_ISFINITE(airspeed.indicated_airspeed_m_s)
+	    || (airspeed.indicated_airspeed_m_s <= 0.f)
+	   ) {
+		return false;
+	}
+
+	airspeed_sample = estimator::airspeedSample{
+		.time_us = airspeed.timestamp_sample,
+		.true_airspeed = airspeed.true_airspeed_m_s * scale_factor,
+		.eas2tas = airspeed.true_airspeed_m_s / airspeed.indicated_airspeed_m_s,
+	};
+
+	return true;
+}
+#endif // CONFIG_EKF2_AIRSPEED
+
+#if defined(CONFIG_EKF2_BAROMETER)
+estimator::baroSample baroSampleFromAirData(const vehicle_air_data_s &airdata, bool reset)
+{
+	return estimator::baroSample{airdata.timestamp_sample, airdata.baro_alt_meter, reset};
+}
+#endif // CONFIG_EKF2_BAROMETER
+
+#if defined(CONFIG_EKF2_GNSS)
+bool gnssSampleFromSensorGps(const sensor_gps_s &gps, float yaw_offset_deg, estimator::gnssSample &gnss_sample)
+{
+	if (!gps.vel_ned_valid) {
+		return false; //TODO: change and set to NAN
+	}
+
+	float heading = gps.heading;
+	float heading_offset = gps.heading_offset;
+
+	if (fabsf(yaw_offset_deg) > 0.f) {
+		if (!PX4_ISFINITE(heading_offset) && PX4_ISFINITE(heading)) {
+			// Apply offset
+			heading_offset = matrix::wrap_pi(math::radians(yaw_offset_deg));
+			heading = matrix::wrap_pi(heading - heading_offset);
+		}
+	}
+
+	gnss_sample = estimator::gnssSample{
+		.time_us = gps.timestamp,
+		.lat = gps.latitude_deg,
+		.lon = gps.longitude_deg,
+		.alt = static_cast<float>(gps.altitude_msl_m),
+		.vel = Vector3f{gps.vel_n_m_s, gps.vel_e_m_s, gps.vel_d_m_s},
+		.hacc = gps.eph,
+		.vacc = gps.epv,
+		.sacc = gps.s_variance_m_s,
+		.fix_type = gps.fix_type,
+		.nsats = gps.satellites_used,
+		.pdop = sqrtf(gps.hdop * gps.hdop + gps.vdop * gps.vdop),
+		.yaw = heading, //TODO: move to different message
+		.yaw_acc = gps.heading_accuracy,
+		.yaw_offset = heading_offset,
+		.spoofed = gps.spoofing_state == sensor_gps_s::SPOOFING_STATE_MULTIPLE,
+	};
+
+	return true;
+}
+#endif // CONFIG_EKF2_GNSS
+
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+estimator::magSample magSampleFromMagnetometer(const vehicle_magnetometer_s &magnetometer, bool reset)
+{
+	return estimator::magSample{magnetometer.timestamp_sample, Vector3f{magnetometer.magnetometer_ga}, reset};
+}
+#endif // CONFIG_EKF2_MAGNETOMETER
+
+bool updateSystemFlags(estimator::systemFlagUpdate &flags, const vehicle_status_s &vehicle_status)
+{
+	if (flags.time_us >= vehicle_status.timestamp + kSystemStateTimeoutUs) {
+		return false;
+	}
+
+	// initially set in_air from arming_state (will be overridden if land detector is available)
+	flags.in_air = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
+
+	// let the EKF know if the vehicle motion is that of a fixed wing (forward flight only relative to wind)
+	flags.is_fixed_wing = (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING);
+
+	return true;
+}
+
+bool updateSystemFlags(estimator::systemFlagUpdate &flags, const vehicle_land_detected_s &vehicle_land_detected)
+{
+	if (flags.time_us >= vehicle_land_detected.timestamp + kSystemStateTimeoutUs) {
+		return false;
+	}
+
+	flags.at_rest = vehicle_land_detected.at_rest;
+	flags.in_air = !vehicle_land_detected.landed;
+	flags.gnd_effect = vehicle_land_detected.in_ground_effect;
+
+	return true;
+}
+
+bool updateSystemFlags(estimator::systemFlagUpdate &flags, const launch_detection_status_s &launch_detection_status)
+{
+	if (flags.time_us >= launch_detection_status.timestamp + kSystemStateTimeoutUs) {
+		return false;
+	}
+
+	flags.constant_pos = (launch_detection_status.launch_detection_state ==
+			      launch_detection_status_s::STATE_WAITING_FOR_LAUNCH);
+
+	return true;
+}
+
+} // namespace ekf2
@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file EKF2Conversions.hpp
+ * Conversion of the sensor and vehicle state topics to estimator samples.
+ *
+ * Used by the ekf2 module and by ekf2_offline, so that logs are reprocessed with the
+ * same inputs as in flight.
+ */
+
+#pragma once
+
+#include "EKF/common.h"
+
+#include <uORB/topics/airspeed.h>
+#include <uORB/topics/airspeed_validated.h>
+#include <uORB/topics/launch_detection_status.h>
+#include <uORB/topics/sensor_combined.h>
+#include <uORB/topics/sensor_gps.h>
+#include <uORB/topics/vehicle_air_data.h>
+#include <uORB/topics/vehicle_imu.h>
+#include <uORB/topics/vehicle_land_detected.h>
+#include <uORB/topics/vehicle_magnetometer.h>
+#include <uORB/topics/vehicle_status.h>
+
+namespace ekf2
+{
+
+estimator::imuSample imuSampleFromSensorCombined(const sensor_combined_s &sensor_combined);
+estimator::imuSample imuSampleFromVehicleImu(const vehicle_imu_s &imu);
+
+#if defined(CONFIG_EKF2_AIRSPEED)
+/**
+ * @return false if no airspeed sensor is selected
+ */
+bool airspeedSampleFromAirspeedValidated(const airspeed_validated_s &airspeed_validated,
+		estimator::airspeedSample &airspeed_sample);
+
+/**
+ * Raw airspeed, the scale factor (ASPD_SCALE_1) isn't applied by the airspeed driver
+ * @return false if the measurement is invalid
+ */
+bool airspeedSampleFromAirspeed(const airspeed_s &airspeed, float scale_factor,
+				estimator::airspeedSample &airspeed_sample);
+#endif // CONFIG_EKF2_AIRSPEED
+
+#if defined(CONFIG_EKF2_BAROMETER)
+estimator::baroSample baroSampleFromAirData(const vehicle_air_data_s &airdata, bool reset);
+#endif // CONFIG_EKF2_BAROMETER
+
+#if defined(CONFIG_EKF2_GNSS)
+/**
+ * @param yaw_offset_deg antenna heading offset (EKF2_GPS_YAW_OFF), used if the receiver doesn't report it
+ * @return false if the report has no valid velocity
+ */
+bool gnssSampleFromSensorGps(const sensor_gps_s &gps, float yaw_offset_deg, estimator::gnssSample &gnss_sample);
+#endif // CONFIG_EKF2_GNSS
+
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+estimator::magSample magSampleFromMagnetometer(const vehicle_magnetometer_s &magnetometer, bool reset);
+#endif // CONFIG_EKF2_MAGNETOMETER
+
+/**
+ * Update the system flags (at flags.time_us) from the vehicle state
+ * @return false if the state is too old to be used
+ */
+bool updateSystemFlags(estimator::systemFlagUpdate &flags, const vehicle_status_s &vehicle_status);
+bool updateSystemFlags(estimator::systemFlagUpdate &flags, const vehicle_land_detected_s &vehicle_land_detected);
+bool updateSystemFlags(estimator::systemFlagUpdate &flags, const launch_detection_status_s &launch_detection_status);
+
+} // namespace ekf2
@@ -0,0 +1,249 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file EKF2Params.hpp
+ * Binding of the EKF2 parameters to the estimator parameter struct.
+ *
+ * The ekf2 module reads the values from the parameter storage, ekf2_offline takes them
+ * from the parameters stored in the log. The names, types and default values are those
+ * of the generated parameter metadata.
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include <px4_platform_common/param.h>
+
+#include "EKF/common.h"
+
+namespace ekf2
+{
+
+template<px4::params p>
+using ParamValueType = std::conditional_t<px4::parameters_type[static_cast<int>(p)] == PARAM_TYPE_FLOAT, float, int32_t>;
+
+struct ParamBinding {
+	px4::params param;
+
+	// member of the estimator parameters bound to the parameter, depending on the parameter type
+	float *(*value_float)(estimator::parameters &params);
+	int32_t *(*value_int)(estimator::parameters &params);
+
+	const char *name() const { return px4::parameters[static_cast<int>(param)].name; }
+	param_value_u defaultValue() const { return px4::parameters[static_cast<int>(param)].val; }
+
+	template<px4::params p, typename F>
+	static constexpr ParamBinding make(F value)
+	{
+		if constexpr (std::is_same<ParamValueType<p>, float>::value) {
+			return ParamBinding{p, value, nullptr};
+
+		} else {
+			return ParamBinding{p, nullptr, value};
+		}
+	}
+};
+
+// the member must have the type of the parameter
+#define EKF2_PARAM(name, member) \
+	ParamBinding::make<px4::params::name>([](estimator::parameters & params) -> ParamValueType<px4::params::name> * { \
+		return &params.member; \
+	})
+
+inline constexpr ParamBinding kParamBindings[] {
+	EKF2_PARAM(EKF2_PREDICT_US, filter_update_interval_us),
+	EKF2_PARAM(EKF2_DELAY_MAX, delay_max_ms),
+	EKF2_PARAM(EKF2_IMU_CTRL, imu_ctrl),
+	EKF2_PARAM(EKF2_VEL_LIM, velocity_limit),
+#if defined(CONFIG_EKF2_FIXED_LAG_SMOOTHER)
+	EKF2_PARAM(EKF2_FLS_LEN, fls_length),
+#endif // CONFIG_EKF2_FIXED_LAG_SMOOTHER
+#if defined(CONFIG_EKF2_AUXVEL)
+	EKF2_PARAM(EKF2_AVEL_DELAY, auxvel_delay_ms),
+#endif // CONFIG_EKF2_AUXVEL
+	EKF2_PARAM(EKF2_GYR_NOISE, gyro_noise),
+	EKF2_PARAM(EKF2_ACC_NOISE, accel_noise),
+	EKF2_PARAM(EKF2_GYR_B_NOISE, gyro_bias_p_noise),
+	EKF2_PARAM(EKF2_ACC_B_NOISE, accel_bias_p_noise),
+#if defined(CONFIG_EKF2_WIND)
+	EKF2_PARAM(EKF2_WIND_NSD, wind_vel_nsd),
+#endif // CONFIG_EKF2_WIND
+	EKF2_PARAM(EKF2_NOAID_NOISE, pos_noaid_noise),
+#if defined(CONFIG_EKF2_GNSS)
+	EKF2_PARAM(EKF2_GPS_CTRL, gnss_ctrl),
+	EKF2_PARAM(EKF2_GPS_DELAY, gps_delay_ms),
+	EKF2_PARAM(EKF2_GPS_POS_X, gps_pos_body(0)),
+	EKF2_PARAM(EKF2_GPS_POS_Y, gps_pos_body(1)),
+	EKF2_PARAM(EKF2_GPS_POS_Z, gps_pos_body(2)),
+	EKF2_PARAM(EKF2_GPS_V_NOISE, gps_vel_noise),
+	EKF2_PARAM(EKF2_GPS_P_NOISE, gps_pos_noise),
+	EKF2_PARAM(EKF2_GPS_P_GATE, gps_pos_innov_gate),
+	EKF2_PARAM(EKF2_GPS_V_GATE, gps_vel_innov_gate),
+	EKF2_PARAM(EKF2_GPS_CHECK, gps_check_mask),
+	EKF2_PARAM(EKF2_REQ_EPH, req_hacc),
+	EKF2_PARAM(EKF2_REQ_EPV, req_vacc),
+	EKF2_PARAM(EKF2_REQ_SACC, req_sacc),
+	EKF2_PARAM(EKF2_REQ_NSATS, req_nsats),
+	EKF2_PARAM(EKF2_REQ_PDOP, req_pdop),
+	EKF2_PARAM(EKF2_REQ_HDRIFT, req_hdrift),
+	EKF2_PARAM(EKF2_REQ_VDRIFT, req_vdrift),
+	EKF2_PARAM(EKF2_REQ_GPS_H, req_gps_health),
+	EKF2_PARAM(EKF2_GSF_TAS, EKFGSF_tas_default),
+#endif // CONFIG_EKF2_GNSS
+#if defined(CONFIG_EKF2_BAROMETER)
+	EKF2_PARAM(EKF2_BARO_CTRL, baro_ctrl),
+	EKF2_PARAM(EKF2_BARO_DELAY, baro_delay_ms),
+	EKF2_PARAM(EKF2_BARO_NOISE, baro_noise),
+	EKF2_PARAM(EKF2_BARO_GATE, baro_innov_gate),
+	EKF2_PARAM(EKF2_GND_EFF_DZ, gnd_effect_deadzone),
+	EKF2_PARAM(EKF2_GND_MAX_HGT, gnd_effect_max_hgt),
+# if defined(CONFIG_EKF2_BARO_COMPENSATION)
+	EKF2_PARAM(EKF2_ASPD_MAX, max_correction_airspeed),
+	EKF2_PARAM(EKF2_PCOEF_XP, static_pressure_coef_xp),
+	EKF2_PARAM(EKF2_PCOEF_XN, static_pressure_coef_xn),
+	EKF2_PARAM(EKF2_PCOEF_YP, static_pressure_coef_yp),
+	EKF2_PARAM(EKF2_PCOEF_YN, static_pressure_coef_yn),
+	EKF2_PARAM(EKF2_PCOEF_Z, static_pressure_coef_z),
+# endif // CONFIG_EKF2_BARO_COMPENSATION
+#endif // CONFIG_EKF2_BAROMETER
+#if defined(CONFIG_EKF2_AIRSPEED)
+	EKF2_PARAM(EKF2_ASP_DELAY, airspeed_delay_ms),
+	EKF2_PARAM(EKF2_TAS_GATE, tas_innov_gate),
+	EKF2_PARAM(EKF2_EAS_NOISE, eas_noise),
+	EKF2_PARAM(EKF2_ARSP_THR, arsp_thr),
+#endif // CONFIG_EKF2_AIRSPEED
+#if defined(CONFIG_EKF2_SIDESLIP)
+	EKF2_PARAM(EKF2_BETA_GATE, beta_innov_gate),
+	EKF2_PARAM(EKF2_BETA_NOISE, beta_noise),
+	EKF2_PARAM(EKF2_FUSE_BETA, beta_fusion_enabled),
+#endif // CONFIG_EKF2_SIDESLIP
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+	EKF2_PARAM(EKF2_MAG_DELAY, mag_delay_ms),
+	EKF2_PARAM(EKF2_MAG_E_NOISE, mage_p_noise),
+	EKF2_PARAM(EKF2_MAG_B_NOISE, magb_p_noise),
+	EKF2_PARAM(EKF2_HEAD_NOISE, mag_heading_noise),
+	EKF2_PARAM(EKF2_MAG_NOISE, mag_noise),
+	EKF2_PARAM(EKF2_MAG_DECL, mag_declination_deg),
+	EKF2_PARAM(EKF2_HDG_GATE, heading_innov_gate),
+	EKF2_PARAM(EKF2_MAG_GATE, mag_innov_gate),
+	EKF2_PARAM(EKF2_DECL_TYPE, mag_declination_source),
+	EKF2_PARAM(EKF2_MAG_TYPE, mag_fusion_type),
+	EKF2_PARAM(EKF2_MAG_ACCLIM, mag_acc_gate),
+	EKF2_PARAM(EKF2_MAG_CHECK, mag_check),
+	EKF2_PARAM(EKF2_MAG_CHK_STR, mag_check_strength_tolerance_gs),
+	EKF2_PARAM(EKF2_MAG_CHK_INC, mag_check_inclination_tolerance_deg),
+	EKF2_PARAM(EKF2_SYNT_MAG_Z, synthesize_mag_z),
+#endif // CONFIG_EKF2_MAGNETOMETER
+	EKF2_PARAM(EKF2_HGT_REF, height_sensor_ref),
+	EKF2_PARAM(EKF2_NOAID_TOUT, valid_timeout_max),
+#if defined(CONFIG_EKF2_TERRAIN) || defined(CONFIG_EKF2_OPTICAL_FLOW) || defined(CONFIG_EKF2_RANGE_FINDER)
+	EKF2_PARAM(EKF2_MIN_RNG, rng_gnd_clearance),
+#endif // CONFIG_EKF2_TERRAIN || CONFIG_EKF2_OPTICAL_FLOW || CONFIG_EKF2_RANGE_FINDER
+#if defined(CONFIG_EKF2_TERRAIN)
+	EKF2_PARAM(EKF2_TERR_NOISE, terrain_p_noise),
+	EKF2_PARAM(EKF2_TERR_GRAD, terrain_gradient),
+#endif // CONFIG_EKF2_TERRAIN
+#if defined(CONFIG_EKF2_RANGE_FINDER)
+	EKF2_PARAM(EKF2_RNG_CTRL, rng_ctrl),
+	EKF2_PARAM(EKF2_RNG_DELAY, range_delay_ms),
+	EKF2_PARAM(EKF2_RNG_NOISE, range_noise),
+	EKF2_PARAM(EKF2_RNG_SFE, range_noise_scaler),
+	EKF2_PARAM(EKF2_RNG_GATE, range_innov_gate),
+	EKF2_PARAM(EKF2_RNG_PITCH, rng_sens_pitch),
+	EKF2_PARAM(EKF2_RNG_A_VMAX, max_vel_for_range_aid),
+	EKF2_PARAM(EKF2_RNG_A_HMAX, max_hagl_for_range_aid),
+	EKF2_PARAM(EKF2_RNG_A_IGATE, range_aid_innov_gate),
+	EKF2_PARAM(EKF2_RNG_QLTY_T, range_valid_quality_s),
+	EKF2_PARAM(EKF2_RNG_K_GATE, range_kin_consistency_gate),
+	EKF2_PARAM(EKF2_RNG_FOG, rng_fog),
+	EKF2_PARAM(EKF2_RNG_POS_X, rng_pos_body(0)),
+	EKF2_PARAM(EKF2_RNG_POS_Y, rng_pos_body(1)),
+	EKF2_PARAM(EKF2_RNG_POS_Z, rng_pos_body(2)),
+#endif // CONFIG_EKF2_RANGE_FINDER
+#if defined(CONFIG_EKF2_EXTERNAL_VISION)
+	EKF2_PARAM(EKF2_EV_DELAY, ev_delay_ms),
+	EKF2_PARAM(EKF2_EV_CTRL, ev_ctrl),
+	EKF2_PARAM(EKF2_EV_QMIN, ev_quality_minimum),
+	EKF2_PARAM(EKF2_EVP_NOISE, ev_pos_noise),
+	EKF2_PARAM(EKF2_EVV_NOISE, ev_vel_noise),
+	EKF2_PARAM(EKF2_EVA_NOISE, ev_att_noise),
+	EKF2_PARAM(EKF2_EVV_GATE, ev_vel_innov_gate),
+	EKF2_PARAM(EKF2_EVP_GATE, ev_pos_innov_gate),
+	EKF2_PARAM(EKF2_EV_POS_X, ev_pos_body(0)),
+	EKF2_PARAM(EKF2_EV_POS_Y, ev_pos_body(1)),
+	EKF2_PARAM(EKF2_EV_POS_Z, ev_pos_body(2)),
+#endif // CONFIG_EKF2_EXTERNAL_VISION
+#if defined(CONFIG_EKF2_OPTICAL_FLOW)
+	EKF2_PARAM(EKF2_OF_CTRL, flow_ctrl),
+	EKF2_PARAM(EKF2_OF_GYR_SRC, flow_gyro_src),
+	EKF2_PARAM(EKF2_OF_DELAY, flow_delay_ms),
+	EKF2_PARAM(EKF2_OF_N_MIN, flow_noise),
+	EKF2_PARAM(EKF2_OF_N_MAX, flow_noise_qual_min),
+	EKF2_PARAM(EKF2_OF_QMIN, flow_qual_min),
+	EKF2_PARAM(EKF2_OF_QMIN_GND, flow_qual_min_gnd),
+	EKF2_PARAM(EKF2_OF_GATE, flow_innov_gate),
+	EKF2_PARAM(EKF2_OF_POS_X, flow_pos_body(0)),
+	EKF2_PARAM(EKF2_OF_POS_Y, flow_pos_body(1)),
+	EKF2_PARAM(EKF2_OF_POS_Z, flow_pos_body(2)),
+#endif // CONFIG_EKF2_OPTICAL_FLOW
+#if defined(CONFIG_EKF2_DRAG_FUSION)
+	EKF2_PARAM(EKF2_DRAG_CTRL, drag_ctrl),
+	EKF2_PARAM(EKF2_DRAG_NOISE, drag_noise),
+	EKF2_PARAM(EKF2_BCOEF_X, bcoef_x),
+	EKF2_PARAM(EKF2_BCOEF_Y, bcoef_y),
+	EKF2_PARAM(EKF2_MCOEF, mcoef),
+#endif // CONFIG_EKF2_DRAG_FUSION
+#if defined(CONFIG_EKF2_GRAVITY_FUSION)
+	EKF2_PARAM(EKF2_GRAV_NOISE, gravity_noise),
+#endif // CONFIG_EKF2_GRAVITY_FUSION
+	EKF2_PARAM(EKF2_IMU_POS_X, imu_pos_body(0)),
+	EKF2_PARAM(EKF2_IMU_POS_Y, imu_pos_body(1)),
+	EKF2_PARAM(EKF2_IMU_POS_Z, imu_pos_body(2)),
+	EKF2_PARAM(EKF2_GBIAS_INIT, switch_on_gyro_bias),
+	EKF2_PARAM(EKF2_ABIAS_INIT, switch_on_accel_bias),
+	EKF2_PARAM(EKF2_ANGERR_INIT, initial_tilt_err),
+	EKF2_PARAM(EKF2_ABL_LIM, acc_bias_lim),
+	EKF2_PARAM(EKF2_ABL_ACCLIM, acc_bias_learn_acc_lim),
+	EKF2_PARAM(EKF2_ABL_GYRLIM, acc_bias_learn_gyr_lim),
+	EKF2_PARAM(EKF2_ABL_TAU, acc_bias_learn_tc),
+	EKF2_PARAM(EKF2_GYR_B_LIM, gyro_bias_lim),
+	EKF2_PARAM(EKF2_TAU_VEL, vel_tau),
+	EKF2_PARAM(EKF2_TAU_POS, pos_tau),
+};
+
+#undef EKF2_PARAM
+
+} // namespace ekf2
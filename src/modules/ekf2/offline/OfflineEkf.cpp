@@ -0,0 +1,884 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "OfflineEkf.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#include <lib/atmosphere/atmosphere.h>
+
+using matrix::Eulerf;
+using matrix::Quatf;
+using matrix::Vector3f;
+
+namespace ekf2_offline
+{
+
+// copy a vector into a (possibly unaligned) packed record field
+template<size_t N>
+static void copyVector(void *dst, const matrix::Vector<float, N> &v)
+{
+	float tmp[N];
+	v.copyTo(tmp);
+	memcpy(dst, tmp, sizeof(tmp));
+}
+
+/*
+ * Output topics, a subset of the fields published by EKF2. The field names are those of the uORB
+ * messages, the topics are named ekf2_offline_* so that they can't be mistaken for the full messages.
+ */
+#pragma pack(push, 1)
+struct AttitudeRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	float q[4];
+	float delta_q_reset[4];
+	uint8_t quat_reset_counter;
+};
+
+struct LocalPositionRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	float x;
+	float y;
+	float z;
+	float vx;
+	float vy;
+	float vz;
+	float z_deriv;
+	float ax;
+	float ay;
+	float az;
+	float heading;
+	float heading_var;
+	float unaided_heading;
+	float tilt_var;
+	float eph;
+	float epv;
+	float evh;
+	float evv;
+	double ref_lat;
+	double ref_lon;
+	float ref_alt;
+	uint8_t xy_reset_counter;
+	uint8_t z_reset_counter;
+	uint8_t vxy_reset_counter;
+	uint8_t vz_reset_counter;
+	uint8_t heading_reset_counter;
+	bool xy_valid;
+	bool z_valid;
+	bool v_xy_valid;
+	bool v_z_valid;
+	bool xy_global;
+	bool z_global;
+	bool heading_good_for_control;
+	bool dead_reckoning;
+};
+
+struct GlobalPositionRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	double lat;
+	double lon;
+	float alt;
+	float eph;
+	float epv;
+	bool lat_lon_valid;
+	bool alt_valid;
+	bool dead_reckoning;
+};
+
+struct EstimatorStatesRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	float states[25];
+	uint8_t n_states;
+	float covariances[24];
+};
+
+struct EstimatorStatusRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	uint64_t control_mode_flags;
+	uint32_t filter_fault_flags;
+	float vel_test_ratio;
+	float pos_test_ratio;
+	float hgt_test_ratio;
+	float hdg_test_ratio;
+	float tas_test_ratio;
+	float hagl_test_ratio;
+	float beta_test_ratio;
+	float pos_horiz_accuracy;
+	float pos_vert_accuracy;
+	uint16_t solution_status_flags;
+	uint8_t reset_count_vel_ne;
+	uint8_t reset_count_vel_d;
+	uint8_t reset_count_pos_ne;
+	uint8_t reset_count_pod_d;
+	uint8_t reset_count_quat;
+};
+
+struct SensorBiasRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	float gyro_bias[3];
+	float gyro_bias_variance[3];
+	float accel_bias[3];
+	float accel_bias_variance[3];
+	float mag_bias[3];
+	float mag_bias_variance[3];
+};
+#pragma pack(pop)
+
+static constexpr char kAttitudeFormat[] = "ekf2_offline_attitude:"
+		"uint64_t timestamp;uint64_t timestamp_sample;float[4] q;float[4] delta_q_reset;uint8_t quat_reset_counter;";
+
+static constexpr char kLocalPositionFormat[] = "ekf2_offline_local_position:"
+		"uint64_t timestamp;uint64_t timestamp_sample;float x;float y;float z;float vx;float vy;float vz;float z_deriv;"
+		"float ax;float ay;float az;"
+		"float heading;float heading_var;float unaided_heading;float tilt_var;float eph;float epv;float evh;float evv;"
+		"double ref_lat;double ref_lon;float ref_alt;uint8_t xy_reset_counter;uint8_t z_reset_counter;"
+		"uint8_t vxy_reset_counter;uint8_t vz_reset_counter;uint8_t heading_reset_counter;bool xy_valid;bool z_valid;"
+		"bool v_xy_valid;bool v_z_valid;bool xy_global;bool z_global;bool heading_good_for_control;bool dead_reckoning;";
+
+static constexpr char kGlobalPositionFormat[] = "ekf2_offline_global_position:"
+		"uint64_t timestamp;uint64_t timestamp_sample;double lat;double lon;float alt;float eph;float epv;bool lat_lon_valid;"
+		"bool alt_valid;bool dead_reckoning;";
+
+static constexpr char kEstimatorStatesFormat[] = "ekf2_offline_states:uint64_t timestamp;uint64_t timestamp_sample;"
+		"float[25] states;uint8_t n_states;float[24] covariances;";
+
+static constexpr char kEstimatorStatusFormat[] = "ekf2_offline_status:uint64_t timestamp;uint64_t timestamp_sample;"
+		"uint64_t control_mode_flags;uint32_t filter_fault_flags;float vel_test_ratio;float pos_test_ratio;"
+		"float hgt_test_ratio;float hdg_test_ratio;float tas_test_ratio;float hagl_test_ratio;float beta_test_ratio;"
+		"float pos_horiz_accuracy;float pos_vert_accuracy;uint16_t solution_status_flags;uint8_t reset_count_vel_ne;"
+		"uint8_t reset_count_vel_d;uint8_t reset_count_pos_ne;uint8_t reset_count_pod_d;uint8_t reset_count_quat;";
+
+static constexpr char kSensorBiasFormat[] = "ekf2_offline_sensor_bias:uint64_t timestamp;uint64_t timestamp_sample;"
+		"float[3] gyro_bias;float[3] gyro_bias_variance;float[3] accel_bias;float[3] accel_bias_variance;"
+		"float[3] mag_bias;float[3] mag_bias_variance;";
+
+bool OfflineEkf::setParameter(estimator::parameters &params, const char *name, float value)
+{
+	for (const ekf2::ParamBinding &binding : ekf2::kParamBindings) {
+		if (strcmp(binding.name(), name) == 0) {
+			if (binding.value_float) {
+				*binding.value_float(params) = value;
+
+			} else {
+				*binding.value_int(params) = static_cast<int32_t>(lroundf(value));
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool OfflineEkf::supportsParameter(const char *name)
+{
+#if defined(CONFIG_EKF2_GNSS)
+
+	if (strcmp(name, "EKF2_GPS_YAW_OFF") == 0) {
+		return true;
+	}
+
+#endif // CONFIG_EKF2_GNSS
+
+	estimator::parameters params{};
+	return setParameter(params, name, 0.f);
+}
+
+bool OfflineEkf::run(const char *log_path, const char *output_path, const std::vector<ParamOverride> &overrides)
+{
+	ULogReader reader;
+
+	if (!reader.open(log_path)) {
+		_error = "failed to read log";
+		return false;
+	}
+
+	subscribe(reader);
+
+	if (_subscriptions[SensorCombined] < 0) {
+		_error = "no sensor_combined data";
+		return false;
+	}
+
+	ULogWriter writer;
+
+	if (!writer.open(output_path, reader.start_time())) {
+		_error = "failed to open output";
+		return false;
+	}
+
+	writer.addInfo("sys_name", "PX4");
+	writer.addInfo("replay", log_path);
+
+	addOutputTopics(writer);
+	applyParameters(reader, overrides, writer);
+
+	_attitude_id = writer.addLoggedMessage("ekf2_offline_attitude");
+	_local_position_id = writer.addLoggedMessage("ekf2_offline_local_position");
+	_global_position_id = writer.addLoggedMessage("ekf2_offline_global_position");
+	_estimator_states_id = writer.addLoggedMessage("ekf2_offline_states");
+	_estimator_status_id = writer.addLoggedMessage("ekf2_offline_status");
+	_sensor_bias_id = writer.addLoggedMessage("ekf2_offline_sensor_bias");
+
+	// the messages are processed in file order, the aiding samples are buffered
+	// by the estimator and fused once the delayed time horizon has reached them
+	ULogReader::Message msg;
+
+	while (reader.next(msg)) {
+		if (msg.subscription == _subscriptions[SensorCombined]) {
+			handleImu(msg);
+
+			if (_ekf.update()) {
+				_statistics.ekf_updates++;
+				writeOutput(writer, msg.timestamp);
+			}
+
+		} else if (msg.subscription == _subscriptions[VehicleAirData]) {
+			handleAirData(msg);
+
+		} else if (msg.subscription == _subscriptions[VehicleMagnetometer]) {
+			handleMagnetometer(msg);
+
+		} else if (msg.subscription == _subscriptions[VehicleGpsPosition]) {
+			handleGps(msg);
+
+		} else if (msg.subscription == _subscriptions[AirspeedValidated]) {
+			handleAirspeed(msg);
+
+		} else if (msg.subscription == _subscriptions[VehicleStatus]) {
+			handleVehicleStatus(msg);
+
+		} else if (msg.subscription == _subscriptions[VehicleLandDetected]) {
+			handleLandDetected(msg);
+
+		} else if (msg.subscription == _subscriptions[LaunchDetectionStatus]) {
+			handleLaunchDetection(msg);
+		}
+	}
+
+	_statistics.log_duration_us = _last_timestamp - _first_timestamp;
+
+	if (!writer.close()) {
+		_error = "failed to write output";
+		return false;
+	}
+
+	if (_statistics.imu_samples == 0) {
+		_error = "no sensor_combined data";
+		return false;
+	}
+
+	return true;
+}
+
+void OfflineEkf::subscribe(ULogReader &reader)
+{
+	_subscriptions[SensorCombined] = reader.subscribe("sensor_combined");
+	_subscriptions[VehicleAirData] = reader.subscribe("vehicle_air_data");
+	_subscriptions[VehicleMagnetometer] = reader.subscribe("vehicle_magnetometer");
+	_subscriptions[VehicleGpsPosition] = reader.subscribe("vehicle_gps_position");
+	_subscriptions[AirspeedValidated] = reader.subscribe("airspeed_validated");
+	_subscriptions[VehicleStatus] = reader.subscribe("vehicle_status");
+	_subscriptions[VehicleLandDetected] = reader.subscribe("vehicle_land_detected");
+	_subscriptions[LaunchDetectionStatus] = reader.subscribe("launch_detection_status");
+
+	int s = _subscriptions[SensorCombined];
+	_imu_fields.gyro_rad = reader.field(s, "gyro_rad");
+	_imu_fields.gyro_integral_dt = reader.field(s, "gyro_integral_dt");
+	_imu_fields.accelerometer_m_s2 = reader.field(s, "accelerometer_m_s2");
+	_imu_fields.accelerometer_integral_dt = reader.field(s, "accelerometer_integral_dt");
+	_imu_fields.accelerometer_clipping = reader.field(s, "accelerometer_clipping");
+	_imu_fields.accel_calibration_count = reader.field(s, "accel_calibration_count");
+	_imu_fields.gyro_calibration_count = reader.field(s, "gyro_calibration_count");
+
+	s = _subscriptions[VehicleAirData];
+	_air_data_fields.timestamp_sample = reader.field(s, "timestamp_sample");
+	_air_data_fields.baro_device_id = reader.field(s, "baro_device_id");
+	_air_data_fields.baro_alt_meter = reader.field(s, "baro_alt_meter");
+	_air_data_fields.rho = reader.field(s, "rho");
+	_air_data_fields.calibration_count = reader.field(s, "calibration_count");
+
+	s = _subscriptions[VehicleMagnetometer];
+	_mag_fields.timestamp_sample = reader.field(s, "timestamp_sample");
+	_mag_fields.device_id = reader.field(s, "device_id");
+	_mag_fields.magnetometer_ga = reader.field(s, "magnetometer_ga");
+	_mag_fields.calibration_count = reader.field(s, "calibration_count");
+
+	s = _subscriptions[VehicleGpsPosition];
+	_gps_fields.latitude_deg = reader.field(s, "latitude_deg");
+	_gps_fields.longitude_deg = reader.field(s, "longitude_deg");
+	_gps_fields.altitude_msl_m = reader.field(s, "altitude_msl_m");
+	_gps_fields.lat = reader.field(s, "lat");
+	_gps_fields.lon = reader.field(s, "lon");
+	_gps_fields.alt = reader.field(s, "alt");
+	_gps_fields.eph = reader.field(s, "eph");
+	_gps_fields.epv = reader.field(s, "epv");
+	_gps_fields.s_variance_m_s = reader.field(s, "s_variance_m_s");
+	_gps_fields.hdop = reader.field(s, "hdop");
+	_gps_fields.vdop = reader.field(s, "vdop");
+	_gps_fields.vel_n_m_s = reader.field(s, "vel_n_m_s");
+	_gps_fields.vel_e_m_s = reader.field(s, "vel_e_m_s");
+	_gps_fields.vel_d_m_s = reader.field(s, "vel_d_m_s");
+	_gps_fields.vel_ned_valid = reader.field(s, "vel_ned_valid");
+	_gps_fields.fix_type = reader.field(s, "fix_type");
+	_gps_fields.satellites_used = reader.field(s, "satellites_used");
+	_gps_fields.heading = reader.field(s, "heading");
+	_gps_fields.heading_offset = reader.field(s, "heading_offset");
+	_gps_fields.heading_accuracy = reader.field(s, "heading_accuracy");
+	_gps_fields.spoofing_state = reader.field(s, "spoofing_state");
+
+	s = _subscriptions[AirspeedValidated];
+	_airspeed_fields.true_airspeed_m_s = reader.field(s, "true_airspeed_m_s");
+	_airspeed_fields.calibrated_airspeed_m_s = reader.field(s, "calibrated_airspeed_m_s");
+	_airspeed_fields.selected_airspeed_index = reader.field(s, "selected_airspeed_index");
+
+	s = _subscriptions[VehicleStatus];
+	_status_fields.arming_state = reader.field(s, "arming_state");
+	_status_fields.vehicle_type = reader.field(s, "vehicle_type");
+
+	s = _subscriptions[VehicleLandDetected];
+	_land_detected_fields.landed = reader.field(s, "landed");
+	_land_detected_fields.at_rest = reader.field(s, "at_rest");
+	_land_detected_fields.in_ground_effect = reader.field(s, "in_ground_effect");
+
+	s = _subscriptions[LaunchDetectionStatus];
+	_launch_detection_fields.launch_detection_state = reader.field(s, "launch_detection_state");
+}
+
+void OfflineEkf::applyParameters(const ULogReader &reader, const std::vector<ParamOverride> &overrides,
+				 ULogWriter &writer)
+{
+	estimator::parameters &params = *_ekf.getParamHandle();
+
+	// parameters which aren't in the log keep their default value, as in EKF2
+	for (const ekf2::ParamBinding &binding : ekf2::kParamBindings) {
+		if (binding.value_float) {
+			*binding.value_float(params) = binding.defaultValue().f;
+
+		} else {
+			*binding.value_int(params) = binding.defaultValue().i;
+		}
+	}
+
+#if defined(CONFIG_EKF2_GNSS)
+	_gps_yaw_offset = px4::parameters[static_cast<int>(px4::params::EKF2_GPS_YAW_OFF)].val.f;
+#endif // CONFIG_EKF2_GNSS
+
+	// all the parameters of the original log are kept in the output, the overrides replace them
+	for (const auto &param : reader.parameters()) {
+		const char *name = param.first.c_str();
+		const ULogReader::Parameter &value = param.second;
+
+		const ParamOverride *override_value = nullptr;
+
+		for (const ParamOverride &o : overrides) {
+			if (o.name == param.first) {
+				override_value = &o;
+			}
+		}
+
+		if (value.is_float) {
+			const float v = override_value ? override_value->value : value.value_float;
+			applyParameter(name, v);
+			writer.addParameter(name, v);
+
+		} else {
+			const int32_t v = override_value ? static_cast<int32_t>(lroundf(override_value->value)) : value.value_int;
+			applyParameter(name, static_cast<float>(v));
+			writer.addParameter(name, v);
+		}
+	}
+
+	// overrides of parameters which aren't in the log
+	for (const ParamOverride &o : overrides) {
+		if (reader.parameters().find(o.name) == reader.parameters().end()) {
+			if (applyParameter(o.name.c_str(), o.value)) {
+				writer.addParameter(o.name.c_str(), o.value);
+			}
+		}
+	}
+
+	_ekf.updateParameters();
+}
+
+bool OfflineEkf::applyParameter(const char *name, float value)
+{
+#if defined(CONFIG_EKF2_GNSS)
+
+	if (strcmp(name, "EKF2_GPS_YAW_OFF") == 0) {
+		_gps_yaw_offset = value;
+		_statistics.params_applied++;
+		return true;
+	}
+
+#endif // CONFIG_EKF2_GNSS
+
+	if (!setParameter(*_ekf.getParamHandle(), name, value)) {
+		return false;
+	}
+
+	_statistics.params_applied++;
+	return true;
+}
+
+void OfflineEkf::addOutputTopics(ULogWriter &writer)
+{
+	writer.addFormat(kAttitudeFormat);
+	writer.addFormat(kLocalPositionFormat);
+	writer.addFormat(kGlobalPositionFormat);
+	writer.addFormat(kEstimatorStatesFormat);
+	writer.addFormat(kEstimatorStatusFormat);
+	writer.addFormat(kSensorBiasFormat);
+}
+
+void OfflineEkf::handleImu(const ULogReader::Message &msg)
+{
+	sensor_combined_s sensor_combined{};
+	sensor_combined.timestamp = msg.timestamp;
+	ULogReader::copy(msg, _imu_fields.gyro_rad, sensor_combined.gyro_rad);
+	ULogReader::copy(msg, _imu_fields.gyro_integral_dt, sensor_combined.gyro_integral_dt);
+	ULogReader::copy(msg, _imu_fields.accelerometer_m_s2, sensor_combined.accelerometer_m_s2);
+	ULogReader::copy(msg, _imu_fields.accelerometer_integral_dt, sensor_combined.accelerometer_integral_dt);
+	ULogReader::copy(msg, _imu_fields.accelerometer_clipping, sensor_combined.accelerometer_clipping);
+	ULogReader::copy(msg, _imu_fields.accel_calibration_count, sensor_combined.accel_calibration_count);
+	ULogReader::copy(msg, _imu_fields.gyro_calibration_count, sensor_combined.gyro_calibration_count);
+
+	if (sensor_combined.accel_calibration_count != _accel_calibration_count) {
+		_ekf.resetAccelBias();
+		_accel_calibration_count = sensor_combined.accel_calibration_count;
+	}
+
+	if (sensor_combined.gyro_calibration_count != _gyro_calibration_count) {
+		_ekf.resetGyroBias();
+		_gyro_calibration_count = sensor_combined.gyro_calibration_count;
+	}
+
+	const imuSample imu_sample = ekf2::imuSampleFromSensorCombined(sensor_combined);
+	_ekf.setIMUData(imu_sample);
+
+	updateSystemFlags(imu_sample.time_us);
+
+	if (_statistics.imu_samples == 0) {
+		_first_timestamp = imu_sample.time_us;
+	}
+
+	_last_timestamp = imu_sample.time_us;
+	_statistics.imu_samples++;
+}
+
+void OfflineEkf::handleAirData(const ULogReader::Message &msg)
+{
+#if defined(CONFIG_EKF2_BAROMETER)
+	vehicle_air_data_s airdata{};
+	airdata.timestamp = msg.timestamp;
+	airdata.timestamp_sample = msg.timestamp;
+	airdata.baro_alt_meter = NAN;
+	airdata.rho = atmosphere::kAirDensitySeaLevelStandardAtmos;
+	ULogReader::copy(msg, _air_data_fields.timestamp_sample, airdata.timestamp_sample);
+	ULogReader::copy(msg, _air_data_fields.baro_device_id, airdata.baro_device_id);
+	ULogReader::copy(msg, _air_data_fields.baro_alt_meter, airdata.baro_alt_meter);
+	ULogReader::copy(msg, _air_data_fields.rho, airdata.rho);
+	ULogReader::copy(msg, _air_data_fields.calibration_count, airdata.calibration_count);
+
+	// reset the bias if the barometer or its calibration has changed
+	const bool reset = (airdata.baro_device_id != _device_id_baro)
+			   || (airdata.calibration_count != _baro_calibration_count);
+
+	if (reset) {
+		_device_id_baro = airdata.baro_device_id;
+		_baro_calibration_count = airdata.calibration_count;
+	}
+
+	_ekf.set_air_density(airdata.rho);
+	_ekf.setBaroData(ekf2::baroSampleFromAirData(airdata, reset));
+#else
+	(void)msg;
+#endif // CONFIG_EKF2_BAROMETER
+}
+
+void OfflineEkf::handleMagnetometer(const ULogReader::Message &msg)
+{
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+	vehicle_magnetometer_s magnetometer{};
+	magnetometer.timestamp = msg.timestamp;
+	magnetometer.timestamp_sample = msg.timestamp;
+	magnetometer.magnetometer_ga[0] = magnetometer.magnetometer_ga[1] = magnetometer.magnetometer_ga[2] = NAN;
+	ULogReader::copy(msg, _mag_fields.timestamp_sample, magnetometer.timestamp_sample);
+	ULogReader::copy(msg, _mag_fields.device_id, magnetometer.device_id);
+	ULogReader::copy(msg, _mag_fields.magnetometer_ga, magnetometer.magnetometer_ga);
+	ULogReader::copy(msg, _mag_fields.calibration_count, magnetometer.calibration_count);
+
+	// reset the bias if the magnetometer or its calibration has changed
+	const bool reset = (magnetometer.device_id != _device_id_mag)
+			   || (magnetometer.calibration_count != _mag_calibration_count);
+
+	if (reset) {
+		_device_id_mag = magnetometer.device_id;
+		_mag_calibration_count = magnetometer.calibration_count;
+	}
+
+	_ekf.setMagData(ekf2::magSampleFromMagnetometer(magnetometer, reset));
+#else
+	(void)msg;
+#endif // CONFIG_EKF2_MAGNETOMETER
+}
+
+void OfflineEkf::handleGps(const ULogReader::Message &msg)
+{
+#if defined(CONFIG_EKF2_GNSS)
+	sensor_gps_s gps{};
+	gps.timestamp = msg.timestamp;
+	gps.heading = NAN;
+	gps.heading_offset = NAN;
+
+	if (_gps_fields.latitude_deg.valid()) {
+		ULogReader::copy(msg, _gps_fields.latitude_deg, gps.latitude_deg);
+		ULogReader::copy(msg, _gps_fields.longitude_deg, gps.longitude_deg);
+		ULogReader::copy(msg, _gps_fields.altitude_msl_m, gps.altitude_msl_m);
+
+	} else {
+		// logs from older firmware versions (1e-7 deg, mm)
+		gps.latitude_deg = ULogReader::get<double>(msg, _gps_fields.lat) * 1e-7;
+		gps.longitude_deg = ULogReader::get<double>(msg, _gps_fields.lon) * 1e-7;
+		gps.altitude_msl_m = ULogReader::get<double>(msg, _gps_fields.alt) * 1e-3;
+	}
+
+	ULogReader::copy(msg, _gps_fields.eph, gps.eph);
+	ULogReader::copy(msg, _gps_fields.epv, gps.epv);
+	ULogReader::copy(msg, _gps_fields.s_variance_m_s, gps.s_variance_m_s);
+	ULogReader::copy(msg, _gps_fields.hdop, gps.hdop);
+	ULogReader::copy(msg, _gps_fields.vdop, gps.vdop);
+	ULogReader::copy(msg, _gps_fields.vel_n_m_s, gps.vel_n_m_s);
+	ULogReader::copy(msg, _gps_fields.vel_e_m_s, gps.vel_e_m_s);
+	ULogReader::copy(msg, _gps_fields.vel_d_m_s, gps.vel_d_m_s);
+	ULogReader::copy(msg, _gps_fields.vel_ned_valid, gps.vel_ned_valid);
+	ULogReader::copy(msg, _gps_fields.fix_type, gps.fix_type);
+	ULogReader::copy(msg, _gps_fields.satellites_used, gps.satellites_used);
+	ULogReader::copy(msg, _gps_fields.heading, gps.heading);
+	ULogReader::copy(msg, _gps_fields.heading_offset, gps.heading_offset);
+	ULogReader::copy(msg, _gps_fields.heading_accuracy, gps.heading_accuracy);
+	ULogReader::copy(msg, _gps_fields.spoofing_state, gps.spoofing_state);
+
+	gnssSample gnss_sample;
+
+	if (ekf2::gnssSampleFromSensorGps(gps, _gps_yaw_offset, gnss_sample)) {
+		_ekf.setGpsData(gnss_sample);
+	}
+
+#else
+	(void)msg;
+#endif // CONFIG_EKF2_GNSS
+}
+
+void OfflineEkf::handleAirspeed(const ULogReader::Message &msg)
+{
+#if defined(CONFIG_EKF2_AIRSPEED)
+	airspeed_validated_s airspeed_validated{};
+	airspeed_validated.timestamp = msg.timestamp;
+	airspeed_validated.true_airspeed_m_s = NAN;
+	airspeed_validated.calibrated_airspeed_m_s = NAN;
+	ULogReader::copy(msg, _airspeed_fields.true_airspeed_m_s, airspeed_validated.true_airspeed_m_s);
+	ULogReader::copy(msg, _airspeed_fields.calibrated_airspeed_m_s, airspeed_validated.calibrated_airspeed_m_s);
+	ULogReader::copy(msg, _airspeed_fields.selected_airspeed_index, airspeed_validated.selected_airspeed_index);
+
+	airspeedSample airspeed_sample;
+
+	if (ekf2::airspeedSampleFromAirspeedValidated(airspeed_validated, airspeed_sample)) {
+		_ekf.setAirspeedData(airspeed_sample);
+	}
+
+#else
+	(void)msg;
+#endif // CONFIG_EKF2_AIRSPEED
+}
+
+void OfflineEkf::handleVehicleStatus(const ULogReader::Message &msg)
+{
+	_vehicle_status.timestamp = msg.timestamp;
+	ULogReader::copy(msg, _status_fields.arming_state, _vehicle_status.arming_state);
+	ULogReader::copy(msg, _status_fields.vehicle_type, _vehicle_status.vehicle_type);
+	_vehicle_status_updated = true;
+}
+
+void OfflineEkf::handleLandDetected(const ULogReader::Message &msg)
+{
+	_vehicle_land_detected.timestamp = msg.timestamp;
+	_vehicle_land_detected.landed = true;
+	ULogReader::copy(msg, _land_detected_fields.landed, _vehicle_land_detected.landed);
+	ULogReader::copy(msg, _land_detected_fields.at_rest, _vehicle_land_detected.at_rest);
+	ULogReader::copy(msg, _land_detected_fields.in_ground_effect, _vehicle_land_detected.in_ground_effect);
+	_land_detected_updated = true;
+}
+
+void OfflineEkf::handleLaunchDetection(const ULogReader::Message &msg)
+{
+	_launch_detection_status.timestamp = msg.timestamp;
+	ULogReader::copy(msg, _launch_detection_fields.launch_detection_state,
+			 _launch_detection_status.launch_detection_state);
+}
+
+void OfflineEkf::updateSystemFlags(uint64_t time_us)
+{
+	// same as EKF2::UpdateSystemFlagsSample(), the flags are updated when the vehicle state changes
+	if (!_vehicle_status_updated && !_land_detected_updated) {
+		return;
+	}
+
+	systemFlagUpdate flags{};
+	flags.time_us = time_us;
+
+	if (_vehicle_status.timestamp != 0) {
+		ekf2::updateSystemFlags(flags, _vehicle_status);
+	}
+
+	if (_vehicle_land_detected.timestamp != 0) {
+		ekf2::updateSystemFlags(flags, _vehicle_land_detected);
+	}
+
+	if (_launch_detection_status.timestamp != 0) {
+		ekf2::updateSystemFlags(flags, _launch_detection_status);
+	}
+
+	_ekf.setSystemFlagData(flags);
+
+	_vehicle_status_updated = false;
+	_land_detected_updated = false;
+}
+
+void OfflineEkf::writeOutput(ULogWriter &writer, uint64_t timestamp)
+{
+	const bool dead_reckoning = _ekf.control_status_flags().inertial_dead_reckoning
+				    || _ekf.control_status_flags().wind_dead_reckoning;
+
+	{
+		AttitudeRecord att{};
+		att.timestamp = timestamp;
+		att.timestamp_sample = timestamp;
+
+		// the records are packed, the values are copied through aligned temporaries
+		float q[4];
+		float delta_q_reset[4];
+		uint8_t quat_reset_counter;
+		_ekf.getQuaternion().copyTo(q);
+		_ekf.get_quat_reset(delta_q_reset, &quat_reset_counter);
+		memcpy(att.q, q, sizeof(q));
+		memcpy(att.delta_q_reset, delta_q_reset, sizeof(delta_q_reset));
+		att.quat_reset_counter = quat_reset_counter;
+		writer.writeData(_attitude_id, &att, sizeof(att));
+	}
+
+	{
+		LocalPositionRecord lpos{};
+		lpos.timestamp = timestamp;
+		lpos.timestamp_sample = timestamp;
+
+		const Vector3f position{_ekf.getPosition()};
+		lpos.x = position(0);
+		lpos.y = position(1);
+		lpos.z = position(2);
+
+		const Vector3f velocity{_ekf.getVelocity()};
+		lpos.vx = velocity(0);
+		lpos.vy = velocity(1);
+		lpos.vz = velocity(2);
+
+		lpos.z_deriv = _ekf.getVerticalPositionDerivative();
+
+		const Vector3f vel_deriv{_ekf.getVelocityDerivative()};
+		_ekf.resetVelocityDerivativeAccumulation();
+		lpos.ax = vel_deriv(0);
+		lpos.ay = vel_deriv(1);
+		lpos.az = vel_deriv(2);
+
+		lpos.xy_valid = _ekf.isLocalHorizontalPositionValid();
+		lpos.v_xy_valid = _ekf.isLocalHorizontalPositionValid();
+		lpos.z_valid = _ekf.isLocalVerticalPositionValid() || _ekf.isLocalVerticalVelocityValid();
+		lpos.v_z_valid = _ekf.isLocalVerticalVelocityValid() || _ekf.isLocalVerticalPositionValid();
+
+		if (_ekf.global_origin_valid()) {
+			lpos.ref_lat = _ekf.global_origin().getProjectionReferenceLat();
+			lpos.ref_lon = _ekf.global_origin().getProjectionReferenceLon();
+			lpos.ref_alt = _ekf.getEkfGlobalOriginAltitude();
+			lpos.xy_global = true;
+			lpos.z_global = true;
+
+		} else {
+			lpos.ref_lat = static_cast<double>(NAN);
+			lpos.ref_lon = static_cast<double>(NAN);
+			lpos.ref_alt = NAN;
+		}
+
+		Quatf delta_q_reset;
+		uint8_t heading_reset_counter;
+		_ekf.get_quat_reset(&delta_q_reset(0), &heading_reset_counter);
+		lpos.heading_reset_counter = heading_reset_counter;
+
+		lpos.heading = Eulerf(_ekf.getQuaternion()).psi();
+		lpos.unaided_heading = _ekf.getUnaidedYaw();
+		lpos.heading_var = _ekf.getYawVar();
+		lpos.heading_good_for_control = _ekf.isYawFinalAlignComplete();
+		lpos.tilt_var = _ekf.getTiltVariance();
+
+		float eph, epv, evh, evv;
+		_ekf.get_ekf_lpos_accuracy(&eph, &epv);
+		_ekf.get_ekf_vel_accuracy(&evh, &evv);
+		lpos.eph = eph;
+		lpos.epv = epv;
+		lpos.evh = evh;
+		lpos.evv = evv;
+
+		float delta_z;
+		float delta_xy[2];
+		uint8_t counter;
+		_ekf.get_posD_reset(&delta_z, &counter);
+		lpos.z_reset_counter = counter;
+		_ekf.get_velD_reset(&delta_z, &counter);
+		lpos.vz_reset_counter = counter;
+		_ekf.get_posNE_reset(delta_xy, &counter);
+		lpos.xy_reset_counter = counter;
+		_ekf.get_velNE_reset(delta_xy, &counter);
+		lpos.vxy_reset_counter = counter;
+
+		lpos.dead_reckoning = dead_reckoning;
+
+		writer.writeData(_local_position_id, &lpos, sizeof(lpos));
+	}
+
+	if (_ekf.global_origin_valid() && _ekf.control_status().flags.yaw_align) {
+		GlobalPositionRecord gpos{};
+		gpos.timestamp = timestamp;
+		gpos.timestamp_sample = timestamp;
+
+		const LatLonAlt lla = _ekf.getLatLonAlt();
+		gpos.lat = lla.latitude_deg();
+		gpos.lon = lla.longitude_deg();
+		gpos.alt = lla.altitude();
+		gpos.lat_lon_valid = _ekf.isGlobalHorizontalPositionValid();
+		gpos.alt_valid = _ekf.isGlobalVerticalPositionValid();
+		float eph, epv;
+		_ekf.get_ekf_gpos_accuracy(&eph, &epv);
+		gpos.eph = eph;
+		gpos.epv = epv;
+		gpos.dead_reckoning = dead_reckoning;
+
+		writer.writeData(_global_position_id, &gpos, sizeof(gpos));
+	}
+
+	{
+		EstimatorStatesRecord states{};
+		states.timestamp = timestamp;
+		states.timestamp_sample = _ekf.time_delayed_us();
+		const auto state_vector = _ekf.getStateVector();
+		const auto covariances = _ekf.covariances_diagonal();
+		static_assert(sizeof(states.states) == sizeof(state_vector), "estimator_states size mismatch");
+		static_assert(sizeof(states.covariances) == sizeof(float) * State::size, "estimator_states size mismatch");
+		copyVector(states.states, state_vector);
+		states.n_states = state_vector.size();
+		copyVector(states.covariances, covariances);
+
+		writer.writeData(_estimator_states_id, &states, sizeof(states));
+	}
+
+	{
+		EstimatorStatusRecord status{};
+		status.timestamp = timestamp;
+		status.timestamp_sample = _ekf.time_delayed_us();
+		status.control_mode_flags = _ekf.control_status().value;
+		status.filter_fault_flags = _ekf.fault_status().value;
+
+		const float vel_xy_test_ratio = _ekf.getHorizontalVelocityInnovationTestRatio();
+		const float vel_z_test_ratio = _ekf.getVerticalVelocityInnovationTestRatio();
+
+		if (PX4_ISFINITE(vel_xy_test_ratio) && PX4_ISFINITE(vel_z_test_ratio)) {
+			status.vel_test_ratio = fmaxf(vel_xy_test_ratio, vel_z_test_ratio);
+
+		} else if (PX4_ISFINITE(vel_xy_test_ratio)) {
+			status.vel_test_ratio = vel_xy_test_ratio;
+
+		} else {
+			status.vel_test_ratio = vel_z_test_ratio;
+		}
+
+		status.hdg_test_ratio = _ekf.getHeadingInnovationTestRatio();
+		status.pos_test_ratio = _ekf.getHorizontalPositionInnovationTestRatio();
+		status.hgt_test_ratio = _ekf.getVerticalPositionInnovationTestRatio();
+		status.tas_test_ratio = _ekf.getAirspeedInnovationTestRatio();
+		status.hagl_test_ratio = _ekf.getHeightAboveGroundInnovationTestRatio();
+		status.beta_test_ratio = _ekf.getSyntheticSideslipInnovationTestRatio();
+
+		float pos_horiz_accuracy, pos_vert_accuracy;
+		_ekf.get_ekf_lpos_accuracy(&pos_horiz_accuracy, &pos_vert_accuracy);
+		status.pos_horiz_accuracy = pos_horiz_accuracy;
+		status.pos_vert_accuracy = pos_vert_accuracy;
+		status.solution_status_flags = _ekf.get_ekf_soln_status();
+
+		status.reset_count_vel_ne = _ekf.state_reset_status().reset_count.velNE;
+		status.reset_count_vel_d = _ekf.state_reset_status().reset_count.velD;
+		status.reset_count_pos_ne = _ekf.state_reset_status().reset_count.posNE;
+		status.reset_count_pod_d = _ekf.state_reset_status().reset_count.posD;
+		status.reset_count_quat = _ekf.state_reset_status().reset_count.quat;
+
+		writer.writeData(_estimator_status_id, &status, sizeof(status));
+	}
+
+	{
+		SensorBiasRecord bias{};
+		bias.timestamp = timestamp;
+		bias.timestamp_sample = _ekf.time_delayed_us();
+		const Vector3f gyro_bias{_ekf.getGyroBias()};
+		const Vector3f gyro_bias_variance{_ekf.getGyroBiasVariance()};
+		const Vector3f accel_bias{_ekf.getAccelBias()};
+		const Vector3f accel_bias_variance{_ekf.getAccelBiasVariance()};
+		copyVector(bias.gyro_bias, gyro_bias);
+		copyVector(bias.gyro_bias_variance, gyro_bias_variance);
+		copyVector(bias.accel_bias, accel_bias);
+		copyVector(bias.accel_bias_variance, accel_bias_variance);
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+		const Vector3f mag_bias{_ekf.getMagBias()};
+		const Vector3f mag_bias_variance{_ekf.getMagBiasVariance()};
+		copyVector(bias.mag_bias, mag_bias);
+		copyVector(bias.mag_bias_variance, mag_bias_variance);
+#endif // CONFIG_EKF2_MAGNETOMETER
+
+		writer.writeData(_sensor_bias_id, &bias, sizeof(bias));
+	}
+}
+
+} // namespace ekf2_offline
@@ -0,0 +1,209 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file OfflineEkf.hpp
+ * Run the estimator over a ULog file without the PX4 scheduler and uORB.
+ *
+ * The topics used by ekf2 (sensor_combined, vehicle_air_data, vehicle_magnetometer, vehicle_gps_position,
+ * airspeed_validated, vehicle_status, vehicle_land_detected and launch_detection_status) are read from the
+ * log into their uORB structs, converted to estimator samples by EKF2Conversions.hpp as in EKF2.cpp and
+ * pushed directly into Ekf. Each instance owns its estimator, several logs can be processed in parallel.
+ *
+ * The estimator parameters (EKF2Params.hpp) start at their default values, are then set from the log
+ * and can be overridden by name.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EKF/ekf.h"
+#include "EKF2Conversions.hpp"
+#include "EKF2Params.hpp"
+#include "ULogReader.hpp"
+#include "ULogWriter.hpp"
+
+namespace ekf2_offline
+{
+
+using ulog::ULogReader;
+using ulog::ULogWriter;
+
+struct ParamOverride {
+	std::string name;
+	float value;
+};
+
+class OfflineEkf
+{
+public:
+	struct Statistics {
+		uint64_t imu_samples{0};
+		uint64_t ekf_updates{0};
+		uint64_t log_duration_us{0};
+		uint32_t params_applied{0};
+	};
+
+	OfflineEkf() = default;
+	~OfflineEkf() = default;
+
+	/**
+	 * Process a log and write the estimator output topics to output_path
+	 * @return false if the log can't be read, has no IMU data or the output can't be written
+	 */
+	bool run(const char *log_path, const char *output_path, const std::vector<ParamOverride> &overrides);
+
+	const Statistics &statistics() const { return _statistics; }
+	const char *error() const { return _error; }
+
+	const Ekf &ekf() const { return _ekf; }
+
+	/**
+	 * Set an estimator parameter by its PX4 name (e.g. EKF2_GPS_DELAY)
+	 * @return false if the parameter isn't bound to the estimator parameters
+	 */
+	static bool setParameter(estimator::parameters &params, const char *name, float value);
+
+	/**
+	 * @return true if the parameter is used by the offline estimator and can be overridden
+	 */
+	static bool supportsParameter(const char *name);
+
+private:
+	enum Topic {
+		SensorCombined,
+		VehicleAirData,
+		VehicleMagnetometer,
+		VehicleGpsPosition,
+		AirspeedValidated,
+		VehicleStatus,
+		VehicleLandDetected,
+		LaunchDetectionStatus,
+		TopicCount
+	};
+
+	void subscribe(ULogReader &reader);
+	void applyParameters(const ULogReader &reader, const std::vector<ParamOverride> &overrides, ULogWriter &writer);
+	bool applyParameter(const char *name, float value);
+	void addOutputTopics(ULogWriter &writer);
+
+	void handleImu(const ULogReader::Message &msg);
+	void handleAirData(const ULogReader::Message &msg);
+	void handleMagnetometer(const ULogReader::Message &msg);
+	void handleGps(const ULogReader::Message &msg);
+	void handleAirspeed(const ULogReader::Message &msg);
+	void handleVehicleStatus(const ULogReader::Message &msg);
+	void handleLandDetected(const ULogReader::Message &msg);
+	void handleLaunchDetection(const ULogReader::Message &msg);
+	void updateSystemFlags(uint64_t time_us);
+
+	void writeOutput(ULogWriter &writer, uint64_t timestamp);
+
+	Ekf _ekf{};
+
+	int _subscriptions[TopicCount] {};
+
+	// field lookups, resolved once from the log formats
+	struct {
+		ULogReader::Field gyro_rad, gyro_integral_dt, accelerometer_m_s2, accelerometer_integral_dt, accelerometer_clipping,
+			  accel_calibration_count, gyro_calibration_count;
+	} _imu_fields{};
+
+	struct {
+		ULogReader::Field timestamp_sample, baro_device_id, baro_alt_meter, rho, calibration_count;
+	} _air_data_fields{};
+
+	struct {
+		ULogReader::Field timestamp_sample, device_id, magnetometer_ga, calibration_count;
+	} _mag_fields{};
+
+	struct {
+		ULogReader::Field latitude_deg, longitude_deg, altitude_msl_m, lat, lon, alt, eph, epv, s_variance_m_s, hdop, vdop,
+			  vel_n_m_s, vel_e_m_s, vel_d_m_s, vel_ned_valid, fix_type, satellites_used, heading, heading_offset,
+			  heading_accuracy, spoofing_state;
+	} _gps_fields{};
+
+	struct {
+		ULogReader::Field true_airspeed_m_s, calibrated_airspeed_m_s, selected_airspeed_index;
+	} _airspeed_fields{};
+
+	struct {
+		ULogReader::Field arming_state, vehicle_type;
+	} _status_fields{};
+
+	struct {
+		ULogReader::Field landed, at_rest, in_ground_effect;
+	} _land_detected_fields{};
+
+	struct {
+		ULogReader::Field launch_detection_state;
+	} _launch_detection_fields{};
+
+	// output msg_id
+	uint16_t _attitude_id{0};
+	uint16_t _local_position_id{0};
+	uint16_t _global_position_id{0};
+	uint16_t _estimator_states_id{0};
+	uint16_t _estimator_status_id{0};
+	uint16_t _sensor_bias_id{0};
+
+	// sensor state
+	uint8_t _accel_calibration_count{0};
+	uint8_t _gyro_calibration_count{0};
+	uint32_t _device_id_baro{0};
+	uint8_t _baro_calibration_count{0};
+	uint32_t _device_id_mag{0};
+	uint8_t _mag_calibration_count{0};
+
+#if defined(CONFIG_EKF2_GNSS)
+	float _gps_yaw_offset{0.f}; ///< EKF2_GPS_YAW_OFF, applied by the conversion instead of the estimator
+#endif // CONFIG_EKF2_GNSS
+
+	// latest system state used by the system flags update, not received yet while the timestamp is 0
+	vehicle_status_s _vehicle_status{};
+	vehicle_land_detected_s _vehicle_land_detected{};
+	launch_detection_status_s _launch_detection_status{};
+	bool _vehicle_status_updated{false};
+	bool _land_detected_updated{false};
+
+	uint64_t _first_timestamp{0};
+	uint64_t _last_timestamp{0};
+
+	Statistics _statistics{};
+	const char *_error{""};
+};
+
+} // namespace ekf2_offline
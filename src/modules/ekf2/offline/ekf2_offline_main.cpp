@@ -0,0 +1,199 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ekf2_offline_main.cpp
+ * Batch EKF runner: reprocess ULog files with the estimator, in parallel on all cores.
+ *
+ * Usage: ekf2_offline [-j <jobs>] [-o <output dir>] [-p <NAME>=<value>]... <log.ulg>...
+ *
+ * For each input log <name>.ulg the estimator output is written to <output dir>/<name>_ekf2.ulg
+ * (next to the input log by default).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <getopt.h>
+
+#include "OfflineEkf.hpp"
+
+using namespace ekf2_offline;
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-j <jobs>] [-o <output dir>] [-p <NAME>=<value>]... <log.ulg>...\n"
+		"  -j <jobs>       number of logs processed in parallel (default: number of cores)\n"
+		"  -o <dir>        output directory (default: next to the input log)\n"
+		"  -p NAME=VALUE   override an estimator parameter, can be repeated\n", name);
+}
+
+static std::string outputPath(const std::string &log_path, const char *output_dir)
+{
+	std::string name = log_path;
+	const size_t slash = name.find_last_of('/');
+
+	std::string dir = (slash != std::string::npos) ? name.substr(0, slash + 1) : "";
+
+	if (slash != std::string::npos) {
+		name = name.substr(slash + 1);
+	}
+
+	const size_t ext = name.rfind(".ulg");
+
+	if (ext != std::string::npos) {
+		name.resize(ext);
+	}
+
+	if (output_dir) {
+		dir = std::string(output_dir) + "/";
+	}
+
+	return dir + name + "_ekf2.ulg";
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned jobs = std::thread::hardware_concurrency();
+	const char *output_dir = nullptr;
+	std::vector<ParamOverride> overrides;
+
+	int ch;
+
+	while ((ch = getopt(argc, argv, "j:o:p:h")) != -1) {
+		switch (ch) {
+		case 'j':
+			jobs = strtoul(optarg, nullptr, 10);
+			break;
+
+		case 'o':
+			output_dir = optarg;
+			break;
+
+		case 'p': {
+				const char *separator = strchr(optarg, '=');
+				char *end = nullptr;
+
+				if (separator) {
+					const float value = strtof(separator + 1, &end);
+
+					if (end != separator + 1) {
+						overrides.push_back({std::string(optarg, separator - optarg), value});
+						break;
+					}
+				}
+
+				fprintf(stderr, "invalid parameter override '%s'\n", optarg);
+				return 1;
+			}
+
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (optind >= argc) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	for (const ParamOverride &o : overrides) {
+		if (!OfflineEkf::supportsParameter(o.name.c_str())) {
+			fprintf(stderr, "parameter %s isn't supported\n", o.name.c_str());
+			return 1;
+		}
+	}
+
+	std::vector<std::string> logs(argv + optind, argv + argc);
+	jobs = (jobs == 0) ? 1 : jobs;
+	jobs = (jobs > logs.size()) ? logs.size() : jobs;
+
+	// each worker picks the next unprocessed log, the estimators don't share any state
+	std::atomic<size_t> next_log{0};
+	std::atomic<int> failures{0};
+	std::mutex print_mutex;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	auto worker = [&]() {
+		for (size_t i = next_log++; i < logs.size(); i = next_log++) {
+			const std::string output = outputPath(logs[i], output_dir);
+			const auto log_start = std::chrono::steady_clock::now();
+
+			std::unique_ptr<OfflineEkf> ekf(new OfflineEkf());
+			const bool success = ekf->run(logs[i].c_str(), output.c_str(), overrides);
+
+			const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - log_start).count();
+			const OfflineEkf::Statistics &stats = ekf->statistics();
+
+			std::lock_guard<std::mutex> lock(print_mutex);
+
+			if (success) {
+				printf("%s -> %s: %.1f s of data, %" PRIu64 " IMU samples, %" PRIu64 " EKF updates in %.2f s (%.0fx real time)\n",
+				       logs[i].c_str(), output.c_str(), stats.log_duration_us * 1e-6, stats.imu_samples, stats.ekf_updates,
+				       elapsed_s, (elapsed_s > 0.) ? stats.log_duration_us * 1e-6 / elapsed_s : 0.);
+
+			} else {
+				fprintf(stderr, "%s: %s\n", logs[i].c_str(), ekf->error());
+				failures++;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+
+	for (unsigned i = 1; i < jobs; i++) {
+		threads.emplace_back(worker);
+	}
+
+	worker();
+
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+
+	const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	printf("processed %zu logs with %u jobs in %.2f s, %d failed\n", logs.size(), jobs, elapsed_s, failures.load());
+
+	return (failures > 0) ? 1 : 0;
+}
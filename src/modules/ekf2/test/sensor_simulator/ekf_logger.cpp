@@ -52,7 +52,7 @@ void EkfLogger::writeState()
 		_file << time;
 
 		if (_state_logging_enabled) {
-			auto state = _ekf->state().vector();
+			auto state = _ekf->getStateVector();
 
 			for (unsigned i = 0; i < state.size(); i++) {
 				_file << "," << std::setprecision(2) << state(i);
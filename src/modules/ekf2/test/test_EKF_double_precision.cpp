@@ -0,0 +1,209 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_EKF_double_precision.cpp
+ *
+ * @brief Run the replay datasets with the EKF built with CONFIG_EKF2_DOUBLE_PRECISION and compare
+ * the states and variances against the single precision change indication of test_EKF_withReplayData.
+ * The double precision run is logged to its own change indication file.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <fstream>
+#include <math.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+#include "sensor_simulator/ekf_logger.h"
+
+class EkfDoublePrecisionTest : public ::testing::Test
+{
+public:
+	EkfDoublePrecisionTest(): ::testing::Test(),
+		_ekf{std::make_shared<Ekf>()},
+		_sensor_simulator(_ekf),
+		_ekf_wrapper(_ekf),
+		_ekf_logger(_ekf) {};
+
+	std::shared_ptr<Ekf> _ekf;
+	SensorSimulator _sensor_simulator;
+	EkfWrapper _ekf_wrapper;
+	EkfLogger _ekf_logger;
+
+	static constexpr uint8_t kLoggingRateHz = 10;
+
+	// the change indication files are written with 2 significant digits
+	static constexpr float kPrintTolerance = 0.05f;
+
+	// differences are reported above the rounding of the reference file
+	struct Result {
+		float max_quat_diff{0.f};      // max quaternion component difference
+		float max_vel_diff{0.f};       // (m/s)
+		float max_pos_diff{0.f};       // (m)
+		float max_rel_var_diff{0.f};   // max relative variance difference
+		double run_time_s{0.0};
+		int samples{0};
+	};
+
+	static float diffAbovePrintTolerance(float value, float reference)
+	{
+		return fmaxf(fabsf(value - reference) - kPrintTolerance * fabsf(reference), 0.f);
+	}
+
+	static std::vector<std::vector<float>> readChangeIndication(const char *file)
+	{
+		std::vector<std::vector<float>> rows;
+		std::ifstream stream(file);
+		std::string line;
+
+		// skip header
+		std::getline(stream, line);
+
+		while (std::getline(stream, line)) {
+			std::vector<float> row;
+			std::stringstream line_stream(line);
+			std::string value;
+
+			while (std::getline(line_stream, value, ',')) {
+				row.push_back(std::stof(value));
+			}
+
+			rows.push_back(row);
+		}
+
+		return rows;
+	}
+
+	Result runAndCompare(const char *reference_file, int duration_s)
+	{
+		const std::vector<std::vector<float>> reference = readChangeIndication(reference_file);
+
+		Result result;
+		double run_time_s = 0.0;
+
+		for (int i = 0; i < duration_s * kLoggingRateHz; ++i) {
+			const auto start = std::chrono::steady_clock::now();
+			_sensor_simulator.runReplaySeconds(1.0f / kLoggingRateHz);
+			run_time_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			_ekf_logger.writeStateToFile();
+
+			if (i >= (int)reference.size()) {
+				continue;
+			}
+
+			// row layout: timestamp, state vector, covariance diagonal
+			const std::vector<float> &row = reference[i];
+			const auto state = _ekf->getStateVector();
+			const auto variance = _ekf->covariances_diagonal();
+			EXPECT_EQ(row.size(), 1 + state.size() + variance.size());
+			EXPECT_EQ((uint64_t)row[0], _ekf->time_delayed_us());
+
+			for (unsigned k = 0; k < 4; k++) {
+				result.max_quat_diff = fmaxf(result.max_quat_diff, diffAbovePrintTolerance(state(k), row[1 + k]));
+			}
+
+			for (unsigned k = 0; k < 3; k++) {
+				result.max_vel_diff = fmaxf(result.max_vel_diff, diffAbovePrintTolerance(state(4 + k), row[5 + k]));
+				result.max_pos_diff = fmaxf(result.max_pos_diff, diffAbovePrintTolerance(state(7 + k), row[8 + k]));
+			}
+
+			for (unsigned k = 0; k < variance.size(); k++) {
+				const float ref = row[1 + state.size() + k];
+				const float rel_diff = diffAbovePrintTolerance(variance(k), ref) / fmaxf(fabsf(ref), FLT_MIN);
+				result.max_rel_var_diff = fmaxf(result.max_rel_var_diff, rel_diff);
+			}
+
+			result.samples++;
+		}
+
+		result.run_time_s = run_time_s;
+
+		return result;
+	}
+
+	static void print(const char *name, const Result &result)
+	{
+		printf("%s (%s precision EKF, %d samples, %.3f s): max diff above print tolerance quat %.2e, "
+		       "vel %.2e m/s, pos %.2e m, relative variance %.2e\n",
+		       name, sizeof(StateScalar) == sizeof(double) ? "double" : "single", result.samples, result.run_time_s,
+		       (double)result.max_quat_diff, (double)result.max_vel_diff, (double)result.max_pos_diff,
+		       (double)result.max_rel_var_diff);
+	}
+};
+
+TEST_F(EkfDoublePrecisionTest, irisGps)
+{
+	_sensor_simulator.loadSensorDataFromFile(TEST_DATA_PATH"/replay_data/iris_gps.csv");
+	_ekf_logger.setFilePath(TEST_DATA_PATH"/change_indication/iris_gps_double.csv");
+
+	_sensor_simulator.startGps();
+	_ekf_wrapper.enableGpsFusion();
+
+	const Result result = runAndCompare(TEST_DATA_PATH"/change_indication/iris_gps.csv", 35);
+	print("iris_gps", result);
+
+	EXPECT_EQ(result.samples, 35 * kLoggingRateHz);
+	EXPECT_LT(result.max_quat_diff, 1e-3f);
+	EXPECT_LT(result.max_vel_diff, 1e-2f);
+	EXPECT_LT(result.max_pos_diff, 0.1f);
+	EXPECT_LT(result.max_rel_var_diff, 1e-2f);
+}
+
+TEST_F(EkfDoublePrecisionTest, ekfGsfReset)
+{
+	_sensor_simulator.loadSensorDataFromFile(TEST_DATA_PATH"/replay_data/ekf_gsf_reset.csv");
+	_ekf_logger.setFilePath(TEST_DATA_PATH"/change_indication/ekf_gsf_reset_double.csv");
+
+	_sensor_simulator.startGps();
+	_ekf_wrapper.enableGpsFusion();
+	auto params = _ekf->getParamHandle();
+	params->gps_vel_innov_gate = 1.f;
+	params->gps_pos_innov_gate = 1.f;
+
+	const Result result = runAndCompare(TEST_DATA_PATH"/change_indication/ekf_gsf_reset.csv", 39);
+	print("ekf_gsf_reset", result);
+
+	EXPECT_EQ(result.samples, 39 * kLoggingRateHz);
+	EXPECT_LT(result.max_quat_diff, 1e-3f);
+	EXPECT_LT(result.max_vel_diff, 1e-2f);
+	EXPECT_LT(result.max_pos_diff, 0.1f);
+	EXPECT_LT(result.max_rel_var_diff, 1e-2f);
+}
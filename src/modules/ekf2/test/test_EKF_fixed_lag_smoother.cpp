@@ -0,0 +1,244 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_EKF_fixed_lag_smoother.cpp
+ *
+ * @brief Unit tests for the fixed-lag RTS smoother, fed by a linear constant velocity Kalman filter
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "EKF/fixed_lag_smoother/fixed_lag_smoother.h"
+
+using Vector6f = FixedLagSmoother::VectorSmoother;
+using Matrix6f = FixedLagSmoother::SquareMatrixSmoother;
+
+class EkfFixedLagSmootherTest : public ::testing::Test
+{
+public:
+	static constexpr float kDt = 0.01f;
+	static constexpr float kAccelNoise = 0.5f; // m/s^2
+	static constexpr float kPosNoise = 1.f;    // m
+
+	struct Step {
+		uint64_t time_us;
+		Vector6f truth;
+		Vector6f x_post;
+		Matrix6f P_post;
+	};
+
+	FixedLagSmoother _smoother;
+	std::vector<Step> _history;
+
+	std::mt19937 _gen{42};
+	std::normal_distribution<float> _normal{0.f, 1.f};
+
+	Vector6f _truth{};
+	Vector6f _x{};
+	Matrix6f _P{};
+	uint64_t _time_us{0};
+
+	void SetUp() override
+	{
+		_P = matrix::diag(Vector6f(std::array<float, 6> {100.f, 100.f, 100.f, 1.f, 1.f, 1.f}.data()));
+		_truth(3) = 2.f;
+		_truth(4) = -1.f;
+	}
+
+	// run one cycle of the filter and feed the smoother the same way the EKF does
+	void runFilterStep()
+	{
+		_time_us += static_cast<uint64_t>(kDt * 1e6f);
+
+		Matrix6f F;
+		F.setIdentity();
+		F(0, 3) = F(1, 4) = F(2, 5) = kDt;
+
+		// truth, with random acceleration
+		for (int i = 0; i < 3; i++) {
+			const float accel = kAccelNoise * _normal(_gen);
+			_truth(i) += _truth(i + 3) * kDt + 0.5f * accel * kDt * kDt;
+			_truth(i + 3) += accel * kDt;
+		}
+
+		// prediction
+		Matrix6f Q;
+
+		for (int i = 0; i < 3; i++) {
+			const float var = kAccelNoise * kAccelNoise;
+			Q(i, i) = 0.25f * kDt * kDt * kDt * kDt * var;
+			Q(i, i + 3) = Q(i + 3, i) = 0.5f * kDt * kDt * kDt * var;
+			Q(i + 3, i + 3) = kDt * kDt * var;
+		}
+
+		_x = F * _x;
+		_P = F * _P * F.transpose() + Q;
+
+		_smoother.setPrior(_x, _P);
+
+		// sequential position fusion
+		for (int i = 0; i < 3; i++) {
+			const float innov_var = _P(i, i) + kPosNoise * kPosNoise;
+			const float innov = _truth(i) + kPosNoise * _normal(_gen) - _x(i);
+			const Vector6f K = Vector6f(_P.col(i)) / innov_var;
+			const Matrix6f KHP = matrix::Matrix<float, 6, 1>(K) * matrix::Matrix<float, 1, 6>(_P.row(i));
+			_x += K * innov;
+			_P -= KHP;
+		}
+
+		_smoother.push(_time_us, kDt, _x, _P);
+
+		_history.push_back({_time_us, _truth, _x, _P});
+	}
+
+	const Step *findStep(uint64_t time_us) const
+	{
+		for (const Step &step : _history) {
+			if (step.time_us == time_us) {
+				return &step;
+			}
+		}
+
+		return nullptr;
+	}
+};
+
+TEST_F(EkfFixedLagSmootherTest, disabledByDefault)
+{
+	EXPECT_FALSE(_smoother.valid());
+	EXPECT_TRUE(_smoother.allocate(0));
+	EXPECT_FALSE(_smoother.valid());
+
+	runFilterStep();
+	_smoother.update();
+
+	FixedLagSmoother::Output output;
+	EXPECT_FALSE(_smoother.getOutput(output));
+}
+
+TEST_F(EkfFixedLagSmootherTest, passSpreadOverSeveralUpdates)
+{
+	const uint8_t lag = 50;
+	ASSERT_TRUE(_smoother.allocate(lag));
+
+	FixedLagSmoother::Output output;
+
+	for (int i = 0; i < lag; i++) {
+		runFilterStep();
+		_smoother.update();
+		EXPECT_FALSE(_smoother.getOutput(output));
+	}
+
+	// the history is full, the (lag - 1) backward steps need several updates
+	int updates = 0;
+
+	while (!_smoother.getOutput(output)) {
+		runFilterStep();
+		_smoother.update();
+		updates++;
+		ASSERT_LT(updates, lag);
+	}
+
+	// the pass started with the update that filled the history
+	EXPECT_EQ(updates + 1, (lag - 1 + FixedLagSmoother::kStepsPerUpdate - 1) / FixedLagSmoother::kStepsPerUpdate);
+
+	// the output refers to the oldest entry of the window at the start of the pass
+	EXPECT_EQ(output.time_us, _history[_history.size() - updates - lag].time_us);
+}
+
+TEST_F(EkfFixedLagSmootherTest, smoothedBetterThanFiltered)
+{
+	ASSERT_TRUE(_smoother.allocate(60));
+
+	float sum_sq_err_filter = 0.f;
+	float sum_sq_err_smoother = 0.f;
+	int outputs = 0;
+
+	for (int i = 0; i < 3000; i++) {
+		runFilterStep();
+		_smoother.update();
+
+		FixedLagSmoother::Output output;
+
+		if (_smoother.getOutput(output)) {
+			const Step *step = findStep(output.time_us);
+			ASSERT_NE(step, nullptr);
+
+			for (int axis = 0; axis < 3; axis++) {
+				// the smoothed variance can't be larger than the filtered one
+				EXPECT_LE(output.pos_var(axis), step->P_post(axis, axis) * 1.0001f);
+				EXPECT_LE(output.vel_var(axis), step->P_post(axis + 3, axis + 3) * 1.0001f);
+
+				sum_sq_err_filter += (step->x_post(axis) - step->truth(axis)) * (step->x_post(axis) - step->truth(axis));
+				sum_sq_err_smoother += (output.pos(axis) - step->truth(axis)) * (output.pos(axis) - step->truth(axis));
+			}
+
+			outputs++;
+		}
+	}
+
+	EXPECT_GT(outputs, 100);
+	EXPECT_LT(sum_sq_err_smoother, 0.7f * sum_sq_err_filter);
+}
+
+TEST_F(EkfFixedLagSmootherTest, resetClearsHistory)
+{
+	const uint8_t lag = 20;
+	ASSERT_TRUE(_smoother.allocate(lag));
+
+	for (int i = 0; i < lag - 1; i++) {
+		runFilterStep();
+		_smoother.update();
+	}
+
+	// a reset in the middle of filling the window restarts the history
+	_smoother.reset();
+
+	FixedLagSmoother::Output output;
+
+	for (int i = 0; i < lag; i++) {
+		runFilterStep();
+		_smoother.update();
+		EXPECT_FALSE(_smoother.getOutput(output));
+	}
+
+	for (int i = 0; i < lag; i++) {
+		runFilterStep();
+		_smoother.update();
+	}
+
+	EXPECT_TRUE(_smoother.getOutput(output));
+}
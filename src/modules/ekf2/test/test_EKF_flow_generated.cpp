@@ -44,7 +44,7 @@ using namespace matrix;
 TEST(FlowGenerated, distBottom0xy)
 {
 	// GIVEN: 0 distance to the ground (singularity)
-	StateSample state{};
+	StateSampleT<float> state{};
 	state.quat_nominal = Quatf();
 
 	const float R = sq(radians(sq(0.5f)));
@@ -60,7 +60,7 @@ TEST(FlowGenerated, distBottom0xy)
 TEST(FlowGenerated, distBottom0y)
 {
 	// GIVEN: 0 distance to the ground (singularity)
-	StateSample state{};
+	StateSampleT<float> state{};
 	state.quat_nominal = Quatf();
 
 	const float R = sq(radians(sq(0.5f)));
@@ -75,7 +75,7 @@ TEST(FlowGenerated, distBottom0y)
 TEST(FlowGenerated, distBottomNeg)
 {
 	// GIVEN: a small negative distance to the ground (singularity)
-	StateSample state{};
+	StateSampleT<float> state{};
 	state.quat_nominal = Quatf();
 	state.pos(2) = 1e-3f;
 
@@ -42,7 +42,7 @@ using namespace matrix;
 TEST(GnssYawFusionGenerated, SingularityPitch90)
 {
 	// GIVEN: a vertically oriented antenna (antenna vector aligned with the Forward axis)
-	StateSample state{};
+	StateSampleT<float> state{};
 	state.quat_nominal = Eulerf(0.f, -M_PI_F / 2.f, 0.f);
 	const float yaw_offset = M_PI_F;
 
@@ -65,7 +65,7 @@ TEST(GnssYawFusionGenerated, SingularityPitch90)
 TEST(GnssYawFusionGenerated, SingularityRoll90)
 {
 	// GIVEN: a vertically oriented antenna (antenna vector aligned with the Right axis)
-	StateSample state{};
+	StateSampleT<float> state{};
 	state.quat_nominal = Eulerf(-M_PI_F / 2.f, 0.f, 0.f);
 	const float yaw_offset = M_PI_F / 2.f;
 
@@ -43,7 +43,7 @@ using namespace matrix;
 TEST(MagDeclinationGenerated, declination90deg)
 {
 	// GIVEN: an estimated mag declination of 90 degrees
-	StateSample state{};
+	StateSampleT<float> state{};
 	state.mag_I(0) = 0.f; // North mag field
 	state.mag_I(1) = 0.2f; // East mag field
 
@@ -65,7 +65,7 @@ TEST(MagDeclinationGenerated, declination90deg)
 TEST(MagDeclinationGenerated, declinationUndefined)
 {
 	// GIVEN: an undefined declination
-	StateSample state{};
+	StateSampleT<float> state{};
 	state.mag_I(0) = 0.f; // North mag field
 	state.mag_I(1) = 0.f; // East mag field
 
@@ -0,0 +1,215 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <memory>
+#include <string>
+
+#include "offline/OfflineEkf.hpp"
+
+using namespace ekf2_offline;
+
+#pragma pack(push, 1)
+struct SensorCombinedRecord {
+	uint64_t timestamp;
+	float gyro_rad[3];
+	uint32_t gyro_integral_dt;
+	int32_t accelerometer_timestamp_relative;
+	float accelerometer_m_s2[3];
+	uint32_t accelerometer_integral_dt;
+	uint8_t accelerometer_clipping;
+};
+
+struct VehicleAirDataRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	uint32_t baro_device_id;
+	float baro_alt_meter;
+	float rho;
+};
+#pragma pack(pop)
+
+class EkfOfflineTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		_log_path = std::string("/tmp/ekf2_offline_test_") + std::to_string(getpid()) + ".ulg";
+		_output_path = std::string("/tmp/ekf2_offline_test_") + std::to_string(getpid()) + "_ekf2.ulg";
+	}
+
+	void TearDown() override
+	{
+		remove(_log_path.c_str());
+		remove(_output_path.c_str());
+	}
+
+	// write a log of a vehicle sitting level on the ground with IMU at 200 Hz and baro at 20 Hz
+	void writeLog(float duration_s)
+	{
+		ULogWriter writer;
+		ASSERT_TRUE(writer.open(_log_path.c_str(), 0));
+
+		writer.addFormat("sensor_combined:uint64_t timestamp;float[3] gyro_rad;uint32_t gyro_integral_dt;"
+				 "int32_t accelerometer_timestamp_relative;float[3] accelerometer_m_s2;"
+				 "uint32_t accelerometer_integral_dt;uint8_t accelerometer_clipping;");
+		writer.addFormat("vehicle_air_data:uint64_t timestamp;uint64_t timestamp_sample;uint32_t baro_device_id;"
+				 "float baro_alt_meter;float rho;");
+		writer.addParameter("EKF2_BARO_DELAY", 5.f);
+		writer.addParameter("EKF2_HGT_REF", (int32_t)0);
+		// no gravity fusion, as in the estimator unit tests (the other parameters keep their default value)
+		writer.addParameter("EKF2_IMU_CTRL", (int32_t)3);
+
+		const uint16_t imu_id = writer.addLoggedMessage("sensor_combined");
+		const uint16_t baro_id = writer.addLoggedMessage("vehicle_air_data");
+
+		const uint64_t dt_us = 5000;
+
+		for (uint64_t t = dt_us; t <= (uint64_t)(duration_s * 1e6f); t += dt_us) {
+			SensorCombinedRecord imu{};
+			imu.timestamp = t;
+			imu.gyro_integral_dt = dt_us;
+			imu.accelerometer_m_s2[2] = -CONSTANTS_ONE_G;
+			imu.accelerometer_integral_dt = dt_us;
+			writer.writeData(imu_id, &imu, sizeof(imu));
+
+			if (t % 50000 == 0) {
+				VehicleAirDataRecord baro{};
+				baro.timestamp = t;
+				baro.timestamp_sample = t;
+				baro.baro_device_id = 1;
+				baro.baro_alt_meter = _baro_altitude;
+				baro.rho = 1.225f;
+				writer.writeData(baro_id, &baro, sizeof(baro));
+			}
+		}
+
+		ASSERT_TRUE(writer.close());
+	}
+
+	std::string _log_path;
+	std::string _output_path;
+	const float _baro_altitude{122.f};
+};
+
+TEST_F(EkfOfflineTest, runLog)
+{
+	writeLog(10.f);
+
+	std::unique_ptr<OfflineEkf> ekf(new OfflineEkf());
+	ASSERT_TRUE(ekf->run(_log_path.c_str(), _output_path.c_str(), {}));
+
+	const OfflineEkf::Statistics &stats = ekf->statistics();
+	EXPECT_EQ(stats.imu_samples, 2000u);
+	EXPECT_GT(stats.ekf_updates, 900u); // filter runs at 100 Hz
+	EXPECT_NEAR(stats.log_duration_us, 10e6, 10000);
+	EXPECT_EQ(stats.params_applied, 3u);
+
+	// level and aligned, using the baro as height reference
+	EXPECT_TRUE(ekf->ekf().control_status_flags().tilt_align);
+	EXPECT_TRUE(ekf->ekf().control_status_flags().baro_hgt);
+	EXPECT_LT(ekf->ekf().getTiltVariance(), 1e-2f);
+
+	// the output can be read back with the estimator topics
+	ULogReader reader;
+	ASSERT_TRUE(reader.open(_output_path.c_str()));
+	const int attitude_sub = reader.subscribe("ekf2_offline_attitude");
+	const int states_sub = reader.subscribe("ekf2_offline_states");
+	ASSERT_GE(attitude_sub, 0);
+	ASSERT_GE(states_sub, 0);
+	EXPECT_LT(reader.subscribe("vehicle_attitude"), 0);
+
+	const ULogReader::Field q = reader.field(attitude_sub, "q");
+	ASSERT_TRUE(q.valid());
+	EXPECT_EQ(q.array_length, 4);
+
+	unsigned attitude_count = 0;
+	float q0 = NAN;
+	ULogReader::Message msg;
+
+	while (reader.next(msg)) {
+		if (msg.subscription == attitude_sub) {
+			q0 = ULogReader::get<float>(msg, q, NAN, 0);
+			attitude_count++;
+		}
+	}
+
+	EXPECT_EQ(attitude_count, stats.ekf_updates);
+	EXPECT_NEAR(q0, 1.f, 1e-4f);
+}
+
+TEST_F(EkfOfflineTest, parameterOverride)
+{
+	estimator::parameters params{};
+	EXPECT_TRUE(OfflineEkf::setParameter(params, "EKF2_BARO_DELAY", 20.f));
+	EXPECT_FLOAT_EQ(params.baro_delay_ms, 20.f);
+	EXPECT_FALSE(OfflineEkf::setParameter(params, "EKF2_NOT_A_PARAM", 1.f));
+
+	// parameters converted by Ekf::updateParameters() go through the same table
+	EXPECT_TRUE(OfflineEkf::setParameter(params, "EKF2_TAU_POS", 0.5f));
+	EXPECT_FLOAT_EQ(params.pos_tau, 0.5f);
+	EXPECT_TRUE(OfflineEkf::setParameter(params, "EKF2_REQ_GPS_H", 2.f));
+	EXPECT_FLOAT_EQ(params.req_gps_health, 2.f);
+
+	// applied by the GNSS conversion, not an estimator parameter
+	EXPECT_FALSE(OfflineEkf::setParameter(params, "EKF2_GPS_YAW_OFF", 90.f));
+	EXPECT_TRUE(OfflineEkf::supportsParameter("EKF2_GPS_YAW_OFF"));
+	EXPECT_FALSE(OfflineEkf::supportsParameter("EKF2_NOT_A_PARAM"));
+
+	writeLog(2.f);
+
+	std::unique_ptr<OfflineEkf> ekf(new OfflineEkf());
+	ASSERT_TRUE(ekf->run(_log_path.c_str(), _output_path.c_str(), {{"EKF2_BARO_DELAY", 20.f}}));
+
+	// the override is applied on top of the logged value
+	ULogReader reader;
+	ASSERT_TRUE(reader.open(_output_path.c_str()));
+	bool found = false;
+
+	for (const auto &param : reader.parameters()) {
+		if (param.first == "EKF2_BARO_DELAY") {
+			EXPECT_FLOAT_EQ(param.second.value_float, 20.f);
+			found = true;
+		}
+	}
+
+	EXPECT_TRUE(found);
+}
+
+TEST_F(EkfOfflineTest, invalidLog)
+{
+	std::unique_ptr<OfflineEkf> ekf(new OfflineEkf());
+	EXPECT_FALSE(ekf->run("/nonexistent/log.ulg", _output_path.c_str(), {}));
+}
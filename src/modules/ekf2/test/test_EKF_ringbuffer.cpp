@@ -32,6 +32,7 @@
  ****************************************************************************/
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <math.h>
 #include "EKF/ekf.h"
 
@@ -158,3 +159,212 @@ TEST_F(EkfRingBufferTest, reallocateBuffer)
 	EXPECT_EQ(3, _buffer->get_length());
 
 }
+
+class EkfTimestampedRingBufferTest : public ::testing::Test
+{
+public:
+	// 1 kHz IMU with a 400 ms delay horizon
+	static constexpr uint16_t kImuRateHz = 1000;
+	static constexpr uint16_t kHorizonMs = 400;
+	static constexpr uint16_t kLength = kImuRateHz * kHorizonMs / 1000;
+
+	sample _x{}, _y{}, _z{};
+
+	void SetUp() override
+	{
+		_x.time_us = 1000000;
+		_y.time_us = 2000000;
+		_z.time_us = 3000000;
+	}
+};
+
+TEST_F(EkfTimestampedRingBufferTest, orderOfSamples)
+{
+	TimestampedRingBuffer<sample, 3> buffer;
+	EXPECT_EQ(0, buffer.entries());
+
+	buffer.push(_x);
+	EXPECT_EQ(_x.time_us, buffer.get_newest().time_us);
+	EXPECT_EQ(_x.time_us, buffer.get_oldest().time_us);
+
+	buffer.push(_y);
+	buffer.push(_z);
+	EXPECT_EQ(_x.time_us, buffer.get_oldest().time_us);
+	EXPECT_EQ(_z.time_us, buffer.get_newest().time_us);
+
+	// overwrite the oldest sample when full
+	sample w{};
+	w.time_us = 4000000;
+	buffer.push(w);
+	EXPECT_EQ(3, buffer.entries());
+	EXPECT_EQ(_y.time_us, buffer.get_oldest().time_us);
+	EXPECT_EQ(w.time_us, buffer.get_newest().time_us);
+}
+
+TEST_F(EkfTimestampedRingBufferTest, popSample)
+{
+	TimestampedRingBuffer<sample, 3> buffer;
+	buffer.push(_x);
+	buffer.push(_y);
+	buffer.push(_z);
+
+	sample pop = {};
+	EXPECT_FALSE(buffer.pop_first_older_than(0, &pop));
+
+	EXPECT_TRUE(buffer.pop_first_older_than(_x.time_us + 1, &pop));
+	EXPECT_EQ(_x.time_us, pop.time_us);
+	EXPECT_TRUE(buffer.pop_first_older_than(_y.time_us + 10, &pop));
+	EXPECT_EQ(_y.time_us, pop.time_us);
+	EXPECT_TRUE(buffer.pop_first_older_than(_z.time_us + 100, &pop));
+	EXPECT_EQ(_z.time_us, pop.time_us);
+	EXPECT_EQ(0, buffer.entries());
+	EXPECT_FALSE(buffer.pop_first_older_than(_z.time_us + 100, &pop));
+}
+
+TEST_F(EkfTimestampedRingBufferTest, popDropsOlderSamples)
+{
+	TimestampedRingBuffer<sample, 3> buffer;
+	buffer.push(_x);
+	buffer.push(_y);
+	buffer.push(_z);
+
+	sample pop = {};
+	EXPECT_TRUE(buffer.pop_first_older_than(_y.time_us + 10, &pop));
+	EXPECT_EQ(_y.time_us, pop.time_us);
+	EXPECT_EQ(1, buffer.entries());
+	EXPECT_EQ(_z.time_us, buffer.get_oldest().time_us);
+}
+
+TEST_F(EkfTimestampedRingBufferTest, pushOlderSample)
+{
+	TimestampedRingBuffer<sample, 3> buffer;
+	buffer.push(_x);
+	buffer.push(_z);
+
+	// the samples newer than a pushed sample are dropped to keep the order
+	buffer.push(_y);
+	EXPECT_EQ(2, buffer.entries());
+	EXPECT_EQ(_x.time_us, buffer.get_oldest().time_us);
+	EXPECT_EQ(_y.time_us, buffer.get_newest().time_us);
+
+	sample pop = {};
+	EXPECT_TRUE(buffer.pop_first_older_than(_y.time_us + 1, &pop));
+	EXPECT_EQ(_y.time_us, pop.time_us);
+}
+
+TEST_F(EkfTimestampedRingBufferTest, askingForTooNewSample)
+{
+	TimestampedRingBuffer<sample, 3> buffer;
+	buffer.push(_x);
+	buffer.push(_y);
+	buffer.push(_z);
+
+	sample pop = {};
+	EXPECT_TRUE(buffer.pop_first_older_than(_z.time_us + 99000, &pop));
+	EXPECT_FALSE(buffer.pop_first_older_than(_y.time_us + 100000, &pop));
+}
+
+TEST_F(EkfTimestampedRingBufferTest, sameResultAsRingBuffer)
+{
+	// RingBuffer is limited to 255 entries
+	static constexpr uint8_t kLengthCompared = 250;
+	RingBuffer<sample> reference(kLengthCompared);
+	TimestampedRingBuffer<sample, kLengthCompared> buffer;
+
+	uint64_t time_us = 1000000;
+
+	for (int i = 0; i < 5000; i++) {
+		// irregular sampling
+		time_us += 500 + (i * 7919) % 1000;
+
+		sample s{};
+		s.time_us = time_us;
+		s.data[0] = static_cast<float>(i);
+		reference.push(s);
+		buffer.push(s);
+
+		if (i % 3 == 0) {
+			const uint64_t horizon = time_us - (i * 104729) % 200000;
+			sample pop_reference{};
+			sample pop{};
+			ASSERT_EQ(reference.pop_first_older_than(horizon, &pop_reference), buffer.pop_first_older_than(horizon, &pop));
+			EXPECT_EQ(pop_reference.time_us, pop.time_us);
+			EXPECT_EQ(pop_reference.data[0], pop.data[0]);
+		}
+	}
+}
+
+// best of a few runs, in ns per push/pop
+template <typename Buffer>
+static double benchmarkPushPop(Buffer &buffer, uint16_t imu_rate_hz, uint16_t horizon_ms, int iterations,
+			       int &popped)
+{
+	static constexpr int kRuns = 3;
+	double best_ns = INFINITY;
+
+	for (int run = 0; run < kRuns; run++) {
+		buffer.reset();
+		popped = 0;
+
+		const uint64_t dt_us = 1000000 / imu_rate_hz;
+		uint64_t time_us = 1000000;
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < iterations; i++) {
+			time_us += dt_us;
+
+			sample s{};
+			s.time_us = time_us;
+			buffer.push(s);
+
+			// pop at the delayed horizon, as done for the observation buffers
+			sample pop{};
+
+			if (buffer.pop_first_older_than(time_us - horizon_ms * 1000 + dt_us / 2, &pop)) {
+				popped++;
+			}
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		best_ns = fmin(best_ns, std::chrono::duration<double, std::nano>(end - start).count() / iterations);
+	}
+
+	return best_ns;
+}
+
+TEST_F(EkfTimestampedRingBufferTest, benchmarkPushPop)
+{
+	static constexpr int kIterations = 100000;
+
+	// compare both implementations with the longest RingBuffer possible (250 ms at 1 kHz)
+	static constexpr uint16_t kHorizonComparedMs = 250;
+	RingBuffer<sample> reference(kImuRateHz * kHorizonComparedMs / 1000 + 1);
+	TimestampedRingBuffer<sample, kImuRateHz * kHorizonComparedMs / 1000 + 1> buffer_compared;
+
+	int popped_reference = 0;
+	int popped_compared = 0;
+	const double ns_reference = benchmarkPushPop(reference, kImuRateHz, kHorizonComparedMs, kIterations, popped_reference);
+	const double ns_compared = benchmarkPushPop(buffer_compared, kImuRateHz, kHorizonComparedMs, kIterations,
+				   popped_compared);
+
+	EXPECT_EQ(popped_reference, popped_compared);
+
+	// 1 kHz IMU with a 400 ms delay horizon
+	static TimestampedRingBuffer<sample, kLength + 1> buffer;
+	int popped = 0;
+	const double ns = benchmarkPushPop(buffer, kImuRateHz, kHorizonMs, kIterations, popped);
+
+	EXPECT_EQ(popped, kIterations - kLength);
+
+	printf("push/pop %d Hz, %d ms horizon: RingBuffer %.1f ns, TimestampedRingBuffer %.1f ns\n",
+	       kImuRateHz, kHorizonComparedMs, ns_reference, ns_compared);
+	printf("push/pop %d Hz, %d ms horizon: TimestampedRingBuffer %.1f ns (%d Bytes)\n",
+	       kImuRateHz, kHorizonMs, ns, buffer.get_total_size());
+
+	// the linear scan of RingBuffer is about 10 times slower at this length, keep a wide margin for noisy hosts
+	EXPECT_LT(2. * ns_compared, ns_reference);
+
+	// the binary search hardly depends on the length
+	EXPECT_LT(ns, 2. * ns_compared);
+}
@@ -58,7 +58,7 @@ TEST(YawFusionGenerated, positiveVarianceAllOrientations)
 	for (float yaw = 0.f; yaw < 2.f * M_PI_F; yaw += M_PI_F / 4.f) {
 		for (float pitch = 0.f; pitch < 2.f * M_PI_F; pitch += M_PI_F / 4.f) {
 			for (float roll = 0.f; roll < 2.f * M_PI_F; roll += M_PI_F / 4.f) {
-				StateSample state{};
+				StateSampleT<float> state{};
 				state.quat_nominal = Eulerf(roll, pitch, yaw);
 
 				sym::ComputeYawInnovVarAndH(state.vector(), P, R, &innov_var, &H);
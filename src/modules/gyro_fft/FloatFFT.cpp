@@ -0,0 +1,187 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "FloatFFT.hpp"
+
+#include <math.h>
+#include <px4_platform_common/defines.h>
+
+FloatFFT::~FloatFFT()
+{
+	free();
+}
+
+void FloatFFT::free()
+{
+	delete[] _bit_reverse;
+	delete[] _twiddle_real;
+	delete[] _twiddle_imag;
+	delete[] _split_real;
+	delete[] _split_imag;
+	delete[] _work_real;
+	delete[] _work_imag;
+
+	_bit_reverse = nullptr;
+	_twiddle_real = nullptr;
+	_twiddle_imag = nullptr;
+	_split_real = nullptr;
+	_split_imag = nullptr;
+	_work_real = nullptr;
+	_work_imag = nullptr;
+
+	_length = 0;
+	_stages = 0;
+}
+
+bool FloatFFT::init(int length)
+{
+	free();
+
+	if ((length < 16) || (length > 8192) || ((length & (length - 1)) != 0)) {
+		return false;
+	}
+
+	const int half = length / 2;
+
+	_bit_reverse = new uint16_t[half];
+	_twiddle_real = new float[half];
+	_twiddle_imag = new float[half];
+	_split_real = new float[half];
+	_split_imag = new float[half];
+	_work_real = new float[half];
+	_work_imag = new float[half];
+
+	if (!_bit_reverse || !_twiddle_real || !_twiddle_imag || !_split_real || !_split_imag || !_work_real || !_work_imag) {
+		free();
+		return false;
+	}
+
+	_length = length;
+
+	while ((1 << _stages) < half) {
+		_stages++;
+	}
+
+	for (int i = 0; i < half; i++) {
+		int reversed = 0;
+
+		for (int bit = 0; bit < _stages; bit++) {
+			reversed |= ((i >> bit) & 1) << (_stages - 1 - bit);
+		}
+
+		_bit_reverse[i] = reversed;
+	}
+
+	// stage s combines transforms of length 2^s into 2^(s+1), using e^(-j*2*pi*k/2^(s+1)) for k < 2^s
+	for (int stage = 0; stage < _stages; stage++) {
+		const int span = 1 << stage;
+
+		for (int k = 0; k < span; k++) {
+			const float angle = -M_PI_F * k / span;
+			_twiddle_real[span - 1 + k] = cosf(angle);
+			_twiddle_imag[span - 1 + k] = sinf(angle);
+		}
+	}
+
+	for (int k = 0; k < half; k++) {
+		const float angle = -2.f * M_PI_F * k / length;
+		_split_real[k] = cosf(angle);
+		_split_imag[k] = sinf(angle);
+	}
+
+	return true;
+}
+
+void FloatFFT::transform(const float input[], float real[], float imag[])
+{
+	if (_length == 0) {
+		return;
+	}
+
+	const int half = _length / 2;
+	float *re = _work_real;
+	float *im = _work_imag;
+
+	// z[n] = x[2n] + j x[2n+1] in bit reversed order
+	for (int n = 0; n < half; n++) {
+		const int i = _bit_reverse[n];
+		re[i] = input[2 * n];
+		im[i] = input[2 * n + 1];
+	}
+
+	for (int stage = 0; stage < _stages; stage++) {
+		const int span = 1 << stage;
+		const float *w_real = &_twiddle_real[span - 1];
+		const float *w_imag = &_twiddle_imag[span - 1];
+
+		for (int group = 0; group < half; group += 2 * span) {
+			float *a_real = &re[group];
+			float *a_imag = &im[group];
+			float *b_real = &re[group + span];
+			float *b_imag = &im[group + span];
+
+			for (int k = 0; k < span; k++) {
+				const float t_real = b_real[k] * w_real[k] - b_imag[k] * w_imag[k];
+				const float t_imag = b_real[k] * w_imag[k] + b_imag[k] * w_real[k];
+
+				b_real[k] = a_real[k] - t_real;
+				b_imag[k] = a_imag[k] - t_imag;
+				a_real[k] = a_real[k] + t_real;
+				a_imag[k] = a_imag[k] + t_imag;
+			}
+		}
+	}
+
+	// split: X[k] = E[k] + e^(-j*2*pi*k/N) O[k]
+	//   with E[k] = (Z[k] + conj(Z[N/2-k])) / 2 and O[k] = -j (Z[k] - conj(Z[N/2-k])) / 2
+	real[0] = re[0] + im[0];
+	imag[0] = 0.f;
+	real[half] = re[0] - im[0];
+	imag[half] = 0.f;
+
+	for (int k = 1; k < half; k++) {
+		const float z_real = re[k];
+		const float z_imag = im[k];
+		const float c_real = re[half - k];
+		const float c_imag = -im[half - k];
+
+		const float even_real = 0.5f * (z_real + c_real);
+		const float even_imag = 0.5f * (z_imag + c_imag);
+		const float odd_real = 0.5f * (z_imag - c_imag);
+		const float odd_imag = -0.5f * (z_real - c_real);
+
+		real[k] = even_real + _split_real[k] * odd_real - _split_imag[k] * odd_imag;
+		imag[k] = even_imag + _split_real[k] * odd_imag + _split_imag[k] * odd_real;
+	}
+}
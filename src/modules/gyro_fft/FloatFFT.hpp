@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file FloatFFT.hpp
+ *
+ * Single precision real FFT for power of 2 lengths.
+ *
+ * The real input of length N is transformed with a complex FFT of length N/2 (even samples
+ * as real part, odd samples as imaginary part) followed by a split step. The complex FFT is
+ * an iterative radix-2 implementation on separate real and imaginary arrays with contiguous
+ * twiddle factors per stage, so the butterfly loops vectorize (NEON, SSE/AVX).
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class FloatFFT
+{
+public:
+	FloatFFT() = default;
+	~FloatFFT();
+
+	// no copy, assignment, move, move assignment
+	FloatFFT(const FloatFFT &) = delete;
+	FloatFFT &operator=(const FloatFFT &) = delete;
+	FloatFFT(FloatFFT &&) = delete;
+	FloatFFT &operator=(FloatFFT &&) = delete;
+
+	/**
+	 * @param length FFT length N, power of 2 between 16 and 8192
+	 */
+	bool init(int length);
+
+	int length() const { return _length; }
+
+	/**
+	 * Forward transform of length() real samples
+	 * @param input real samples
+	 * @param real output bins 0 ... N/2 (N/2 + 1 values)
+	 * @param imag output bins 0 ... N/2 (N/2 + 1 values)
+	 */
+	void transform(const float input[], float real[], float imag[]);
+
+private:
+	void free();
+
+	int _length{0};
+	int _stages{0};
+
+	uint16_t *_bit_reverse{nullptr}; // N/2
+
+	// complex FFT twiddle factors, stage s uses the 2^s factors starting at 2^s - 1
+	float *_twiddle_real{nullptr};
+	float *_twiddle_imag{nullptr};
+
+	// split step twiddle factors e^(-j*2*pi*k/N), k = 0 ... N/2 - 1
+	float *_split_real{nullptr};
+	float *_split_imag{nullptr};
+
+	// N/2 point complex work buffer
+	float *_work_real{nullptr};
+	float *_work_imag{nullptr};
+};
@@ -67,10 +67,45 @@ GyroFFT::~GyroFFT()
 	delete[] _fft_input_buffer;
 	delete[] _fft_outupt_buffer;
 	delete[] _peak_magnitudes_all;
+	delete[] _sliding_dft_spectrum;
 }
 
 bool GyroFFT::init()
 {
+	if (_param_imu_gyro_fft_mth.get() == (int32_t)Method::Welch) {
+#if defined(CONFIG_GYRO_FFT_WELCH)
+		return InitWelch();
+#else
+		PX4_ERR("Welch method not available, using FFT");
+#endif // CONFIG_GYRO_FFT_WELCH
+	}
+
+	_sliding_dft_enabled = (_param_imu_gyro_fft_mth.get() == (int32_t)Method::SlidingDFT);
+
+	if (_sliding_dft_enabled) {
+		// no FFT buffers needed, only the window of samples per axis
+		const int32_t length = _param_imu_gyro_fft_len.get();
+
+		if ((length >= 64) && (length <= 4096)) {
+			_imu_gyro_fft_len = length;
+			_peak_magnitudes_all = new float[length] {};
+			_sliding_dft_spectrum = new float[length] {};
+
+			if (_peak_magnitudes_all && _sliding_dft_spectrum
+			    && _sliding_dft[0].init(length) && _sliding_dft[1].init(length) && _sliding_dft[2].init(length)) {
+
+				if (!SensorSelectionUpdate(true)) {
+					ScheduleDelayed(500_ms);
+				}
+
+				return true;
+			}
+		}
+
+		PX4_ERR("sliding DFT init failed (IMU_GYRO_FFT_LEN=%" PRId32 ")", length);
+		return false;
+	}
+
 	bool buffers_allocated = false;
 
 	// arm_rfft_init_q15(&_rfft_q15, _imu_gyro_fft_len, 0, 1) manually inlined to save flash
@@ -165,6 +200,36 @@ bool GyroFFT::init()
 	return false;
 }
 
+#if defined(CONFIG_GYRO_FFT_WELCH)
+bool GyroFFT::InitWelch()
+{
+	const int32_t length = _param_imu_gyro_fft_len.get();
+	const int32_t hop = (_param_imu_gyro_fft_ovl.get() == 50) ? length / 2 : length / 4;
+	const int32_t averages = math::constrain(_param_imu_gyro_fft_avg.get(), (int32_t)1, (int32_t)16);
+
+	_imu_gyro_fft_len = length;
+
+	// magnitudes of bin 0 ... N/2
+	_peak_magnitudes_all = new float[length / 2 + 1] {};
+
+	if (_peak_magnitudes_all
+	    && _welch[0].init(length, hop, averages) && _welch[1].init(length, hop, averages)
+	    && _welch[2].init(length, hop, averages)) {
+
+		_welch_enabled = true;
+
+		if (!SensorSelectionUpdate(true)) {
+			ScheduleDelayed(500_ms);
+		}
+
+		return true;
+	}
+
+	PX4_ERR("Welch init failed (IMU_GYRO_FFT_LEN=%" PRId32 ")", length);
+	return false;
+}
+#endif // CONFIG_GYRO_FFT_WELCH
+
 bool GyroFFT::SensorSelectionUpdate(bool force)
 {
 	if (_sensor_selection_sub.updated() || (_selected_sensor_device_id == 0) || force) {
@@ -266,7 +331,8 @@ static inline float tau(float x)
 	return (0.25f * p1 - sqrtf(6.f) / 24.f * p2);
 }
 
-float GyroFFT::EstimatePeakFrequencyBin(q15_t fft[], int peak_index)
+template<typename T>
+float GyroFFT::EstimatePeakFrequencyBin(const T fft[], int peak_index)
 {
 	if (peak_index >= 2) {
 		// find peak location using Quinn's Second Estimator (2020-06-14: http://dspguru.com/dsp/howtos/how-to-interpolate-fft-peak/)
@@ -336,9 +402,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_fifo_sub.update(&sensor_gyro_fifo)) {
 			if (_sensor_gyro_fifo_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				Reset();
 
 				perf_count(_gyro_fifo_generation_gap_perf);
 			}
@@ -347,15 +411,13 @@ void GyroFFT::Run()
 
 			if (fabsf(sensor_gyro_fifo.scale - _fifo_last_scale) > FLT_EPSILON) {
 				// force reset if scale has changed
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				Reset();
 
 				_fifo_last_scale = sensor_gyro_fifo.scale;
 			}
 
 			int16_t *input[] {sensor_gyro_fifo.x, sensor_gyro_fifo.y, sensor_gyro_fifo.z};
-			Update(sensor_gyro_fifo.timestamp_sample, input, sensor_gyro_fifo.samples);
+			Update(sensor_gyro_fifo.timestamp_sample, input, sensor_gyro_fifo.samples, sensor_gyro_fifo.scale);
 		}
 
 	} else {
@@ -365,9 +427,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_sub.update(&sensor_gyro)) {
 			if (_sensor_gyro_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				Reset();
 
 				perf_count(_gyro_generation_gap_perf);
 			}
@@ -380,7 +440,7 @@ void GyroFFT::Run()
 			int16_t gyro_z[1] {(int16_t)roundf(sensor_gyro.z * gyro_scale)};
 
 			int16_t *input[] {gyro_x, gyro_y, gyro_z};
-			Update(sensor_gyro.timestamp_sample, input, 1);
+			Update(sensor_gyro.timestamp_sample, input, 1, 1.f / gyro_scale);
 		}
 	}
 
@@ -392,8 +452,41 @@ void GyroFFT::Run()
 	perf_end(_cycle_perf);
 }
 
-void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N)
+void GyroFFT::Reset()
+{
+	for (int axis = 0; axis < 3; axis++) {
+		_fft_buffer_index[axis] = 0;
+
+		if (_sliding_dft_enabled) {
+			_sliding_dft[axis].reset();
+		}
+
+#if defined(CONFIG_GYRO_FFT_WELCH)
+
+		if (_welch_enabled) {
+			_welch[axis].reset();
+		}
+
+#endif // CONFIG_GYRO_FFT_WELCH
+	}
+}
+
+void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N, float scale)
 {
+	if (_sliding_dft_enabled) {
+		UpdateSlidingDFT(timestamp_sample, input, N);
+		return;
+	}
+
+#if defined(CONFIG_GYRO_FFT_WELCH)
+
+	if (_welch_enabled) {
+		UpdateWelch(timestamp_sample, input, N, scale);
+		return;
+	}
+
+#endif // CONFIG_GYRO_FFT_WELCH
+
 	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
 
 	for (int axis = 0; axis < 3; axis++) {
@@ -429,10 +522,163 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 	}
 }
 
-void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer)
+void GyroFFT::UpdateSlidingDFT(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N)
 {
-	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+	// track the bins of the configured frequency range, reconfigured when the gyro sample rate changes
+	if (fabsf(_gyro_sample_rate_hz - _sliding_dft_sample_rate_hz) > FLT_EPSILON) {
+		const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+		const int bin_min = floorf(_param_imu_gyro_fft_min.get() / resolution_hz);
+		const int bin_max = ceilf(_param_imu_gyro_fft_max.get() / resolution_hz);
 
+		bool band_limited = false;
+
+		for (int axis = 0; axis < 3; axis++) {
+			band_limited |= !_sliding_dft[axis].configure(bin_min, bin_max);
+		}
+
+		if (band_limited) {
+			PX4_WARN("sliding DFT limited to %.1f - %.1f Hz", (double)(_sliding_dft[0].binMin() * resolution_hz),
+				 (double)(_sliding_dft[0].binMax() * resolution_hz));
+		}
+
+		_sliding_dft_sample_rate_hz = _gyro_sample_rate_hz;
+	}
+
+	static constexpr int FIFO_SIZE_MAX = sizeof(sensor_gyro_fifo_s::x) / sizeof(sensor_gyro_fifo_s::x[0]);
+
+	if (N > FIFO_SIZE_MAX) {
+		return;
+	}
+
+	perf_begin(_fft_perf);
+
+	for (int axis = 0; axis < 3; axis++) {
+		float samples[FIFO_SIZE_MAX];
+
+		for (int n = 0; n < N; n++) {
+			samples[n] = input[axis][n];
+		}
+
+		_sliding_dft[axis].update(samples, N);
+
+		// update the peak estimate with every batch once a full window has been processed
+		if (_sliding_dft[axis].ready()) {
+			FindPeaksSlidingDFT(timestamp_sample, axis);
+		}
+	}
+
+	perf_end(_fft_perf);
+}
+
+#if defined(CONFIG_GYRO_FFT_WELCH)
+void GyroFFT::UpdateWelch(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N, float scale)
+{
+	static constexpr int FIFO_SIZE_MAX = sizeof(sensor_gyro_fifo_s::x) / sizeof(sensor_gyro_fifo_s::x[0]);
+
+	if (N > FIFO_SIZE_MAX) {
+		return;
+	}
+
+	perf_begin(_fft_perf);
+
+	bool psd_updated = false;
+
+	for (int axis = 0; axis < 3; axis++) {
+		// raw int16 -> rad/s
+		float samples[FIFO_SIZE_MAX];
+
+		for (int n = 0; n < N; n++) {
+			samples[n] = input[axis][n] * scale;
+		}
+
+		WelchPSD &welch = _welch[axis];
+		welch.setSampleRate(_gyro_sample_rate_hz);
+
+		if (welch.update(samples, N)) {
+			// peaks are found in the amplitude spectrum of the averaged PSD
+			const float *psd = welch.psd();
+			const int bin_end = _imu_gyro_fft_len / 2;
+			float bin_mag_sum = 0.f;
+
+			_peak_magnitudes_all[0] = 0.f;
+			_peak_magnitudes_all[bin_end] = 0.f;
+
+			for (int bin_index = 1; bin_index < bin_end; bin_index++) {
+				const float magnitude = sqrtf(psd[bin_index]);
+				_peak_magnitudes_all[bin_index] = magnitude;
+				bin_mag_sum += magnitude;
+			}
+
+			SelectPeaks(timestamp_sample, axis, welch, bin_end, bin_mag_sum, bin_end - 1);
+
+			psd_updated = true;
+		}
+	}
+
+	// all axes receive the same samples and complete their segments together
+	if (psd_updated) {
+		PublishWelchPSD(timestamp_sample);
+	}
+
+	perf_end(_fft_perf);
+}
+
+void GyroFFT::PublishWelchPSD(const hrt_abstime &timestamp_sample)
+{
+	sensor_gyro_psd_s sensor_gyro_psd{};
+	sensor_gyro_psd.timestamp_sample = timestamp_sample;
+	sensor_gyro_psd.device_id = _selected_sensor_device_id;
+	sensor_gyro_psd.sensor_sample_rate_hz = _gyro_sample_rate_hz;
+	sensor_gyro_psd.resolution_hz = _welch[0].resolutionHz();
+	sensor_gyro_psd.averages = _welch[0].averages();
+
+	// log spaced bands from the first bin up to Nyquist
+	sensor_gyro_psd.band_start_hz = sensor_gyro_psd.resolution_hz;
+	sensor_gyro_psd.band_ratio = powf(0.5f * _gyro_sample_rate_hz / sensor_gyro_psd.band_start_hz, 1.f / PSD_NUM_BANDS);
+
+	float *psd_publish[] {sensor_gyro_psd.psd_x, sensor_gyro_psd.psd_y, sensor_gyro_psd.psd_z};
+
+	for (int axis = 0; axis < 3; axis++) {
+		_welch[axis].bands(sensor_gyro_psd.band_start_hz, sensor_gyro_psd.band_ratio, psd_publish[axis], PSD_NUM_BANDS);
+	}
+
+	sensor_gyro_psd.timestamp = hrt_absolute_time();
+	_sensor_gyro_psd_pub.publish(sensor_gyro_psd);
+}
+#endif // CONFIG_GYRO_FFT_WELCH
+
+void GyroFFT::FindPeaksSlidingDFT(const hrt_abstime &timestamp_sample, int axis)
+{
+	const SlidingDFT &sliding_dft = _sliding_dft[axis];
+
+	// bins outside of the tracked band are empty
+	for (int bin_index = 0; bin_index <= sliding_dft.binMax() + 1; bin_index++) {
+		_peak_magnitudes_all[bin_index] = 0.f;
+		_sliding_dft_spectrum[2 * bin_index] = 0.f;
+		_sliding_dft_spectrum[2 * bin_index + 1] = 0.f;
+	}
+
+	// the peak frequency is interpolated with the rectangular window bins
+	for (int bin_index = sliding_dft.binMin() - 1; bin_index <= sliding_dft.binMax() + 1; bin_index++) {
+		_sliding_dft_spectrum[2 * bin_index] = sliding_dft.real(bin_index);
+		_sliding_dft_spectrum[2 * bin_index + 1] = sliding_dft.imag(bin_index);
+	}
+
+	// and the peaks are found with the Hann windowed magnitude
+	float bin_mag_sum = 0.f;
+
+	for (int bin_index = sliding_dft.binMin(); bin_index <= sliding_dft.binMax(); bin_index++) {
+		const float magnitude = sliding_dft.windowedMagnitude(bin_index);
+		_peak_magnitudes_all[bin_index] = magnitude;
+		bin_mag_sum += magnitude;
+	}
+
+	SelectPeaks(timestamp_sample, axis, _sliding_dft_spectrum, sliding_dft.binMax() + 1, bin_mag_sum,
+		    sliding_dft.binMax() - sliding_dft.binMin() + 1);
+}
+
+void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer)
+{
 	// sum total energy across all used buckets for SNR
 	float bin_mag_sum = 0;
 
@@ -450,6 +696,14 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 		bin_mag_sum += fft_magnitude;
 	}
 
+	SelectPeaks(timestamp_sample, axis, fft_outupt_buffer, _imu_gyro_fft_len, bin_mag_sum, _imu_gyro_fft_len / 2 - 1);
+}
+
+template<typename Spectrum>
+void GyroFFT::SelectPeaks(const hrt_abstime &timestamp_sample, int axis, const Spectrum &spectrum, int bin_end,
+			  float bin_mag_sum, int num_bins)
+{
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
 
 	// find raw peaks
 	uint16_t raw_peak_index[MAX_NUM_PEAKS] {};
@@ -460,7 +714,7 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 		float largest_peak = 0;
 		int largest_peak_index = 0;
 
-		for (int bin_index = 1; bin_index < _imu_gyro_fft_len; bin_index++) {
+		for (int bin_index = 1; bin_index < bin_end; bin_index++) {
 
 			const float freq_hz = bin_index * resolution_hz;
 
@@ -504,12 +758,13 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 	for (int peak_new = 0; peak_new < MAX_NUM_PEAKS; peak_new++) {
 		if (raw_peak_index[peak_new] > 0) {
 
-			const float adjusted_bin = 0.5f * EstimatePeakFrequencyBin(fft_outupt_buffer, 2 * raw_peak_index[peak_new]);
+			const float adjusted_bin = InterpolatePeakBin(spectrum, raw_peak_index[peak_new]);
 
 			if (PX4_ISFINITE(adjusted_bin)) {
 				const float freq_adjusted = resolution_hz * adjusted_bin;
 
-				const float snr = 10.f * log10f((_imu_gyro_fft_len - 1) * peak_magnitude[peak_new] /
+				// (2 * num_bins + 1 = FFT length - 1 for the full spectrum)
+				const float snr = 10.f * log10f((2 * num_bins + 1) * peak_magnitude[peak_new] /
 								(bin_mag_sum - peak_magnitude[peak_new]));
 
 				if (PX4_ISFINITE(freq_adjusted)
@@ -703,6 +958,22 @@ int GyroFFT::task_spawn(int argc, char *argv[])
 int GyroFFT::print_status()
 {
 	PX4_INFO("gyro sample rate: %.3f Hz", (double)_gyro_sample_rate_hz);
+
+	if (_sliding_dft_enabled) {
+		const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+		PX4_INFO("sliding DFT: %d bins, %.1f - %.1f Hz", _sliding_dft[0].binMax() - _sliding_dft[0].binMin() + 1,
+			 (double)(_sliding_dft[0].binMin() * resolution_hz), (double)(_sliding_dft[0].binMax() * resolution_hz));
+	}
+
+#if defined(CONFIG_GYRO_FFT_WELCH)
+
+	if (_welch_enabled) {
+		PX4_INFO("Welch: %d samples, %d averages, %.2f Hz resolution", _welch[0].length(), _welch[0].averages(),
+			 (double)_welch[0].resolutionHz());
+	}
+
+#endif // CONFIG_GYRO_FFT_WELCH
+
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_fft_perf);
@@ -50,12 +50,19 @@
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_gyro_fft.h>
 #include <uORB/topics/sensor_gyro_fifo.h>
+#include <uORB/topics/sensor_gyro_psd.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_imu_status.h>
 
 #include "arm_math.h"
 #include "arm_const_structs.h"
 
+#include "SlidingDFT.hpp"
+
+#if defined(CONFIG_GYRO_FFT_WELCH)
+#include "WelchPSD.hpp"
+#endif // CONFIG_GYRO_FFT_WELCH
+
 using namespace time_literals;
 
 class GyroFFT : public ModuleBase<GyroFFT>, public ModuleParams, public px4::ScheduledWorkItem
@@ -84,12 +91,33 @@ private:
 	static constexpr int MAX_NUM_PEAKS = sizeof(sensor_gyro_fft_s::peak_frequencies_x) / sizeof(
 			sensor_gyro_fft_s::peak_frequencies_x[0]);
 
+	enum class Method : int32_t {
+		FFT = 0,
+		SlidingDFT = 1,
+		Welch = 2,
+	};
+
 	void Run() override;
 	inline void FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer);
-	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
+	inline void FindPeaksSlidingDFT(const hrt_abstime &timestamp_sample, int axis);
+	template<typename Spectrum>
+	inline void SelectPeaks(const hrt_abstime &timestamp_sample, int axis, const Spectrum &spectrum, int bin_end,
+				float bin_mag_sum, int num_bins);
+	template<typename T>
+	inline float EstimatePeakFrequencyBin(const T fft[], int peak_index);
+	template<typename T>
+	inline float InterpolatePeakBin(const T fft[], int bin) { return 0.5f * EstimatePeakFrequencyBin(fft, 2 * bin); }
 	inline void Publish();
+	void Reset();
 	bool SensorSelectionUpdate(bool force = false);
-	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
+	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N, float scale);
+	void UpdateSlidingDFT(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
+#if defined(CONFIG_GYRO_FFT_WELCH)
+	bool InitWelch();
+	inline float InterpolatePeakBin(const WelchPSD &welch, int bin) { return welch.peakBin(bin); }
+	void UpdateWelch(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N, float scale);
+	inline void PublishWelchPSD(const hrt_abstime &timestamp_sample);
+#endif // CONFIG_GYRO_FFT_WELCH
 	inline void UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
 				 float peak_snr[MAX_NUM_PEAKS], int num_peaks_found);
 	void VehicleIMUStatusUpdate(bool force = false);
@@ -143,6 +171,22 @@ private:
 
 	float *_peak_magnitudes_all{nullptr};
 
+	// streaming estimator (IMU_GYRO_FFT_MTH 1), band limited DFT updated with every sample
+	bool _sliding_dft_enabled{false};
+	SlidingDFT _sliding_dft[3] {};
+	float *_sliding_dft_spectrum{nullptr}; // [real[0], imag[0], real[1], imag[1], ...] like the FFT output
+	float _sliding_dft_sample_rate_hz{0.f};
+
+#if defined(CONFIG_GYRO_FFT_WELCH)
+	// Welch averaged float FFT (IMU_GYRO_FFT_MTH 2)
+	static constexpr int PSD_NUM_BANDS = sizeof(sensor_gyro_psd_s::psd_x) / sizeof(sensor_gyro_psd_s::psd_x[0]);
+
+	uORB::Publication<sensor_gyro_psd_s> _sensor_gyro_psd_pub{ORB_ID(sensor_gyro_psd)};
+
+	bool _welch_enabled{false};
+	WelchPSD _welch[3] {};
+#endif // CONFIG_GYRO_FFT_WELCH
+
 	float _gyro_sample_rate_hz{8000}; // 8 kHz default
 
 	float _fifo_last_scale{0};
@@ -166,7 +210,10 @@ private:
 		(ParamInt<px4::params::IMU_GYRO_FFT_LEN>) _param_imu_gyro_fft_len,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MIN>) _param_imu_gyro_fft_min,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MAX>) _param_imu_gyro_fft_max,
-		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr
+		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr,
+		(ParamInt<px4::params::IMU_GYRO_FFT_MTH>) _param_imu_gyro_fft_mth,
+		(ParamInt<px4::params::IMU_GYRO_FFT_OVL>) _param_imu_gyro_fft_ovl,
+		(ParamInt<px4::params::IMU_GYRO_FFT_AVG>) _param_imu_gyro_fft_avg
 	)
 };
 
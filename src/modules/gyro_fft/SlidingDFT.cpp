@@ -0,0 +1,148 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "SlidingDFT.hpp"
+
+#include <mathlib/math/Limits.hpp>
+#include <px4_platform_common/defines.h>
+#include <string.h>
+
+SlidingDFT::~SlidingDFT()
+{
+	delete[] _buffer;
+}
+
+bool SlidingDFT::init(int length)
+{
+	delete[] _buffer;
+	_buffer = nullptr;
+	_length = 0;
+
+	if (length <= 0) {
+		return false;
+	}
+
+	_buffer = new float[length];
+
+	if (_buffer == nullptr) {
+		return false;
+	}
+
+	_length = length;
+
+	// r^N = 0.99, the errors decay with a time constant of about 100 windows
+	_damping_n = 0.99f;
+	_damping = powf(_damping_n, 1.f / _length);
+
+	reset();
+	return true;
+}
+
+bool SlidingDFT::configure(int bin_min, int bin_max)
+{
+	bin_min = math::max(bin_min, 1);
+	bin_max = math::min(bin_max, _length / 2 - 2);
+
+	const bool limited = (bin_max - bin_min + 1) > (MAX_BINS - 2);
+
+	if (limited) {
+		bin_max = bin_min + MAX_BINS - 3;
+	}
+
+	if ((_buffer == nullptr) || (bin_max < bin_min)) {
+		_bin_min = 0;
+		_bin_max = -1;
+		_num_bins = 0;
+		return false;
+	}
+
+	_bin_min = bin_min;
+	_bin_max = bin_max;
+	_num_bins = bin_max - bin_min + 3;
+
+	for (int i = 0; i < _num_bins; i++) {
+		const int k = _bin_min - 1 + i;
+		const float omega = 2.f * M_PI_F * k / _length;
+		_twiddle_real[i] = _damping * cosf(omega);
+		_twiddle_imag[i] = _damping * sinf(omega);
+	}
+
+	reset();
+	return !limited;
+}
+
+void SlidingDFT::reset()
+{
+	if (_buffer) {
+		memset(_buffer, 0, sizeof(float) * _length);
+	}
+
+	_index = 0;
+	_sample_count = 0;
+
+	memset(_real, 0, sizeof(_real));
+	memset(_imag, 0, sizeof(_imag));
+}
+
+void SlidingDFT::update(const float samples[], int num_samples)
+{
+	if (_num_bins == 0) {
+		return;
+	}
+
+	for (int n = 0; n < num_samples; n++) {
+		// new sample in, oldest sample (damped r^N) out
+		const float delta = samples[n] - _damping_n * _buffer[_index];
+		_buffer[_index] = samples[n];
+		_index = (_index + 1 < _length) ? _index + 1 : 0;
+
+		for (int i = 0; i < _num_bins; i++) {
+			const float real = _real[i] + delta;
+			const float imag = _imag[i];
+			_real[i] = real * _twiddle_real[i] - imag * _twiddle_imag[i];
+			_imag[i] = real * _twiddle_imag[i] + imag * _twiddle_real[i];
+		}
+	}
+
+	_sample_count = math::min(_sample_count + num_samples, _length);
+}
+
+float SlidingDFT::windowedMagnitude(int k) const
+{
+	// Hann window w[n] = 0.5 - 0.5 * cos(2*pi*n/N) in the frequency domain: 0.5 X[k] - 0.25 (X[k-1] + X[k+1])
+	const int i = k - _bin_min + 1;
+	const float real = 0.5f * _real[i] - 0.25f * (_real[i - 1] + _real[i + 1]);
+	const float imag = 0.5f * _imag[i] - 0.25f * (_imag[i - 1] + _imag[i + 1]);
+	return sqrtf(real * real + imag * imag);
+}
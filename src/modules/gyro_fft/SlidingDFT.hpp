@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file SlidingDFT.hpp
+ *
+ * Sliding DFT over a band of bins, updated with every new sample.
+ *
+ * Each bin X[k] of the DFT of the last N samples is updated recursively at constant cost
+ *   X[k] = r * e^(j*2*pi*k/N) * (X[k] + x[n] - r^N * x[n-N])
+ * The damping r slightly below 1 (r^N = 0.99) keeps the recursion stable, rounding errors
+ * decay instead of accumulating.
+ *
+ * The Hann window is applied in the frequency domain, using the neighbouring bins.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class SlidingDFT
+{
+public:
+	static constexpr int MAX_BINS = 64;
+
+	SlidingDFT() = default;
+	~SlidingDFT();
+
+	// no copy, assignment, move, move assignment
+	SlidingDFT(const SlidingDFT &) = delete;
+	SlidingDFT &operator=(const SlidingDFT &) = delete;
+	SlidingDFT(SlidingDFT &&) = delete;
+	SlidingDFT &operator=(SlidingDFT &&) = delete;
+
+	/**
+	 * Allocate the sample buffer
+	 * @param length DFT length N
+	 */
+	bool init(int length);
+
+	/**
+	 * Select the bins to track and reset
+	 * The band is limited to MAX_BINS - 2 bins (the neighbouring bins are needed for the window).
+	 * @return false if the band is empty or has been limited
+	 */
+	bool configure(int bin_min, int bin_max);
+
+	void reset();
+
+	void update(const float samples[], int num_samples);
+
+	// true once a full window of samples has been processed
+	bool ready() const { return _sample_count >= _length; }
+
+	int length() const { return _length; }
+	int binMin() const { return _bin_min; }
+	int binMax() const { return _bin_max; }
+
+	// DFT bin (rectangular window), valid for binMin() - 1 <= k <= binMax() + 1
+	float real(int k) const { return _real[k - _bin_min + 1]; }
+	float imag(int k) const { return _imag[k - _bin_min + 1]; }
+
+	// Hann windowed bin magnitude, valid for binMin() <= k <= binMax()
+	float windowedMagnitude(int k) const;
+
+private:
+	float *_buffer{nullptr};
+
+	int _length{0};
+	int _index{0};
+	int _sample_count{0};
+
+	int _bin_min{0};
+	int _bin_max{-1};
+	int _num_bins{0}; // including the 2 neighbouring bins
+
+	float _damping{1.f};
+	float _damping_n{1.f};
+
+	// twiddle factors r * e^(j*2*pi*k/N)
+	float _twiddle_real[MAX_BINS] {};
+	float _twiddle_imag[MAX_BINS] {};
+
+	float _real[MAX_BINS] {};
+	float _imag[MAX_BINS] {};
+};
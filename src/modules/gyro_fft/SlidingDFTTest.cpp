@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the sliding DFT
+ * Run this test only using make tests TESTFILTER=SlidingDFT
+ */
+
+#include <gtest/gtest.h>
+#include <px4_platform_common/defines.h>
+#include <random>
+#include <vector>
+
+#include "SlidingDFT.hpp"
+
+class SlidingDFTTest : public ::testing::Test
+{
+public:
+	static constexpr int N = 256;
+
+	void SetUp() override
+	{
+		ASSERT_TRUE(_sdft.init(N));
+		ASSERT_TRUE(_sdft.configure(BIN_MIN, BIN_MAX));
+	}
+
+	void update(float sample)
+	{
+		_history.push_back(sample);
+		_sdft.update(&sample, 1);
+	}
+
+	// direct (damped) DFT of the last N samples
+	void referenceBin(int k, double &real, double &imag) const
+	{
+		const double damping = pow(0.99, 1.0 / N);
+		real = 0.0;
+		imag = 0.0;
+
+		for (int i = 0; i < N; i++) {
+			const double x = _history[_history.size() - N + i] * pow(damping, N - i);
+			real += x * cos(2.0 * M_PI * k * i / N);
+			imag -= x * sin(2.0 * M_PI * k * i / N);
+		}
+	}
+
+	int peakBin() const
+	{
+		int peak = -1;
+		float peak_magnitude = 0.f;
+
+		for (int k = _sdft.binMin(); k <= _sdft.binMax(); k++) {
+			if (_sdft.windowedMagnitude(k) > peak_magnitude) {
+				peak_magnitude = _sdft.windowedMagnitude(k);
+				peak = k;
+			}
+		}
+
+		return peak;
+	}
+
+	static constexpr int BIN_MIN = 4;
+	static constexpr int BIN_MAX = 20;
+	static constexpr float SAMPLE_RATE = 8000.f;
+
+	SlidingDFT _sdft;
+	std::vector<float> _history;
+};
+
+TEST_F(SlidingDFTTest, configure)
+{
+	EXPECT_EQ(_sdft.binMin(), BIN_MIN);
+	EXPECT_EQ(_sdft.binMax(), BIN_MAX);
+
+	// band limited to the available bins
+	EXPECT_FALSE(_sdft.configure(1, 200));
+	EXPECT_EQ(_sdft.binMax() - _sdft.binMin() + 3, SlidingDFT::MAX_BINS);
+
+	// empty band
+	EXPECT_FALSE(_sdft.configure(20, 10));
+}
+
+TEST_F(SlidingDFTTest, matchesDirectDFT)
+{
+	std::mt19937 generator{1};
+	std::uniform_int_distribution<int> distribution{-2000, 2000};
+
+	for (int n = 0; n < 3 * N + 17; n++) {
+		update(distribution(generator));
+		EXPECT_EQ(_sdft.ready(), n >= N - 1);
+	}
+
+	for (int k = BIN_MIN - 1; k <= BIN_MAX + 1; k++) {
+		double real = 0.0;
+		double imag = 0.0;
+		referenceBin(k, real, imag);
+
+		// relative to the scale of the bins (sqrt(N) * 2000 / sqrt(3))
+		EXPECT_NEAR(_sdft.real(k), real, 5.0);
+		EXPECT_NEAR(_sdft.imag(k), imag, 5.0);
+	}
+}
+
+TEST_F(SlidingDFTTest, stableLongRun)
+{
+	// 5 minutes at 8 kHz, the rounding errors must not accumulate
+	std::mt19937 generator{2};
+	std::normal_distribution<float> noise{0.f, 200.f};
+
+	for (int n = 0; n < 5 * 60 * 8000; n++) {
+		const float sample = roundf(10000.f * sinf(2.f * M_PI_F * 340.f * (n % 8000) / SAMPLE_RATE) + noise(generator));
+		update(sample);
+	}
+
+	// 1e-5 of the sine peak magnitude (N/2 * 10000)
+	const double tolerance = 1e-5 * N / 2 * 10000.0;
+
+	for (int k = BIN_MIN - 1; k <= BIN_MAX + 1; k++) {
+		double real = 0.0;
+		double imag = 0.0;
+		referenceBin(k, real, imag);
+
+		EXPECT_NEAR(_sdft.real(k), real, tolerance);
+		EXPECT_NEAR(_sdft.imag(k), imag, tolerance);
+	}
+}
+
+TEST_F(SlidingDFTTest, peakTracking)
+{
+	// bin resolution 31.25 Hz
+	const float resolution_hz = SAMPLE_RATE / N;
+	float phase = 0.f;
+
+	auto run = [&](float frequency_hz, int num_samples) {
+		for (int n = 0; n < num_samples; n++) {
+			phase += 2.f * M_PI_F * frequency_hz / SAMPLE_RATE;
+			update(1000.f * sinf(phase));
+		}
+	};
+
+	run(4.4f * resolution_hz, N);
+	EXPECT_EQ(peakBin(), 4);
+
+	run(11.6f * resolution_hz, N);
+	EXPECT_EQ(peakBin(), 12);
+
+	// the estimate follows a frequency step within half a window
+	run(17.f * resolution_hz, N / 2 + 8);
+	EXPECT_EQ(peakBin(), 17);
+}
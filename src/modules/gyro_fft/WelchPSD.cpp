@@ -0,0 +1,267 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "WelchPSD.hpp"
+
+#include <mathlib/math/Limits.hpp>
+#include <px4_platform_common/defines.h>
+#include <string.h>
+
+WelchPSD::~WelchPSD()
+{
+	free();
+}
+
+void WelchPSD::free()
+{
+	delete[] _window;
+	delete[] _buffer;
+	delete[] _segment;
+	delete[] _real;
+	delete[] _imag;
+	delete[] _periodograms;
+	delete[] _psd;
+
+	_window = nullptr;
+	_buffer = nullptr;
+	_segment = nullptr;
+	_real = nullptr;
+	_imag = nullptr;
+	_periodograms = nullptr;
+	_psd = nullptr;
+
+	_length = 0;
+}
+
+bool WelchPSD::init(int length, int hop, int averages)
+{
+	free();
+
+	if (!_fft.init(length) || (hop <= 0) || (hop > length) || (averages <= 0)) {
+		return false;
+	}
+
+	const int num_bins = length / 2 + 1;
+
+	_window = new float[length];
+	_buffer = new float[length];
+	_segment = new float[length];
+	_real = new float[num_bins];
+	_imag = new float[num_bins];
+	_periodograms = new float[averages * num_bins];
+	_psd = new float[num_bins];
+
+	if (!_window || !_buffer || !_segment || !_real || !_imag || !_periodograms || !_psd) {
+		free();
+		return false;
+	}
+
+	_length = length;
+	_hop = hop;
+	_averages = averages;
+
+	// periodic Hann window
+	_window_power = 0.f;
+
+	for (int n = 0; n < _length; n++) {
+		_window[n] = 0.5f * (1.f - cosf(2.f * M_PI_F * n / _length));
+		_window_power += _window[n] * _window[n];
+	}
+
+	reset();
+	return true;
+}
+
+void WelchPSD::reset()
+{
+	if (_length == 0) {
+		return;
+	}
+
+	memset(_buffer, 0, sizeof(float) * _length);
+	memset(_psd, 0, sizeof(float) * numBins());
+
+	_buffer_index = 0;
+	_sample_count = 0;
+	_buffer_filled = false;
+	_periodogram_index = 0;
+	_segments_count = 0;
+}
+
+bool WelchPSD::update(const float samples[], int num_samples)
+{
+	if (_length == 0) {
+		return false;
+	}
+
+	bool updated = false;
+
+	for (int n = 0; n < num_samples; n++) {
+		_buffer[_buffer_index] = samples[n];
+		_buffer_index = (_buffer_index + 1 < _length) ? _buffer_index + 1 : 0;
+		_sample_count++;
+
+		if ((!_buffer_filled && (_sample_count >= _length)) || (_buffer_filled && (_sample_count >= _hop))) {
+			_buffer_filled = true;
+			_sample_count = 0;
+
+			processSegment();
+			updated = true;
+		}
+	}
+
+	return updated;
+}
+
+void WelchPSD::processSegment()
+{
+	// oldest sample first
+	const int tail = _length - _buffer_index;
+
+	for (int n = 0; n < tail; n++) {
+		_segment[n] = _buffer[_buffer_index + n] * _window[n];
+	}
+
+	for (int n = 0; n < _buffer_index; n++) {
+		_segment[tail + n] = _buffer[n] * _window[tail + n];
+	}
+
+	_fft.transform(_segment, _real, _imag);
+
+	// one-sided PSD, the DC and Nyquist bins aren't doubled
+	const int num_bins = numBins();
+	const float scale = (_sample_rate_hz > 0.f) ? 1.f / (_sample_rate_hz * _window_power) : 1.f / _window_power;
+	float *periodogram = &_periodograms[_periodogram_index * num_bins];
+
+	for (int k = 0; k < num_bins; k++) {
+		const float power = (_real[k] * _real[k] + _imag[k] * _imag[k]) * scale;
+		periodogram[k] = ((k == 0) || (k == num_bins - 1)) ? power : 2.f * power;
+	}
+
+	_periodogram_index = (_periodogram_index + 1 < _averages) ? _periodogram_index + 1 : 0;
+	_segments_count = math::min(_segments_count + 1, _averages);
+
+	// average of the last segments
+	const float average_scale = 1.f / _segments_count;
+
+	for (int k = 0; k < num_bins; k++) {
+		_psd[k] = 0.f;
+	}
+
+	for (int segment = 0; segment < _segments_count; segment++) {
+		const float *p = &_periodograms[segment * num_bins];
+
+		for (int k = 0; k < num_bins; k++) {
+			_psd[k] += p[k];
+		}
+	}
+
+	for (int k = 0; k < num_bins; k++) {
+		_psd[k] *= average_scale;
+	}
+}
+
+float WelchPSD::peakBin(int bin) const
+{
+	if ((_length == 0) || (bin < 1) || (bin >= numBins() - 1)) {
+		return NAN;
+	}
+
+	const float left = _psd[bin - 1];
+	const float center = _psd[bin];
+	const float right = _psd[bin + 1];
+
+	if (!(center > 0.f) || (center < left) || (center < right)) {
+		return NAN;
+	}
+
+	// parabola through the log magnitudes (a Hann window peak is close to a Gaussian)
+	static constexpr float MIN_POWER = 1e-30f;
+	const float alpha = logf(math::max(left, MIN_POWER));
+	const float beta = logf(center);
+	const float gamma = logf(math::max(right, MIN_POWER));
+
+	const float denominator = alpha - 2.f * beta + gamma;
+
+	if (fabsf(denominator) < FLT_EPSILON) {
+		return bin;
+	}
+
+	const float delta = 0.5f * (alpha - gamma) / denominator;
+
+	return bin + math::constrain(delta, -0.5f, 0.5f);
+}
+
+void WelchPSD::bands(float band_start_hz, float band_ratio, float bands[], int num_bands) const
+{
+	const float resolution_hz = resolutionHz();
+
+	for (int band = 0; band < num_bands; band++) {
+		bands[band] = NAN;
+	}
+
+	if ((_length == 0) || !(resolution_hz > 0.f) || !(band_ratio > 1.f)) {
+		return;
+	}
+
+	const int num_bins = numBins();
+	float lower_hz = band_start_hz;
+
+	for (int band = 0; band < num_bands; band++) {
+		const float upper_hz = lower_hz * band_ratio;
+
+		// bins with their center frequency in [lower, upper)
+		const int bin_first = math::max((int)ceilf(lower_hz / resolution_hz), 0);
+		const int bin_last = math::min((int)ceilf(upper_hz / resolution_hz) - 1, num_bins - 1);
+
+		if (bin_first <= bin_last) {
+			float sum = 0.f;
+
+			for (int k = bin_first; k <= bin_last; k++) {
+				sum += _psd[k];
+			}
+
+			bands[band] = sum / (bin_last - bin_first + 1);
+
+		} else {
+			const int bin_closest = roundf(sqrtf(lower_hz * upper_hz) / resolution_hz);
+
+			if (bin_closest < num_bins) {
+				bands[band] = _psd[bin_closest];
+			}
+		}
+
+		lower_hz = upper_hz;
+	}
+}
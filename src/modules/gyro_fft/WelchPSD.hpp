@@ -0,0 +1,128 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file WelchPSD.hpp
+ *
+ * Power spectral density estimate with Welch's method: Hann windowed segments of N samples,
+ * overlapping by N - hop samples, and the periodograms of the last segments averaged.
+ *
+ * The one-sided PSD is in input units^2 / Hz.
+ */
+
+#pragma once
+
+#include "FloatFFT.hpp"
+
+class WelchPSD
+{
+public:
+	WelchPSD() = default;
+	~WelchPSD();
+
+	// no copy, assignment, move, move assignment
+	WelchPSD(const WelchPSD &) = delete;
+	WelchPSD &operator=(const WelchPSD &) = delete;
+	WelchPSD(WelchPSD &&) = delete;
+	WelchPSD &operator=(WelchPSD &&) = delete;
+
+	/**
+	 * @param length segment length N (power of 2)
+	 * @param hop number of new samples between two segments (N/2 for 50% overlap, N/4 for 75%)
+	 * @param averages number of averaged segments
+	 */
+	bool init(int length, int hop, int averages);
+
+	void setSampleRate(float sample_rate_hz) { _sample_rate_hz = sample_rate_hz; }
+
+	void reset();
+
+	/**
+	 * Add samples
+	 * @return true if a new segment has been processed and psd() updated
+	 */
+	bool update(const float samples[], int num_samples);
+
+	int length() const { return _length; }
+	int numBins() const { return _length / 2 + 1; }
+	float resolutionHz() const { return _sample_rate_hz / _length; }
+
+	// number of segments currently averaged
+	int averages() const { return _segments_count; }
+
+	// averaged PSD of bin 0 ... N/2
+	const float *psd() const { return _psd; }
+
+	/**
+	 * Peak location with a parabola fitted through the log PSD of the bin and its neighbours
+	 * @return fractional bin, NAN if the bin isn't a local maximum
+	 */
+	float peakBin(int bin) const;
+
+	/**
+	 * Mean PSD in log spaced bands with edges band_start_hz * band_ratio^i.
+	 * Bands narrower than a bin use the PSD of the bin closest to their center.
+	 */
+	void bands(float band_start_hz, float band_ratio, float bands[], int num_bands) const;
+
+private:
+	void free();
+	void processSegment();
+
+	FloatFFT _fft{};
+
+	int _length{0};
+	int _hop{0};
+	int _averages{0};
+
+	float _sample_rate_hz{0.f};
+
+	float *_window{nullptr};
+	float _window_power{0.f}; // sum(w^2)
+
+	float *_buffer{nullptr}; // last N samples (ring buffer)
+	int _buffer_index{0};
+	int _sample_count{0};    // samples since the last segment, N before the first
+	bool _buffer_filled{false};
+
+	float *_segment{nullptr};
+	float *_real{nullptr};
+	float *_imag{nullptr};
+
+	float *_periodograms{nullptr}; // [averages][N/2 + 1]
+	int _periodogram_index{0};
+	int _segments_count{0};
+
+	float *_psd{nullptr};
+};
@@ -0,0 +1,263 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the float FFT and the Welch PSD estimate
+ * Run this test only using make tests TESTFILTER=WelchPSD
+ */
+
+#include <gtest/gtest.h>
+#include <px4_platform_common/defines.h>
+#include <random>
+#include <vector>
+
+#include "FloatFFT.hpp"
+#include "WelchPSD.hpp"
+
+static constexpr float SAMPLE_RATE = 8000.f;
+
+TEST(FloatFFTTest, invalidLength)
+{
+	FloatFFT fft;
+	EXPECT_FALSE(fft.init(0));
+	EXPECT_FALSE(fft.init(100));
+	EXPECT_FALSE(fft.init(8));
+	EXPECT_TRUE(fft.init(16));
+}
+
+TEST(FloatFFTTest, matchesDirectDFT)
+{
+	std::mt19937 generator{1};
+	std::normal_distribution<float> noise{0.f, 1.f};
+
+	for (int length : {16, 64, 1024}) {
+		FloatFFT fft;
+		ASSERT_TRUE(fft.init(length));
+
+		std::vector<float> input(length);
+
+		for (float &x : input) {
+			x = noise(generator);
+		}
+
+		std::vector<float> real(length / 2 + 1);
+		std::vector<float> imag(length / 2 + 1);
+		fft.transform(input.data(), real.data(), imag.data());
+
+		for (int k = 0; k <= length / 2; k++) {
+			double expected_real = 0.0;
+			double expected_imag = 0.0;
+
+			for (int n = 0; n < length; n++) {
+				expected_real += input[n] * cos(2.0 * M_PI * k * n / length);
+				expected_imag -= input[n] * sin(2.0 * M_PI * k * n / length);
+			}
+
+			EXPECT_NEAR(real[k], expected_real, 1e-4 * length) << "length " << length << " bin " << k;
+			EXPECT_NEAR(imag[k], expected_imag, 1e-4 * length) << "length " << length << " bin " << k;
+		}
+	}
+}
+
+class WelchPSDTest : public ::testing::Test
+{
+public:
+	static constexpr int N = 1024;
+
+	void SetUp() override
+	{
+		ASSERT_TRUE(_welch.init(N, N / 4, 8));
+		_welch.setSampleRate(SAMPLE_RATE);
+	}
+
+	// feed in FIFO sized batches, returns the number of processed segments
+	int run(int num_samples, float sine_hz, float sine_amplitude, float noise_std)
+	{
+		std::normal_distribution<float> noise{0.f, noise_std};
+		int segments = 0;
+
+		for (int n = 0; n < num_samples; n += BATCH) {
+			float samples[BATCH];
+
+			for (int i = 0; i < BATCH; i++) {
+				_phase += 2.0 * M_PI * sine_hz / SAMPLE_RATE;
+				samples[i] = sine_amplitude * sin(_phase) + noise(_generator);
+			}
+
+			segments += _welch.update(samples, BATCH);
+		}
+
+		return segments;
+	}
+
+	static constexpr int BATCH = 8;
+
+	WelchPSD _welch;
+	std::mt19937 _generator{2};
+	double _phase{0.0};
+};
+
+TEST_F(WelchPSDTest, overlap)
+{
+	// first segment after N samples, then one every hop (75% overlap)
+	EXPECT_EQ(run(N - BATCH, 100.f, 1.f, 0.f), 0);
+	EXPECT_EQ(run(BATCH, 100.f, 1.f, 0.f), 1);
+	EXPECT_EQ(run(N, 100.f, 1.f, 0.f), 4);
+	EXPECT_EQ(_welch.averages(), 5);
+
+	run(10 * N, 100.f, 1.f, 0.f);
+	EXPECT_EQ(_welch.averages(), 8);
+}
+
+TEST_F(WelchPSDTest, whiteNoiseLevel)
+{
+	// one-sided PSD of white noise: variance / (fs / 2)
+	const float noise_std = 0.2f;
+	run(20 * N, 0.f, 0.f, noise_std);
+
+	const float expected = noise_std * noise_std / (SAMPLE_RATE / 2.f);
+	double mean = 0.0;
+
+	for (int k = 1; k < N / 2; k++) {
+		mean += _welch.psd()[k];
+	}
+
+	mean /= (N / 2 - 1);
+	EXPECT_NEAR(mean, expected, 0.05 * expected);
+}
+
+TEST_F(WelchPSDTest, averagingReducesVariance)
+{
+	auto spread = [this]() {
+		double sum = 0.0;
+		double sum_squared = 0.0;
+
+		for (int k = 1; k < N / 2; k++) {
+			sum += _welch.psd()[k];
+			sum_squared += _welch.psd()[k] * _welch.psd()[k];
+		}
+
+		const double mean = sum / (N / 2 - 1);
+		return sqrt(sum_squared / (N / 2 - 1) - mean * mean) / mean;
+	};
+
+	run(N, 0.f, 0.f, 1.f);
+	ASSERT_EQ(_welch.averages(), 1);
+	const double spread_single = spread();
+
+	run(7 * N / 4, 0.f, 0.f, 1.f);
+	ASSERT_EQ(_welch.averages(), 8);
+	const double spread_averaged = spread();
+
+	// a single periodogram has a relative standard deviation of 1, the overlapping segments are partially correlated
+	EXPECT_GT(spread_single, 0.8);
+	EXPECT_LT(spread_averaged, 0.6 * spread_single);
+}
+
+TEST_F(WelchPSDTest, sinePower)
+{
+	// the PSD integrated over the peak is the sine power A^2 / 2
+	const float amplitude = 0.5f;
+	run(10 * N, 117.f, amplitude, 0.f);
+
+	const int peak = roundf(117.f / _welch.resolutionHz());
+	double power = 0.0;
+
+	for (int k = peak - 3; k <= peak + 3; k++) {
+		power += _welch.psd()[k] * _welch.resolutionHz();
+	}
+
+	EXPECT_NEAR(power, amplitude * amplitude / 2.f, 0.02 * amplitude * amplitude / 2.f);
+}
+
+TEST_F(WelchPSDTest, peakInterpolation)
+{
+	const float resolution_hz = SAMPLE_RATE / N;
+
+	for (float offset : {0.f, 0.1f, 0.25f, 0.4f, 0.5f, -0.3f}) {
+		const float frequency_hz = (12.f + offset) * resolution_hz;
+
+		_welch.reset();
+		run(4 * N, frequency_hz, 1.f, 0.01f);
+
+		// raw peak
+		int peak = 1;
+
+		for (int k = 1; k < N / 2; k++) {
+			if (_welch.psd()[k] > _welch.psd()[peak]) {
+				peak = k;
+			}
+		}
+
+		const float estimate_hz = _welch.peakBin(peak) * resolution_hz;
+
+		// within 5% of a bin
+		EXPECT_NEAR(estimate_hz, frequency_hz, 0.05f * resolution_hz) << "offset " << offset;
+	}
+
+	EXPECT_FALSE(PX4_ISFINITE(_welch.peakBin(0)));
+}
+
+TEST_F(WelchPSDTest, bands)
+{
+	static constexpr int NUM_BANDS = 40;
+	const float band_start_hz = _welch.resolutionHz();
+	const float band_ratio = powf((SAMPLE_RATE / 2.f) / band_start_hz, 1.f / NUM_BANDS);
+
+	// white noise and a sine at 117 Hz
+	const float noise_std = 0.2f;
+	run(20 * N, 117.f, 0.5f, noise_std);
+
+	float bands[NUM_BANDS];
+	_welch.bands(band_start_hz, band_ratio, bands, NUM_BANDS);
+
+	const int sine_band = floorf(logf(117.f / band_start_hz) / logf(band_ratio));
+	const float noise_psd = noise_std * noise_std / (SAMPLE_RATE / 2.f);
+	double noise_mean = 0.0;
+
+	for (int band = 0; band < NUM_BANDS; band++) {
+		ASSERT_TRUE(PX4_ISFINITE(bands[band])) << "band " << band;
+
+		if (band == sine_band) {
+			EXPECT_GT(bands[band], 100.f * noise_psd);
+
+		} else if (abs(band - sine_band) > 1) {
+			noise_mean += bands[band];
+		}
+	}
+
+	// the low bands only contain a few bins and repeat the nearest bin when empty
+	noise_mean /= NUM_BANDS - 3;
+	EXPECT_NEAR(noise_mean, noise_psd, 0.2 * noise_psd);
+}
@@ -83,3 +83,46 @@ PARAM_DEFINE_INT32(IMU_GYRO_FFT_LEN, 512);
 * @group Sensors
 */
 PARAM_DEFINE_FLOAT(IMU_GYRO_FFT_SNR, 10.f);
+
+/**
+* IMU gyro FFT method.
+*
+* The FFT processes a full window of IMU_GYRO_FFT_LEN samples at once (3/4 overlap),
+* the sliding DFT updates the bins between IMU_GYRO_FFT_MIN and IMU_GYRO_FFT_MAX with every
+* sample and the peak estimate with every gyro FIFO batch, for lower latency at a constant CPU load.
+* Welch averages the power spectra of IMU_GYRO_FFT_AVG overlapping segments computed with a
+* single precision FFT for a lower variance peak estimate and publishes the PSD (sensor_gyro_psd),
+* only available on Linux targets.
+*
+* @value 0 FFT
+* @value 1 Sliding DFT
+* @value 2 Welch (float FFT)
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_MTH, 0);
+
+/**
+* IMU gyro FFT Welch segment overlap.
+*
+* Only used with IMU_GYRO_FFT_MTH Welch.
+*
+* @value 50 50%
+* @value 75 75%
+* @unit %
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_OVL, 75);
+
+/**
+* IMU gyro FFT Welch number of averaged segments.
+*
+* Only used with IMU_GYRO_FFT_MTH Welch.
+*
+* @min 1
+* @max 16
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_AVG, 8);
@@ -121,6 +121,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("sensor_combined");
 	add_optional_topic("sensor_correction");
 	add_optional_topic("sensor_gyro_fft", 50);
+	add_optional_topic("sensor_gyro_psd", 100);
 	add_topic("sensor_selection");
 	add_topic("sensors_status_imu", 200);
 	add_optional_topic("spoilers_setpoint", 1000);
@@ -179,6 +180,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic_multi("estimator_event_flags", 10);
 	add_optional_topic_multi("estimator_optical_flow_vel", 200);
 	add_optional_topic_multi("estimator_sensor_bias", 1000);
+	add_optional_topic_multi("estimator_smoothed_odometry", 20);
 	add_optional_topic_multi("estimator_status", 200);
 	add_optional_topic_multi("estimator_status_flags", 10);
 	add_optional_topic_multi("yaw_estimator_status", 1000);
@@ -0,0 +1,395 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "HighLatencyCodec.hpp"
+
+namespace high_latency
+{
+
+namespace
+{
+
+static constexpr uint8_t KEYFRAME_FLAG = 0x80;
+static constexpr uint8_t SEQ_MASK = 0x7f;
+
+// timestamp resolution of ~1 s, the reports are sent every few seconds at most
+static constexpr uint8_t TIMESTAMP_SHIFT = 10;
+static constexpr uint8_t MAX_HORIZONTAL_SHIFT = 10; // ~11 m
+static constexpr uint8_t MAX_VERTICAL_SHIFT = 4; // 16 m
+
+bool is_absolute(int field)
+{
+	// events are counted per report, not relative to the reference
+	return field == static_cast<int>(Field::ModeChanges) || field == static_cast<int>(Field::FailureEvents);
+}
+
+bool is_position(int field)
+{
+	return field == static_cast<int>(Field::Latitude) || field == static_cast<int>(Field::Longitude)
+	       || field == static_cast<int>(Field::Altitude);
+}
+
+uint8_t floor_log2(uint32_t value)
+{
+	uint8_t result = 0;
+
+	while (value > 1) {
+		value >>= 1;
+		result++;
+	}
+
+	return result;
+}
+
+/**
+ * Quantization step of a field as power of 2: the position to 1/8 of its accuracy
+ */
+uint8_t field_shift(int field, uint8_t horizontal_shift, uint8_t vertical_shift)
+{
+	switch (static_cast<Field>(field)) {
+	case Field::Timestamp: return TIMESTAMP_SHIFT;
+
+	case Field::Latitude:
+	case Field::Longitude: return horizontal_shift;
+
+	case Field::Altitude: return vertical_shift;
+
+	default: return 0;
+	}
+}
+
+// the differences are computed modulo 2^32, so that e.g. the longitude wraps around
+int32_t quantize(int32_t value, int32_t reference, uint8_t shift)
+{
+	const int64_t diff = static_cast<int32_t>(static_cast<uint32_t>(value) - static_cast<uint32_t>(reference));
+
+	if (shift == 0) {
+		return static_cast<int32_t>(diff);
+	}
+
+	const int64_t half = int64_t(1) << (shift - 1);
+	const int64_t q = diff >= 0 ? (diff + half) >> shift : -((-diff + half) >> shift);
+	return static_cast<int32_t>(q);
+}
+
+int32_t reconstruct(int32_t reference, int32_t q, uint8_t shift)
+{
+	return static_cast<int32_t>(static_cast<uint32_t>(reference) + static_cast<uint32_t>(static_cast<int64_t>(q) << shift));
+}
+
+uint32_t zigzag(int32_t value)
+{
+	return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int32_t unzigzag(uint32_t value)
+{
+	return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+class Writer
+{
+public:
+	Writer(uint8_t *buffer, size_t size) : _buffer(buffer), _size(size) {}
+
+	void put(uint8_t byte)
+	{
+		if (_length < _size) {
+			_buffer[_length] = byte;
+
+		} else {
+			_overflow = true;
+		}
+
+		_length++;
+	}
+
+	void put_varint(uint32_t value)
+	{
+		while (value >= 0x80) {
+			put(static_cast<uint8_t>(value) | 0x80);
+			value >>= 7;
+		}
+
+		put(static_cast<uint8_t>(value));
+	}
+
+	size_t length() const { return _overflow ? 0 : _length; }
+
+private:
+	uint8_t *_buffer;
+	size_t _size;
+	size_t _length{0};
+	bool _overflow{false};
+};
+
+class Reader
+{
+public:
+	Reader(const uint8_t *buffer, size_t length) : _buffer(buffer), _length(length) {}
+
+	bool get(uint8_t &byte)
+	{
+		if (_offset >= _length) {
+			return false;
+		}
+
+		byte = _buffer[_offset++];
+		return true;
+	}
+
+	bool get_varint(uint32_t &value)
+	{
+		value = 0;
+
+		for (int shift = 0; shift < 35; shift += 7) {
+			uint8_t byte;
+
+			if (!get(byte)) {
+				return false;
+			}
+
+			value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+
+			if ((byte & 0x80) == 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool done() const { return _offset == _length; }
+
+private:
+	const uint8_t *_buffer;
+	size_t _length;
+	size_t _offset{0};
+};
+
+} // namespace
+
+void Encoder::set_keyframe_interval(uint16_t interval)
+{
+	if (interval < 1) {
+		interval = 1;
+
+	} else if (interval > MAX_KEYFRAME_INTERVAL) {
+		interval = MAX_KEYFRAME_INTERVAL;
+	}
+
+	_keyframe_interval = interval;
+}
+
+size_t Encoder::encode(const Report &report, uint8_t *buffer, size_t size)
+{
+	const bool keyframe = !_reference_valid || (_count - _reference_count) >= _keyframe_interval;
+	const uint8_t seq = _count & SEQ_MASK;
+
+	static const Report zero{};
+	const Report &reference = keyframe ? zero : _reference;
+
+	// quantize the position relative to its accuracy
+	uint32_t eph = report[Field::Eph] > 0 ? report[Field::Eph] : 0;
+	uint32_t epv = report[Field::Epv] > 0 ? report[Field::Epv] : 0;
+	uint8_t horizontal_shift = floor_log2(eph * 9 / 8); // 1 degE7 ~ 1.1 cm, 1/8 of eph in dm
+	uint8_t vertical_shift = floor_log2(epv / 80); // 1/8 of epv in dm
+	horizontal_shift = horizontal_shift < MAX_HORIZONTAL_SHIFT ? horizontal_shift : MAX_HORIZONTAL_SHIFT;
+	vertical_shift = vertical_shift < MAX_VERTICAL_SHIFT ? vertical_shift : MAX_VERTICAL_SHIFT;
+
+	int32_t quantized[FIELD_COUNT];
+	Report state{};
+	uint32_t bitmap = 0;
+
+	for (int i = 0; i < FIELD_COUNT; i++) {
+		const int32_t ref = is_absolute(i) ? 0 : reference.value[i];
+		const uint8_t shift = field_shift(i, horizontal_shift, vertical_shift);
+		quantized[i] = quantize(report.value[i], ref, shift);
+		state.value[i] = reconstruct(ref, quantized[i], shift);
+
+		if (quantized[i] != 0) {
+			bitmap |= 1u << i;
+		}
+	}
+
+	Writer writer{buffer, size};
+	writer.put(seq | (keyframe ? KEYFRAME_FLAG : 0));
+
+	if (!keyframe) {
+		writer.put(_reference_count & SEQ_MASK);
+	}
+
+	writer.put_varint(bitmap);
+
+	bool position_present = false;
+
+	for (int i = 0; i < FIELD_COUNT; i++) {
+		position_present |= (bitmap & (1u << i)) && is_position(i);
+	}
+
+	if (position_present) {
+		writer.put(horizontal_shift | (vertical_shift << 4));
+	}
+
+	for (int i = 0; i < FIELD_COUNT; i++) {
+		if (bitmap & (1u << i)) {
+			writer.put_varint(zigzag(quantized[i]));
+		}
+	}
+
+	const size_t length = writer.length();
+
+	if (length == 0) {
+		return 0;
+	}
+
+	Entry &entry = _history[_count % HISTORY_SIZE];
+	entry.state = state;
+	entry.count = _count;
+	entry.valid = true;
+
+	if (keyframe) {
+		_reference = state;
+		_reference_count = _count;
+		_reference_valid = true;
+		_keyframes++;
+	}
+
+	_count++;
+	return length;
+}
+
+void Encoder::acknowledge(uint8_t seq)
+{
+	if (!_reference_valid) {
+		// waiting for the next keyframe
+		return;
+	}
+
+	for (const Entry &entry : _history) {
+		if (entry.valid && (entry.count & SEQ_MASK) == (seq & SEQ_MASK) && entry.count > _reference_count) {
+			_reference = entry.state;
+			_reference_count = entry.count;
+			return;
+		}
+	}
+}
+
+bool Decoder::decode(const uint8_t *buffer, size_t length, Report &report, uint8_t &seq)
+{
+	Reader reader{buffer, length};
+	uint8_t header;
+
+	if (!reader.get(header)) {
+		return false;
+	}
+
+	Report reference{};
+
+	if ((header & KEYFRAME_FLAG) == 0) {
+		uint8_t reference_seq;
+
+		if (!reader.get(reference_seq)) {
+			return false;
+		}
+
+		const Entry &entry = _history[reference_seq % HISTORY_SIZE];
+
+		if (!entry.valid || entry.seq != reference_seq) {
+			return false;
+		}
+
+		reference = entry.state;
+	}
+
+	uint32_t bitmap;
+
+	if (!reader.get_varint(bitmap) || (bitmap >> FIELD_COUNT) != 0) {
+		return false;
+	}
+
+	uint8_t horizontal_shift = 0;
+	uint8_t vertical_shift = 0;
+	bool position_present = false;
+
+	for (int i = 0; i < FIELD_COUNT; i++) {
+		position_present |= (bitmap & (1u << i)) && is_position(i);
+	}
+
+	if (position_present) {
+		uint8_t shifts;
+
+		if (!reader.get(shifts)) {
+			return false;
+		}
+
+		horizontal_shift = shifts & 0xf;
+		vertical_shift = shifts >> 4;
+	}
+
+	Report state{};
+
+	for (int i = 0; i < FIELD_COUNT; i++) {
+		const int32_t ref = is_absolute(i) ? 0 : reference.value[i];
+		int32_t q = 0;
+
+		if (bitmap & (1u << i)) {
+			uint32_t value;
+
+			if (!reader.get_varint(value)) {
+				return false;
+			}
+
+			q = unzigzag(value);
+		}
+
+		state.value[i] = reconstruct(ref, q, field_shift(i, horizontal_shift, vertical_shift));
+	}
+
+	if (!reader.done()) {
+		return false;
+	}
+
+	seq = header & SEQ_MASK;
+
+	Entry &entry = _history[seq % HISTORY_SIZE];
+	entry.state = state;
+	entry.seq = seq;
+	entry.valid = true;
+
+	report = state;
+	return true;
+}
+
+} // namespace high_latency
@@ -0,0 +1,180 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file HighLatencyCodec.hpp
+ * Compact encoding of the high latency (satellite link) telemetry.
+ *
+ * A report carries the HIGH_LATENCY2 fields (same units) and the events aggregated since the
+ * previous report. Only the fields that changed with respect to a reference state known to the
+ * receiver are sent: either the last keyframe, or the latest report acknowledged by the receiver.
+ * The position is quantized adaptively to a fraction of its accuracy (eph/epv).
+ *
+ * Message layout:
+ *  - header: bit 7 keyframe, bits 0-6 sequence number
+ *  - sequence number of the reference (delta reports only)
+ *  - bitmap of the present fields, as varint
+ *  - quantization shifts, if a position field is present: bits 0-3 latitude/longitude, bits 4-7 altitude
+ *  - the present fields in order, zigzag varint of the quantized difference to the reference
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace high_latency
+{
+
+enum class Field : uint8_t {
+	Timestamp,		///< [ms]
+	Latitude,		///< [degE7]
+	Longitude,		///< [degE7]
+	Altitude,		///< [m]
+	TargetAltitude,		///< [m]
+	TargetDistance,		///< [dam]
+	Heading,		///< [deg/2]
+	TargetHeading,		///< [deg/2]
+	WpNum,
+	CustomMode,
+	FailureFlags,		///< HL_FAILURE_FLAG set at the time of the report
+	Type,
+	Autopilot,
+	Airspeed,		///< [m/s*5]
+	AirspeedSp,		///< [m/s*5]
+	Groundspeed,		///< [m/s*5]
+	Windspeed,		///< [m/s*5]
+	WindHeading,		///< [deg/2]
+	Eph,			///< [dm]
+	Epv,			///< [dm]
+	TemperatureAir,		///< [degC]
+	ClimbRate,		///< [dm/s]
+	Throttle,		///< [%]
+	Battery,		///< [%]
+	ModeChanges,		///< number of flight mode changes since the previous report
+	FailureEvents,		///< HL_FAILURE_FLAG raised since the previous report that are not set anymore
+	Count
+};
+
+static constexpr int FIELD_COUNT = static_cast<int>(Field::Count);
+
+struct Report {
+	int32_t value[FIELD_COUNT] {};
+
+	int32_t &operator[](Field field) { return value[static_cast<int>(field)]; }
+	int32_t operator[](Field field) const { return value[static_cast<int>(field)]; }
+};
+
+class Encoder
+{
+public:
+	/// upper bound of an encoded report, size of the HIGH_LATENCY_COMPACT data field
+	static constexpr size_t MAX_SIZE = 128;
+
+	/// the reference must still be known by the decoder
+	static constexpr uint16_t MAX_KEYFRAME_INTERVAL = 31;
+
+	Encoder() = default;
+	~Encoder() = default;
+
+	/**
+	 * Number of reports after which a keyframe is sent if no newer report was acknowledged
+	 */
+	void set_keyframe_interval(uint16_t interval);
+
+	/**
+	 * Encode a report
+	 * @return length written to buffer, 0 if it doesn't fit
+	 */
+	size_t encode(const Report &report, uint8_t *buffer, size_t size);
+
+	/**
+	 * Handle the acknowledgement of a report, it becomes the reference of the next ones
+	 */
+	void acknowledge(uint8_t seq);
+
+	/**
+	 * Force a keyframe with the next report, e.g. if the receiver lost its state
+	 */
+	void reset() { _reference_valid = false; }
+
+	uint32_t keyframes() const { return _keyframes; }
+	uint32_t reports() const { return _count; }
+
+private:
+	static constexpr int HISTORY_SIZE = 8;
+
+	struct Entry {
+		Report state;		///< report as reconstructed by the receiver
+		uint32_t count{0};	///< report counter, not wrapping
+		bool valid{false};
+	};
+
+	Entry _history[HISTORY_SIZE] {};
+
+	Report _reference{};
+	uint32_t _reference_count{0};
+	bool _reference_valid{false};
+
+	uint32_t _count{0};
+	uint32_t _keyframes{0};
+	uint16_t _keyframe_interval{10};
+};
+
+class Decoder
+{
+public:
+	Decoder() = default;
+	~Decoder() = default;
+
+	/**
+	 * Decode a report
+	 * @param seq sequence number of the report, to be acknowledged
+	 * @return false if the message is invalid or its reference is unknown
+	 */
+	bool decode(const uint8_t *buffer, size_t length, Report &report, uint8_t &seq);
+
+private:
+	static constexpr int HISTORY_SIZE = Encoder::MAX_KEYFRAME_INTERVAL + 1;
+
+	struct Entry {
+		Report state;
+		uint8_t seq{0};
+		bool valid{false};
+	};
+
+	Entry _history[HISTORY_SIZE] {};
+};
+
+} // namespace high_latency
@@ -0,0 +1,292 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "HighLatencyCodec.hpp"
+#include <gtest/gtest.h>
+
+using namespace high_latency;
+
+static Report make_report(int i)
+{
+	Report report{};
+	report[Field::Timestamp] = 100000 + i * 30000;
+	report[Field::Latitude] = 473977419 + i * 1000;
+	report[Field::Longitude] = 85455938 - i * 2000;
+	report[Field::Altitude] = 500 + i;
+	report[Field::TargetAltitude] = 520;
+	report[Field::Heading] = 45;
+	report[Field::WpNum] = 3;
+	report[Field::CustomMode] = 4;
+	report[Field::Type] = 1;
+	report[Field::Autopilot] = 12;
+	report[Field::Groundspeed] = 100;
+	report[Field::Eph] = 10;
+	report[Field::Epv] = 20;
+	report[Field::TemperatureAir] = 15;
+	report[Field::Throttle] = 60;
+	report[Field::Battery] = 90 - i;
+	return report;
+}
+
+static void expect_near(const Report &decoded, const Report &report)
+{
+	for (int i = 0; i < FIELD_COUNT; i++) {
+		const Field field = static_cast<Field>(i);
+
+		if (field == Field::Timestamp) {
+			EXPECT_NEAR(decoded[field], report[field], 512);
+
+		} else if (field == Field::Latitude || field == Field::Longitude) {
+			// 1/8 of eph
+			EXPECT_NEAR(decoded[field], report[field], report[Field::Eph] * 9 / 16 + 1);
+
+		} else {
+			EXPECT_EQ(decoded[field], report[field]) << "field " << i;
+		}
+	}
+}
+
+TEST(HighLatencyCodec, KeyframeRoundTrip)
+{
+	Encoder encoder;
+	Decoder decoder;
+	uint8_t buffer[Encoder::MAX_SIZE];
+	const Report report = make_report(0);
+
+	const size_t length = encoder.encode(report, buffer, sizeof(buffer));
+	ASSERT_GT(length, 0u);
+	EXPECT_NE(buffer[0] & 0x80, 0);
+
+	Report decoded;
+	uint8_t seq = 0xff;
+	ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+	EXPECT_EQ(seq, 0);
+	expect_near(decoded, report);
+}
+
+TEST(HighLatencyCodec, DeltasAreSmaller)
+{
+	Encoder encoder;
+	Decoder decoder;
+	uint8_t buffer[Encoder::MAX_SIZE];
+
+	const size_t keyframe_length = encoder.encode(make_report(0), buffer, sizeof(buffer));
+	Report decoded;
+	uint8_t seq;
+	ASSERT_TRUE(decoder.decode(buffer, keyframe_length, decoded, seq));
+
+	for (int i = 1; i < 5; i++) {
+		const Report report = make_report(i);
+		const size_t length = encoder.encode(report, buffer, sizeof(buffer));
+		ASSERT_GT(length, 0u);
+		EXPECT_LT(length, keyframe_length / 2);
+		ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+		EXPECT_EQ(seq, i);
+		expect_near(decoded, report);
+	}
+}
+
+TEST(HighLatencyCodec, NoErrorAccumulation)
+{
+	Encoder encoder;
+	Decoder decoder;
+	encoder.set_keyframe_interval(Encoder::MAX_KEYFRAME_INTERVAL);
+	uint8_t buffer[Encoder::MAX_SIZE];
+	Report decoded;
+	uint8_t seq;
+
+	for (int i = 0; i < 100; i++) {
+		Report report = make_report(i);
+		// drift slower than the quantization step
+		report[Field::Latitude] = 473977419 + i * 3;
+		const size_t length = encoder.encode(report, buffer, sizeof(buffer));
+		ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+		expect_near(decoded, report);
+		encoder.acknowledge(seq);
+	}
+}
+
+TEST(HighLatencyCodec, LostReportsWithoutAck)
+{
+	Encoder encoder;
+	Decoder decoder;
+	encoder.set_keyframe_interval(4);
+	uint8_t buffer[Encoder::MAX_SIZE];
+	Report decoded;
+	uint8_t seq;
+
+	for (int i = 0; i < 12; i++) {
+		const Report report = make_report(i);
+		const size_t length = encoder.encode(report, buffer, sizeof(buffer));
+
+		// every other report is lost, the others are relative to the last keyframe
+		if (i % 2 == 0) {
+			ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+			expect_near(decoded, report);
+		}
+	}
+
+	EXPECT_EQ(encoder.keyframes(), 3u);
+}
+
+TEST(HighLatencyCodec, AcknowledgedReference)
+{
+	Encoder encoder;
+	Decoder decoder;
+	encoder.set_keyframe_interval(4);
+	uint8_t buffer[Encoder::MAX_SIZE];
+	Report decoded;
+	uint8_t seq;
+
+	for (int i = 0; i < 20; i++) {
+		const Report report = make_report(i);
+		const size_t length = encoder.encode(report, buffer, sizeof(buffer));
+		ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+		expect_near(decoded, report);
+
+		// the reference keeps moving, no keyframe is needed
+		encoder.acknowledge(seq);
+
+		if (i > 0) {
+			EXPECT_EQ(buffer[1], (seq - 1) & 0x7f);
+		}
+	}
+
+	EXPECT_EQ(encoder.keyframes(), 1u);
+}
+
+TEST(HighLatencyCodec, UnknownReference)
+{
+	Encoder encoder;
+	Decoder decoder;
+	uint8_t buffer[Encoder::MAX_SIZE];
+	Report decoded;
+	uint8_t seq;
+
+	// keyframe lost
+	encoder.encode(make_report(0), buffer, sizeof(buffer));
+
+	const size_t length = encoder.encode(make_report(1), buffer, sizeof(buffer));
+	EXPECT_FALSE(decoder.decode(buffer, length, decoded, seq));
+
+	// truncated
+	EXPECT_FALSE(decoder.decode(buffer, 1, decoded, seq));
+
+	encoder.reset();
+	const size_t keyframe_length = encoder.encode(make_report(2), buffer, sizeof(buffer));
+	EXPECT_TRUE(decoder.decode(buffer, keyframe_length, decoded, seq));
+}
+
+TEST(HighLatencyCodec, AdaptiveQuantization)
+{
+	Encoder accurate_encoder;
+	Encoder coarse_encoder;
+	Decoder decoder;
+	uint8_t buffer[Encoder::MAX_SIZE];
+	Report decoded;
+	uint8_t seq;
+
+	Report report = make_report(0);
+	accurate_encoder.encode(report, buffer, sizeof(buffer));
+	report = make_report(1);
+	const size_t accurate_length = accurate_encoder.encode(report, buffer, sizeof(buffer));
+
+	report = make_report(0);
+	report[Field::Eph] = 250;
+	report[Field::Epv] = 250;
+	size_t length = coarse_encoder.encode(report, buffer, sizeof(buffer));
+	ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+
+	report = make_report(1);
+	report[Field::Eph] = 250;
+	report[Field::Epv] = 250;
+	const size_t coarse_length = coarse_encoder.encode(report, buffer, sizeof(buffer));
+	EXPECT_LT(coarse_length, accurate_length);
+
+	ASSERT_TRUE(decoder.decode(buffer, coarse_length, decoded, seq));
+	// 1/8 of 25 m, 2.8 m steps
+	EXPECT_NEAR(decoded[Field::Latitude], report[Field::Latitude], 128);
+	EXPECT_NEAR(decoded[Field::Altitude], report[Field::Altitude], 1);
+}
+
+TEST(HighLatencyCodec, Events)
+{
+	Encoder encoder;
+	Decoder decoder;
+	uint8_t buffer[Encoder::MAX_SIZE];
+	Report decoded;
+	uint8_t seq;
+
+	Report report = make_report(0);
+	report[Field::ModeChanges] = 2;
+	size_t length = encoder.encode(report, buffer, sizeof(buffer));
+	ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+	EXPECT_EQ(decoded[Field::ModeChanges], 2);
+
+	// event counts are not relative to the reference
+	report[Field::ModeChanges] = 0;
+	report[Field::FailureEvents] = 1 << 3;
+	length = encoder.encode(report, buffer, sizeof(buffer));
+	ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+	EXPECT_EQ(decoded[Field::ModeChanges], 0);
+	EXPECT_EQ(decoded[Field::FailureEvents], 1 << 3);
+}
+
+TEST(HighLatencyCodec, LongitudeWrap)
+{
+	Encoder encoder;
+	Decoder decoder;
+	uint8_t buffer[Encoder::MAX_SIZE];
+	Report decoded;
+	uint8_t seq;
+
+	Report report = make_report(0);
+	report[Field::Longitude] = 1799999990;
+	size_t length = encoder.encode(report, buffer, sizeof(buffer));
+	ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+
+	report[Field::Longitude] = -1799999990;
+	length = encoder.encode(report, buffer, sizeof(buffer));
+	ASSERT_TRUE(decoder.decode(buffer, length, decoded, seq));
+	EXPECT_NEAR(decoded[Field::Longitude], report[Field::Longitude], 8);
+}
+
+TEST(HighLatencyCodec, BufferTooSmall)
+{
+	Encoder encoder;
+	uint8_t buffer[4];
+
+	EXPECT_EQ(encoder.encode(make_report(0), buffer, sizeof(buffer)), 0u);
+	EXPECT_EQ(encoder.reports(), 0u);
+}
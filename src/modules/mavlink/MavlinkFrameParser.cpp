@@ -0,0 +1,123 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MavlinkFrameParser.hpp"
+
+#include <string.h>
+
+size_t MavlinkFrameParser::parse(const uint8_t *buf, size_t len, mavlink_message_t &msg)
+{
+	if (len == 0) {
+		return 0;
+	}
+
+	size_t header_len = 0;
+	size_t signature_len = 0;
+
+	if (buf[0] == MAVLINK_STX) {
+		// magic, len, incompat_flags, compat_flags, seq, sysid, compid, msgid (24 bit)
+		header_len = MAVLINK_NUM_HEADER_BYTES;
+
+		if ((len < header_len) || ((buf[2] & ~MAVLINK_IFLAG_MASK) != 0)) {
+			// incomplete or uses an incompatible feature
+			return 0;
+		}
+
+		if (buf[2] & MAVLINK_IFLAG_SIGNED) {
+			signature_len = MAVLINK_SIGNATURE_BLOCK_LEN;
+		}
+
+		msg.incompat_flags = buf[2];
+		msg.compat_flags = buf[3];
+		msg.seq = buf[4];
+		msg.sysid = buf[5];
+		msg.compid = buf[6];
+		msg.msgid = buf[7] | (buf[8] << 8) | (buf[9] << 16);
+
+	} else if (buf[0] == MAVLINK_STX_MAVLINK1) {
+		// magic, len, seq, sysid, compid, msgid (8 bit)
+		header_len = MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1;
+
+		if (len < header_len) {
+			return 0;
+		}
+
+		msg.incompat_flags = 0;
+		msg.compat_flags = 0;
+		msg.seq = buf[2];
+		msg.sysid = buf[3];
+		msg.compid = buf[4];
+		msg.msgid = buf[5];
+
+	} else {
+		return 0;
+	}
+
+	const size_t payload_len = buf[1];
+	const size_t frame_len = header_len + payload_len + MAVLINK_NUM_CHECKSUM_BYTES + signature_len;
+
+	if (len < frame_len) {
+		return 0;
+	}
+
+	// header (without magic) and payload, followed by the CRC extra byte of the message
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msg.msgid);
+	uint16_t checksum = crc_calculate(&buf[1], header_len - 1 + payload_len);
+	crc_accumulate(entry ? entry->crc_extra : 0, &checksum);
+
+	const uint8_t *ck = &buf[header_len + payload_len];
+
+	if ((ck[0] != (checksum & 0xFF)) || (ck[1] != (checksum >> 8))) {
+		return 0;
+	}
+
+	msg.magic = buf[0];
+	msg.len = payload_len;
+	msg.checksum = checksum;
+	msg.ck[0] = ck[0];
+	msg.ck[1] = ck[1];
+
+	uint8_t *payload = reinterpret_cast<uint8_t *>(_MAV_PAYLOAD_NON_CONST(&msg));
+	memcpy(payload, &buf[header_len], payload_len);
+
+	if (entry && (payload_len < entry->max_msg_len)) {
+		memset(&payload[payload_len], 0, entry->max_msg_len - payload_len);
+	}
+
+	if (signature_len > 0) {
+		memcpy(msg.signature, &ck[MAVLINK_NUM_CHECKSUM_BYTES], signature_len);
+	}
+
+	return frame_len;
+}
@@ -0,0 +1,64 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MavlinkFrameParser.hpp
+ * Parser for complete MAVLink frames, e.g. the content of a UDP datagram.
+ *
+ * mavlink_parse_char() runs a state machine for every byte. When the frames are known to be
+ * complete, the header, payload length and checksum can be validated in one pass instead.
+ */
+
+#pragma once
+
+#include "mavlink_bridge_header.h"
+#include <stddef.h>
+#include <stdint.h>
+
+class MavlinkFrameParser
+{
+public:
+	/**
+	 * Parse a MAVLink 1 or 2 frame at the start of a buffer.
+	 *
+	 * The checksum includes the CRC extra byte of the message, as with mavlink_parse_char().
+	 * The payload of truncated MAVLink 2 messages is zero filled up to the message length.
+	 *
+	 * @param buf received bytes, starting with the magic byte of a frame
+	 * @param len number of bytes in buf
+	 * @param msg parsed message
+	 * @return length of the frame in bytes, 0 if buf doesn't start with a complete and valid frame
+	 */
+	static size_t parse(const uint8_t *buf, size_t len, mavlink_message_t &msg);
+};
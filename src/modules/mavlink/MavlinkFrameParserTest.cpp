@@ -0,0 +1,268 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MavlinkFrameParser.hpp"
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+namespace
+{
+
+static constexpr int num_flood_frames = 100000;
+
+// pack without a channel, mavlink_msg_*_pack() needs a running mavlink instance
+size_t pack_position_target(uint8_t *buf, uint8_t seq, bool mavlink1)
+{
+	mavlink_set_position_target_local_ned_t target{};
+	target.time_boot_ms = 1000u * seq;
+	target.x = 1.f;
+	target.y = -2.f;
+	target.z = -3.f + seq;
+	target.type_mask = 0x0DF8;
+	target.coordinate_frame = MAV_FRAME_LOCAL_NED;
+
+	mavlink_status_t status{};
+	status.current_tx_seq = seq;
+
+	if (mavlink1) {
+		status.flags |= MAVLINK_STATUS_FLAG_OUT_MAVLINK1;
+	}
+
+	mavlink_message_t msg{};
+	msg.msgid = MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED;
+	memcpy(_MAV_PAYLOAD_NON_CONST(&msg), &target, sizeof(target));
+	mavlink_finalize_message_buffer(&msg, 255, 190, &status, MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED_MIN_LEN,
+					MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED_LEN, MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED_CRC);
+
+	return mavlink_msg_to_send_buffer(buf, &msg);
+}
+
+size_t pack_odometry(uint8_t *buf, uint8_t seq)
+{
+	// mostly zeros, the MAVLink 2 payload is truncated
+	mavlink_odometry_t odometry{};
+	odometry.time_usec = 1000000u * seq;
+	odometry.x = 5.f;
+	odometry.q[0] = 1.f;
+	odometry.frame_id = MAV_FRAME_LOCAL_FRD;
+
+	mavlink_status_t status{};
+	status.current_tx_seq = seq;
+
+	mavlink_message_t msg{};
+	msg.msgid = MAVLINK_MSG_ID_ODOMETRY;
+	memcpy(_MAV_PAYLOAD_NON_CONST(&msg), &odometry, sizeof(odometry));
+	mavlink_finalize_message_buffer(&msg, 1, 197, &status, MAVLINK_MSG_ID_ODOMETRY_MIN_LEN,
+					MAVLINK_MSG_ID_ODOMETRY_LEN, MAVLINK_MSG_ID_ODOMETRY_CRC);
+
+	return mavlink_msg_to_send_buffer(buf, &msg);
+}
+
+// datagram with a mix of MAVLink 1 and 2 frames, as sent by an offboard computer
+size_t generate_datagram(uint8_t *buf, uint8_t seq)
+{
+	size_t len = 0;
+	len += pack_position_target(&buf[len], seq, false);
+	len += pack_odometry(&buf[len], seq + 1);
+	len += pack_position_target(&buf[len], seq + 2, true);
+	return len;
+}
+
+// reference: byte wise state machine of the MAVLink library
+int parse_bytewise(const uint8_t *buf, size_t len, mavlink_message_t *out, int max_out)
+{
+	mavlink_message_t rxmsg{};
+	mavlink_status_t status{};
+	mavlink_status_t r_status{};
+	int count = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		if (mavlink_frame_char_buffer(&rxmsg, &status, buf[i], &out[count], &r_status) == MAVLINK_FRAMING_OK) {
+			count = (count + 1 < max_out) ? count + 1 : count;
+		}
+	}
+
+	return count;
+}
+
+int parse_frames(const uint8_t *buf, size_t len, mavlink_message_t *out, int max_out)
+{
+	size_t i = 0;
+	int count = 0;
+
+	while (i < len) {
+		const size_t frame_len = MavlinkFrameParser::parse(&buf[i], len - i, out[count]);
+
+		if (frame_len == 0) {
+			break;
+		}
+
+		count = (count + 1 < max_out) ? count + 1 : count;
+		i += frame_len;
+	}
+
+	return count;
+}
+
+void expect_same_message(const mavlink_message_t &a, const mavlink_message_t &b)
+{
+	EXPECT_EQ(a.magic, b.magic);
+	EXPECT_EQ(a.len, b.len);
+	EXPECT_EQ(a.incompat_flags, b.incompat_flags);
+	EXPECT_EQ(a.seq, b.seq);
+	EXPECT_EQ(a.sysid, b.sysid);
+	EXPECT_EQ(a.compid, b.compid);
+	EXPECT_EQ(a.msgid, b.msgid);
+	EXPECT_EQ(a.checksum, b.checksum);
+
+	// including the zero filled part of truncated payloads
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(a.msgid);
+	ASSERT_NE(entry, nullptr);
+	EXPECT_EQ(memcmp(_MAV_PAYLOAD(&a), _MAV_PAYLOAD(&b), entry->max_msg_len), 0);
+}
+
+} // namespace
+
+TEST(MavlinkFrameParser, SameAsBytewiseParser)
+{
+	uint8_t buf[1024];
+	const size_t len = generate_datagram(buf, 10);
+
+	mavlink_message_t expected[4];
+	mavlink_message_t parsed[4];
+
+	ASSERT_EQ(parse_bytewise(buf, len, expected, 4), 3);
+	ASSERT_EQ(parse_frames(buf, len, parsed, 4), 3);
+
+	for (int i = 0; i < 3; i++) {
+		expect_same_message(expected[i], parsed[i]);
+	}
+
+	EXPECT_EQ(parsed[0].magic, MAVLINK_STX);
+	EXPECT_EQ(parsed[1].msgid, MAVLINK_MSG_ID_ODOMETRY);
+	EXPECT_LT(parsed[1].len, MAVLINK_MSG_ID_ODOMETRY_LEN);
+	EXPECT_EQ(parsed[2].magic, MAVLINK_STX_MAVLINK1);
+
+	mavlink_odometry_t odometry;
+	mavlink_msg_odometry_decode(&parsed[1], &odometry);
+	EXPECT_EQ(odometry.time_usec, 11000000u);
+	EXPECT_FLOAT_EQ(odometry.x, 5.f);
+	EXPECT_FLOAT_EQ(odometry.q[0], 1.f);
+	EXPECT_EQ(odometry.frame_id, MAV_FRAME_LOCAL_FRD);
+}
+
+TEST(MavlinkFrameParser, RejectsCorruptedFrame)
+{
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+	mavlink_message_t msg;
+
+	size_t len = pack_odometry(buf, 0);
+	ASSERT_EQ(MavlinkFrameParser::parse(buf, len, msg), len);
+
+	// payload bit flip
+	buf[MAVLINK_NUM_HEADER_BYTES + 3] ^= 0x10;
+	EXPECT_EQ(MavlinkFrameParser::parse(buf, len, msg), 0u);
+
+	// checksum
+	len = pack_position_target(buf, 0, false);
+	buf[len - 1] ^= 0x01;
+	EXPECT_EQ(MavlinkFrameParser::parse(buf, len, msg), 0u);
+
+	// unsupported incompatibility flag
+	len = pack_position_target(buf, 0, false);
+	buf[2] |= 0x80;
+	EXPECT_EQ(MavlinkFrameParser::parse(buf, len, msg), 0u);
+
+	// no magic byte
+	len = pack_position_target(buf, 0, false);
+	EXPECT_EQ(MavlinkFrameParser::parse(&buf[1], len - 1, msg), 0u);
+}
+
+TEST(MavlinkFrameParser, RejectsIncompleteFrame)
+{
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+	mavlink_message_t msg;
+
+	const size_t len = pack_position_target(buf, 0, false);
+
+	for (size_t i = 0; i < len; i++) {
+		EXPECT_EQ(MavlinkFrameParser::parse(buf, i, msg), 0u);
+	}
+
+	// trailing bytes belong to the next frame
+	EXPECT_EQ(MavlinkFrameParser::parse(buf, sizeof(buf), msg), len);
+}
+
+TEST(MavlinkFrameParser, FloodThroughput)
+{
+	// pre-generate the datagrams, only the parsing is timed
+	static constexpr int num_datagrams = num_flood_frames / 3;
+	static constexpr size_t datagram_size = 3 * MAVLINK_MAX_PACKET_LEN;
+	uint8_t *datagrams = new uint8_t[num_datagrams * datagram_size];
+	size_t *datagram_len = new size_t[num_datagrams];
+
+	for (int i = 0; i < num_datagrams; i++) {
+		datagram_len[i] = generate_datagram(&datagrams[i * datagram_size], i * 3);
+	}
+
+	mavlink_message_t msgs[4];
+
+	auto measure = [&](int (*parser)(const uint8_t *, size_t, mavlink_message_t *, int), int &frames) {
+		frames = 0;
+		const auto start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < num_datagrams; i++) {
+			frames += parser(&datagrams[i * datagram_size], datagram_len[i], msgs, 4);
+		}
+
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	};
+
+	int frames_bytewise = 0;
+	int frames_parsed = 0;
+	const double t_bytewise = measure(parse_bytewise, frames_bytewise);
+	const double t_parsed = measure(parse_frames, frames_parsed);
+
+	EXPECT_EQ(frames_bytewise, num_datagrams * 3);
+	EXPECT_EQ(frames_parsed, num_datagrams * 3);
+
+	printf("byte wise: %.0f frames/s, frame parser: %.0f frames/s\n",
+	       (t_bytewise > 0.) ? frames_bytewise / t_bytewise : 0., (t_parsed > 0.) ? frames_parsed / t_parsed : 0.);
+
+	delete[] datagrams;
+	delete[] datagram_len;
+}
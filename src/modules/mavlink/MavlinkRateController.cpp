@@ -0,0 +1,172 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MavlinkRateController.hpp"
+
+#include <float.h>
+#include <math.h>
+
+void MavlinkRateController::add_rtt_sample(const hrt_abstime &now, uint32_t rtt_us)
+{
+	const float rtt = rtt_us;
+
+	if (!_rtt_valid) {
+		_rtt_filtered = rtt;
+		_rtt_min = rtt;
+		_rtt_valid = true;
+
+	} else {
+		_rtt_filtered += RTT_FILTER_ALPHA * (rtt - _rtt_filtered);
+		_rtt_min = fminf(rtt, _rtt_min * RTT_MIN_DRIFT);
+	}
+
+	_rtt_timestamp = now;
+}
+
+void MavlinkRateController::update(const hrt_abstime &now, const Feedback &feedback)
+{
+	if (_bandwidth <= 0.f || _bandwidth > feedback.data_rate) {
+		// initialization or lower data rate
+		_bandwidth = feedback.data_rate;
+	}
+
+	if (now < _last_update + UPDATE_INTERVAL) {
+		return;
+	}
+
+	const float dt = (_last_update > 0) ? (now - _last_update) * 1e-6f : 0.f;
+	_last_update = now;
+
+	if (_rtt_valid && (now > _rtt_timestamp + RTT_TIMEOUT)) {
+		// timesync isn't answered (anymore)
+		_rtt_valid = false;
+	}
+
+	Limit congestion = Limit::None;
+
+	if (feedback.tx_error_rate > 0.f) {
+		congestion = Limit::TxErrors;
+
+	} else if ((feedback.radio_txbuf >= 0) && (feedback.radio_txbuf < RADIO_BUFFER_LOW_PERCENTAGE)) {
+		congestion = Limit::RadioBuffer;
+
+	} else if (_rtt_valid && (_rtt_filtered > _rtt_min + _latency_threshold)) {
+		congestion = Limit::Latency;
+	}
+
+	if (congestion != Limit::None) {
+		// multiplicative decrease, at most once per hold time to let the queues drain
+		if (now >= _last_decrease + DECREASE_HOLD_TIME) {
+			_bandwidth *= DECREASE_FACTOR;
+			_last_decrease = now;
+			_congestion = congestion;
+		}
+
+	} else if ((feedback.radio_txbuf < 0) || (feedback.radio_txbuf > RADIO_BUFFER_HALF_PERCENTAGE)) {
+		// additive increase while the link has spare capacity
+		_bandwidth += INCREASE_RATE * feedback.data_rate * dt;
+	}
+
+	if (_bandwidth >= feedback.data_rate) {
+		_bandwidth = feedback.data_rate;
+		_congestion = Limit::None;
+
+	} else if (_bandwidth < MIN_RATE_MULT * feedback.data_rate) {
+		_bandwidth = MIN_RATE_MULT * feedback.data_rate;
+	}
+}
+
+void MavlinkRateController::allocate(float available, const float demand[], const float weight[], int count,
+				     float multiplier[])
+{
+	float total_demand = 0.f;
+
+	for (int i = 0; i < count; i++) {
+		total_demand += demand[i];
+		multiplier[i] = 1.f;
+	}
+
+	if (total_demand <= available) {
+		_limit = Limit::None;
+		return;
+	}
+
+	_limit = (_congestion != Limit::None) ? _congestion : Limit::DataRate;
+
+	// Weighted water filling: each class gets min(1, k * weight) of its demand, k is chosen so that
+	// the allocation matches the available bandwidth. The classes saturate in order of decreasing
+	// weight, find the number of saturated classes for which k is consistent.
+	const float budget = fmaxf(available, 0.f);
+	float saturated_demand = 0.f;
+	float saturated_weight = FLT_MAX;
+	float k = 0.f;
+
+	while (true) {
+		// next class to saturate: the one with the highest weight below the current saturation level
+		float weighted_demand = 0.f;
+		float max_weight = 0.f;
+
+		for (int i = 0; i < count; i++) {
+			if (weight[i] < saturated_weight) {
+				weighted_demand += demand[i] * weight[i];
+				max_weight = fmaxf(max_weight, weight[i]);
+			}
+		}
+
+		if (weighted_demand <= 0.f) {
+			k = 0.f;
+			break;
+		}
+
+		k = (budget - saturated_demand) / weighted_demand;
+
+		if (k * max_weight <= 1.f) {
+			break;
+		}
+
+		// the classes with the highest weight are saturated, remove them
+		for (int i = 0; i < count; i++) {
+			if (weight[i] == max_weight) {
+				saturated_demand += demand[i];
+			}
+		}
+
+		saturated_weight = max_weight;
+	}
+
+	for (int i = 0; i < count; i++) {
+		const float mult = (weight[i] >= saturated_weight) ? 1.f : k * weight[i];
+		multiplier[i] = fminf(fmaxf(mult, MIN_RATE_MULT), 1.f);
+	}
+}
@@ -0,0 +1,137 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MavlinkRateController.hpp
+ * Closed loop control of the telemetry rate of a mavlink instance.
+ *
+ * The bandwidth available on the link is estimated from the congestion feedback (TX buffer
+ * overruns, the TX buffer reported by the radio in RADIO_STATUS and the timesync round trip time):
+ * it is reduced multiplicatively on congestion and increased additively up to the configured
+ * data rate otherwise. The bandwidth is then allocated to the stream priority classes by weight,
+ * the classes with a higher weight keep their configured rate while the others are reduced.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <stdint.h>
+
+using namespace time_literals;
+
+class MavlinkRateController
+{
+public:
+	/// Reason the stream rates are reduced, same values as telemetry_status_s::RATE_LIMIT_*
+	enum class Limit : uint8_t {
+		None,		///< all streams are sent at their configured rate
+		DataRate,	///< the configured data rate is exceeded
+		TxErrors,	///< the TX buffer overflowed
+		RadioBuffer,	///< the radio reported a low TX buffer
+		Latency		///< the round trip time increased
+	};
+
+	struct Feedback {
+		float data_rate;	///< configured maximum data rate (Bytes/s)
+		float tx_error_rate;	///< rate of the bytes not fitting into the TX buffer (Bytes/s)
+		int radio_txbuf;	///< free TX buffer of the radio (%), negative if RADIO_STATUS isn't received
+	};
+
+	/// lowest rate multiplier, so that something is always sent
+	static constexpr float MIN_RATE_MULT = 0.05f;
+
+	MavlinkRateController() = default;
+	~MavlinkRateController() = default;
+
+	/**
+	 * Set the increase of the round trip time above the lowest one seen that is considered as congestion
+	 */
+	void set_latency_threshold(hrt_abstime threshold) { _latency_threshold = threshold; }
+
+	/**
+	 * Add a timesync round trip time sample
+	 */
+	void add_rtt_sample(const hrt_abstime &now, uint32_t rtt_us);
+
+	/**
+	 * Update the bandwidth estimate, called at every iteration of the main loop
+	 */
+	void update(const hrt_abstime &now, const Feedback &feedback);
+
+	/**
+	 * Allocate the bandwidth to the stream classes
+	 *
+	 * @param available bandwidth for the rate scaled streams (Bytes/s)
+	 * @param demand bandwidth of each class at the configured stream rates (Bytes/s)
+	 * @param weight of each class
+	 * @param count number of classes
+	 * @param multiplier rate multiplier of each class, between MIN_RATE_MULT and 1
+	 */
+	void allocate(float available, const float demand[], const float weight[], int count, float multiplier[]);
+
+	/// @return estimated link bandwidth (Bytes/s)
+	float bandwidth() const { return _bandwidth; }
+
+	/// @return filtered round trip time (us), 0 if no recent sample
+	float rtt() const { return _rtt_valid ? _rtt_filtered : 0.f; }
+
+	Limit limit() const { return _limit; }
+
+private:
+	static constexpr hrt_abstime UPDATE_INTERVAL = 100_ms;
+	static constexpr hrt_abstime DECREASE_HOLD_TIME = 500_ms;	///< minimum time between two decreases
+	static constexpr hrt_abstime RTT_TIMEOUT = 5_s;
+
+	static constexpr float DECREASE_FACTOR = 0.8f;
+	static constexpr float INCREASE_RATE = 0.1f;			///< fraction of the data rate per second
+	static constexpr float RTT_FILTER_ALPHA = 0.25f;
+	static constexpr float RTT_MIN_DRIFT = 1.01f;			///< forget the lowest RTT slowly (per sample)
+
+	static constexpr int RADIO_BUFFER_LOW_PERCENTAGE = 35;
+	static constexpr int RADIO_BUFFER_HALF_PERCENTAGE = 50;
+
+	float _bandwidth{0.f};
+	Limit _congestion{Limit::None};		///< last congestion reason, until the bandwidth recovered
+	Limit _limit{Limit::None};
+
+	hrt_abstime _last_update{0};
+	hrt_abstime _last_decrease{0};
+
+	float _rtt_filtered{0.f};
+	float _rtt_min{0.f};
+	hrt_abstime _rtt_timestamp{0};
+	bool _rtt_valid{false};
+
+	hrt_abstime _latency_threshold{250_ms};
+};
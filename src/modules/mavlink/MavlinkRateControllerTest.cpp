@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MavlinkRateController.hpp"
+#include <gtest/gtest.h>
+
+static constexpr float DATA_RATE = 1000.f;
+
+// High, Normal, Low priority
+static constexpr float WEIGHTS[3] {10.f, 3.f, 1.f};
+
+TEST(MavlinkRateController, AllocateEnoughBandwidth)
+{
+	MavlinkRateController controller;
+	const float demand[3] {100.f, 300.f, 500.f};
+	float multiplier[3];
+
+	controller.allocate(1000.f, demand, WEIGHTS, 3, multiplier);
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_FLOAT_EQ(multiplier[i], 1.f);
+	}
+
+	EXPECT_EQ(controller.limit(), MavlinkRateController::Limit::None);
+}
+
+TEST(MavlinkRateController, AllocateByWeight)
+{
+	MavlinkRateController controller;
+	const float demand[3] {100.f, 300.f, 1000.f};
+	float multiplier[3];
+
+	// the high priority class keeps its rate, the others are scaled by weight
+	controller.allocate(500.f, demand, WEIGHTS, 3, multiplier);
+
+	EXPECT_FLOAT_EQ(multiplier[0], 1.f);
+	EXPECT_FLOAT_EQ(multiplier[1], 3.f * multiplier[2]);
+	EXPECT_NEAR(demand[0] * multiplier[0] + demand[1] * multiplier[1] + demand[2] * multiplier[2], 500.f, 0.1f);
+	EXPECT_EQ(controller.limit(), MavlinkRateController::Limit::DataRate);
+
+	// shortage: all classes are reduced in proportion to their weight
+	controller.allocate(200.f, demand, WEIGHTS, 3, multiplier);
+
+	EXPECT_LT(multiplier[0], 1.f);
+	EXPECT_FLOAT_EQ(multiplier[0], 10.f * multiplier[2]);
+	EXPECT_FLOAT_EQ(multiplier[1], 3.f * multiplier[2]);
+	EXPECT_NEAR(demand[0] * multiplier[0] + demand[1] * multiplier[1] + demand[2] * multiplier[2], 200.f, 0.1f);
+
+	// no bandwidth left, nothing drops below the minimum
+	controller.allocate(0.f, demand, WEIGHTS, 3, multiplier);
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_FLOAT_EQ(multiplier[i], MavlinkRateController::MIN_RATE_MULT);
+	}
+}
+
+TEST(MavlinkRateController, EqualWeightsScaleUniformly)
+{
+	MavlinkRateController controller;
+	const float demand[3] {200.f, 300.f, 500.f};
+	const float weights[3] {1.f, 1.f, 1.f};
+	float multiplier[3];
+
+	controller.allocate(500.f, demand, weights, 3, multiplier);
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_FLOAT_EQ(multiplier[i], 0.5f);
+	}
+}
+
+TEST(MavlinkRateController, TxErrorsDecreaseBandwidth)
+{
+	MavlinkRateController controller;
+	hrt_abstime now = 1_s;
+
+	controller.update(now, {DATA_RATE, 0.f, -1});
+	EXPECT_FLOAT_EQ(controller.bandwidth(), DATA_RATE);
+
+	// multiplicative decrease, at most every 500 ms
+	for (int i = 0; i < 10; i++) {
+		now += 100_ms;
+		controller.update(now, {DATA_RATE, 50.f, -1});
+	}
+
+	EXPECT_NEAR(controller.bandwidth(), DATA_RATE * 0.8f * 0.8f, 1.f);
+
+	const float demand[3] {100.f, 300.f, 1000.f};
+	float multiplier[3];
+	controller.allocate(controller.bandwidth(), demand, WEIGHTS, 3, multiplier);
+	EXPECT_EQ(controller.limit(), MavlinkRateController::Limit::TxErrors);
+
+	// additive increase back to the data rate without congestion
+	for (int i = 0; i < 100; i++) {
+		now += 100_ms;
+		controller.update(now, {DATA_RATE, 0.f, -1});
+	}
+
+	EXPECT_FLOAT_EQ(controller.bandwidth(), DATA_RATE);
+
+	controller.allocate(controller.bandwidth(), demand, WEIGHTS, 3, multiplier);
+	EXPECT_EQ(controller.limit(), MavlinkRateController::Limit::DataRate);
+}
+
+TEST(MavlinkRateController, RadioBuffer)
+{
+	MavlinkRateController controller;
+	hrt_abstime now = 1_s;
+
+	controller.update(now, {DATA_RATE, 0.f, 20});
+	now += 1_s;
+	controller.update(now, {DATA_RATE, 0.f, 20});
+	EXPECT_LT(controller.bandwidth(), DATA_RATE);
+
+	// no increase while the radio buffer is between low and half
+	const float bandwidth = controller.bandwidth();
+	now += 1_s;
+	controller.update(now, {DATA_RATE, 0.f, 40});
+	EXPECT_FLOAT_EQ(controller.bandwidth(), bandwidth);
+
+	now += 1_s;
+	controller.update(now, {DATA_RATE, 0.f, 90});
+	EXPECT_GT(controller.bandwidth(), bandwidth);
+}
+
+TEST(MavlinkRateController, Latency)
+{
+	MavlinkRateController controller;
+	controller.set_latency_threshold(100_ms);
+	hrt_abstime now = 1_s;
+
+	controller.add_rtt_sample(now, 20000);
+	controller.update(now, {DATA_RATE, 0.f, -1});
+	EXPECT_FLOAT_EQ(controller.bandwidth(), DATA_RATE);
+
+	// queueing delay builds up
+	for (int i = 0; i < 10; i++) {
+		now += 100_ms;
+		controller.add_rtt_sample(now, 400000);
+		controller.update(now, {DATA_RATE, 0.f, -1});
+	}
+
+	EXPECT_LT(controller.bandwidth(), DATA_RATE);
+
+	// samples stop, the latency feedback times out
+	const float bandwidth = controller.bandwidth();
+	now += 10_s;
+	controller.update(now, {DATA_RATE, 0.f, -1});
+	EXPECT_FLOAT_EQ(controller.rtt(), 0.f);
+	EXPECT_GT(controller.bandwidth(), bandwidth);
+}
@@ -0,0 +1,239 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MavlinkRouting.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+MavlinkForwardRing::~MavlinkForwardRing()
+{
+	delete[] _buffer;
+}
+
+bool MavlinkForwardRing::allocate(size_t size)
+{
+	uint32_t size_pow2 = 1;
+
+	while (size_pow2 < size) {
+		size_pow2 <<= 1;
+	}
+
+	delete[] _buffer;
+	_buffer = new uint8_t[size_pow2];
+	_size = (_buffer != nullptr) ? size_pow2 : 0;
+	_head.store(0);
+	_tail.store(0);
+
+	return _buffer != nullptr;
+}
+
+void MavlinkForwardRing::write(uint32_t pos, const uint8_t *data, uint32_t len)
+{
+	const uint32_t index = pos & (_size - 1);
+	const uint32_t first = (len < _size - index) ? len : _size - index;
+
+	memcpy(&_buffer[index], data, first);
+	memcpy(_buffer, &data[first], len - first);
+}
+
+void MavlinkForwardRing::read(uint32_t pos, uint8_t *data, uint32_t len) const
+{
+	const uint32_t index = pos & (_size - 1);
+	const uint32_t first = (len < _size - index) ? len : _size - index;
+
+	memcpy(data, &_buffer[index], first);
+	memcpy(&data[first], _buffer, len - first);
+}
+
+bool MavlinkForwardRing::push(const uint8_t *frame, uint16_t len)
+{
+	const uint32_t head = _head.load();
+	const uint32_t used = head - _tail.load();
+
+	if ((len == 0) || (used + HEADER_LEN + len > _size)) {
+		_dropped.fetch_add(1);
+		return false;
+	}
+
+	const uint8_t header[HEADER_LEN] {static_cast<uint8_t>(len & 0xFF), static_cast<uint8_t>(len >> 8)};
+	write(head, header, HEADER_LEN);
+	write(head + HEADER_LEN, frame, len);
+
+	// publish the frame to the consumer
+	_head.store(head + HEADER_LEN + len);
+
+	_forwarded.fetch_add(1);
+	_forwarded_bytes.fetch_add(len);
+	return true;
+}
+
+uint16_t MavlinkForwardRing::front_length() const
+{
+	const uint32_t tail = _tail.load();
+
+	if (_head.load() == tail) {
+		return 0;
+	}
+
+	uint8_t header[HEADER_LEN];
+	read(tail, header, HEADER_LEN);
+	return header[0] | (header[1] << 8);
+}
+
+uint16_t MavlinkForwardRing::pop(uint8_t *buf, size_t max_len)
+{
+	const uint16_t len = front_length();
+
+	if (len == 0) {
+		return 0;
+	}
+
+	const uint32_t tail = _tail.load();
+
+	if (len <= max_len) {
+		read(tail + HEADER_LEN, buf, len);
+	}
+
+	// release the space to the producer
+	_tail.store(tail + HEADER_LEN + len);
+
+	return (len <= max_len) ? len : 0;
+}
+
+bool MavlinkRouteTable::learn(uint8_t system_id, uint8_t component_id, int link)
+{
+	if ((link < 0) || (link >= MAX_LINKS)) {
+		return false;
+	}
+
+	const uint32_t route_key = key(system_id, component_id);
+	const uint32_t link_bit = 1u << link;
+
+	// entries are never removed, the used ones are contiguous
+	for (Route &route : _routes) {
+		uint32_t current_key = route.key.load();
+
+		// claim an unused entry, if another thread was faster current_key holds its key
+		if ((current_key == 0) && route.key.compare_exchange(&current_key, route_key)) {
+			current_key = route_key;
+		}
+
+		if (current_key == route_key) {
+			if ((route.links.load() & link_bit) == 0) {
+				route.links.fetch_or(link_bit);
+			}
+
+			return true;
+		}
+	}
+
+	_overflow.store(true);
+	return false;
+}
+
+uint32_t MavlinkRouteTable::links(int system_id, int component_id) const
+{
+	uint32_t result = 0;
+	bool found = false;
+
+	for (const Route &route : _routes) {
+		const uint32_t route_key = route.key.load();
+
+		if (route_key == 0) {
+			break;
+		}
+
+		const int route_system_id = (route_key - 1) >> 8;
+		const int route_component_id = (route_key - 1) & 0xFF;
+
+		if ((system_id == 0)
+		    || ((route_system_id == system_id) && ((component_id == 0) || (route_component_id == component_id)))) {
+			result |= route.links.load();
+			found = true;
+		}
+	}
+
+	if (!found && (system_id != 0) && _overflow.load()) {
+		return UINT32_MAX;
+	}
+
+	return result;
+}
+
+void MavlinkRouteTable::remove_link(int link)
+{
+	if ((link < 0) || (link >= MAX_LINKS)) {
+		return;
+	}
+
+	for (Route &route : _routes) {
+		if (route.key.load() == 0) {
+			break;
+		}
+
+		route.links.fetch_and(~(1u << link));
+	}
+}
+
+void MavlinkRouteTable::print() const
+{
+	printf("routes:\n");
+
+	for (const Route &route : _routes) {
+		const uint32_t route_key = route.key.load();
+
+		if (route_key == 0) {
+			break;
+		}
+
+		const uint32_t route_links = route.links.load();
+
+		if (route_links != 0) {
+			printf("\tsysid:%3u, compid:%3u, instances:", (unsigned)((route_key - 1) >> 8), (unsigned)((route_key - 1) & 0xFF));
+
+			for (int link = 0; link < MAX_LINKS; link++) {
+				if (route_links & (1u << link)) {
+					printf(" #%d", link);
+				}
+			}
+
+			printf("\n");
+		}
+	}
+
+	if (_overflow.load()) {
+		printf("\trouting table full, unknown targets are sent to all instances\n");
+	}
+}
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MavlinkRouting.hpp
+ * Forwarding of MAVLink frames between the mavlink instances.
+ *
+ * The routing table remembers on which links a (sysid, compid) was seen. Forwarded frames are
+ * serialized once and passed as raw bytes to the destination instances, through one single
+ * producer single consumer ring per source instance, so the receiver threads never block the
+ * sending threads.
+ */
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class MavlinkForwardRing
+{
+public:
+	MavlinkForwardRing() = default;
+	~MavlinkForwardRing();
+
+	// no copy, the buffer is owned by the ring
+	MavlinkForwardRing(const MavlinkForwardRing &) = delete;
+	MavlinkForwardRing &operator=(const MavlinkForwardRing &) = delete;
+
+	/**
+	 * Allocate the buffer, the size is rounded up to a power of 2
+	 * @return false if the allocation failed
+	 */
+	bool allocate(size_t size);
+
+	/**
+	 * Append a frame, only called by the producer thread
+	 * @return false if the ring is full, the frame is counted as dropped
+	 */
+	bool push(const uint8_t *frame, uint16_t len);
+
+	/**
+	 * Length of the oldest frame, only called by the consumer thread
+	 * @return 0 if the ring is empty
+	 */
+	uint16_t front_length() const;
+
+	/**
+	 * Remove the oldest frame, only called by the consumer thread
+	 * @return length of the frame, 0 if the ring is empty or the frame doesn't fit into buf
+	 */
+	uint16_t pop(uint8_t *buf, size_t max_len);
+
+	uint32_t forwarded() const { return _forwarded.load(); }
+	uint32_t forwarded_bytes() const { return _forwarded_bytes.load(); }
+	uint32_t dropped() const { return _dropped.load(); }
+
+private:
+	static constexpr uint32_t HEADER_LEN = sizeof(uint16_t); ///< frame length, little endian
+
+	void write(uint32_t pos, const uint8_t *data, uint32_t len);
+	void read(uint32_t pos, uint8_t *data, uint32_t len) const;
+
+	uint8_t *_buffer{nullptr};
+	uint32_t _size{0};
+
+	// free running positions, the buffer index is position & (size - 1)
+	px4::atomic<uint32_t> _head{0}; ///< written by the producer
+	px4::atomic<uint32_t> _tail{0}; ///< written by the consumer
+
+	px4::atomic<uint32_t> _forwarded{0};
+	px4::atomic<uint32_t> _forwarded_bytes{0};
+	px4::atomic<uint32_t> _dropped{0};
+};
+
+class MavlinkRouteTable
+{
+public:
+	static constexpr int MAX_ROUTES = 64;
+	static constexpr int MAX_LINKS = 32;
+
+	MavlinkRouteTable() = default;
+
+	/**
+	 * Remember that a component was seen on a link.
+	 * Lock-free, a new component takes the next free entry with a compare and swap.
+	 * @return false if the table is full
+	 */
+	bool learn(uint8_t system_id, uint8_t component_id, int link);
+
+	/**
+	 * Links on which a target was seen. A system id of 0 matches every component (broadcast),
+	 * a component id of 0 every component of the system.
+	 * @return bitmask of the links, all links if the target is unknown and the table overflowed
+	 */
+	uint32_t links(int system_id, int component_id) const;
+
+	/**
+	 * Forget a link, e.g. when the instance is stopped
+	 */
+	void remove_link(int link);
+
+	void print() const;
+
+private:
+	static uint32_t key(uint8_t system_id, uint8_t component_id) { return ((system_id << 8) | component_id) + 1; }
+
+	struct Route {
+		px4::atomic<uint32_t> key{0}; ///< 0 for an unused entry
+		px4::atomic<uint32_t> links{0};
+	};
+
+	Route _routes[MAX_ROUTES] {};
+	px4::atomic_bool _overflow{false};
+};
@@ -0,0 +1,168 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "MavlinkRouting.hpp"
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <thread>
+
+TEST(MavlinkForwardRing, PushPop)
+{
+	MavlinkForwardRing ring;
+	ASSERT_TRUE(ring.allocate(100)); // rounded up to 128
+
+	uint8_t frame[40];
+	uint8_t out[64];
+
+	for (int i = 0; i < 10; i++) {
+		// wraps around the end of the buffer
+		memset(frame, i, sizeof(frame));
+		ASSERT_TRUE(ring.push(frame, sizeof(frame) - i));
+		EXPECT_EQ(ring.front_length(), sizeof(frame) - i);
+		ASSERT_EQ(ring.pop(out, sizeof(out)), sizeof(frame) - i);
+		EXPECT_EQ(memcmp(frame, out, sizeof(frame) - i), 0);
+	}
+
+	EXPECT_EQ(ring.front_length(), 0);
+	EXPECT_EQ(ring.pop(out, sizeof(out)), 0);
+	EXPECT_EQ(ring.forwarded(), 10u);
+	EXPECT_EQ(ring.dropped(), 0u);
+}
+
+TEST(MavlinkForwardRing, Full)
+{
+	MavlinkForwardRing ring;
+	ASSERT_TRUE(ring.allocate(128));
+
+	uint8_t frame[40] {};
+
+	// 3 frames including the length headers fit
+	EXPECT_TRUE(ring.push(frame, sizeof(frame)));
+	EXPECT_TRUE(ring.push(frame, sizeof(frame)));
+	EXPECT_TRUE(ring.push(frame, sizeof(frame)));
+	EXPECT_FALSE(ring.push(frame, sizeof(frame)));
+	EXPECT_EQ(ring.dropped(), 1u);
+
+	// a frame larger than the output buffer is discarded
+	uint8_t out[16];
+	EXPECT_EQ(ring.pop(out, sizeof(out)), 0);
+	EXPECT_TRUE(ring.push(frame, sizeof(frame)));
+	EXPECT_EQ(ring.forwarded(), 4u);
+}
+
+TEST(MavlinkForwardRing, ProducerConsumer)
+{
+	MavlinkForwardRing ring;
+	ASSERT_TRUE(ring.allocate(512));
+
+	static constexpr int num_frames = 10000;
+
+	std::thread producer([&ring]() {
+		uint8_t frame[64];
+
+		for (int i = 0; i < num_frames;) {
+			const uint16_t len = 1 + (i % sizeof(frame));
+			memset(frame, i & 0xFF, len);
+
+			if (ring.push(frame, len)) {
+				i++;
+
+			} else {
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	uint8_t out[64];
+
+	for (int i = 0; i < num_frames;) {
+		const uint16_t len = ring.pop(out, sizeof(out));
+
+		if (len > 0) {
+			ASSERT_EQ(len, 1 + (i % sizeof(out)));
+			ASSERT_EQ(out[0], i & 0xFF);
+			ASSERT_EQ(out[len - 1], i & 0xFF);
+			i++;
+
+		} else {
+			std::this_thread::yield();
+		}
+	}
+
+	producer.join();
+	EXPECT_EQ(ring.forwarded(), (uint32_t)num_frames);
+}
+
+TEST(MavlinkRouteTable, Lookup)
+{
+	MavlinkRouteTable table;
+
+	EXPECT_EQ(table.links(1, 1), 0u);
+	EXPECT_EQ(table.links(0, 0), 0u);
+
+	EXPECT_TRUE(table.learn(255, 190, 0)); // GCS on instance 0
+	EXPECT_TRUE(table.learn(1, 191, 1)); // companion on instance 1
+	EXPECT_TRUE(table.learn(1, 100, 1));
+	EXPECT_TRUE(table.learn(1, 100, 2)); // camera seen on two links
+	EXPECT_TRUE(table.learn(1, 100, 2));
+
+	EXPECT_EQ(table.links(255, 190), 1u << 0);
+	EXPECT_EQ(table.links(1, 191), 1u << 1);
+	EXPECT_EQ(table.links(1, 100), (1u << 1) | (1u << 2));
+	EXPECT_EQ(table.links(1, 0), (1u << 1) | (1u << 2));
+	EXPECT_EQ(table.links(0, 0), (1u << 0) | (1u << 1) | (1u << 2));
+	EXPECT_EQ(table.links(2, 0), 0u);
+	EXPECT_EQ(table.links(1, 1), 0u);
+
+	table.remove_link(1);
+	EXPECT_EQ(table.links(1, 191), 0u);
+	EXPECT_EQ(table.links(1, 100), 1u << 2);
+}
+
+TEST(MavlinkRouteTable, Overflow)
+{
+	MavlinkRouteTable table;
+
+	for (int i = 0; i < MavlinkRouteTable::MAX_ROUTES; i++) {
+		EXPECT_TRUE(table.learn(1, i, 0));
+	}
+
+	EXPECT_TRUE(table.learn(1, 0, 1));
+	EXPECT_FALSE(table.learn(2, 1, 1));
+
+	// known targets are still routed, unknown ones go everywhere
+	EXPECT_EQ(table.links(1, 0), (1u << 0) | (1u << 1));
+	EXPECT_EQ(table.links(2, 1), UINT32_MAX);
+}
@@ -54,12 +54,14 @@ constexpr const char MavlinkFTP::_root_dir[];
 MavlinkFTP::MavlinkFTP(Mavlink &mavlink) :
 	_mavlink(mavlink)
 {
-	// initialize session
-	_session_info.fd = -1;
 }
 
 MavlinkFTP::~MavlinkFTP()
 {
+	for (SessionInfo &session : _session_info) {
+		_closeSession(session);
+	}
+
 	delete[] _work_buffer1;
 	delete[] _work_buffer2;
 }
@@ -67,12 +69,13 @@ MavlinkFTP::~MavlinkFTP()
 unsigned
 MavlinkFTP::get_size()
 {
-	if (_session_info.stream_download) {
-		return MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
-
-	} else {
-		return 0;
+	for (const SessionInfo &session : _session_info) {
+		if (session.stream_download) {
+			return MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+		}
 	}
+
+	return 0;
 }
 
 #ifdef MAVLINK_FTP_UNIT_TEST
@@ -503,7 +506,13 @@ MavlinkFTP::_workList(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 {
-	if (_session_info.fd >= 0) {
+	int session_index = 0;
+
+	while (session_index < kMaxSessions && _session_info[session_index].fd >= 0) {
+		session_index++;
+	}
+
+	if (session_index == kMaxSessions) {
 		PX4_ERR("FTP: Open failed - out of sessions");
 		return kErrNoSessionsAvailable;
 	}
@@ -541,11 +550,13 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 		return kErrFailErrno;
 	}
 
-	_session_info.fd = fd;
-	_session_info.file_size = fileSize;
-	_session_info.stream_download = false;
+	SessionInfo &session = _session_info[session_index];
+	session = SessionInfo{};
+	session.fd = fd;
+	session.file_size = fileSize;
+	session.last_access = hrt_absolute_time();
 
-	payload->session = 0;
+	payload->session = session_index;
 	payload->size = sizeof(uint32_t);
 	std::memcpy(payload->data, &fileSize, payload->size);
 
@@ -556,31 +567,24 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workRead(PayloadHeader *payload)
 {
-	if (payload->session != 0 || _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload);
+
+	if (session == nullptr) {
 		return kErrInvalidSession;
 	}
 
-	PX4_DEBUG("FTP: read offset:%ld" PRIu32, payload->offset);
+	PX4_DEBUG("FTP: read offset:%" PRIu32, payload->offset);
 
 	// We have to test seek past EOF ourselves, lseek will allow seek past EOF
-	if (payload->offset >= _session_info.file_size) {
+	if (payload->offset >= session->file_size) {
 		PX4_WARN("request past EOF");
 		return kErrEOF;
 	}
 
-	PX4_DEBUG("lseek with offset: %ld", payload->offset);
-
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-		_our_errno = errno;
-		PX4_ERR("seek fail: %s", strerror(_our_errno));
-		return kErrFailErrno;
-	}
-
-	int bytes_read = ::read(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_read = _readSession(*session, payload->offset, &payload->data[0], payload->size);
 
 	if (bytes_read < 0) {
 		// Negative return indicates error other than eof
-		_our_errno = errno;
 		PX4_ERR("read fail %d, %s", bytes_read, strerror(_our_errno));
 		return kErrFailErrno;
 	}
@@ -594,19 +598,52 @@ MavlinkFTP::_workRead(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id)
 {
-	if (payload->session != 0 && _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload);
+
+	if (session == nullptr) {
 		PX4_DEBUG("_workBurst: no session or no fd");
 		return kErrInvalidSession;
 	}
 
-	PX4_DEBUG("FTP: burst offset:%" PRIu32, payload->offset);
-	// Setup for streaming sends
-	_session_info.stream_download = true;
-	_session_info.stream_offset = payload->offset;
-	_session_info.stream_chunk_transmitted = 0;
-	_session_info.stream_seq_number = payload->seq_number + 1;
-	_session_info.stream_target_system_id = target_system_id;
-	_session_info.stream_target_component_id = target_component_id;
+	// optional burst length, the default keeps the behavior of clients that don't send one
+	uint32_t length = kDefaultBurstLength;
+
+	if (payload->size == sizeof(uint32_t)) {
+		std::memcpy(&length, payload->data, sizeof(length));
+	}
+
+	PX4_DEBUG("FTP: burst offset:%" PRIu32 " length:%" PRIu32, payload->offset, length);
+
+	const uint32_t end = (payload->offset + length > payload->offset) ? payload->offset + length : UINT32_MAX;
+
+	if (session->stream_download && payload->offset == session->stream_end
+	    && session->stream_target_system_id == target_system_id
+	    && session->stream_target_component_id == target_component_id) {
+		// pipelined request: slide the window of the active burst
+		session->stream_end = end;
+
+	} else if (session->stream_download && payload->size == sizeof(uint32_t) && payload->offset < session->stream_offset
+		   && session->stream_target_system_id == target_system_id
+		   && session->stream_target_component_id == target_component_id) {
+		// selective retransmission of data that was lost, the queue is served before the window continues
+		if (session->num_retransmit == kMaxRetransmitRanges) {
+			PX4_DEBUG("FTP: retransmission queue full");
+			return kErrFail;
+		}
+
+		session->retransmit[session->num_retransmit++] = ByteRange{payload->offset,
+				(end < session->stream_offset) ? end : session->stream_offset};
+
+	} else {
+		// Setup for streaming sends
+		session->stream_download = true;
+		session->stream_offset = payload->offset;
+		session->stream_end = end;
+		session->num_retransmit = 0;
+		session->stream_seq_number = payload->seq_number + 1;
+		session->stream_target_system_id = target_system_id;
+		session->stream_target_component_id = target_component_id;
+	}
 
 	return kErrNone;
 }
@@ -615,7 +652,9 @@ MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workWrite(PayloadHeader *payload)
 {
-	if (payload->session != 0 && _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload);
+
+	if (session == nullptr) {
 		PX4_DEBUG("_workWrite: no session or no fd");
 		return kErrInvalidSession;
 	}
@@ -624,14 +663,14 @@ MavlinkFTP::_workWrite(PayloadHeader *payload)
 		return kErrFailFileProtected;
 	}
 
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
+	if (lseek(session->fd, payload->offset, SEEK_SET) < 0) {
 		// Unable to see to the specified location
 		PX4_ERR("seek fail");
 		return kErrFailErrno;
 	}
 
 	PX4_DEBUG("write %d bytes", payload->size);
-	int bytes_written = ::write(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_written = ::write(session->fd, &payload->data[0], payload->size);
 
 	if (bytes_written < 0) {
 		// Negative return indicates error other than eof
@@ -790,14 +829,14 @@ MavlinkFTP::_workTruncateFile(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workTerminate(PayloadHeader *payload)
 {
-	if (payload->session != 0 || _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload);
+
+	if (session == nullptr) {
 		return kErrInvalidSession;
 	}
 
 	PX4_DEBUG("work terminate: close");
-	::close(_session_info.fd);
-	_session_info.fd = -1;
-	_session_info.stream_download = false;
+	_closeSession(*session);
 
 	payload->size = 0;
 
@@ -810,10 +849,8 @@ MavlinkFTP::_workReset(PayloadHeader *payload)
 {
 	PX4_DEBUG("work reset: close");
 
-	if (_session_info.fd != -1) {
-		::close(_session_info.fd);
-		_session_info.fd = -1;
-		_session_info.stream_download = false;
+	for (SessionInfo &session : _session_info) {
+		_closeSession(session);
 	}
 
 	payload->size = 0;
@@ -1010,6 +1047,82 @@ MavlinkFTP::_copy_file(const char *src_path, const char *dst_path, size_t length
 	return (length > 0) ? -1 : 0;
 }
 
+MavlinkFTP::SessionInfo *
+MavlinkFTP::_getSession(PayloadHeader *payload)
+{
+	if (payload->session >= kMaxSessions || _session_info[payload->session].fd < 0) {
+		return nullptr;
+	}
+
+	SessionInfo &session = _session_info[payload->session];
+	session.last_access = hrt_absolute_time();
+	return &session;
+}
+
+void
+MavlinkFTP::_closeSession(SessionInfo &session)
+{
+	if (session.fd < 0) {
+		return;
+	}
+
+	delete[] session.read_ahead;
+	::close(session.fd);
+	session = SessionInfo{};
+}
+
+int
+MavlinkFTP::_readSession(SessionInfo &session, uint32_t offset, uint8_t *dst, uint8_t length)
+{
+	if (offset >= session.file_size) {
+		return 0;
+	}
+
+	if (length > session.file_size - offset) {
+		length = session.file_size - offset;
+	}
+
+	if (!session.read_ahead) {
+		session.read_ahead = new uint8_t[kReadAheadLength];
+		session.read_ahead_length = 0;
+	}
+
+	uint8_t *buffer = session.read_ahead ? session.read_ahead : dst;
+	const int buffer_length = session.read_ahead ? kReadAheadLength : length;
+
+	if (!session.read_ahead || offset < session.read_ahead_offset
+	    || offset + length > session.read_ahead_offset + session.read_ahead_length) {
+
+		session.read_ahead_length = 0;
+
+		if (lseek(session.fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		int bytes_read = ::read(session.fd, buffer, buffer_length);
+
+		if (bytes_read < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		if (!session.read_ahead) {
+			return bytes_read;
+		}
+
+		session.read_ahead_offset = offset;
+		session.read_ahead_length = bytes_read;
+	}
+
+	// the buffer can hold less than requested at the end of the file
+	const int available = session.read_ahead_offset + session.read_ahead_length - offset;
+	const int bytes_read = (length < available) ? length : available;
+	memcpy(dst, &session.read_ahead[offset - session.read_ahead_offset], bytes_read);
+
+	return bytes_read;
+}
+
 void MavlinkFTP::send()
 {
 
@@ -1026,125 +1139,159 @@ void MavlinkFTP::send()
 				_work_buffer2 = nullptr;
 			}
 		}
+	}
 
-	} else if (_session_info.fd != -1) {
-		// close session without activity
-		if (hrt_elapsed_time(&_last_work_buffer_access) > 10_s) {
-			::close(_session_info.fd);
-			_session_info.fd = -1;
-			_session_info.stream_download = false;
+	bool stream_download = false;
+
+	for (SessionInfo &session : _session_info) {
+		if (session.fd != -1 && !session.stream_download && hrt_elapsed_time(&session.last_access) > 10_s) {
+			// close session without activity
+			_closeSession(session);
 			_last_reply_valid = false;
 			PX4_WARN("Session was closed without activity");
 		}
+
+		stream_download |= session.stream_download;
 	}
 
 	// Anything to stream?
-	if (!_session_info.stream_download) {
+	if (!stream_download) {
 		return;
 	}
 
 #ifndef MAVLINK_FTP_UNIT_TEST
+	const unsigned packet_size = get_size();
+
 	// Skip send if not enough room
 	unsigned max_bytes_to_send = _mavlink.get_free_tx_buf();
 	PX4_DEBUG("MavlinkFTP::send max_bytes_to_send(%u) get_free_tx_buf(%u)", max_bytes_to_send, _mavlink.get_free_tx_buf());
 
-	if (max_bytes_to_send < get_size()) {
+	if (max_bytes_to_send < packet_size) {
 		return;
 	}
 
 #endif
 
-	// Send stream packets until buffer is full
+	// Send stream packets until buffer is full, interleaving the sessions with an active burst
 
 	bool more_data;
 
 	do {
 		more_data = false;
 
-		ErrorCode error_code = kErrNone;
+		for (int i = 0; i < kMaxSessions; i++) {
+			SessionInfo &session = _session_info[(_next_stream_session + i) % kMaxSessions];
 
-		mavlink_file_transfer_protocol_t ftp_msg;
-		PayloadHeader *payload = reinterpret_cast<PayloadHeader *>(&ftp_msg.payload[0]);
+			if (!session.stream_download) {
+				continue;
+			}
 
-		payload->seq_number = _session_info.stream_seq_number;
-		payload->session = 0;
-		payload->opcode = kRspAck;
-		payload->req_opcode = kCmdBurstReadFile;
-		payload->offset = _session_info.stream_offset;
-		_session_info.stream_seq_number++;
+#ifndef MAVLINK_FTP_UNIT_TEST
 
-		PX4_DEBUG("stream send: offset %" PRIu32, _session_info.stream_offset);
+			if (max_bytes_to_send < packet_size) {
+				more_data = false;
+				break;
+			}
 
-		// We have to test seek past EOF ourselves, lseek will allow seek past EOF
-		if (_session_info.stream_offset >= _session_info.file_size) {
-			error_code = kErrEOF;
-			PX4_DEBUG("stream download: sending Nak EOF");
-		}
+			max_bytes_to_send -= packet_size;
+#endif
 
-		if (error_code == kErrNone) {
-			if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-				error_code = kErrFailErrno;
-				PX4_WARN("stream download: seek fail");
-			}
+			more_data |= _sendBurstPacket(session);
 		}
+	} while (more_data);
 
-		if (error_code == kErrNone) {
-			int bytes_read = ::read(_session_info.fd, &payload->data[0], kMaxDataLength);
+	_next_stream_session = (_next_stream_session + 1) % kMaxSessions;
+}
 
-			if (bytes_read < 0) {
-				// Negative return indicates error other than eof
-				error_code = kErrFailErrno;
-				PX4_WARN("stream download: read fail");
+bool
+MavlinkFTP::_sendBurstPacket(SessionInfo &session)
+{
+	ErrorCode error_code = kErrNone;
 
-			} else {
-				payload->size = bytes_read;
-				_session_info.stream_offset += bytes_read;
-				_session_info.stream_chunk_transmitted += bytes_read;
-			}
+	mavlink_file_transfer_protocol_t ftp_msg;
+	PayloadHeader *payload = reinterpret_cast<PayloadHeader *>(&ftp_msg.payload[0]);
+
+	// queued retransmissions are sent before the window continues
+	ByteRange *retransmit = (session.num_retransmit > 0) ? &session.retransmit[0] : nullptr;
+
+	payload->seq_number = session.stream_seq_number;
+	payload->session = &session - _session_info;
+	payload->opcode = kRspAck;
+	payload->req_opcode = kCmdBurstReadFile;
+	payload->burst_complete = false;
+	payload->offset = retransmit ? retransmit->offset : session.stream_offset;
+	session.stream_seq_number++;
+	session.last_access = hrt_absolute_time();
+
+	PX4_DEBUG("stream send: offset %" PRIu32, payload->offset);
+
+	// We have to test seek past EOF ourselves, lseek will allow seek past EOF
+	if (payload->offset >= session.file_size) {
+		error_code = kErrEOF;
+		PX4_DEBUG("stream download: sending Nak EOF");
+	}
+
+	if (error_code == kErrNone) {
+		uint8_t length = kMaxDataLength;
+
+		if (retransmit && retransmit->end - retransmit->offset < length) {
+			length = retransmit->end - retransmit->offset;
 		}
 
-		if (error_code != kErrNone) {
-			payload->opcode = kRspNak;
-			payload->size = 1;
-			uint8_t *pData = &payload->data[0];
-			*pData = error_code; // Straight reference to data[0] is causing bogus gcc array subscript error
+		int bytes_read = _readSession(session, payload->offset, &payload->data[0], length);
 
-			if (error_code == kErrFailErrno) {
-				payload->size = 2;
-				payload->data[1] = _our_errno;
-			}
+		if (bytes_read < 0) {
+			// Negative return indicates error other than eof
+			error_code = kErrFailErrno;
+			PX4_WARN("stream download: read fail");
 
-			_session_info.stream_download = false;
+		} else if (bytes_read == 0) {
+			// the file was truncated since it was opened
+			error_code = kErrEOF;
 
 		} else {
-#ifndef MAVLINK_FTP_UNIT_TEST
+			payload->size = bytes_read;
 
-			if (max_bytes_to_send < (get_size() * 2)) {
-				more_data = false;
+			if (retransmit) {
+				retransmit->offset += bytes_read;
 
-				/* perform transfers in 35K chunks - this is determined empirical */
-				if (_session_info.stream_chunk_transmitted > 35000) {
-					payload->burst_complete = true;
-					_session_info.stream_download = false;
-					_session_info.stream_chunk_transmitted = 0;
+				if (retransmit->offset >= retransmit->end) {
+					session.num_retransmit--;
+					memmove(&session.retransmit[0], &session.retransmit[1], session.num_retransmit * sizeof(ByteRange));
 				}
 
 			} else {
-#endif
-				more_data = true;
-				payload->burst_complete = false;
-#ifndef MAVLINK_FTP_UNIT_TEST
-				max_bytes_to_send -= get_size();
+				session.stream_offset += bytes_read;
 			}
 
-#endif
+			if (session.num_retransmit == 0 && session.stream_offset >= session.stream_end) {
+				payload->burst_complete = true;
+				session.stream_download = false;
+			}
 		}
+	}
 
-		ftp_msg.target_system = _session_info.stream_target_system_id;
-		ftp_msg.target_network = 0;
-		ftp_msg.target_component = _session_info.stream_target_component_id;
-		_reply(&ftp_msg);
-	} while (more_data);
+	if (error_code != kErrNone) {
+		payload->opcode = kRspNak;
+		payload->size = 1;
+		uint8_t *pData = &payload->data[0];
+		*pData = error_code; // Straight reference to data[0] is causing bogus gcc array subscript error
+
+		if (error_code == kErrFailErrno) {
+			payload->size = 2;
+			payload->data[1] = _our_errno;
+		}
+
+		session.stream_download = false;
+		session.num_retransmit = 0;
+	}
+
+	ftp_msg.target_system = session.stream_target_system_id;
+	ftp_msg.target_network = 0;
+	ftp_msg.target_component = session.stream_target_component_id;
+	_reply(&ftp_msg);
+
+	return session.stream_download;
 }
 
 bool MavlinkFTP::_validatePathIsWritable(const char *path)
@@ -147,6 +147,24 @@ private:
 	ErrorCode	_workRename(PayloadHeader *payload);
 	ErrorCode	_workCalcFileCRC32(PayloadHeader *payload);
 
+	struct SessionInfo;
+
+	/// @return the open session referenced by payload->session or nullptr
+	SessionInfo	*_getSession(PayloadHeader *payload);
+	void		_closeSession(SessionInfo &session);
+
+	/**
+	 * Read file data of a session, served from the memory mapped file or the read-ahead buffer
+	 * @return number of bytes read (0 at EOF) or -1 on error (_our_errno is set)
+	 */
+	int		_readSession(SessionInfo &session, uint32_t offset, uint8_t *dst, uint8_t length);
+
+	/**
+	 * Send the next burst packet of a session
+	 * @return false if the burst of the session is complete
+	 */
+	bool		_sendBurstPacket(SessionInfo &session);
+
 	uint8_t _getServerSystemId(void);
 	uint8_t _getServerComponentId(void);
 	uint8_t _getServerChannel(void);
@@ -171,17 +189,49 @@ private:
 	/// @brief Maximum data size in RequestHeader::data
 	static const uint8_t	kMaxDataLength = MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN - sizeof(PayloadHeader);
 
+#if defined(CONSTRAINED_MEMORY)
+	static constexpr int	kMaxSessions = 1;
+	static constexpr int	kReadAheadLength = 2 * kMaxDataLength;
+#else
+	static constexpr int	kMaxSessions = 3;
+	static constexpr int	kReadAheadLength = 16 * kMaxDataLength;
+#endif
+
+	/// @brief Default length of a burst if the client doesn't specify one (determined empirically)
+	static constexpr uint32_t	kDefaultBurstLength = 35000;
+
+	/// @brief Maximum number of queued retransmission ranges per session
+	static constexpr int	kMaxRetransmitRanges = 8;
+
+	struct ByteRange {
+		uint32_t	offset;
+		uint32_t	end;
+	};
+
+	/**
+	 * A burst streams [stream_offset, stream_end) of the file. A burst request continuing at stream_end
+	 * while the burst is still active slides the window instead of restarting it, so that a client can keep
+	 * several requests in flight. A burst request with an explicit length for an offset that was already
+	 * streamed queues a retransmission of only that range, which is sent before the stream continues.
+	 */
 	struct SessionInfo {
-		int		fd;
-		uint32_t	file_size;
-		bool		stream_download;
-		uint32_t	stream_offset;
-		uint16_t	stream_seq_number;
-		uint8_t		stream_target_system_id;
-		uint8_t         stream_target_component_id;
-		unsigned	stream_chunk_transmitted;
+		int		fd{-1};
+		uint32_t	file_size{0};
+		bool		stream_download{false};
+		uint32_t	stream_offset{0};
+		uint32_t	stream_end{0};
+		uint16_t	stream_seq_number{0};
+		uint8_t		stream_target_system_id{0};
+		uint8_t         stream_target_component_id{0};
+		ByteRange	retransmit[kMaxRetransmitRanges] {};
+		uint8_t		num_retransmit{0};
+		uint8_t		*read_ahead{nullptr};	///< read-ahead buffer of the burst and read commands
+		uint32_t	read_ahead_offset{0};
+		int		read_ahead_length{0};
+		hrt_abstime	last_access{0};
 	};
-	struct SessionInfo _session_info {};	///< Session info, fd=-1 for no active session
+	SessionInfo _session_info[kMaxSessions] {};	///< Session info, fd=-1 for no active session
+	uint8_t _next_stream_session{0};		///< round-robin start of the burst sessions
 
 	ReceiveMessageFunc_t	_utRcvMsgFunc{};	///< Unit test override for mavlink message sending
 	void			*_worker_data{nullptr};	///< Additional parameter to _utRcvMsgFunc;
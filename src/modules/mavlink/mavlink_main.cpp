@@ -81,6 +81,7 @@
 #define MAIN_LOOP_DELAY                10000           ///< 100 Hz @ 1000 bytes/s data rate
 
 static pthread_mutex_t mavlink_module_mutex = PTHREAD_MUTEX_INITIALIZER;
+static MavlinkRouteTable mavlink_route_table; ///< links on which each remote component was seen
 static pthread_mutex_t mavlink_event_buffer_mutex = PTHREAD_MUTEX_INITIALIZER;
 events::EventBuffer *Mavlink::_event_buffer = nullptr;
 
@@ -163,6 +164,11 @@ Mavlink::~Mavlink()
 		mavlink_module_instances[_instance_id] = nullptr;
 	}
 
+	for (auto &forward_ring : _forward_rings) {
+		delete forward_ring.load();
+		forward_ring.store(nullptr);
+	}
+
 	// if this instance was responsible for checking events then select a new mavlink instance
 	if (check_events()) {
 		check_events_disable();
@@ -418,6 +424,11 @@ Mavlink::get_status_all_instances(bool show_streams_status)
 		}
 	}
 
+	if (!show_streams_status && (iterations > 0)) {
+		printf("\n");
+		mavlink_route_table.print();
+	}
+
 	/* return an error if there are no instances */
 	return (iterations == 0);
 }
@@ -485,14 +496,22 @@ Mavlink::forward_message(const mavlink_message_t *msg, Mavlink *self)
 		return;
 	}
 
+	// Pass message only to the instances on which the target component was seen before
+	const uint32_t links = mavlink_route_table.links(target_system_id, target_component_id) & ~(1u << self->get_instance_id());
+
+	if (links == 0) {
+		return;
+	}
+
+	// serialize once, the destinations send the raw frame
+	uint8_t frame[MAVLINK_MAX_PACKET_LEN];
+	const uint16_t frame_len = mavlink_msg_to_send_buffer(frame, msg);
+
 	LockGuard lg{mavlink_module_mutex};
 
 	for (Mavlink *inst : mavlink_module_instances) {
-		if (inst && (inst != self) && (inst->get_forwarding_on())) {
-			// Pass message only if target component was seen before
-			if (inst->_receiver.component_was_seen(target_system_id, target_component_id)) {
-				inst->pass_message(msg);
-			}
+		if (inst && (links & (1u << inst->get_instance_id())) && inst->get_forwarding_on()) {
+			inst->pass_message(self->get_instance_id(), frame, frame_len);
 		}
 	}
 }
@@ -766,6 +785,27 @@ void Mavlink::send_finish()
 		return;
 	}
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+
+	if (_tx_batch_active && (get_protocol() == Protocol::UDP) && pthread_equal(_tx_batch_thread, pthread_self())) {
+		if ((_tx_batch_count >= TX_BATCH_MAX_PACKETS) || (_tx_batch_fill + _buf_fill > sizeof(_tx_batch_buf))) {
+			send_tx_batch();
+		}
+
+		// keep the packet boundaries, every packet is sent as its own datagram
+		memcpy(&_tx_batch_buf[_tx_batch_fill], _buf, _buf_fill);
+		_tx_batch_iov[_tx_batch_count].iov_base = &_tx_batch_buf[_tx_batch_fill];
+		_tx_batch_iov[_tx_batch_count].iov_len = _buf_fill;
+		_tx_batch_count++;
+		_tx_batch_fill += _buf_fill;
+
+		_buf_fill = 0;
+		pthread_mutex_unlock(&_send_mutex);
+		return;
+	}
+
+#endif // MAVLINK_UDP_SENDMMSG
+
 	int ret = -1;
 
 	// send message to UART
@@ -787,26 +827,17 @@ void Mavlink::send_finish()
 
 # endif // CONFIG_NET
 
-		if ((_mode != MAVLINK_MODE_ONBOARD) && broadcast_enabled() &&
-		    (!get_client_source_initialized() || !is_gcs_connected())) {
-
-			if (!_broadcast_address_found) {
-				find_broadcast_address();
-			}
-
-			if (_broadcast_address_found && _buf_fill > 0) {
-
-				int bret = sendto(_socket_fd, _buf, _buf_fill, 0, (struct sockaddr *)&_bcast_addr, sizeof(_bcast_addr));
-
-				if (bret <= 0) {
-					if (!_broadcast_failed_warned) {
-						PX4_ERR("sending broadcast failed, errno: %d: %s", errno, strerror(errno));
-						_broadcast_failed_warned = true;
-					}
+		if (broadcast_required()) {
+			int bret = sendto(_socket_fd, _buf, _buf_fill, 0, (struct sockaddr *)&_bcast_addr, sizeof(_bcast_addr));
 
-				} else {
-					_broadcast_failed_warned = false;
+			if (bret <= 0) {
+				if (!_broadcast_failed_warned) {
+					PX4_ERR("sending broadcast failed, errno: %d: %s", errno, strerror(errno));
+					_broadcast_failed_warned = true;
 				}
+
+			} else {
+				_broadcast_failed_warned = false;
 			}
 		}
 	}
@@ -827,6 +858,107 @@ void Mavlink::send_finish()
 	pthread_mutex_unlock(&_send_mutex);
 }
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+void Mavlink::begin_tx_batch()
+{
+	if (get_protocol() == Protocol::UDP) {
+		pthread_mutex_lock(&_send_mutex);
+		_tx_batch_thread = pthread_self();
+		_tx_batch_active = true;
+		pthread_mutex_unlock(&_send_mutex);
+	}
+}
+
+void Mavlink::end_tx_batch()
+{
+	pthread_mutex_lock(&_send_mutex);
+	send_tx_batch();
+	_tx_batch_active = false;
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::send_tx_batch()
+{
+	if (_tx_batch_count == 0) {
+		return;
+	}
+
+	unsigned msg_count = 0;
+
+	for (unsigned i = 0; i < _tx_batch_count; i++) {
+		mmsghdr &msg = _tx_batch_msgs[msg_count++];
+		msg = {};
+		msg.msg_hdr.msg_name = &_src_addr;
+		msg.msg_hdr.msg_namelen = sizeof(_src_addr);
+		msg.msg_hdr.msg_iov = &_tx_batch_iov[i];
+		msg.msg_hdr.msg_iovlen = 1;
+	}
+
+	const bool broadcast = broadcast_required();
+
+	if (broadcast) {
+		for (unsigned i = 0; i < _tx_batch_count; i++) {
+			mmsghdr &msg = _tx_batch_msgs[msg_count++];
+			msg = {};
+			msg.msg_hdr.msg_name = &_bcast_addr;
+			msg.msg_hdr.msg_namelen = sizeof(_bcast_addr);
+			msg.msg_hdr.msg_iov = &_tx_batch_iov[i];
+			msg.msg_hdr.msg_iovlen = 1;
+		}
+	}
+
+	// sendmmsg() stops at the first failing datagram: skip it and continue with the next one, so that only the
+	// failing datagram is lost like with sendto(). The msg_len of a datagram that wasn't sent stays 0.
+	unsigned sent = 0;
+	int send_errno = 0;
+
+	while (sent < msg_count) {
+		const int ret = sendmmsg(_socket_fd, &_tx_batch_msgs[sent], msg_count - sent, 0);
+
+		if (ret > 0) {
+			sent += ret;
+
+		} else {
+			send_errno = errno;
+			sent++;
+		}
+	}
+
+	// same accounting as for the single packets, the client datagrams come first
+	for (unsigned i = 0; i < _tx_batch_count; i++) {
+		if (_tx_batch_msgs[i].msg_len > 0) {
+			_tstatus.tx_message_count++;
+			count_txbytes(_tx_batch_iov[i].iov_len);
+			_last_write_success_time = _last_write_try_time;
+
+		} else {
+			count_txerrbytes(_tx_batch_iov[i].iov_len);
+		}
+	}
+
+	if (broadcast) {
+		bool broadcast_failed = false;
+
+		for (unsigned i = _tx_batch_count; i < msg_count; i++) {
+			broadcast_failed |= (_tx_batch_msgs[i].msg_len == 0);
+		}
+
+		if (broadcast_failed) {
+			if (!_broadcast_failed_warned) {
+				PX4_ERR("sending broadcast failed, errno: %d: %s", send_errno, strerror(send_errno));
+				_broadcast_failed_warned = true;
+			}
+
+		} else {
+			_broadcast_failed_warned = false;
+		}
+	}
+
+	_tx_batch_count = 0;
+	_tx_batch_fill = 0;
+}
+#endif // MAVLINK_UDP_SENDMMSG
+
 void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
 {
 	if (!_tx_buffer_low) {
@@ -841,6 +973,21 @@ void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
 }
 
 #ifdef MAVLINK_UDP
+bool Mavlink::broadcast_required()
+{
+	if ((_mode != MAVLINK_MODE_ONBOARD) && broadcast_enabled() &&
+	    (!get_client_source_initialized() || !is_gcs_connected())) {
+
+		if (!_broadcast_address_found) {
+			find_broadcast_address();
+		}
+
+		return _broadcast_address_found;
+	}
+
+	return false;
+}
+
 void Mavlink::find_broadcast_address()
 {
 	struct ifconf ifconf;
@@ -1026,6 +1173,8 @@ Mavlink::handle_message(const mavlink_message_t *msg)
 	 *  NOTE: this is called from the receiver thread
 	 */
 
+	mavlink_route_table.learn(msg->sysid, msg->compid, _instance_id);
+
 	if (get_forwarding_on()) {
 		/* forward any messages to other mavlink instances */
 		Mavlink::forward_message(msg, this);
@@ -1182,6 +1331,8 @@ Mavlink::configure_stream(const char *stream_name, const float rate)
 
 	for (const auto &stream : _streams) {
 		if (strcmp(stream_name, stream->get_name()) == 0) {
+			_stream_scheduler.invalidate();
+
 			if (interval != 0) {
 				/* set new interval */
 				stream->set_interval(interval);
@@ -1203,6 +1354,7 @@ Mavlink::configure_stream(const char *stream_name, const float rate)
 	if (stream != nullptr) {
 		stream->set_interval(interval);
 		_streams.add(stream);
+		_stream_scheduler.invalidate();
 
 		return OK;
 	}
@@ -1248,17 +1400,54 @@ Mavlink::configure_stream_threadsafe(const char *stream_name, const float rate)
 }
 
 void
-Mavlink::pass_message(const mavlink_message_t *msg)
+Mavlink::pass_message(int source_instance, const uint8_t *frame, uint16_t len)
 {
-	/* size is 12 bytes plus variable payload */
-	int size = MAVLINK_NUM_NON_PAYLOAD_BYTES + msg->len;
-	LockGuard lg{_message_buffer_mutex};
+	if ((source_instance < 0) || (source_instance >= MAVLINK_COMM_NUM_BUFFERS)) {
+		return;
+	}
 
-	if (!_message_buffer.push_back(reinterpret_cast<const uint8_t *>(msg), size)) {
+	// only the source instance writes to its ring, the module mutex held by forward_message()
+	// keeps this instance alive
+	MavlinkForwardRing *ring = _forward_rings[source_instance].load();
+
+	if (ring == nullptr) {
+		ring = new MavlinkForwardRing();
+
+		if ((ring == nullptr) || !ring->allocate(FORWARD_RING_SIZE)) {
+			delete ring;
+			perf_count(_forwarding_error_perf);
+			return;
+		}
+
+		_forward_rings[source_instance].store(ring);
+	}
+
+	if (!ring->push(frame, len)) {
 		perf_count(_forwarding_error_perf);
 	}
 }
 
+void
+Mavlink::send_forwarded_messages()
+{
+	uint8_t frame[MAVLINK_MAX_PACKET_LEN];
+
+	for (auto &forward_ring : _forward_rings) {
+		MavlinkForwardRing *ring = forward_ring.load();
+
+		// keep the frame queued until there is space to send it
+		if (ring && (ring->front_length() > 0) && (ring->front_length() <= get_free_tx_buf())) {
+			const uint16_t len = ring->pop(frame, sizeof(frame));
+
+			if (len > 0) {
+				send_start(len);
+				send_bytes(frame, len);
+				send_finish();
+			}
+		}
+	}
+}
+
 MavlinkShell *
 Mavlink::get_shell()
 {
@@ -1298,14 +1487,19 @@ Mavlink::update_rate_mult()
 {
 	float const_rate = 0.0f;
 	float rate = 0.0f;
+	float priority_rate[MavlinkStream::PRIORITY_COUNT] {};
 
 	/* scale down rates if their theoretical bandwidth is exceeding the link bandwidth */
 	for (const auto &stream : _streams) {
+		const float stream_rate = (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() :
+					  0;
+
 		if (stream->const_rate()) {
-			const_rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			const_rate += stream_rate;
 
 		} else {
-			rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			rate += stream_rate;
+			priority_rate[(int)stream->priority()] += stream_rate;
 		}
 	}
 
@@ -1315,6 +1509,11 @@ Mavlink::update_rate_mult()
 		mavlink_ulog_streaming_rate_inv = 1.0f - _mavlink_ulog->current_data_rate();
 	}
 
+	if (_param_mav_rate_ctl.get()) {
+		update_rate_controller(const_rate, rate, priority_rate, mavlink_ulog_streaming_rate_inv);
+		return;
+	}
+
 	/* scale up and down as the link permits */
 	float bandwidth_mult = (float)(_datarate * mavlink_ulog_streaming_rate_inv - const_rate) / rate;
 
@@ -1359,6 +1558,70 @@ Mavlink::update_rate_mult()
 
 	/* ensure the rate multiplier never drops below 5% so that something is always sent */
 	_rate_mult = math::constrain(_rate_mult, 0.05f, 1.0f);
+
+	for (float &priority_rate_mult : _priority_rate_mult) {
+		priority_rate_mult = _rate_mult;
+	}
+}
+
+void
+Mavlink::update_rate_controller(float const_rate, float rate, const float priority_rate[],
+				float mavlink_ulog_streaming_rate_inv)
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	MavlinkRateController::Feedback feedback{};
+	feedback.data_rate = _datarate;
+	feedback.tx_error_rate = _tstatus.tx_error_rate_avg;
+	feedback.radio_txbuf = -1;
+
+	bool log_radio_timeout = false;
+
+	pthread_mutex_lock(&_radio_status_mutex);
+
+	if (_radio_status_available) {
+		// check for RADIO_STATUS timeout and reset
+		if (hrt_elapsed_time(&_rstatus.timestamp) > (_param_mav_radio_timeout.get() * 1_s)) {
+			_radio_status_available = false;
+			log_radio_timeout = true;
+
+		} else {
+			feedback.radio_txbuf = _rstatus.txbuf;
+		}
+	}
+
+	pthread_mutex_unlock(&_radio_status_mutex);
+
+	if (log_radio_timeout) {
+		PX4_ERR("instance %d: RADIO_STATUS timeout", _instance_id);
+	}
+
+	const uint32_t rtt_us = _timesync_rtt_us.fetch_and(0);
+
+	if (rtt_us > 0) {
+		_rate_controller.add_rtt_sample(now, rtt_us);
+	}
+
+	_rate_controller.set_latency_threshold(_param_mav_rate_rtt.get() * 1_ms);
+	_rate_controller.update(now, feedback);
+
+	// allocate what the constant rate streams and the ulog streaming leave to the streams by priority weight
+	const float available = _rate_controller.bandwidth() * mavlink_ulog_streaming_rate_inv - const_rate;
+	const float weights[MavlinkStream::PRIORITY_COUNT] {
+		_param_mav_rate_w_high.get(),
+		_param_mav_rate_w_norm.get(),
+		_param_mav_rate_w_low.get()
+	};
+
+	_rate_controller.allocate(available, priority_rate, weights, MavlinkStream::PRIORITY_COUNT, _priority_rate_mult);
+
+	float allocated = 0.f;
+
+	for (int i = 0; i < MavlinkStream::PRIORITY_COUNT; i++) {
+		allocated += priority_rate[i] * _priority_rate_mult[i];
+	}
+
+	_rate_mult = (rate > 0.f) ? math::constrain(allocated / rate, 0.05f, 1.0f) : 1.0f;
 }
 
 void
@@ -1719,7 +1982,19 @@ Mavlink::configure_streams_to_default(const char *configure_single_stream)
 		break;
 
 	case MAVLINK_MODE_IRIDIUM:
+#if defined(MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT) // Only defined if development.xml is used
+		if (_param_mav_hl_encoding.get() != 1) {
+			configure_stream_local("HIGH_LATENCY2", _high_latency_freq);
+		}
+
+		if (_param_mav_hl_encoding.get() != 0) {
+			configure_stream_local("HIGH_LATENCY_COMPACT", _high_latency_freq);
+		}
+
+#else
 		configure_stream_local("HIGH_LATENCY2", _high_latency_freq);
+#endif // MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT
+
 		break;
 
 	case MAVLINK_MODE_MINIMAL:
@@ -2236,24 +2511,9 @@ Mavlink::task_main(int argc, char *argv[])
 		return PX4_ERROR;
 	}
 
-	pthread_mutex_init(&_message_buffer_mutex, nullptr);
 	pthread_mutex_init(&_send_mutex, nullptr);
 	pthread_mutex_init(&_radio_status_mutex, nullptr);
 
-	/* if we are passing on mavlink messages, we need to prepare a buffer for this instance */
-	if (get_forwarding_on()) {
-		/* initialize message buffer if multiplexing is on.
-		 * make space for two messages plus off-by-one space as we use the empty element
-		 * marker ring buffer approach.
-		 */
-		LockGuard lg{_message_buffer_mutex};
-
-		if (!_message_buffer.allocate(2 * sizeof(mavlink_message_t) + 1)) {
-			PX4_ERR("msg buf alloc fail");
-			return PX4_ERROR;
-		}
-	}
-
 	/* Activate sending the data by default (for the IRIDIUM mode it will be disabled after the first round of packages is sent)*/
 	_transmitting_enabled = true;
 	_transmitting_enabled_commanded = true;
@@ -2355,6 +2615,10 @@ Mavlink::task_main(int argc, char *argv[])
 		perf_count(_loop_interval_perf);
 		perf_begin(_loop_perf);
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+		begin_tx_batch();
+#endif // MAVLINK_UDP_SENDMMSG
+
 		const hrt_abstime t = hrt_absolute_time();
 
 		update_rate_mult();
@@ -2392,20 +2656,26 @@ Mavlink::task_main(int argc, char *argv[])
 
 		check_requested_subscriptions();
 
-		/* update streams */
-		for (const auto &stream : _streams) {
-			stream->update(t);
+		/* update the streams which are due */
+		_stream_scheduler.update(_streams, t);
 
-			if (!_first_heartbeat_sent) {
-				if (_mode == MAVLINK_MODE_IRIDIUM) {
-					if (stream->get_id() == MAVLINK_MSG_ID_HIGH_LATENCY2) {
-						_first_heartbeat_sent = stream->first_message_sent();
-					}
+		if (!_first_heartbeat_sent) {
+			uint16_t heartbeat_id = MAVLINK_MSG_ID_HEARTBEAT;
 
-				} else {
-					if (stream->get_id() == MAVLINK_MSG_ID_HEARTBEAT) {
-						_first_heartbeat_sent = stream->first_message_sent();
-					}
+			if (_mode == MAVLINK_MODE_IRIDIUM) {
+				heartbeat_id = MAVLINK_MSG_ID_HIGH_LATENCY2;
+#if defined(MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT)
+
+				if (_param_mav_hl_encoding.get() == 1) {
+					heartbeat_id = MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT;
+				}
+
+#endif // MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT
+			}
+
+			for (const auto &stream : _streams) {
+				if (stream->get_id() == heartbeat_id) {
+					_first_heartbeat_sent = stream->first_message_sent();
 				}
 			}
 		}
@@ -2454,21 +2724,9 @@ Mavlink::task_main(int argc, char *argv[])
 
 		/* pass messages from other instances */
 		if (get_forwarding_on()) {
-
-			mavlink_message_t msg;
-			size_t available_bytes;
-			{
-				// We only send one message at a time, not to put too much strain on a
-				// link from forwarded messages.
-				LockGuard lg{_message_buffer_mutex};
-				available_bytes = _message_buffer.pop_front(reinterpret_cast<uint8_t *>(&msg), sizeof(msg));
-				// We need to make sure to release the lock here before sending the
-				// bytes out via IP or UART which could potentially take longer.
-			}
-
-			if (available_bytes > 0) {
-				resend_message(&msg);
-			}
+			// We only send one message per source instance at a time, not to put too much strain on a
+			// link from forwarded messages.
+			send_forwarded_messages();
 		}
 
 		/* update TX/RX rates*/
@@ -2488,6 +2746,10 @@ Mavlink::task_main(int argc, char *argv[])
 			_bytes_timestamp = t;
 		}
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+		end_tx_batch();
+#endif // MAVLINK_UDP_SENDMMSG
+
 		// publish status at 1 Hz, or sooner if HEARTBEAT has updated
 		if ((hrt_elapsed_time(&_tstatus.timestamp) >= 1_s) || _tstatus_updated) {
 			publish_telemetry_status();
@@ -2498,11 +2760,14 @@ Mavlink::task_main(int argc, char *argv[])
 
 	_receiver.stop();
 
+	mavlink_route_table.remove_link(_instance_id);
+
 	delete _subscribe_to_stream;
 	_subscribe_to_stream = nullptr;
 
 	/* delete streams */
 	_streams.clear();
+	_stream_scheduler.invalidate();
 
 	if (_uart_fd >= 0) {
 		/* discard all pending data, as close() might block otherwise on NuttX with flow control enabled */
@@ -2523,7 +2788,6 @@ Mavlink::task_main(int argc, char *argv[])
 
 	pthread_mutex_destroy(&_send_mutex);
 	pthread_mutex_destroy(&_radio_status_mutex);
-	pthread_mutex_destroy(&_message_buffer_mutex);
 
 	PX4_INFO("exiting channel %i", (int)_channel);
 
@@ -2775,6 +3039,9 @@ void Mavlink::check_requested_subscriptions()
 	}
 }
 
+static_assert((uint8_t)MavlinkRateController::Limit::Latency == telemetry_status_s::RATE_LIMIT_LATENCY,
+	      "rate limit reasons out of sync with telemetry_status");
+
 void Mavlink::publish_telemetry_status()
 {
 	// many fields are populated in place
@@ -2782,6 +3049,21 @@ void Mavlink::publish_telemetry_status()
 	_tstatus.mode = _mode;
 	_tstatus.data_rate = _datarate;
 	_tstatus.rate_multiplier = _rate_mult;
+
+	for (int i = 0; i < MavlinkStream::PRIORITY_COUNT; i++) {
+		_tstatus.priority_rate_multiplier[i] = _priority_rate_mult[i];
+	}
+
+	if (_param_mav_rate_ctl.get()) {
+		_tstatus.rate_limit = (uint8_t)_rate_controller.limit();
+		_tstatus.bandwidth_estimate = _rate_controller.bandwidth();
+		_tstatus.round_trip_time = _rate_controller.rtt() * 1e-3f;
+
+	} else {
+		_tstatus.rate_limit = (_rate_mult < 1.0f) ? telemetry_status_s::RATE_LIMIT_DATA_RATE : telemetry_status_s::RATE_LIMIT_NONE;
+		_tstatus.bandwidth_estimate = _datarate;
+		_tstatus.round_trip_time = 0.f;
+	}
 	_tstatus.flow_control = get_flow_control_enabled();
 	_tstatus.ftp = ftp_enabled();
 	_tstatus.forwarding = get_forwarding_on();
@@ -2986,6 +3268,16 @@ Mavlink::display_status()
 	printf("\t  tx: %.1f B/s\n", (double)_tstatus.tx_rate_avg);
 	printf("\t  txerr: %.1f B/s\n", (double)_tstatus.tx_error_rate_avg);
 	printf("\t  tx rate mult: %.3f\n", (double)_rate_mult);
+
+	if (_param_mav_rate_ctl.get()) {
+		static constexpr const char *limit_str[] {"none", "data rate", "TX errors", "radio buffer", "latency"};
+		const MavlinkRateController::Limit limit = _rate_controller.limit();
+
+		printf("\t  rate control: %.1f B/s, limit: %s, rtt: %.1f ms\n", (double)_rate_controller.bandwidth(),
+		       limit_str[(int)limit], (double)(_rate_controller.rtt() * 1e-3f));
+		printf("\t  rate mult high/normal/low: %.3f %.3f %.3f\n", (double)_priority_rate_mult[0],
+		       (double)_priority_rate_mult[1], (double)_priority_rate_mult[2]);
+	}
 	printf("\t  tx rate max: %i B/s\n", _datarate);
 	printf("\t  rx: %.1f B/s\n", (double)_tstatus.rx_rate_avg);
 	printf("\t  rx loss: %.1f%%\n", (double)_tstatus.rx_message_lost_rate);
@@ -2994,6 +3286,19 @@ Mavlink::display_status()
 	_receiver.print_detailed_rx_stats();
 #endif // !CONSTRAINED_FLASH
 
+	if (get_forwarding_on()) {
+		printf("\tforwarded messages:\n");
+
+		for (int i = 0; i < MAVLINK_COMM_NUM_BUFFERS; i++) {
+			const MavlinkForwardRing *ring = _forward_rings[i].load();
+
+			if (ring) {
+				printf("\t  from instance #%d: %" PRIu32 " (%" PRIu32 " B), dropped: %" PRIu32 "\n", i, ring->forwarded(),
+				       ring->forwarded_bytes(), ring->dropped());
+			}
+		}
+	}
+
 	if (_mavlink_ulog) {
 		printf("\tULog rate: %.1f%% of max %.1f%%\n", (double)_mavlink_ulog->current_data_rate() * 100.,
 		       (double)_mavlink_ulog->maximum_data_rate() * 100.);
@@ -3054,8 +3359,6 @@ Mavlink::display_status_streams()
 {
 	printf("\t%-20s%-16s %s\n", "Name", "Rate Config (current) [Hz]", "Message Size (if active) [B]");
 
-	const float rate_mult = _rate_mult;
-
 	for (const auto &stream : _streams) {
 		const int interval = stream->get_interval();
 		const unsigned size = stream->get_size();
@@ -3068,7 +3371,7 @@ Mavlink::display_status_streams()
 			float rate = 1000000.0f / (float)interval;
 			// Note that the actual current rate can be lower if the associated uORB topic updates at a
 			// lower rate.
-			float rate_current = stream->const_rate() ? rate : rate * rate_mult;
+			float rate_current = stream->const_rate() ? rate : rate * get_rate_mult(stream->priority());
 			snprintf(rate_str, sizeof(rate_str), "%6.2f (%.3f)", (double)rate, (double)rate_current);
 		}
 
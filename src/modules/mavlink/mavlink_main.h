@@ -60,7 +60,6 @@
 
 #include <containers/List.hpp>
 #include <parameters/param.h>
-#include <lib/variable_length_ringbuffer/VariableLengthRingbuffer.hpp>
 #include <perf/perf_counter.h>
 #include <px4_platform_common/cli.h>
 #include <px4_platform_common/px4_config.h>
@@ -79,23 +78,33 @@
 #include <uORB/topics/vehicle_command_ack.h>
 #include <uORB/topics/vehicle_status.h>
 
+#include "MavlinkRateController.hpp"
+#include "MavlinkRouting.hpp"
 #include "mavlink_command_sender.h"
 #include "mavlink_events.h"
 #include "mavlink_messages.h"
 #include "mavlink_receiver.h"
 #include "mavlink_shell.h"
+#include "mavlink_stream_scheduler.h"
 #include "mavlink_ulog.h"
 
 #define DEFAULT_BAUD_RATE       57600
 #define DEFAULT_DEVICE_NAME     "/dev/ttyS1"
 
 #define HASH_PARAM              "_HASH_CHECK"
+#define HASH_CHUNKS_PARAM       "_HASH_CHUNKS"  ///< request/root of the chunk hashes
+#define HASH_CHUNK_PARAM        "_HASH_CHUNK"   ///< hash of a single chunk, or request to send a chunk
 
 #if defined(CONFIG_NET) || defined(__PX4_POSIX)
 # define MAVLINK_UDP
 # define DEFAULT_REMOTE_PORT_UDP 14550 ///< GCS port per MAVLink spec
 #endif // CONFIG_NET || __PX4_POSIX
 
+#if defined(MAVLINK_UDP) && defined(__PX4_LINUX)
+# define MAVLINK_UDP_SENDMMSG ///< batch the UDP packets of a main loop iteration
+# define MAVLINK_UDP_RECVMMSG ///< receive multiple UDP datagrams per wakeup
+#endif // MAVLINK_UDP && __PX4_LINUX
+
 enum class Protocol {
 	SERIAL = 0,
 #if defined(MAVLINK_UDP)
@@ -415,6 +424,11 @@ public:
 
 	float			get_rate_mult() const { return _rate_mult; }
 
+	/**
+	 * Get the rate multiplier of the streams of a priority class
+	 */
+	float			get_rate_mult(MavlinkStream::Priority priority) const { return _priority_rate_mult[(int)priority]; }
+
 	float			get_baudrate() { return _baudrate; }
 
 	/* Functions for waiting to start transmission until message received. */
@@ -449,6 +463,29 @@ public:
 
 	void			update_radio_status(const radio_status_s &radio_status);
 
+	/**
+	 * Report the round trip time of a TIMESYNC message sent by this instance, called from the receiver thread
+	 */
+	void			update_timesync_rtt(uint64_t rtt_us)
+	{
+		// 0 is reserved for no new sample
+		_timesync_rtt_us.store((rtt_us == 0) ? 1 : ((rtt_us < UINT32_MAX) ? rtt_us : UINT32_MAX));
+	}
+
+	/**
+	 * Report the acknowledgement of a compact high latency report, called from the receiver thread
+	 */
+	void			acknowledge_high_latency_report(uint8_t seq) { _high_latency_ack.store(0x100 | seq); }
+
+	/**
+	 * @return sequence number of the latest acknowledged compact high latency report, -1 if none since the last call
+	 */
+	int			take_high_latency_ack()
+	{
+		const uint32_t ack = _high_latency_ack.fetch_and(0);
+		return (ack != 0) ? (int)(ack & 0xff) : -1;
+	}
+
 	unsigned		get_system_type() { return _param_mav_type.get(); }
 
 	Protocol 		get_protocol() const { return _protocol; }
@@ -503,6 +540,10 @@ public:
 	bool hash_check_enabled() const { return _param_mav_hash_chk_en.get(); }
 	bool forward_heartbeats_enabled() const { return _param_mav_hb_forw_en.get(); }
 
+	int32_t get_mission_window() const { return _param_mav_mis_window.get(); }
+
+	int32_t get_high_latency_keyframe_interval() const { return _param_mav_hl_keyframe.get(); }
+
 	bool failure_injection_enabled() const { return _param_sys_failure_injection_enabled.get(); }
 
 	struct ping_statistics_s {
@@ -569,6 +610,7 @@ private:
 	unsigned		_main_loop_delay{1000};	/**< mainloop delay, depends on data rate */
 
 	List<MavlinkStream *>		_streams;
+	MavlinkStreamScheduler		_stream_scheduler{*this};
 
 	MavlinkShell		*_mavlink_shell{nullptr};
 	MavlinkULog		*_mavlink_ulog{nullptr};
@@ -588,12 +630,17 @@ private:
 	int			_baudrate{57600};
 	int			_datarate{1000};		///< data rate for normal streams (attitude, position, etc.)
 	float			_rate_mult{1.0f};
+	float			_priority_rate_mult[MavlinkStream::PRIORITY_COUNT] {1.0f, 1.0f, 1.0f};
 	float			_high_latency_freq{0.015f};	///< frequency of HIGH_LATENCY2 stream
 
 	bool			_radio_status_available{false};
 	bool			_radio_status_critical{false};
 	float			_radio_status_mult{1.0f};
 
+	MavlinkRateController	_rate_controller{};
+	px4::atomic<uint32_t>	_timesync_rtt_us{0};	///< latest round trip time sample, 0 if consumed
+	px4::atomic<uint32_t>	_high_latency_ack{0};	///< 0x100 | sequence number of the latest acknowledged report, 0 if consumed
+
 	/**
 	 * If the queue index is not at 0, the queue sending
 	 * logic will send parameters from the current index
@@ -637,6 +684,19 @@ private:
 	uint8_t			_buf[MAVLINK_MAX_PACKET_LEN] {};
 	unsigned		_buf_fill{0};
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+	static constexpr unsigned TX_BATCH_MAX_PACKETS{32};
+
+	uint8_t			_tx_batch_buf[TX_BATCH_MAX_PACKETS * MAVLINK_MAX_PACKET_LEN] {};
+	unsigned		_tx_batch_fill{0};
+	iovec			_tx_batch_iov[TX_BATCH_MAX_PACKETS] {};
+	mmsghdr			_tx_batch_msgs[2 * TX_BATCH_MAX_PACKETS] {}; ///< client and broadcast address
+	unsigned		_tx_batch_count{0};
+
+	pthread_t		_tx_batch_thread{};
+	bool			_tx_batch_active{false};
+#endif // MAVLINK_UDP_SENDMMSG
+
 	bool			_tx_buffer_low{false};
 
 	const char 		*_interface_name{nullptr};
@@ -650,8 +710,9 @@ private:
 
 	ping_statistics_s	_ping_stats {};
 
-	pthread_mutex_t		_message_buffer_mutex{};
-	VariableLengthRingbuffer _message_buffer{};
+	/* frames forwarded from other instances, one ring per source instance, allocated on first use */
+	static constexpr size_t FORWARD_RING_SIZE{1024};
+	px4::atomic<MavlinkForwardRing *> _forward_rings[MAVLINK_COMM_NUM_BUFFERS] {};
 
 	pthread_mutex_t		_send_mutex {};
 	pthread_mutex_t         _radio_status_mutex {};
@@ -667,6 +728,14 @@ private:
 		(ParamBool<px4::params::MAV_HASH_CHK_EN>) _param_mav_hash_chk_en,
 		(ParamBool<px4::params::MAV_HB_FORW_EN>) _param_mav_hb_forw_en,
 		(ParamInt<px4::params::MAV_RADIO_TOUT>)      _param_mav_radio_timeout,
+		(ParamBool<px4::params::MAV_RATE_CTL>) _param_mav_rate_ctl,
+		(ParamFloat<px4::params::MAV_RATE_W_HIGH>) _param_mav_rate_w_high,
+		(ParamFloat<px4::params::MAV_RATE_W_NORM>) _param_mav_rate_w_norm,
+		(ParamFloat<px4::params::MAV_RATE_W_LOW>) _param_mav_rate_w_low,
+		(ParamInt<px4::params::MAV_RATE_RTT>) _param_mav_rate_rtt,
+		(ParamInt<px4::params::MAV_MIS_WINDOW>) _param_mav_mis_window,
+		(ParamInt<px4::params::MAV_HL_ENCODING>) _param_mav_hl_encoding,
+		(ParamInt<px4::params::MAV_HL_KEYFRAME>) _param_mav_hl_keyframe,
 		(ParamInt<px4::params::SYS_HITL>) _param_sys_hitl,
 		(ParamBool<px4::params::SYS_FAILURE_EN>) _param_sys_failure_injection_enabled
 	)
@@ -704,7 +773,15 @@ private:
 	 */
 	int configure_streams_to_default(const char *configure_single_stream = nullptr);
 
-	void pass_message(const mavlink_message_t *msg);
+	/**
+	 * Queue a frame forwarded from another instance, called from the receiver thread of the source instance
+	 */
+	void pass_message(int source_instance, const uint8_t *frame, uint16_t len);
+
+	/**
+	 * Send the frames forwarded from other instances, one per source instance
+	 */
+	void send_forwarded_messages();
 
 	void publish_telemetry_status();
 
@@ -729,12 +806,37 @@ private:
 	 */
 	void update_rate_mult();
 
+	/**
+	 * Update the closed loop rate controller and the rate multipliers of the stream priority classes
+	 */
+	void update_rate_controller(float const_rate, float rate, const float priority_rate[],
+				    float mavlink_ulog_streaming_rate_inv);
+
 #if defined(MAVLINK_UDP)
 	void find_broadcast_address();
 
+	/**
+	 * @return true if the packets also have to be sent to the broadcast address
+	 */
+	bool broadcast_required();
+
 	void init_udp();
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_UDP_SENDMMSG)
+	/**
+	 * Collect the UDP packets sent by the calling thread until end_tx_batch()
+	 * and send them together with sendmmsg()
+	 */
+	void begin_tx_batch();
+	void end_tx_batch();
+
+	/**
+	 * Send the collected packets, _send_mutex must be held
+	 */
+	void send_tx_batch();
+#endif // MAVLINK_UDP_SENDMMSG
+
 
 	bool set_channel();
 
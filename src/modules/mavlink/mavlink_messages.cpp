@@ -154,6 +154,10 @@
 # include "streams/UAVIONIX_ADSB_OUT_DYNAMIC.hpp"
 #endif // !CONSTRAINED_FLASH
 
+#if !defined(CONSTRAINED_FLASH) && defined(MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT) // Only defined if development.xml is used
+# include "streams/HIGH_LATENCY_COMPACT.hpp"
+#endif
+
 // ensure PX4 rotation enum and MAV_SENSOR_ROTATION align
 static_assert(MAV_SENSOR_ROTATION_NONE == static_cast<MAV_SENSOR_ORIENTATION>(ROTATION_NONE),
 	      "Roll: 0, Pitch: 0, Yaw: 0");
@@ -429,6 +433,9 @@ static const StreamListItem streams_list[] = {
 #if defined(HIGH_LATENCY2_HPP)
 	create_stream_list_item<MavlinkStreamHighLatency2>(),
 #endif // HIGH_LATENCY2_HPP
+#if defined(HIGH_LATENCY_COMPACT_HPP)
+	create_stream_list_item<MavlinkStreamHighLatencyCompact>(),
+#endif // HIGH_LATENCY_COMPACT_HPP
 #if defined(HIL_STATE_QUATERNION_HPP)
 	create_stream_list_item<MavlinkStreamHILStateQuaternion>(),
 #endif // HIL_STATE_QUATERNION_HPP
@@ -317,15 +317,15 @@ MavlinkMissionManager::send_mission_item(uint8_t sysid, uint8_t compid, uint16_t
 	switch (_mission_type) {
 
 	case MAV_MISSION_TYPE_MISSION: {
-			read_success = _dataman_client.readSync(_mission_dataman_id, seq, reinterpret_cast<uint8_t *>(&mission_item),
-								sizeof(mission_item_s));
+			read_success = read_transfer_item(_mission_dataman_id, seq, reinterpret_cast<uint8_t *>(&mission_item),
+							  sizeof(mission_item_s));
 		}
 		break;
 
 	case MAV_MISSION_TYPE_FENCE: { // Read a geofence point
 			mission_fence_point_s mission_fence_point;
-			read_success = _dataman_client.readSync(_fence_dataman_id, seq,
-								reinterpret_cast<uint8_t *>(&mission_fence_point), sizeof(mission_fence_point_s));
+			read_success = read_transfer_item(_fence_dataman_id, seq,
+							  reinterpret_cast<uint8_t *>(&mission_fence_point), sizeof(mission_fence_point_s));
 
 			mission_item.nav_cmd = mission_fence_point.nav_cmd;
 			mission_item.frame = mission_fence_point.frame;
@@ -344,8 +344,8 @@ MavlinkMissionManager::send_mission_item(uint8_t sysid, uint8_t compid, uint16_t
 		break;
 
 	case MAV_MISSION_TYPE_RALLY: { // Read a safe point / rally point
-			read_success = _dataman_client.readSync(_safepoint_dataman_id, seq, reinterpret_cast<uint8_t *>(&mission_item),
-								sizeof(mission_item_s));
+			read_success = read_transfer_item(_safepoint_dataman_id, seq, reinterpret_cast<uint8_t *>(&mission_item),
+							  sizeof(mission_item_s));
 		}
 		break;
 
@@ -552,12 +552,18 @@ MavlinkMissionManager::send()
 		}
 	}
 
+	if (_state == MAVLINK_WPM_STATE_SENDLIST && _transfer_window > 1) {
+		// read ahead the next items of the download
+		_dataman_cache.update();
+	}
+
 	/* check for timed-out operations */
 	if (_state == MAVLINK_WPM_STATE_GETLIST && (_time_last_sent > 0)
 	    && hrt_elapsed_time(&_time_last_sent) > MAVLINK_MISSION_RETRY_TIMEOUT_DEFAULT) {
 
-		// try to request item again after timeout
-		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+		// try to request the missing items again after timeout
+		_transfer_requested = _transfer_seq;
+		request_mission_items();
 
 	} else if (_state != MAVLINK_WPM_STATE_IDLE && (_time_last_recv > 0)
 		   && hrt_elapsed_time(&_time_last_recv) > MAVLINK_MISSION_PROTOCOL_TIMEOUT_DEFAULT) {
@@ -757,6 +763,24 @@ MavlinkMissionManager::handle_mission_request_list(const mavlink_message_t *msg)
 			_transfer_partner_sysid = msg->sysid;
 			_transfer_partner_compid = msg->compid;
 
+			const int32_t window = _mavlink.get_mission_window();
+			_transfer_window = (window < 1) ? 1 : ((window > MAX_TRANSFER_WINDOW) ? MAX_TRANSFER_WINDOW : window);
+
+			if (_transfer_window > 1) {
+				if (_dataman_cache.size() != _transfer_window) {
+					_dataman_cache.resize(_transfer_window);
+				}
+
+				_dataman_cache.invalidate();
+
+				const dm_item_t dataman_id = (_mission_type == MAV_MISSION_TYPE_FENCE) ? _fence_dataman_id :
+							     ((_mission_type == MAV_MISSION_TYPE_RALLY) ? _safepoint_dataman_id : _mission_dataman_id);
+
+				for (uint16_t seq = 0; seq < _transfer_count && seq < _transfer_window; seq++) {
+					_dataman_cache.load(dataman_id, seq);
+				}
+			}
+
 			if (_transfer_count > 0) {
 				PX4_DEBUG("WPM: MISSION_REQUEST_LIST OK, %u mission items to send, mission type=%i", _transfer_count, _mission_type);
 
@@ -818,13 +842,14 @@ MavlinkMissionManager::handle_mission_request_both(const mavlink_message_t *msg)
 
 				_time_last_recv = hrt_absolute_time();
 
-				/* _transfer_seq contains sequence of expected request */
-				if (wpr.seq == _transfer_seq && _transfer_seq < _transfer_count) {
+				/* _transfer_seq contains sequence of expected request, a windowed client may request up to
+				 * _transfer_window items ahead and request any previous item again */
+				if (wpr.seq >= _transfer_seq && wpr.seq < _transfer_seq + _transfer_window && wpr.seq < _transfer_count) {
 					PX4_DEBUG("WPM: MISSION_ITEM_REQUEST(_INT) seq %u from ID %u", wpr.seq, msg->sysid);
 
-					_transfer_seq++;
+					_transfer_seq = wpr.seq + 1;
 
-				} else if (wpr.seq == _transfer_seq - 1) {
+				} else if (wpr.seq == _transfer_seq - 1 || (_transfer_window > 1 && wpr.seq < _transfer_seq)) {
 					PX4_DEBUG("WPM: MISSION_ITEM_REQUEST(_INT) seq %u from ID %u (again)", wpr.seq, msg->sysid);
 
 				} else {
@@ -991,6 +1016,28 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 			_transfer_land_start_marker = -1;
 			_transfer_land_marker = -1;
 
+			free_transfer_buffers();
+
+			const int32_t window = _mavlink.get_mission_window();
+			_transfer_window = (window < 1) ? 1 : ((window > MAX_TRANSFER_WINDOW) ? MAX_TRANSFER_WINDOW : window);
+
+			if (_transfer_window > 1) {
+				_transfer_window_items = new WindowItem[_transfer_window] {};
+
+				if (_transfer_window_items == nullptr) {
+					_transfer_window = 1;
+				}
+			}
+
+			// without a staging buffer the items are written one by one
+			_staged_item_size = (_mission_type == MAV_MISSION_TYPE_FENCE) ? sizeof(mission_fence_point_s) : sizeof(mission_item_s);
+			_staged_capacity = (_transfer_count < MAX_STAGED_ITEMS) ? _transfer_count : MAX_STAGED_ITEMS;
+			_staged_items = new uint8_t[_staged_capacity * _staged_item_size];
+
+			if (_staged_items == nullptr) {
+				_staged_capacity = 0;
+			}
+
 		} else if (_state == MAVLINK_WPM_STATE_GETLIST) {
 			_time_last_recv = hrt_absolute_time();
 
@@ -1026,7 +1073,8 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 			return;
 		}
 
-		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+		_transfer_requested = _transfer_seq;
+		request_mission_items();
 	}
 }
 
@@ -1034,6 +1082,20 @@ void
 MavlinkMissionManager::switch_to_idle_state()
 {
 	_state = MAVLINK_WPM_STATE_IDLE;
+	free_transfer_buffers();
+}
+
+void
+MavlinkMissionManager::free_transfer_buffers()
+{
+	delete[] _transfer_window_items;
+	_transfer_window_items = nullptr;
+
+	delete[] _staged_items;
+	_staged_items = nullptr;
+	_staged_capacity = 0;
+	_staged_count = 0;
+	_staged_seq = 0;
 }
 
 
@@ -1081,7 +1143,17 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				_time_last_recv = hrt_absolute_time();
 
 				if (wp.seq != _transfer_seq) {
-					PX4_DEBUG("WPM: MISSION_ITEM ERROR: seq %u was not the expected %u", wp.seq, _transfer_seq);
+					if (_transfer_window_items != nullptr && wp.seq > _transfer_seq && wp.seq < _transfer_seq + _transfer_window
+					    && wp.seq < _transfer_count) {
+						/* Item received ahead of the expected one, keep it until the missing ones arrive */
+						WindowItem &window_item = _transfer_window_items[wp.seq % _transfer_window];
+						window_item.item = wp;
+						window_item.valid = true;
+						PX4_DEBUG("WPM: MISSION_ITEM seq %u received ahead of %u", wp.seq, _transfer_seq);
+
+					} else {
+						PX4_DEBUG("WPM: MISSION_ITEM ERROR: seq %u was not the expected %u", wp.seq, _transfer_seq);
+					}
 
 					/* Item sequence not expected, ignore item */
 					return;
@@ -1114,145 +1186,44 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				return;
 			}
 
-			struct mission_item_s mission_item = {};
-
-			int ret = parse_mavlink_mission_item(&wp, &mission_item);
-
-			if (ret != PX4_OK) {
-				PX4_DEBUG("WPM: MISSION_ITEM ERROR: seq %u invalid item", wp.seq);
-
-				_mavlink.send_statustext_critical("IGN MISSION_ITEM: Invalid item\t");
-				events::send(events::ID("mavlink_mission_mis_item_invalid"), events::Log::Error,
-					     "Ignoring mission item, invalid item");
-
-				send_mission_ack(_transfer_partner_sysid, _transfer_partner_compid, ret);
-				switch_to_idle_state();
-				_transfer_in_progress = false;
+			if (!store_mission_item(wp)) {
 				return;
 			}
 
-			_transfer_current_crc32 = crc32_for_mission_item(wp, _transfer_current_crc32);
-
-			bool write_failed = false;
-			bool check_failed = false;
-
-			switch (_mission_type) {
-
-			case MAV_MISSION_TYPE_MISSION: {
-					// check that we don't get a wrong item (hardening against wrong client implementations, the list here
-					// does not need to be complete)
-					if (mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_INCLUSION ||
-					    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_EXCLUSION ||
-					    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_CIRCLE_INCLUSION ||
-					    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_CIRCLE_EXCLUSION ||
-					    mission_item.nav_cmd == MAV_CMD_NAV_RALLY_POINT) {
-						check_failed = true;
+			/* continue with the items that were received ahead */
+			while (_transfer_window_items != nullptr && _transfer_seq < _transfer_count) {
+				WindowItem &window_item = _transfer_window_items[_transfer_seq % _transfer_window];
 
-					} else {
-
-						write_failed = !_dataman_client.writeSync(_transfer_dataman_id, wp.seq,
-								reinterpret_cast<uint8_t *>(&mission_item),
-								sizeof(struct mission_item_s));
-
-						// Check for land start marker
-						if ((mission_item.nav_cmd == MAV_CMD_DO_LAND_START) && (_transfer_land_start_marker == -1)) {
-							_transfer_land_start_marker = wp.seq;
-						}
-
-						// Check for land index
-						if (((mission_item.nav_cmd == MAV_CMD_NAV_VTOL_LAND) || (mission_item.nav_cmd == MAV_CMD_NAV_LAND))
-						    && (_transfer_land_marker == -1)) {
-							_transfer_land_marker = wp.seq;
-
-							if (_transfer_land_start_marker == -1) {
-								_transfer_land_start_marker = _transfer_land_marker;
-							}
-						}
-
-						if (!write_failed) {
-							/* waypoint marked as current */
-							if (wp.current) {
-								_transfer_current_seq = wp.seq;
-							}
-						}
-					}
+				if (!window_item.valid || window_item.item.seq != _transfer_seq) {
+					break;
 				}
-				break;
-
-			case MAV_MISSION_TYPE_FENCE: { // Write a geofence point
-					mission_fence_point_s mission_fence_point;
-					mission_fence_point.nav_cmd = mission_item.nav_cmd;
-					mission_fence_point.lat = mission_item.lat;
-					mission_fence_point.lon = mission_item.lon;
-					mission_fence_point.alt = mission_item.altitude;
 
-					if (mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_INCLUSION ||
-					    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_EXCLUSION) {
-						mission_fence_point.vertex_count = mission_item.vertex_count;
+				window_item.valid = false;
 
-						if (mission_item.vertex_count < 3) { // feasibility check
-							PX4_ERR("Fence: too few vertices");
-							check_failed = true;
-						}
-
-					} else {
-						mission_fence_point.circle_radius = mission_item.circle_radius;
-					}
-
-					mission_fence_point.frame = mission_item.frame;
-
-					if (!check_failed) {
-						write_failed = !_dataman_client.writeSync(_transfer_dataman_id, wp.seq,
-								reinterpret_cast<uint8_t *>(&mission_fence_point), sizeof(mission_fence_point_s));
-					}
-
-				}
-				break;
-
-			case MAV_MISSION_TYPE_RALLY: { // Write a safe point / rally point
-					write_failed = !_dataman_client.writeSync(_transfer_dataman_id, wp.seq,
-							reinterpret_cast<uint8_t *>(&mission_item), sizeof(mission_item_s), 2_s);
+				if (!store_mission_item(window_item.item)) {
+					return;
 				}
-				break;
-
-			default:
-				_mavlink.send_statustext_critical("Received unknown mission type, abort.\t");
-				events::send(events::ID("mavlink_mission_unknown_mis_type"), events::Log::Error,
-					     "Received unknown mission type, abort");
-				break;
 			}
 
-			if (write_failed || check_failed) {
-				PX4_DEBUG("WPM: MISSION_ITEM ERROR: error writing seq %u to dataman ID %i", wp.seq, _transfer_dataman_id);
+			if (_transfer_seq == _transfer_count) {
+				/* got all new mission items successfully */
+				PX4_DEBUG("WPM: MISSION_ITEM got all %u items, current_seq=%ld, changing state to MAVLINK_WPM_STATE_IDLE",
+					  _transfer_count, _transfer_current_seq);
 
-				send_mission_ack(_transfer_partner_sysid, _transfer_partner_compid, MAV_MISSION_ERROR);
+				if (!write_staged_items()) {
+					PX4_DEBUG("WPM: MISSION_ITEM ERROR: error writing items to dataman ID %i", _transfer_dataman_id);
 
-				if (write_failed) {
+					send_mission_ack(_transfer_partner_sysid, _transfer_partner_compid, MAV_MISSION_ERROR);
 					_mavlink.send_statustext_critical("Unable to write on micro SD\t");
 					events::send(events::ID("mavlink_mission_storage_failure"), events::Log::Error,
 						     "Mission: unable to write to storage");
-				}
-
-				switch_to_idle_state();
-				_transfer_in_progress = false;
-				return;
-			}
-
-			/* waypoint marked as current */
-			if (wp.current) {
-				_transfer_current_seq = wp.seq;
-			}
-
-			PX4_DEBUG("WPM: MISSION_ITEM seq %u received", wp.seq);
 
-			_transfer_seq = wp.seq + 1;
-
-			if (_transfer_seq == _transfer_count) {
-				/* got all new mission items successfully */
-				PX4_DEBUG("WPM: MISSION_ITEM got all %u items, current_seq=%ld, changing state to MAVLINK_WPM_STATE_IDLE",
-					  _transfer_count, _transfer_current_seq);
+					switch_to_idle_state();
+					_transfer_in_progress = false;
+					return;
+				}
 
-				ret = 0;
+				int ret = 0;
 
 				switch (_mission_type) {
 				case MAV_MISSION_TYPE_MISSION:
@@ -1303,8 +1274,8 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				_transfer_in_progress = false;
 
 			} else {
-				/* request next item */
-				send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+				/* request next items */
+				request_mission_items();
 			}
 
 		} else {
@@ -1317,6 +1288,220 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 	}
 }
 
+bool
+MavlinkMissionManager::store_mission_item(const mavlink_mission_item_t &wp)
+{
+	struct mission_item_s mission_item = {};
+
+	int ret = parse_mavlink_mission_item(&wp, &mission_item);
+
+	if (ret != PX4_OK) {
+		PX4_DEBUG("WPM: MISSION_ITEM ERROR: seq %u invalid item", wp.seq);
+
+		_mavlink.send_statustext_critical("IGN MISSION_ITEM: Invalid item\t");
+		events::send(events::ID("mavlink_mission_mis_item_invalid"), events::Log::Error,
+			     "Ignoring mission item, invalid item");
+
+		send_mission_ack(_transfer_partner_sysid, _transfer_partner_compid, ret);
+		switch_to_idle_state();
+		_transfer_in_progress = false;
+		return false;
+	}
+
+	_transfer_current_crc32 = crc32_for_mission_item(wp, _transfer_current_crc32);
+
+	bool write_failed = false;
+	bool check_failed = false;
+
+	switch (_mission_type) {
+
+	case MAV_MISSION_TYPE_MISSION: {
+			// check that we don't get a wrong item (hardening against wrong client implementations, the list here
+			// does not need to be complete)
+			if (mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_INCLUSION ||
+			    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_EXCLUSION ||
+			    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_CIRCLE_INCLUSION ||
+			    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_CIRCLE_EXCLUSION ||
+			    mission_item.nav_cmd == MAV_CMD_NAV_RALLY_POINT) {
+				check_failed = true;
+
+			} else {
+
+				write_failed = !stage_item(wp.seq, &mission_item);
+
+				// Check for land start marker
+				if ((mission_item.nav_cmd == MAV_CMD_DO_LAND_START) && (_transfer_land_start_marker == -1)) {
+					_transfer_land_start_marker = wp.seq;
+				}
+
+				// Check for land index
+				if (((mission_item.nav_cmd == MAV_CMD_NAV_VTOL_LAND) || (mission_item.nav_cmd == MAV_CMD_NAV_LAND))
+				    && (_transfer_land_marker == -1)) {
+					_transfer_land_marker = wp.seq;
+
+					if (_transfer_land_start_marker == -1) {
+						_transfer_land_start_marker = _transfer_land_marker;
+					}
+				}
+
+				if (!write_failed) {
+					/* waypoint marked as current */
+					if (wp.current) {
+						_transfer_current_seq = wp.seq;
+					}
+				}
+			}
+		}
+		break;
+
+	case MAV_MISSION_TYPE_FENCE: { // Write a geofence point
+			mission_fence_point_s mission_fence_point;
+			mission_fence_point.nav_cmd = mission_item.nav_cmd;
+			mission_fence_point.lat = mission_item.lat;
+			mission_fence_point.lon = mission_item.lon;
+			mission_fence_point.alt = mission_item.altitude;
+
+			if (mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_INCLUSION ||
+			    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_EXCLUSION) {
+				mission_fence_point.vertex_count = mission_item.vertex_count;
+
+				if (mission_item.vertex_count < 3) { // feasibility check
+					PX4_ERR("Fence: too few vertices");
+					check_failed = true;
+				}
+
+			} else {
+				mission_fence_point.circle_radius = mission_item.circle_radius;
+			}
+
+			mission_fence_point.frame = mission_item.frame;
+
+			if (!check_failed) {
+				write_failed = !stage_item(wp.seq, &mission_fence_point);
+			}
+
+		}
+		break;
+
+	case MAV_MISSION_TYPE_RALLY: { // Write a safe point / rally point
+			write_failed = !stage_item(wp.seq, &mission_item);
+		}
+		break;
+
+	default:
+		_mavlink.send_statustext_critical("Received unknown mission type, abort.\t");
+		events::send(events::ID("mavlink_mission_unknown_mis_type"), events::Log::Error,
+			     "Received unknown mission type, abort");
+		break;
+	}
+
+	if (write_failed || check_failed) {
+		PX4_DEBUG("WPM: MISSION_ITEM ERROR: error writing seq %u to dataman ID %i", wp.seq, _transfer_dataman_id);
+
+		send_mission_ack(_transfer_partner_sysid, _transfer_partner_compid, MAV_MISSION_ERROR);
+
+		if (write_failed) {
+			_mavlink.send_statustext_critical("Unable to write on micro SD\t");
+			events::send(events::ID("mavlink_mission_storage_failure"), events::Log::Error,
+				     "Mission: unable to write to storage");
+		}
+
+		switch_to_idle_state();
+		_transfer_in_progress = false;
+		return false;
+	}
+
+	/* waypoint marked as current */
+	if (wp.current) {
+		_transfer_current_seq = wp.seq;
+	}
+
+	PX4_DEBUG("WPM: MISSION_ITEM seq %u received", wp.seq);
+
+	_transfer_seq = wp.seq + 1;
+
+	return true;
+}
+
+void
+MavlinkMissionManager::request_mission_items()
+{
+	const uint32_t window_end = _transfer_seq + _transfer_window;
+
+	while (_transfer_requested < _transfer_count && _transfer_requested < window_end) {
+		const bool received = _transfer_window_items != nullptr
+				      && _transfer_window_items[_transfer_requested % _transfer_window].valid
+				      && _transfer_window_items[_transfer_requested % _transfer_window].item.seq == _transfer_requested;
+
+		if (!received) {
+			send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_requested);
+		}
+
+		_transfer_requested++;
+	}
+}
+
+bool
+MavlinkMissionManager::stage_item(uint16_t seq, const void *item)
+{
+	// rally points are written with a shorter timeout
+	const hrt_abstime timeout = (_mission_type == MAV_MISSION_TYPE_RALLY) ? 2_s : 5000_ms;
+
+	if (_staged_items == nullptr) {
+		return _dataman_client.writeSync(_transfer_dataman_id, seq, const_cast<uint8_t *>(static_cast<const uint8_t *>(item)),
+						 _staged_item_size, timeout);
+	}
+
+	if (_staged_count == 0) {
+		_staged_seq = seq;
+	}
+
+	memcpy(_staged_items + _staged_count * _staged_item_size, item, _staged_item_size);
+	_staged_count++;
+
+	if (_staged_count == _staged_capacity) {
+		return write_staged_items();
+	}
+
+	return true;
+}
+
+bool
+MavlinkMissionManager::write_staged_items()
+{
+	if (_staged_count == 0) {
+		return true;
+	}
+
+	const hrt_abstime timeout = (_mission_type == MAV_MISSION_TYPE_RALLY) ? 2_s : 5000_ms;
+
+	const bool success = _dataman_client.writeBulkSync(_transfer_dataman_id, _staged_seq, _staged_items, _staged_item_size,
+			     _staged_count, timeout);
+
+	PX4_DEBUG("WPM: wrote %u staged items from seq %u", _staged_count, _staged_seq);
+
+	_staged_count = 0;
+
+	return success;
+}
+
+bool
+MavlinkMissionManager::read_transfer_item(dm_item_t dataman_id, uint16_t seq, uint8_t *buffer, uint32_t length)
+{
+	if (_transfer_window <= 1) {
+		return _dataman_client.readSync(dataman_id, seq, buffer, length);
+	}
+
+	// served from the cache if it was read ahead already, the next item is read ahead in the meantime
+	const bool success = _dataman_cache.loadWait(dataman_id, seq, buffer, length, 5000_ms);
+
+	if (seq + _transfer_window < _transfer_count) {
+		_dataman_cache.load(dataman_id, seq + _transfer_window);
+	}
+
+	return success;
+}
+
 
 void
 MavlinkMissionManager::handle_mission_clear_all(const mavlink_message_t *msg)
@@ -79,7 +79,7 @@ class MavlinkMissionManager
 public:
 	explicit MavlinkMissionManager(Mavlink &mavlink);
 
-	~MavlinkMissionManager() = default;
+	~MavlinkMissionManager() { free_transfer_buffers(); }
 
 	/**
 	 * Handle sending of messages. Call this regularly at a fixed frequency.
@@ -96,6 +96,7 @@ private:
 	enum MAV_MISSION_TYPE _mission_type {MAV_MISSION_TYPE_MISSION};	///< mission type of current transmission (only one at a time possible)
 
 	DatamanClient _dataman_client{};
+	DatamanCache _dataman_cache{"mavlink_mission_dm_cache_miss", 0};	///< Items read ahead during a download
 
 	uint64_t		_time_last_recv{0};
 	uint64_t		_time_last_sent{0};
@@ -134,6 +135,22 @@ private:
 	int32_t 		_transfer_land_start_marker{-1}; 	///< index of land start mission item in current transmission (if unavailable, index of land mission item, -1 otherwise)
 	int32_t 		_transfer_land_marker{-1}; 		///< index of land mission item in current transmission (-1 if unavailable)
 
+	uint16_t		_transfer_window{1};			///< Number of items requested (upload) or read (download) ahead in current transmission
+	uint16_t		_transfer_requested{0};			///< Next item sequence to request in current transmission
+
+	struct WindowItem {
+		mavlink_mission_item_t item;
+		bool valid;
+	};
+
+	WindowItem		*_transfer_window_items{nullptr};	///< Items received ahead of _transfer_seq, at index seq % _transfer_window
+
+	uint8_t			*_staged_items{nullptr};		///< Items of current transmission not written to dataman yet
+	uint16_t		_staged_capacity{0};			///< Number of items the staging buffer can hold
+	uint16_t		_staged_count{0};			///< Number of items in the staging buffer
+	uint16_t		_staged_seq{0};				///< Item sequence of the first item in the staging buffer
+	uint16_t		_staged_item_size{0};			///< Size of a dataman item of the current mission type
+
 	static bool		_transfer_in_progress;			///< Global variable checking for current transmission
 
 	uORB::Subscription	_mission_result_sub{ORB_ID(mission_result)};
@@ -157,6 +174,20 @@ private:
 	};	/**< Maximum number of mission items for each type
 					(fence & safe points use the first item for the stats) */
 
+	static constexpr uint16_t	MAX_TRANSFER_WINDOW = 16;	///< Upper limit of MAV_MIS_WINDOW
+
+	/**
+	 * Maximum number of uploaded items held in RAM before they are written to dataman.
+	 * The items go to the inactive storage which is only activated after the whole transfer,
+	 * so writing them out early keeps the update atomic. Flushing in chunks also bounds the
+	 * time between the last item and the ACK.
+	 */
+#if defined(CONSTRAINED_MEMORY)
+	static constexpr uint16_t	MAX_STAGED_ITEMS = 16;
+#else
+	static constexpr uint16_t	MAX_STAGED_ITEMS = 64;
+#endif
+
 	/** get the maximum number of item count for the current _mission_type */
 	uint16_t current_max_item_count();
 
@@ -210,6 +241,37 @@ private:
 
 	void send_mission_request(uint8_t sysid, uint8_t compid, uint16_t seq);
 
+	/**
+	 * Request the items of the upload window that were not requested or received yet
+	 */
+	void request_mission_items();
+
+	/**
+	 * Parse, check and stage an item of the current upload, items must be passed in sequence order.
+	 * On error the transfer is aborted.
+	 * @return false if the transfer was aborted
+	 */
+	bool store_mission_item(const mavlink_mission_item_t &wp);
+
+	/**
+	 * Add an item to the staging buffer, the buffer is written to dataman when it's full.
+	 * @return false if writing to dataman failed
+	 */
+	bool stage_item(uint16_t seq, const void *item);
+
+	/**
+	 * Write the staged items to dataman
+	 * @return false if writing to dataman failed
+	 */
+	bool write_staged_items();
+
+	/**
+	 * Read an item of the current download, from the read ahead cache if enabled
+	 */
+	bool read_transfer_item(dm_item_t dataman_id, uint16_t seq, uint8_t *buffer, uint32_t length);
+
+	void free_transfer_buffers();
+
 	/**
 	 *  @brief emits a message that a waypoint reached
 	 *
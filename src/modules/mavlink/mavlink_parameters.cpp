@@ -41,6 +41,7 @@
  */
 
 #include <stdio.h>
+#include <crc32.h>
 
 #include "mavlink_parameters.h"
 #include "mavlink_main.h"
@@ -51,6 +52,12 @@ MavlinkParametersManager::MavlinkParametersManager(Mavlink &mavlink) :
 {
 }
 
+MavlinkParametersManager::~MavlinkParametersManager()
+{
+	delete[] _chunk_hashes;
+	delete[] _chunk_used_end;
+}
+
 unsigned
 MavlinkParametersManager::get_size()
 {
@@ -108,6 +115,18 @@ MavlinkParametersManager::handle_message(const mavlink_message_t *msg)
 				/* enforce null termination */
 				name[MAVLINK_MSG_PARAM_VALUE_FIELD_PARAM_ID_LEN] = '\0';
 
+				/* request to send a chunk of a cached parameter set that doesn't match */
+				if (strncmp(name, HASH_CHUNK_PARAM, sizeof(name)) == 0) {
+					uint32_t chunk;
+					memcpy(&chunk, &set.param_value, sizeof(chunk));
+
+					if (chunk < PARAM_HASH_MAX_CHUNKS) {
+						_requested_chunks.set(chunk);
+					}
+
+					return;
+				}
+
 				/* Whatever the value is, we're being told to stop sending */
 				if (strncmp(name, "_HASH_CHECK", sizeof(name)) == 0) {
 
@@ -191,6 +210,11 @@ MavlinkParametersManager::handle_message(const mavlink_message_t *msg)
 						memcpy(&param_value.param_value, &hash, sizeof(hash));
 						mavlink_msg_param_value_send_struct(_mavlink.get_channel(), &param_value);
 
+					} else if (strncmp(req_read.param_id, HASH_CHUNKS_PARAM, MAVLINK_MSG_PARAM_VALUE_FIELD_PARAM_ID_LEN) == 0) {
+						/* root and chunk hashes for cached params, sent by send_chunk_hash() */
+						compute_chunk_hashes();
+						_send_chunk_hash_index = 0;
+
 					} else {
 						/* local name buffer to enforce null-terminated string */
 						char name[MAVLINK_MSG_PARAM_VALUE_FIELD_PARAM_ID_LEN + 1];
@@ -347,6 +371,12 @@ MavlinkParametersManager::send_params()
 	if (send_one()) {
 		return true;
 
+	} else if (send_chunk_hash()) {
+		return true;
+
+	} else if (send_requested_chunk()) {
+		return true;
+
 	} else if (send_untransmitted()) {
 		return true;
 	}
@@ -459,6 +489,136 @@ MavlinkParametersManager::send_one()
 	return false;
 }
 
+void
+MavlinkParametersManager::compute_chunk_hashes()
+{
+	if (_chunk_hashes == nullptr) {
+		_chunk_hashes = new uint32_t[PARAM_HASH_MAX_CHUNKS];
+		_chunk_used_end = new uint16_t[PARAM_HASH_MAX_CHUNKS];
+
+		if ((_chunk_hashes == nullptr) || (_chunk_used_end == nullptr)) {
+			delete[] _chunk_hashes;
+			delete[] _chunk_used_end;
+			_chunk_hashes = nullptr;
+			_chunk_used_end = nullptr;
+			_chunk_count = 0;
+			return;
+		}
+	}
+
+	memset(_chunk_hashes, 0, PARAM_HASH_MAX_CHUNKS * sizeof(uint32_t));
+	memset(_chunk_used_end, 0, PARAM_HASH_MAX_CHUNKS * sizeof(uint16_t));
+
+	// chunks are keyed by the parameter index, a parameter becoming used only changes its own chunk
+	unsigned count = param_count();
+
+	if (count > PARAM_HASH_MAX_CHUNKS * PARAM_HASH_CHUNK_SIZE) {
+		count = PARAM_HASH_MAX_CHUNKS * PARAM_HASH_CHUNK_SIZE;
+	}
+
+	_chunk_count = (count + PARAM_HASH_CHUNK_SIZE - 1) / PARAM_HASH_CHUNK_SIZE;
+
+	uint16_t used_index = 0;
+
+	for (unsigned i = 0; i < count; i++) {
+		const param_t param = param_for_index(i);
+		const int chunk = i / PARAM_HASH_CHUNK_SIZE;
+
+		if (param_used(param)) {
+			// same as param_hash_check(): name followed by the 4 value bytes, but including volatile
+			// parameters so that a client can compute the hashes from its cache
+			const char *name = param_name(param);
+			int32_t value = 0;
+			param_get(param, &value);
+
+			_chunk_hashes[chunk] = crc32part((const uint8_t *)name, strlen(name), _chunk_hashes[chunk]);
+			_chunk_hashes[chunk] = crc32part((const uint8_t *)&value, param_size(param), _chunk_hashes[chunk]);
+			used_index++;
+		}
+
+		_chunk_used_end[chunk] = used_index;
+	}
+}
+
+bool
+MavlinkParametersManager::send_chunk_hash()
+{
+	if ((_send_chunk_hash_index < 0) || (_chunk_hashes == nullptr)) {
+		return false;
+	}
+
+	mavlink_param_value_t msg{};
+	msg.param_type = MAV_PARAM_TYPE_UINT32;
+
+	if (_send_chunk_hash_index == 0) {
+		const uint32_t root = crc32part((const uint8_t *)_chunk_hashes, _chunk_count * sizeof(uint32_t), 0);
+		msg.param_count = _chunk_count;
+		msg.param_index = PARAM_HASH_CHUNK_SIZE;
+		strncpy(msg.param_id, HASH_CHUNKS_PARAM, MAVLINK_MSG_PARAM_VALUE_FIELD_PARAM_ID_LEN);
+		memcpy(&msg.param_value, &root, sizeof(root));
+
+	} else {
+		const int chunk = _send_chunk_hash_index - 1;
+		msg.param_count = _chunk_used_end[chunk];
+		msg.param_index = chunk;
+		strncpy(msg.param_id, HASH_CHUNK_PARAM, MAVLINK_MSG_PARAM_VALUE_FIELD_PARAM_ID_LEN);
+		memcpy(&msg.param_value, &_chunk_hashes[chunk], sizeof(uint32_t));
+	}
+
+	mavlink_msg_param_value_send_struct(_mavlink.get_channel(), &msg);
+
+	if (++_send_chunk_hash_index > _chunk_count) {
+		_send_chunk_hash_index = -1;
+	}
+
+	return true;
+}
+
+param_t
+MavlinkParametersManager::next_chunk_param(unsigned index) const
+{
+	for (; index < _send_chunk_end; index++) {
+		const param_t param = param_for_index(index);
+
+		if (param == PARAM_INVALID) {
+			break;
+		}
+
+		if (param_used(param)) {
+			return param;
+		}
+	}
+
+	return PARAM_INVALID;
+}
+
+bool
+MavlinkParametersManager::send_requested_chunk()
+{
+	// start the next requested chunk, skipping the ones without used parameters
+	while (_send_chunk_param == PARAM_INVALID) {
+		int chunk = 0;
+
+		while ((chunk < PARAM_HASH_MAX_CHUNKS) && !_requested_chunks[chunk]) {
+			chunk++;
+		}
+
+		if (chunk >= PARAM_HASH_MAX_CHUNKS) {
+			return false;
+		}
+
+		_requested_chunks.set(chunk, false);
+		_send_chunk_end = (chunk + 1) * PARAM_HASH_CHUNK_SIZE;
+		_send_chunk_param = next_chunk_param(chunk * PARAM_HASH_CHUNK_SIZE);
+	}
+
+	send_param(_send_chunk_param);
+
+	_send_chunk_param = next_chunk_param(_send_chunk_param + 1);
+
+	return true;
+}
+
 int
 MavlinkParametersManager::send_param(param_t param, int component_id)
 {
@@ -42,6 +42,7 @@
 
 #pragma once
 
+#include <containers/Bitset.hpp>
 #include <parameters/param.h>
 
 #include "mavlink_bridge_header.h"
@@ -65,7 +66,7 @@ class MavlinkParametersManager
 {
 public:
 	explicit MavlinkParametersManager(Mavlink &mavlink);
-	~MavlinkParametersManager() = default;
+	~MavlinkParametersManager();
 
 	/**
 	 * Handle sending of messages. Call this regularly at a fixed frequency.
@@ -101,6 +102,34 @@ protected:
 
 	int send_param(param_t param, int component_id = -1);
 
+	/**
+	 * Hash synchronization for clients with a cached parameter set.
+	 *
+	 * The parameters are split into chunks of PARAM_HASH_CHUNK_SIZE by their (global) index, so
+	 * that a parameter becoming used or unused only changes the hash of its own chunk.
+	 * The hash of a chunk is the CRC32 over the names and values of its used parameters, computed
+	 * the same way as param_hash_check() but including volatile parameters. The root hash is
+	 * the CRC32 over all chunk hashes.
+	 *
+	 * PARAM_REQUEST_READ of _HASH_CHUNKS (index -1) replies with PARAM_VALUE _HASH_CHUNKS
+	 * (value: root hash, index: chunk size, count: number of chunks), followed by one _HASH_CHUNK
+	 * per chunk (value: chunk hash, index: chunk, count: used index of the end of the chunk).
+	 * The used parameters of chunk n are the used indices from the end of chunk n-1 to the end of chunk n.
+	 * PARAM_SET of _HASH_CHUNK with the chunk index as UINT32 value sends the parameters of a chunk.
+	 */
+	void compute_chunk_hashes();
+
+	/// send the next chunk hash if requested
+	/// @return true if a message was sent
+	bool send_chunk_hash();
+
+	/// send the next parameter of a requested chunk
+	/// @return true if a parameter was sent
+	bool send_requested_chunk();
+
+	/// first used parameter from index to the end of the current chunk
+	param_t next_chunk_param(unsigned index) const;
+
 #if defined(CONFIG_MAVLINK_UAVCAN_PARAMETERS)
 	/**
 	 * Send UAVCAN params
@@ -155,6 +184,17 @@ protected:
 	uORB::Publication<rc_parameter_map_s>	_rc_param_map_pub{ORB_ID(rc_parameter_map)};
 	rc_parameter_map_s _rc_param_map{};
 
+	static constexpr int PARAM_HASH_CHUNK_SIZE{32};
+	static constexpr int PARAM_HASH_MAX_CHUNKS{128};
+
+	uint32_t *_chunk_hashes{nullptr};	///< allocated on the first request
+	uint16_t *_chunk_used_end{nullptr};	///< used index of the end of each chunk
+	int _chunk_count{0};
+	int _send_chunk_hash_index{-1};		///< next chunk hash message, 0 for the root, -1 if none
+	px4::Bitset<PARAM_HASH_MAX_CHUNKS> _requested_chunks{};
+	unsigned _send_chunk_end{0};		///< parameter index of the end of the current chunk
+	param_t _send_chunk_param{PARAM_INVALID};	///< next parameter of the current chunk
+
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 	hrt_abstime _param_update_time{0};
 	int _param_update_index{0};
@@ -155,3 +155,105 @@ PARAM_DEFINE_INT32(MAV_HB_FORW_EN, 1);
  * @max 250
  */
 PARAM_DEFINE_INT32(MAV_RADIO_TOUT, 5);
+
+/**
+ * Closed loop telemetry rate control
+ *
+ * If enabled, the link bandwidth is estimated from the TX buffer overruns, the TX buffer
+ * reported by the radio (RADIO_STATUS) and the timesync round trip time, and is allocated to
+ * the streams by priority weight (MAV_RATE_W_*). Otherwise all streams are scaled uniformly
+ * to the configured data rate.
+ *
+ * @boolean
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_RATE_CTL, 0);
+
+/**
+ * Rate control weight of the high priority streams
+ *
+ * High priority streams are e.g. HEARTBEAT, SYS_STATUS and ATTITUDE. Under bandwidth shortage
+ * the streams of a class are reduced in proportion to the inverse of its weight.
+ *
+ * @min 0
+ * @max 100
+ * @decimal 1
+ * @group MAVLink
+ */
+PARAM_DEFINE_FLOAT(MAV_RATE_W_HIGH, 10.f);
+
+/**
+ * Rate control weight of the normal priority streams
+ *
+ * @min 0
+ * @max 100
+ * @decimal 1
+ * @group MAVLink
+ */
+PARAM_DEFINE_FLOAT(MAV_RATE_W_NORM, 3.f);
+
+/**
+ * Rate control weight of the low priority streams
+ *
+ * Low priority streams carry bulk data, e.g. HIGHRES_IMU and DEBUG_VECT.
+ *
+ * @min 0
+ * @max 100
+ * @decimal 1
+ * @group MAVLink
+ */
+PARAM_DEFINE_FLOAT(MAV_RATE_W_LOW, 1.f);
+
+/**
+ * Rate control latency threshold
+ *
+ * Increase of the timesync round trip time above the lowest one seen, that is
+ * considered as link congestion.
+ *
+ * @unit ms
+ * @min 10
+ * @max 5000
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_RATE_RTT, 250);
+
+/**
+ * Mission transfer window
+ *
+ * Number of mission items that are requested ahead during a mission upload.
+ * Items received out of order within the window are kept until the missing ones arrive.
+ * During a download, the same number of items is read ahead from the storage.
+ * Set to 1 to request one item at a time (the protocol behavior before windowed transfers).
+ *
+ * @min 1
+ * @max 16
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_MIS_WINDOW, 1);
+
+/**
+ * High latency telemetry encoding
+ *
+ * Messages sent in iridium mode. The compact encoding sends HIGH_LATENCY_COMPACT messages
+ * with delta encoded reports, see Tools/mavlink_high_latency_decode.py. Both can be sent to
+ * compare the data volume. The compact encoding requires the development dialect.
+ *
+ * @value 0 HIGH_LATENCY2
+ * @value 1 Compact
+ * @value 2 Both
+ * @reboot_required true
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_HL_ENCODING, 0);
+
+/**
+ * High latency telemetry keyframe interval
+ *
+ * Number of compact reports after which a complete report is sent, unless a newer
+ * report was acknowledged by the ground station.
+ *
+ * @min 1
+ * @max 31
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_HL_KEYFRAME, 10);
@@ -133,207 +133,210 @@ MavlinkReceiver::acknowledge(uint8_t sysid, uint8_t compid, uint16_t command, ui
 }
 
 void
-MavlinkReceiver::handle_message(mavlink_message_t *msg)
-{
-	switch (msg->msgid) {
-	case MAVLINK_MSG_ID_COMMAND_LONG:
-		handle_message_command_long(msg);
-		break;
-
-	case MAVLINK_MSG_ID_COMMAND_INT:
-		handle_message_command_int(msg);
-		break;
-
-	case MAVLINK_MSG_ID_COMMAND_ACK:
-		handle_message_command_ack(msg);
-		break;
-
-	case MAVLINK_MSG_ID_OPTICAL_FLOW_RAD:
-		handle_message_optical_flow_rad(msg);
-		break;
-
-	case MAVLINK_MSG_ID_PING:
-		handle_message_ping(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_MODE:
-		handle_message_set_mode(msg);
-		break;
-
-	case MAVLINK_MSG_ID_ATT_POS_MOCAP:
-		handle_message_att_pos_mocap(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED:
-		handle_message_set_position_target_local_ned(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT:
-		handle_message_set_position_target_global_int(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_ATTITUDE_TARGET:
-		handle_message_set_attitude_target(msg);
-		break;
-
-	case MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE:
-		handle_message_vision_position_estimate(msg);
-		break;
-
-	case MAVLINK_MSG_ID_ODOMETRY:
-		handle_message_odometry(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN:
-		handle_message_set_gps_global_origin(msg);
-		break;
-
-	case MAVLINK_MSG_ID_RADIO_STATUS:
-		handle_message_radio_status(msg);
-		break;
-
-	case MAVLINK_MSG_ID_MANUAL_CONTROL:
-		handle_message_manual_control(msg);
-		break;
+MavlinkReceiver::init_message_handlers()
+{
+	_message_handlers_count = 0;
+	memset(_message_handler_index, 0, sizeof(_message_handler_index));
+
+	if (_mavlink.get_mode() == Mavlink::MAVLINK_MODE::MAVLINK_MODE_GIMBAL) {
+		add_message_handler(MAVLINK_MSG_ID_HEARTBEAT, &MavlinkReceiver::handle_message_heartbeat);
+		add_message_handler(MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE, &MavlinkReceiver::handle_message_gimbal_manager_set_attitude);
+		add_message_handler(MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL,
+				    &MavlinkReceiver::handle_message_gimbal_manager_set_manual_control);
+		add_message_handler(MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION, &MavlinkReceiver::handle_message_gimbal_device_information);
+		add_message_handler(MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS,
+				    &MavlinkReceiver::handle_message_gimbal_device_attitude_status);
+		return;
+	}
 
-	case MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE:
-		handle_message_rc_channels_override(msg);
-		break;
+	add_message_handler(MAVLINK_MSG_ID_COMMAND_LONG, &MavlinkReceiver::handle_message_command_long);
+	add_message_handler(MAVLINK_MSG_ID_COMMAND_INT, &MavlinkReceiver::handle_message_command_int);
+	add_message_handler(MAVLINK_MSG_ID_COMMAND_ACK, &MavlinkReceiver::handle_message_command_ack);
+	add_message_handler(MAVLINK_MSG_ID_OPTICAL_FLOW_RAD, &MavlinkReceiver::handle_message_optical_flow_rad);
+	add_message_handler(MAVLINK_MSG_ID_PING, &MavlinkReceiver::handle_message_ping);
+	add_message_handler(MAVLINK_MSG_ID_SET_MODE, &MavlinkReceiver::handle_message_set_mode);
+	add_message_handler(MAVLINK_MSG_ID_ATT_POS_MOCAP, &MavlinkReceiver::handle_message_att_pos_mocap);
+	add_message_handler(MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED,
+			    &MavlinkReceiver::handle_message_set_position_target_local_ned);
+	add_message_handler(MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT,
+			    &MavlinkReceiver::handle_message_set_position_target_global_int);
+	add_message_handler(MAVLINK_MSG_ID_SET_ATTITUDE_TARGET, &MavlinkReceiver::handle_message_set_attitude_target);
+	add_message_handler(MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE, &MavlinkReceiver::handle_message_vision_position_estimate);
+	add_message_handler(MAVLINK_MSG_ID_ODOMETRY, &MavlinkReceiver::handle_message_odometry);
+	add_message_handler(MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN, &MavlinkReceiver::handle_message_set_gps_global_origin);
+	add_message_handler(MAVLINK_MSG_ID_RADIO_STATUS, &MavlinkReceiver::handle_message_radio_status);
+	add_message_handler(MAVLINK_MSG_ID_MANUAL_CONTROL, &MavlinkReceiver::handle_message_manual_control);
+	add_message_handler(MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE, &MavlinkReceiver::handle_message_rc_channels_override);
+	add_message_handler(MAVLINK_MSG_ID_HEARTBEAT, &MavlinkReceiver::handle_message_heartbeat);
+	add_message_handler(MAVLINK_MSG_ID_DISTANCE_SENSOR, &MavlinkReceiver::handle_message_distance_sensor);
+	add_message_handler(MAVLINK_MSG_ID_FOLLOW_TARGET, &MavlinkReceiver::handle_message_follow_target);
+	add_message_handler(MAVLINK_MSG_ID_LANDING_TARGET, &MavlinkReceiver::handle_message_landing_target);
+	add_message_handler(MAVLINK_MSG_ID_CELLULAR_STATUS, &MavlinkReceiver::handle_message_cellular_status);
+	add_message_handler(MAVLINK_MSG_ID_ADSB_VEHICLE, &MavlinkReceiver::handle_message_adsb_vehicle);
+	add_message_handler(MAVLINK_MSG_ID_GPS_RTCM_DATA, &MavlinkReceiver::handle_message_gps_rtcm_data);
+	add_message_handler(MAVLINK_MSG_ID_BATTERY_STATUS, &MavlinkReceiver::handle_message_battery_status);
+	add_message_handler(MAVLINK_MSG_ID_SERIAL_CONTROL, &MavlinkReceiver::handle_message_serial_control);
+	add_message_handler(MAVLINK_MSG_ID_LOGGING_ACK, &MavlinkReceiver::handle_message_logging_ack);
+	add_message_handler(MAVLINK_MSG_ID_PLAY_TUNE, &MavlinkReceiver::handle_message_play_tune);
+	add_message_handler(MAVLINK_MSG_ID_PLAY_TUNE_V2, &MavlinkReceiver::handle_message_play_tune_v2);
+	add_message_handler(MAVLINK_MSG_ID_OBSTACLE_DISTANCE, &MavlinkReceiver::handle_message_obstacle_distance);
+	add_message_handler(MAVLINK_MSG_ID_TUNNEL, &MavlinkReceiver::handle_message_tunnel);
+	add_message_handler(MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS, &MavlinkReceiver::handle_message_onboard_computer_status);
+	add_message_handler(MAVLINK_MSG_ID_GENERATOR_STATUS, &MavlinkReceiver::handle_message_generator_status);
+	add_message_handler(MAVLINK_MSG_ID_STATUSTEXT, &MavlinkReceiver::handle_message_statustext);
+	add_message_handler(MAVLINK_MSG_ID_OPEN_DRONE_ID_OPERATOR_ID, &MavlinkReceiver::handle_message_open_drone_id_operator_id);
+	add_message_handler(MAVLINK_MSG_ID_OPEN_DRONE_ID_SELF_ID, &MavlinkReceiver::handle_message_open_drone_id_self_id);
+	add_message_handler(MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM, &MavlinkReceiver::handle_message_open_drone_id_system);
 
-	case MAVLINK_MSG_ID_HEARTBEAT:
-		handle_message_heartbeat(msg);
-		break;
+#if !defined(CONSTRAINED_FLASH)
+	add_message_handler(MAVLINK_MSG_ID_NAMED_VALUE_FLOAT, &MavlinkReceiver::handle_message_named_value_float);
+	add_message_handler(MAVLINK_MSG_ID_NAMED_VALUE_INT, &MavlinkReceiver::handle_message_named_value_int);
+	add_message_handler(MAVLINK_MSG_ID_DEBUG, &MavlinkReceiver::handle_message_debug);
+	add_message_handler(MAVLINK_MSG_ID_DEBUG_VECT, &MavlinkReceiver::handle_message_debug_vect);
+	add_message_handler(MAVLINK_MSG_ID_DEBUG_FLOAT_ARRAY, &MavlinkReceiver::handle_message_debug_float_array);
+#endif // !CONSTRAINED_FLASH
 
-	case MAVLINK_MSG_ID_DISTANCE_SENSOR:
-		handle_message_distance_sensor(msg);
-		break;
+	add_message_handler(MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE, &MavlinkReceiver::handle_message_gimbal_manager_set_attitude);
+	add_message_handler(MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL,
+			    &MavlinkReceiver::handle_message_gimbal_manager_set_manual_control);
+	add_message_handler(MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION, &MavlinkReceiver::handle_message_gimbal_device_information);
+	add_message_handler(MAVLINK_MSG_ID_REQUEST_EVENT, &MavlinkReceiver::handle_message_request_event);
+	add_message_handler(MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS,
+			    &MavlinkReceiver::handle_message_gimbal_device_attitude_status);
 
-	case MAVLINK_MSG_ID_FOLLOW_TARGET:
-		handle_message_follow_target(msg);
-		break;
+#if defined(MAVLINK_MSG_ID_SET_VELOCITY_LIMITS) // For now only defined if development.xml is used
+	add_message_handler(MAVLINK_MSG_ID_SET_VELOCITY_LIMITS, &MavlinkReceiver::handle_message_set_velocity_limits);
+#endif
 
-	case MAVLINK_MSG_ID_LANDING_TARGET:
-		handle_message_landing_target(msg);
-		break;
+#if defined(MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT_ACK) // Only defined if development.xml is used
+	add_message_handler(MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT_ACK, &MavlinkReceiver::handle_message_high_latency_compact_ack);
+#endif
 
-	case MAVLINK_MSG_ID_CELLULAR_STATUS:
-		handle_message_cellular_status(msg);
-		break;
+	// HIL messages, only decoded in HIL mode (checked per message, HIL can be enabled at runtime)
+	add_message_handler(MAVLINK_MSG_ID_HIL_SENSOR, &MavlinkReceiver::handle_message_hil);
+	add_message_handler(MAVLINK_MSG_ID_HIL_STATE_QUATERNION, &MavlinkReceiver::handle_message_hil);
+	add_message_handler(MAVLINK_MSG_ID_HIL_OPTICAL_FLOW, &MavlinkReceiver::handle_message_hil);
+	add_message_handler(MAVLINK_MSG_ID_HIL_GPS, &MavlinkReceiver::handle_message_hil);
+
+	// mission manager
+	add_message_handler(MAVLINK_MSG_ID_MISSION_ACK, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_SET_CURRENT, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_REQUEST_LIST, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_REQUEST, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_REQUEST_INT, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_COUNT, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_ITEM, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_ITEM_INT, &MavlinkReceiver::handle_message_mission);
+	add_message_handler(MAVLINK_MSG_ID_MISSION_CLEAR_ALL, &MavlinkReceiver::handle_message_mission);
+
+	// parameter component
+	add_message_handler(MAVLINK_MSG_ID_PARAM_REQUEST_LIST, &MavlinkReceiver::handle_message_parameters);
+	add_message_handler(MAVLINK_MSG_ID_PARAM_SET, &MavlinkReceiver::handle_message_parameters);
+	add_message_handler(MAVLINK_MSG_ID_PARAM_REQUEST_READ, &MavlinkReceiver::handle_message_parameters);
+	add_message_handler(MAVLINK_MSG_ID_PARAM_MAP_RC, &MavlinkReceiver::handle_message_parameters);
 
-	case MAVLINK_MSG_ID_ADSB_VEHICLE:
-		handle_message_adsb_vehicle(msg);
-		break;
+	if (_mavlink.ftp_enabled()) {
+		add_message_handler(MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL, &MavlinkReceiver::handle_message_ftp);
+	}
 
-	case MAVLINK_MSG_ID_GPS_RTCM_DATA:
-		handle_message_gps_rtcm_data(msg);
-		break;
+	// log component
+	add_message_handler(MAVLINK_MSG_ID_LOG_REQUEST_LIST, &MavlinkReceiver::handle_message_log);
+	add_message_handler(MAVLINK_MSG_ID_LOG_REQUEST_DATA, &MavlinkReceiver::handle_message_log);
+	add_message_handler(MAVLINK_MSG_ID_LOG_REQUEST_END, &MavlinkReceiver::handle_message_log);
+	add_message_handler(MAVLINK_MSG_ID_LOG_ERASE, &MavlinkReceiver::handle_message_log);
 
-	case MAVLINK_MSG_ID_BATTERY_STATUS:
-		handle_message_battery_status(msg);
-		break;
+	// timesync component
+	add_message_handler(MAVLINK_MSG_ID_TIMESYNC, &MavlinkReceiver::handle_message_timesync);
+	add_message_handler(MAVLINK_MSG_ID_SYSTEM_TIME, &MavlinkReceiver::handle_message_timesync);
+}
 
-	case MAVLINK_MSG_ID_SERIAL_CONTROL:
-		handle_message_serial_control(msg);
-		break;
+void
+MavlinkReceiver::add_message_handler(uint32_t msg_id, MessageHandlerFunction function)
+{
+	if (_message_handlers_count >= MAX_MESSAGE_HANDLERS) {
+		PX4_ERR("too many message handlers, msgid %" PRIu32 " not handled", msg_id);
+		return;
+	}
 
-	case MAVLINK_MSG_ID_LOGGING_ACK:
-		handle_message_logging_ack(msg);
-		break;
+	unsigned slot = message_handler_hash(msg_id);
 
-	case MAVLINK_MSG_ID_PLAY_TUNE:
-		handle_message_play_tune(msg);
-		break;
+	while (_message_handler_index[slot] != 0) {
+		if (_message_handlers[_message_handler_index[slot] - 1].msg_id == msg_id) {
+			PX4_ERR("duplicate message handler for msgid %" PRIu32, msg_id);
+			return;
+		}
 
-	case MAVLINK_MSG_ID_PLAY_TUNE_V2:
-		handle_message_play_tune_v2(msg);
-		break;
+		slot = (slot + 1) & (MESSAGE_HANDLER_INDEX_SIZE - 1);
+	}
 
-	case MAVLINK_MSG_ID_OBSTACLE_DISTANCE:
-		handle_message_obstacle_distance(msg);
-		break;
+	MessageHandler &handler = _message_handlers[_message_handlers_count];
+	handler = {};
+	handler.function = function;
+	handler.msg_id = msg_id;
 
-	case MAVLINK_MSG_ID_TUNNEL:
-		handle_message_tunnel(msg);
-		break;
+	_message_handler_index[slot] = ++_message_handlers_count;
+}
 
-	case MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS:
-		handle_message_onboard_computer_status(msg);
-		break;
+MavlinkReceiver::MessageHandler *
+MavlinkReceiver::find_message_handler(uint32_t msg_id)
+{
+	// open addressing with linear probing, the index is less than half full
+	unsigned slot = message_handler_hash(msg_id);
 
-	case MAVLINK_MSG_ID_GENERATOR_STATUS:
-		handle_message_generator_status(msg);
-		break;
+	while (_message_handler_index[slot] != 0) {
+		MessageHandler &handler = _message_handlers[_message_handler_index[slot] - 1];
 
-	case MAVLINK_MSG_ID_STATUSTEXT:
-		handle_message_statustext(msg);
-		break;
+		if (handler.msg_id == msg_id) {
+			return &handler;
+		}
 
-	case MAVLINK_MSG_ID_OPEN_DRONE_ID_OPERATOR_ID:
-		handle_message_open_drone_id_operator_id(msg);
-		break;
+		slot = (slot + 1) & (MESSAGE_HANDLER_INDEX_SIZE - 1);
+	}
 
-	case MAVLINK_MSG_ID_OPEN_DRONE_ID_SELF_ID:
-		handle_message_open_drone_id_self_id(msg);
-		break;
+	return nullptr;
+}
 
-	case MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM:
-		handle_message_open_drone_id_system(msg);
-		break;
+void
+MavlinkReceiver::handle_message(mavlink_message_t *msg)
+{
+	MessageHandler *handler = find_message_handler(msg->msgid);
 
+	if (handler) {
 #if !defined(CONSTRAINED_FLASH)
-
-	case MAVLINK_MSG_ID_NAMED_VALUE_FLOAT:
-		handle_message_named_value_float(msg);
-		break;
-
-	case MAVLINK_MSG_ID_NAMED_VALUE_INT:
-		handle_message_named_value_int(msg);
-		break;
-
-	case MAVLINK_MSG_ID_DEBUG:
-		handle_message_debug(msg);
-		break;
-
-	case MAVLINK_MSG_ID_DEBUG_VECT:
-		handle_message_debug_vect(msg);
-		break;
-
-	case MAVLINK_MSG_ID_DEBUG_FLOAT_ARRAY:
-		handle_message_debug_float_array(msg);
-		break;
+		const hrt_abstime start = hrt_absolute_time();
 #endif // !CONSTRAINED_FLASH
 
-	case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE:
-		handle_message_gimbal_manager_set_attitude(msg);
-		break;
+		(this->*handler->function)(msg);
 
-	case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL:
-		handle_message_gimbal_manager_set_manual_control(msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION:
-		handle_message_gimbal_device_information(msg);
-		break;
-
-	case MAVLINK_MSG_ID_REQUEST_EVENT:
-		handle_message_request_event(msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS:
-		handle_message_gimbal_device_attitude_status(msg);
-		break;
+#if !defined(CONSTRAINED_FLASH)
+		const uint32_t elapsed_us = hrt_elapsed_time(&start);
+		handler->received++;
+		handler->total_time_us += elapsed_us;
 
-#if defined(MAVLINK_MSG_ID_SET_VELOCITY_LIMITS) // For now only defined if development.xml is used
+		if (elapsed_us > handler->max_time_us) {
+			handler->max_time_us = elapsed_us;
+		}
 
-	case MAVLINK_MSG_ID_SET_VELOCITY_LIMITS:
-		handle_message_set_velocity_limits(msg);
-		break;
-#endif
+	} else {
+		_unhandled_messages++;
+#endif // !CONSTRAINED_FLASH
+	}
 
-	default:
-		break;
+	if (!_mavlink.boot_complete() && (_mavlink.get_mode() != Mavlink::MAVLINK_MODE::MAVLINK_MODE_GIMBAL)) {
+		// make sure mavlink app has booted before we start processing parameter sync
+		if (hrt_elapsed_time(&_mavlink.get_first_start_time()) > 20_s) {
+			PX4_ERR("system boot did not complete in 20 seconds");
+			_mavlink.set_boot_complete();
+		}
 	}
 
+	/* handle packet with parent object */
+	_mavlink.handle_message(msg);
+}
+
+void
+MavlinkReceiver::handle_message_hil(mavlink_message_t *msg)
+{
 	/*
 	 * Only decode hil messages in HIL mode.
 	 *
@@ -363,75 +366,49 @@ MavlinkReceiver::handle_message(mavlink_message_t *msg)
 		}
 	}
 
-
 	if (_mavlink.get_hil_enabled() || (_mavlink.get_use_hil_gps() && msg->sysid == mavlink_system.sysid)) {
-		switch (msg->msgid) {
-		case MAVLINK_MSG_ID_HIL_GPS:
+		if (msg->msgid == MAVLINK_MSG_ID_HIL_GPS) {
 			handle_message_hil_gps(msg);
-			break;
-
-		default:
-			break;
 		}
-
 	}
+}
 
+void
+MavlinkReceiver::handle_message_mission(mavlink_message_t *msg)
+{
 	/* handle packet with mission manager */
 	_mission_manager.handle_message(msg);
+}
 
+void
+MavlinkReceiver::handle_message_parameters(mavlink_message_t *msg)
+{
 	/* handle packet with parameter component */
 	if (_mavlink.boot_complete()) {
 		// make sure mavlink app has booted before we start processing parameter sync
 		_parameters_manager.handle_message(msg);
-
-	} else {
-		if (hrt_elapsed_time(&_mavlink.get_first_start_time()) > 20_s) {
-			PX4_ERR("system boot did not complete in 20 seconds");
-			_mavlink.set_boot_complete();
-		}
 	}
+}
 
-	if (_mavlink.ftp_enabled()) {
-		/* handle packet with ftp component */
-		_mavlink_ftp.handle_message(msg);
-	}
+void
+MavlinkReceiver::handle_message_ftp(mavlink_message_t *msg)
+{
+	/* handle packet with ftp component */
+	_mavlink_ftp.handle_message(msg);
+}
 
+void
+MavlinkReceiver::handle_message_log(mavlink_message_t *msg)
+{
 	/* handle packet with log component */
 	_mavlink_log_handler.handle_message(msg);
-
-	/* handle packet with timesync component */
-	_mavlink_timesync.handle_message(msg);
-
-	/* handle packet with parent object */
-	_mavlink.handle_message(msg);
 }
 
-void MavlinkReceiver::handle_messages_in_gimbal_mode(mavlink_message_t &msg)
+void
+MavlinkReceiver::handle_message_timesync(mavlink_message_t *msg)
 {
-	switch (msg.msgid) {
-	case MAVLINK_MSG_ID_HEARTBEAT:
-		handle_message_heartbeat(&msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE:
-		handle_message_gimbal_manager_set_attitude(&msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL:
-		handle_message_gimbal_manager_set_manual_control(&msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION:
-		handle_message_gimbal_device_information(&msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS:
-		handle_message_gimbal_device_attitude_status(&msg);
-		break;
-	}
-
-	// Message forwarding
-	_mavlink.handle_message(&msg);
+	/* handle packet with timesync component */
+	_mavlink_timesync.handle_message(msg);
 }
 
 bool
@@ -1285,6 +1262,20 @@ MavlinkReceiver::handle_message_set_gps_global_origin(mavlink_message_t *msg)
 	handle_request_message_command(MAVLINK_MSG_ID_GPS_GLOBAL_ORIGIN);
 }
 
+#if defined(MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT_ACK) // Only defined if development.xml is used
+void MavlinkReceiver::handle_message_high_latency_compact_ack(mavlink_message_t *msg)
+{
+	mavlink_high_latency_compact_ack_t ack;
+	mavlink_msg_high_latency_compact_ack_decode(msg, &ack);
+
+	if (ack.target_system != 0 && ack.target_system != _mavlink.get_system_id()) {
+		return;
+	}
+
+	_mavlink.acknowledge_high_latency_report(ack.seq);
+}
+#endif // MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT_ACK
+
 #if defined(MAVLINK_MSG_ID_SET_VELOCITY_LIMITS) // For now only defined if development.xml is used
 void MavlinkReceiver::handle_message_set_velocity_limits(mavlink_message_t *msg)
 {
@@ -3116,6 +3107,8 @@ MavlinkReceiver::run()
 		px4_prctl(PR_SET_NAME, thread_name, px4_getpid());
 	}
 
+	init_message_handlers();
+
 	// poll timeout in ms. Also defines the max update frequency of the mission & param manager, etc.
 	const int timeout = 10;
 
@@ -3129,7 +3122,6 @@ MavlinkReceiver::run()
 	/* the serial port buffers internally as well, we just need to fit a small chunk */
 	uint8_t buf[64];
 #endif
-	mavlink_message_t msg;
 
 	struct pollfd fds[1] = {};
 
@@ -3139,16 +3131,69 @@ MavlinkReceiver::run()
 	}
 
 #if defined(MAVLINK_UDP)
-	struct sockaddr_in srcaddr = {};
-	socklen_t addrlen = sizeof(srcaddr);
 
 	if (_mavlink.get_protocol() == Protocol::UDP) {
 		fds[0].fd = _mavlink.get_socket_fd();
 		fds[0].events = POLLIN;
 	}
 
+	auto update_client_source_address = [this](const sockaddr_in & source_address) {
+		struct sockaddr_in &srcaddr_last = _mavlink.get_client_source_address();
+
+		int localhost = (127 << 24) + 1;
+
+		if (!_mavlink.get_client_source_initialized()) {
+
+			// set the address either if localhost or if 3 seconds have passed
+			// this ensures that a GCS running on localhost can get a hold of
+			// the system within the first N seconds
+			hrt_abstime stime = _mavlink.get_start_time();
+
+			if ((stime != 0 && (hrt_elapsed_time(&stime) > 3_s))
+			    || (srcaddr_last.sin_addr.s_addr == htonl(localhost))) {
+
+				srcaddr_last.sin_addr.s_addr = source_address.sin_addr.s_addr;
+				srcaddr_last.sin_port = source_address.sin_port;
+
+				_mavlink.set_client_source_initialized();
+
+				PX4_INFO("partner IP: %s", inet_ntoa(source_address.sin_addr));
+			}
+		}
+	};
+
+#endif // MAVLINK_UDP
+
+#if defined(MAVLINK_UDP)
+	struct sockaddr_in srcaddr = {};
+	socklen_t addrlen = sizeof(srcaddr);
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_UDP_RECVMMSG)
+	// receive up to RX_BATCH_MAX_DATAGRAMS datagrams per wakeup. Datagrams on localhost aren't bound by the MTU,
+	// so each slot fits the largest datagram a single recvfrom() into buf accepts.
+	static constexpr unsigned RX_BATCH_MAX_DATAGRAMS = 5;
+	static constexpr unsigned RX_DATAGRAM_SIZE = sizeof(buf);
+
+	uint8_t *rx_batch_buf = nullptr;
+	struct sockaddr_in rx_addr[RX_BATCH_MAX_DATAGRAMS] {};
+	struct iovec rx_iov[RX_BATCH_MAX_DATAGRAMS] {};
+	struct mmsghdr rx_msgs[RX_BATCH_MAX_DATAGRAMS] {};
+
+	if (_mavlink.get_protocol() == Protocol::UDP) {
+		// falls back to recvfrom() if the allocation fails
+		rx_batch_buf = new uint8_t[RX_BATCH_MAX_DATAGRAMS * RX_DATAGRAM_SIZE];
+
+		if (rx_batch_buf != nullptr) {
+			for (unsigned i = 0; i < RX_BATCH_MAX_DATAGRAMS; i++) {
+				rx_iov[i].iov_base = &rx_batch_buf[i * RX_DATAGRAM_SIZE];
+				rx_iov[i].iov_len = RX_DATAGRAM_SIZE;
+			}
+		}
+	}
+
+#endif // MAVLINK_UDP_RECVMMSG
+
 	ssize_t nread = 0;
 	hrt_abstime last_send_update = 0;
 
@@ -3174,102 +3219,88 @@ MavlinkReceiver::run()
 				if (nread == -1 && errno == ENOTCONN) { // Not connected (can happen for USB)
 					usleep(100000);
 				}
+
+				/* if read failed, nothing is parsed */
+				parse_bytes(buf, nread);
 			}
 
 #if defined(MAVLINK_UDP)
 
 			else if (_mavlink.get_protocol() == Protocol::UDP) {
-				if (fds[0].revents & POLLIN) {
-					nread = recvfrom(_mavlink.get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr, &addrlen);
-				}
-
-				struct sockaddr_in &srcaddr_last = _mavlink.get_client_source_address();
-
-				int localhost = (127 << 24) + 1;
+				nread = 0;
 
-				if (!_mavlink.get_client_source_initialized()) {
+# if defined(MAVLINK_UDP_RECVMMSG)
 
-					// set the address either if localhost or if 3 seconds have passed
-					// this ensures that a GCS running on localhost can get a hold of
-					// the system within the first N seconds
-					hrt_abstime stime = _mavlink.get_start_time();
+				if (rx_batch_buf != nullptr) {
+					int datagrams = 0;
 
-					if ((stime != 0 && (hrt_elapsed_time(&stime) > 3_s))
-					    || (srcaddr_last.sin_addr.s_addr == htonl(localhost))) {
-
-						srcaddr_last.sin_addr.s_addr = srcaddr.sin_addr.s_addr;
-						srcaddr_last.sin_port = srcaddr.sin_port;
-
-						_mavlink.set_client_source_initialized();
+					if (fds[0].revents & POLLIN) {
+						for (unsigned i = 0; i < RX_BATCH_MAX_DATAGRAMS; i++) {
+							rx_msgs[i].msg_hdr.msg_name = &rx_addr[i];
+							rx_msgs[i].msg_hdr.msg_namelen = sizeof(rx_addr[i]);
+							rx_msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+							rx_msgs[i].msg_hdr.msg_iovlen = 1;
+						}
 
-						PX4_INFO("partner IP: %s", inet_ntoa(srcaddr.sin_addr));
+						datagrams = recvmmsg(_mavlink.get_socket_fd(), rx_msgs, RX_BATCH_MAX_DATAGRAMS, MSG_DONTWAIT, nullptr);
 					}
-				}
-			}
 
-			// only start accepting messages on UDP once we're sure who we talk to
-			if (_mavlink.get_protocol() != Protocol::UDP || _mavlink.get_client_source_initialized()) {
-#endif // MAVLINK_UDP
-
-				/* if read failed, this loop won't execute */
-				for (ssize_t i = 0; i < nread; i++) {
-					if (mavlink_parse_char(_mavlink.get_channel(), buf[i], &msg, &_status)) {
+					for (int i = 0; i < datagrams; i++) {
+						update_client_source_address(rx_addr[i]);
 
-						/* check if we received version 2 and request a switch. */
-						if (!(_mavlink.get_status()->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)) {
-							/* this will only switch to proto version 2 if allowed in settings */
-							_mavlink.set_proto_version(2);
+						// only start accepting messages on UDP once we're sure who we talk to
+						if (_mavlink.get_client_source_initialized()) {
+							parse_datagram(&rx_batch_buf[i * RX_DATAGRAM_SIZE], rx_msgs[i].msg_len);
+							nread += rx_msgs[i].msg_len;
 						}
+					}
 
-						switch (_mavlink.get_mode()) {
-						case Mavlink::MAVLINK_MODE::MAVLINK_MODE_GIMBAL:
-							handle_messages_in_gimbal_mode(msg);
-							break;
+				} else
+# endif // MAVLINK_UDP_RECVMMSG
+				{
+					ssize_t len = 0;
 
-						default:
-							handle_message(&msg);
-							break;
-						}
+					if (fds[0].revents & POLLIN) {
+						len = recvfrom(_mavlink.get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr, &addrlen);
+					}
 
-						_mavlink.set_has_received_messages(true); // Received first message, unlock wait to transmit '-w' command-line flag
-						update_rx_stats(msg);
+					update_client_source_address(srcaddr);
 
-						if (_message_statistics_enabled) {
-							update_message_statistics(msg);
-						}
+					// only start accepting messages on UDP once we're sure who we talk to
+					if (_mavlink.get_client_source_initialized() && (len > 0)) {
+						parse_datagram(buf, len);
+						nread = len;
 					}
 				}
+			}
 
-				/* count received bytes (nread will be -1 on read error) */
-				if (nread > 0) {
-					_mavlink.count_rxbytes(nread);
+#endif // MAVLINK_UDP
 
-					telemetry_status_s &tstatus = _mavlink.telemetry_status();
-					tstatus.rx_message_count = _total_received_counter;
-					tstatus.rx_message_lost_count = _total_lost_counter;
-					tstatus.rx_message_lost_rate = static_cast<float>(_total_lost_counter) / static_cast<float>(_total_received_counter);
+			/* count received bytes (nread will be -1 on read error) */
+			if (nread > 0) {
+				_mavlink.count_rxbytes(nread);
 
-					if (_mavlink_status_last_buffer_overrun != _status.buffer_overrun) {
-						tstatus.rx_buffer_overruns++;
-						_mavlink_status_last_buffer_overrun = _status.buffer_overrun;
-					}
+				telemetry_status_s &tstatus = _mavlink.telemetry_status();
+				tstatus.rx_message_count = _total_received_counter;
+				tstatus.rx_message_lost_count = _total_lost_counter;
+				tstatus.rx_message_lost_rate = static_cast<float>(_total_lost_counter) / static_cast<float>(_total_received_counter);
 
-					if (_mavlink_status_last_parse_error != _status.parse_error) {
-						tstatus.rx_parse_errors++;
-						_mavlink_status_last_parse_error = _status.parse_error;
-					}
+				if (_mavlink_status_last_buffer_overrun != _status.buffer_overrun) {
+					tstatus.rx_buffer_overruns++;
+					_mavlink_status_last_buffer_overrun = _status.buffer_overrun;
+				}
 
-					if (_mavlink_status_last_packet_rx_drop_count != _status.packet_rx_drop_count) {
-						tstatus.rx_packet_drop_count++;
-						_mavlink_status_last_packet_rx_drop_count = _status.packet_rx_drop_count;
-					}
+				if (_mavlink_status_last_parse_error != _status.parse_error) {
+					tstatus.rx_parse_errors++;
+					_mavlink_status_last_parse_error = _status.parse_error;
 				}
 
-#if defined(MAVLINK_UDP)
+				if (_mavlink_status_last_packet_rx_drop_count != _status.packet_rx_drop_count) {
+					tstatus.rx_packet_drop_count++;
+					_mavlink_status_last_packet_rx_drop_count = _status.packet_rx_drop_count;
+				}
 			}
 
-#endif // MAVLINK_UDP
-
 		} else if (ret == -1) {
 			usleep(10000);
 		}
@@ -3298,6 +3329,74 @@ MavlinkReceiver::run()
 			_tune_publisher->publish_next_tune(t);
 		}
 	}
+
+#if defined(MAVLINK_UDP_RECVMMSG)
+	delete[] rx_batch_buf;
+#endif // MAVLINK_UDP_RECVMMSG
+}
+
+void MavlinkReceiver::parse_bytes(const uint8_t *buf, ssize_t len)
+{
+	mavlink_message_t msg;
+
+	for (ssize_t i = 0; i < len; i++) {
+		if (mavlink_parse_char(_mavlink.get_channel(), buf[i], &msg, &_status)) {
+			handle_received_message(msg);
+		}
+	}
+}
+
+void MavlinkReceiver::parse_datagram(const uint8_t *buf, size_t len)
+{
+	mavlink_status_t &status = *_mavlink.get_status();
+	mavlink_message_t msg;
+	size_t i = 0;
+
+	// datagrams normally contain complete frames, validate them at once unless the byte wise parser
+	// is in the middle of a frame or signature verification is required
+	while ((i < len) && (status.parse_state <= MAVLINK_PARSE_STATE_IDLE) && (status.signing == nullptr)) {
+		const size_t frame_len = MavlinkFrameParser::parse(&buf[i], len - i, msg);
+
+		if (frame_len == 0) {
+			break;
+		}
+
+		// same channel status updates as mavlink_parse_char()
+		if (msg.magic == MAVLINK_STX_MAVLINK1) {
+			status.flags |= MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+
+		} else {
+			status.flags &= ~MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+		}
+
+		status.current_rx_seq = msg.seq;
+		status.packet_rx_success_count++;
+
+		handle_received_message(msg);
+		i += frame_len;
+	}
+
+	// partial or corrupted frames go through the byte wise parser, which resynchronizes
+	parse_bytes(&buf[i], len - i);
+}
+
+void MavlinkReceiver::handle_received_message(mavlink_message_t &msg)
+{
+	/* check if we received version 2 and request a switch. */
+	if (!(_mavlink.get_status()->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)) {
+		/* this will only switch to proto version 2 if allowed in settings */
+		_mavlink.set_proto_version(2);
+	}
+
+	// the message handlers are selected by the mode in init_message_handlers()
+	handle_message(&msg);
+
+	_mavlink.set_has_received_messages(true); // Received first message, unlock wait to transmit '-w' command-line flag
+	update_rx_stats(msg);
+
+	if (_message_statistics_enabled) {
+		update_message_statistics(msg);
+	}
 }
 
 bool MavlinkReceiver::component_was_seen(int system_id, int component_id)
@@ -3479,6 +3578,39 @@ void MavlinkReceiver::print_detailed_rx_stats() const
 			}
 		}
 	}
+
+#if !defined(CONSTRAINED_FLASH)
+	// message handlers sorted by accumulated execution time
+	uint8_t order[MAX_MESSAGE_HANDLERS];
+	int count = 0;
+
+	for (int i = 0; i < _message_handlers_count; i++) {
+		if (_message_handlers[i].received > 0) {
+			int j = count++;
+
+			while ((j > 0) && (_message_handlers[order[j - 1]].total_time_us < _message_handlers[i].total_time_us)) {
+				order[j] = order[j - 1];
+				j--;
+			}
+
+			order[j] = i;
+		}
+	}
+
+	if (count > 0 || _unhandled_messages > 0) {
+		printf("	Message handlers (%" PRIu8 " registered, %" PRIu32 " messages without handler):
+", _message_handlers_count,
+		       _unhandled_messages);
+
+		for (int i = 0; i < count; i++) {
+			const MessageHandler &handler = _message_handlers[order[i]];
+			printf("	  msgid:%5" PRIu32 ", received:%8" PRIu32 ", total:%9.1f ms, avg:%7.1f us, max:%6" PRIu32 " us\n",
+			       handler.msg_id, handler.received, (double)(handler.total_time_us / 1e3),
+			       (double)handler.total_time_us / handler.received, handler.max_time_us);
+		}
+	}
+
+#endif // !CONSTRAINED_FLASH
 }
 
 void MavlinkReceiver::start()
@@ -46,6 +46,7 @@
 #include "mavlink_ftp.h"
 #include "mavlink_log_handler.h"
 #include "mavlink_mission.h"
+#include "MavlinkFrameParser.hpp"
 #include "mavlink_parameters.h"
 #include "MavlinkStatustextHandler.hpp"
 #include "mavlink_timesync.h"
@@ -154,8 +155,51 @@ private:
 	uint8_t handle_request_message_command(uint16_t message_id, float param2 = 0.0f, float param3 = 0.0f,
 					       float param4 = 0.0f, float param5 = 0.0f, float param6 = 0.0f, float param7 = 0.0f);
 
+	/**
+	 * Parse a byte stream with mavlink_parse_char() and handle the received messages
+	 */
+	void parse_bytes(const uint8_t *buf, ssize_t len);
+
+	/**
+	 * Parse a UDP datagram, the complete frames are parsed at once
+	 */
+	void parse_datagram(const uint8_t *buf, size_t len);
+
+	void handle_received_message(mavlink_message_t &msg);
+
+	using MessageHandlerFunction = void (MavlinkReceiver::*)(mavlink_message_t *msg);
+
+	struct MessageHandler {
+		MessageHandlerFunction function{nullptr};
+		uint32_t msg_id{0};
+#if !defined(CONSTRAINED_FLASH)
+		uint32_t received{0};		///< number of handled messages
+		uint32_t max_time_us{0};	///< longest handler execution time
+		uint64_t total_time_us{0};	///< accumulated handler execution time
+#endif // !CONSTRAINED_FLASH
+	};
+
+	/**
+	 * Build the msgid to handler table for the enabled features and the mode of the instance
+	 */
+	void init_message_handlers();
+	void add_message_handler(uint32_t msg_id, MessageHandlerFunction function);
+	MessageHandler *find_message_handler(uint32_t msg_id);
+
+	static unsigned message_handler_hash(uint32_t msg_id)
+	{
+		// Fibonacci hashing, the upper bits are well distributed
+		return (msg_id * 2654435761u) >> (32 - MESSAGE_HANDLER_INDEX_BITS);
+	}
+
 	void handle_message(mavlink_message_t *msg);
-	void handle_messages_in_gimbal_mode(mavlink_message_t &msg);
+
+	void handle_message_hil(mavlink_message_t *msg);
+	void handle_message_mission(mavlink_message_t *msg);
+	void handle_message_parameters(mavlink_message_t *msg);
+	void handle_message_ftp(mavlink_message_t *msg);
+	void handle_message_log(mavlink_message_t *msg);
+	void handle_message_timesync(mavlink_message_t *msg);
 
 	void handle_message_adsb_vehicle(mavlink_message_t *msg);
 	void handle_message_att_pos_mocap(mavlink_message_t *msg);
@@ -202,6 +246,9 @@ private:
 	void handle_message_utm_global_position(mavlink_message_t *msg);
 #if defined(MAVLINK_MSG_ID_SET_VELOCITY_LIMITS) // For now only defined if development.xml is used
 	void handle_message_set_velocity_limits(mavlink_message_t *msg);
+#endif
+#if defined(MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT_ACK) // Only defined if development.xml is used
+	void handle_message_high_latency_compact_ack(mavlink_message_t *msg);
 #endif
 	void handle_message_vision_position_estimate(mavlink_message_t *msg);
 	void handle_message_gimbal_manager_set_attitude(mavlink_message_t *msg);
@@ -285,6 +332,19 @@ private:
 	ReceivedMessageStats *_received_msg_stats{nullptr};
 #endif // !CONSTRAINED_FLASH
 
+	static constexpr int MAX_MESSAGE_HANDLERS{96};
+	static constexpr unsigned MESSAGE_HANDLER_INDEX_BITS{8};
+	static constexpr unsigned MESSAGE_HANDLER_INDEX_SIZE{1u << MESSAGE_HANDLER_INDEX_BITS};
+	static_assert(MESSAGE_HANDLER_INDEX_SIZE >= 2 * MAX_MESSAGE_HANDLERS, "message handler index too small");
+	static_assert(MAX_MESSAGE_HANDLERS < UINT8_MAX, "message handler index entries are uint8_t");
+
+	MessageHandler _message_handlers[MAX_MESSAGE_HANDLERS] {};
+	uint8_t _message_handler_index[MESSAGE_HANDLER_INDEX_SIZE] {}; ///< msgid hash -> handler + 1, 0 if empty
+	uint8_t _message_handlers_count{0};
+#if !defined(CONSTRAINED_FLASH)
+	uint32_t _unhandled_messages{0}; ///< messages without handler, only forwarded
+#endif // !CONSTRAINED_FLASH
+
 	uint64_t _total_received_counter{0};                            ///< The total number of successfully received messages
 	uint64_t _total_lost_counter{0};                                ///< Total messages lost during transmission.
 
@@ -85,7 +85,7 @@ MavlinkStream::update(const hrt_abstime &t)
 	int interval = _interval;
 
 	if (!const_rate()) {
-		interval /= _mavlink->get_rate_mult();
+		interval /= _mavlink->get_rate_mult(priority());
 	}
 
 	// We don't need to send anything if the inverval is 0. send() will be called manually.
@@ -128,3 +128,31 @@ MavlinkStream::update(const hrt_abstime &t)
 
 	return -1;
 }
+
+hrt_abstime
+MavlinkStream::get_next_update_time(const hrt_abstime &t)
+{
+	if (_last_sent == 0) {
+		return t;
+	}
+
+	int interval = _interval;
+
+	if (!const_rate()) {
+		interval /= _mavlink->get_rate_mult(priority());
+	}
+
+	if (interval <= 0) {
+		return t;
+	}
+
+	// same condition as in update()
+	const int64_t next = (int64_t)_last_sent + interval - (_mavlink->get_main_loop_delay() / 10) * 3 + 1;
+
+	if (next > (int64_t)t) {
+		return next;
+	}
+
+	// due, but send() had nothing to send: check for new data again after a quarter of the interval
+	return t + interval / 4;
+}
@@ -52,6 +52,17 @@ class MavlinkStream : public ListNode<MavlinkStream *>
 
 public:
 
+	/**
+	 * Order in which due streams are updated, higher priority streams get the link bandwidth first
+	 */
+	enum class Priority : uint8_t {
+		High,
+		Normal,
+		Low		///< bulk data, deferred while the TX buffer can't hold the message
+	};
+
+	static constexpr int PRIORITY_COUNT = 3;
+
 	MavlinkStream(Mavlink *mavlink);
 	virtual ~MavlinkStream() = default;
 
@@ -87,6 +98,23 @@ public:
 	 */
 	virtual bool const_rate() { return false; }
 
+	virtual Priority priority() const { return Priority::Normal; }
+
+	/**
+	 * @return true if update_data() has to be called at every iteration, the stream
+	 * is then updated in every loop instead of only when it is due
+	 */
+	virtual bool high_rate_update() const { return false; }
+
+	/**
+	 * Get the time at which update() should be called next, based on the last time a message
+	 * was sent and the interval scaled by the rate multiplier
+	 *
+	 * @param t current time
+	 * @return t if the stream is due now
+	 */
+	hrt_abstime get_next_update_time(const hrt_abstime &t);
+
 	/**
 	 * Get maximal total messages size on update
 	 */
@@ -0,0 +1,216 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file mavlink_stream_scheduler.cpp
+ * Deadline ordered update of the streams of a Mavlink instance.
+ */
+
+#include "mavlink_stream_scheduler.h"
+#include "mavlink_main.h"
+
+MavlinkStreamScheduler::~MavlinkStreamScheduler()
+{
+	delete[] _heap;
+	delete[] _polled;
+	delete[] _due;
+}
+
+bool
+MavlinkStreamScheduler::schedule(List<MavlinkStream *> &streams, const hrt_abstime &t)
+{
+	const unsigned count = streams.size();
+
+	if (count > _capacity) {
+		delete[] _heap;
+		delete[] _polled;
+		delete[] _due;
+
+		_heap = new Entry[count];
+		_polled = new MavlinkStream *[count];
+		_due = new MavlinkStream *[count];
+
+		if ((_heap == nullptr) || (_polled == nullptr) || (_due == nullptr)) {
+			delete[] _heap;
+			delete[] _polled;
+			delete[] _due;
+			_heap = nullptr;
+			_polled = nullptr;
+			_due = nullptr;
+			_capacity = 0;
+			return false;
+		}
+
+		_capacity = count;
+	}
+
+	_heap_size = 0;
+	_polled_count = 0;
+
+	for (const auto &stream : streams) {
+		if (polled(stream)) {
+			_polled[_polled_count++] = stream;
+
+		} else if (stream->get_interval() != 0) {
+			push({stream->get_next_update_time(t), stream});
+		}
+	}
+
+	for (int i = 0; i < MavlinkStream::PRIORITY_COUNT; i++) {
+		_rate_mult[i] = _mavlink.get_rate_mult((MavlinkStream::Priority)i);
+	}
+
+	_valid = true;
+
+	return true;
+}
+
+void
+MavlinkStreamScheduler::update(List<MavlinkStream *> &streams, const hrt_abstime &t)
+{
+	for (int i = 0; i < MavlinkStream::PRIORITY_COUNT; i++) {
+		const float rate_mult = _mavlink.get_rate_mult((MavlinkStream::Priority)i);
+
+		if (rate_mult < _rate_mult[i]) {
+			// lower rates only make the scheduled streams due early, they are rescheduled after the update
+			_rate_mult[i] = rate_mult;
+
+		} else if (rate_mult > _rate_mult[i] * 1.1f) {
+			// higher rates move the deadlines of the scaled streams forward
+			_valid = false;
+		}
+	}
+
+	if (!_valid && !schedule(streams, t)) {
+		// out of memory, update all streams
+		for (const auto &stream : streams) {
+			stream->update(t);
+		}
+
+		return;
+	}
+
+	unsigned due_count = 0;
+
+	for (unsigned i = 0; i < _polled_count; i++) {
+		_due[due_count++] = _polled[i];
+	}
+
+	while ((_heap_size > 0) && (_heap[0].due <= t)) {
+		_due[due_count++] = pop().stream;
+	}
+
+	// insertion sort by priority, streams of the same priority stay in deadline order
+	for (unsigned i = 1; i < due_count; i++) {
+		MavlinkStream *stream = _due[i];
+		unsigned j = i;
+
+		for (; (j > 0) && (_due[j - 1]->priority() > stream->priority()); j--) {
+			_due[j] = _due[j - 1];
+		}
+
+		_due[j] = stream;
+	}
+
+	for (unsigned i = 0; i < due_count; i++) {
+		MavlinkStream *stream = _due[i];
+
+		if ((stream->priority() == MavlinkStream::Priority::Low) && (_mavlink.get_free_tx_buf() < stream->get_size())) {
+			// leave the remaining TX buffer to the more important streams, try again in the next iteration
+			if (!polled(stream)) {
+				push({t, stream});
+			}
+
+			continue;
+		}
+
+		stream->update(t);
+
+		if (!polled(stream)) {
+			push({stream->get_next_update_time(t), stream});
+		}
+	}
+}
+
+void
+MavlinkStreamScheduler::push(const Entry &entry)
+{
+	unsigned i = _heap_size++;
+
+	while (i > 0) {
+		const unsigned parent = (i - 1) / 2;
+
+		if (_heap[parent].due <= entry.due) {
+			break;
+		}
+
+		_heap[i] = _heap[parent];
+		i = parent;
+	}
+
+	_heap[i] = entry;
+}
+
+MavlinkStreamScheduler::Entry
+MavlinkStreamScheduler::pop()
+{
+	const Entry top = _heap[0];
+	const Entry last = _heap[--_heap_size];
+	unsigned i = 0;
+
+	while (true) {
+		unsigned child = 2 * i + 1;
+
+		if (child >= _heap_size) {
+			break;
+		}
+
+		if ((child + 1 < _heap_size) && (_heap[child + 1].due < _heap[child].due)) {
+			child++;
+		}
+
+		if (last.due <= _heap[child].due) {
+			break;
+		}
+
+		_heap[i] = _heap[child];
+		i = child;
+	}
+
+	if (_heap_size > 0) {
+		_heap[i] = last;
+	}
+
+	return top;
+}
@@ -0,0 +1,107 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file mavlink_stream_scheduler.h
+ * Deadline ordered update of the streams of a Mavlink instance.
+ *
+ * The streams are kept in a min-heap on the time they are due next, so that the main loop
+ * only updates the streams which are due instead of all of them. Due streams are updated
+ * in order of priority, so that under bandwidth shortage the important messages (HEARTBEAT,
+ * ATTITUDE) are written to the TX buffer first.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <containers/List.hpp>
+
+#include "mavlink_stream.h"
+
+class Mavlink;
+
+class MavlinkStreamScheduler
+{
+public:
+	explicit MavlinkStreamScheduler(Mavlink &mavlink) : _mavlink(mavlink) {}
+	~MavlinkStreamScheduler();
+
+	// no copy, assignment, move, move assignment
+	MavlinkStreamScheduler(const MavlinkStreamScheduler &) = delete;
+	MavlinkStreamScheduler &operator=(const MavlinkStreamScheduler &) = delete;
+	MavlinkStreamScheduler(MavlinkStreamScheduler &&) = delete;
+	MavlinkStreamScheduler &operator=(MavlinkStreamScheduler &&) = delete;
+
+	/**
+	 * Schedule the streams again on the next update. Must be called whenever
+	 * a stream is added, removed or its interval changed.
+	 */
+	void invalidate() { _valid = false; }
+
+	/**
+	 * Update the streams which are due
+	 *
+	 * @param streams all streams of the instance
+	 * @param t current time
+	 */
+	void update(List<MavlinkStream *> &streams, const hrt_abstime &t);
+
+private:
+	struct Entry {
+		hrt_abstime due;
+		MavlinkStream *stream;
+	};
+
+	static bool polled(MavlinkStream *stream) { return stream->high_rate_update() || (stream->get_interval() < 0); }
+
+	bool schedule(List<MavlinkStream *> &streams, const hrt_abstime &t);
+
+	void push(const Entry &entry);
+	Entry pop();
+
+	Mavlink &_mavlink;
+
+	Entry *_heap{nullptr};
+	unsigned _heap_size{0};
+
+	MavlinkStream **_polled{nullptr};	///< streams updated at every iteration
+	unsigned _polled_count{0};
+
+	MavlinkStream **_due{nullptr};		///< streams due in the current iteration
+
+	unsigned _capacity{0};
+
+	float _rate_mult[MavlinkStream::PRIORITY_COUNT] {1.f, 1.f, 1.f};	///< rate multipliers the deadlines were computed with
+	bool _valid{false};
+};
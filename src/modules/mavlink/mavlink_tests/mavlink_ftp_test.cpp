@@ -57,6 +57,11 @@ static const char *_test_files[] = {
 constexpr uint32_t MAX_DATA_LEN = MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN - sizeof(
 		MavlinkFTP::PayloadHeader);
 
+// multi packet file for the windowed and concurrent burst tests, the last packet is partially filled
+static const char *_large_test_file = PX4_MAVLINK_TEST_DATA_DIR "/" "test_large.data";
+constexpr uint32_t LARGE_FILE_SIZE = 10 * MAX_DATA_LEN + 17;
+static uint8_t _large_file_bytes[LARGE_FILE_SIZE];
+
 const MavlinkFtpTest::DownloadTestCase MavlinkFtpTest::_rgDownloadTestCases[] = {
 	{ _test_files[0], MAX_DATA_LEN - 1, true, false },	// Read takes less than single packet
 	{ _test_files[1], MAX_DATA_LEN,	    true, true },	// Read completely fills single packet
@@ -137,6 +142,8 @@ bool MavlinkFtpTest::_remove_test_files()
 		::unlink(_test_files[i]);
 	}
 
+	::unlink(_large_test_file);
+
 	::rmdir(PX4_MAVLINK_TEST_DATA_DIR "/empty_dir");
 	::rmdir(PX4_MAVLINK_TEST_DATA_DIR);
 
@@ -644,6 +651,206 @@ bool MavlinkFtpTest::_burst_test()
 	return true;
 }
 
+/// @brief Tests that a burst request continuing at the end of the active burst slides its window
+bool MavlinkFtpTest::_burst_window_test()
+{
+	BurstCollector collector;
+	uint8_t session = 0;
+
+	ut_assert("create failed", _create_large_test_file(_large_file_bytes, LARGE_FILE_SIZE));
+	ut_assert("open failed", _open_session(_large_test_file, &session));
+
+	_collect_burst(&collector, _large_file_bytes, LARGE_FILE_SIZE);
+
+	// the second request is sent before the first burst is streamed
+	_send_burst(session, 0, 2 * MAX_DATA_LEN);
+	_send_burst(session, 2 * MAX_DATA_LEN, 3 * MAX_DATA_LEN);
+	_ftp_server->send();
+
+	ut_compare("Incorrect number of packets", collector.num_replies, 5);
+
+	for (int i = 0; i < collector.num_replies; i++) {
+		const BurstReply &reply = collector.replies[i];
+		ut_compare("Didn't get Ack back", reply.opcode, MavlinkFTP::kRspAck);
+		ut_compare("Session incorrect", reply.session, session);
+		ut_compare("Offset incorrect", reply.offset, i * MAX_DATA_LEN);
+		ut_compare("Payload size incorrect", reply.size, MAX_DATA_LEN);
+		ut_assert("File contents differ", reply.data_valid);
+		ut_compare("burst_complete incorrect", reply.burst_complete, i == 4);
+	}
+
+	// a window past the end of the file ends with Nak EOF
+	collector.num_replies = 0;
+	_send_burst(session, 5 * MAX_DATA_LEN, 100 * MAX_DATA_LEN);
+	_ftp_server->send();
+
+	ut_compare("Incorrect number of packets", collector.num_replies, 7);
+
+	for (int i = 0; i < 6; i++) {
+		const BurstReply &reply = collector.replies[i];
+		ut_compare("Didn't get Ack back", reply.opcode, MavlinkFTP::kRspAck);
+		ut_compare("Offset incorrect", reply.offset, (5 + i) * MAX_DATA_LEN);
+		ut_compare("Payload size incorrect", reply.size, (i == 5) ? 17 : MAX_DATA_LEN);
+		ut_assert("File contents differ", reply.data_valid);
+	}
+
+	ut_compare("Didn't get Nak back", collector.replies[6].opcode, MavlinkFTP::kRspNak);
+	ut_compare("Incorrect error code", collector.replies[6].error, MavlinkFTP::kErrEOF);
+	ut_compare("Burst still active", _ftp_server->get_size(), 0);
+
+	_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_generic, this);
+
+	return true;
+}
+
+/// @brief Tests that a burst request for an already streamed range only retransmits that range
+bool MavlinkFtpTest::_burst_retransmit_test()
+{
+	BurstCollector collector;
+	uint8_t session = 0;
+
+	ut_assert("create failed", _create_large_test_file(_large_file_bytes, LARGE_FILE_SIZE));
+	ut_assert("open failed", _open_session(_large_test_file, &session));
+
+	_collect_burst(&collector, _large_file_bytes, LARGE_FILE_SIZE);
+
+	// request the lost range [1, 2] packets + 10 bytes while the 5th packet is next
+	collector.request_after = 4;
+	collector.request_session = session;
+	collector.request_offset = MAX_DATA_LEN;
+	collector.request_length = MAX_DATA_LEN + 10;
+
+	_send_burst(session, 0, 8 * MAX_DATA_LEN);
+	_ftp_server->send();
+
+	// the retransmission is sent before the window continues
+	static constexpr struct {
+		uint32_t offset;
+		uint8_t size;
+	} expected[] = {
+		{0, MAX_DATA_LEN}, {MAX_DATA_LEN, MAX_DATA_LEN}, {2 * MAX_DATA_LEN, MAX_DATA_LEN}, {3 * MAX_DATA_LEN, MAX_DATA_LEN},
+		{MAX_DATA_LEN, MAX_DATA_LEN}, {2 * MAX_DATA_LEN, 10},
+		{4 * MAX_DATA_LEN, MAX_DATA_LEN}, {5 * MAX_DATA_LEN, MAX_DATA_LEN}, {6 * MAX_DATA_LEN, MAX_DATA_LEN}, {7 * MAX_DATA_LEN, MAX_DATA_LEN},
+	};
+
+	constexpr int num_expected = sizeof(expected) / sizeof(expected[0]);
+	ut_compare("Incorrect number of packets", collector.num_replies, num_expected);
+
+	for (int i = 0; i < num_expected; i++) {
+		const BurstReply &reply = collector.replies[i];
+		ut_compare("Didn't get Ack back", reply.opcode, MavlinkFTP::kRspAck);
+		ut_compare("Offset incorrect", reply.offset, expected[i].offset);
+		ut_compare("Payload size incorrect", reply.size, expected[i].size);
+		ut_assert("File contents differ", reply.data_valid);
+		ut_compare("burst_complete incorrect", reply.burst_complete, i == num_expected - 1);
+	}
+
+	_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_generic, this);
+
+	return true;
+}
+
+/// @brief Tests bursts of several sessions at once
+bool MavlinkFtpTest::_burst_concurrent_test()
+{
+	BurstCollector collector;
+	uint8_t sessions[MavlinkFTP::kMaxSessions];
+	const MavlinkFTP::PayloadHeader *reply;
+
+	ut_assert("create failed", _create_large_test_file(_large_file_bytes, LARGE_FILE_SIZE));
+
+	for (int i = 0; i < MavlinkFTP::kMaxSessions; i++) {
+		ut_assert("open failed", _open_session(_large_test_file, &sessions[i]));
+	}
+
+	// all sessions in use
+	MavlinkFTP::PayloadHeader payload {};
+	payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+	payload.size = strlen(_large_test_file) + 1;
+
+	bool success = _send_receive_msg(&payload, (const uint8_t *)_large_test_file, payload.size, &reply);
+
+	if (!success) {
+		return false;
+	}
+
+	ut_compare("Didn't get Nak back", reply->opcode, MavlinkFTP::kRspNak);
+	ut_compare("Incorrect error code", reply->data[0], MavlinkFTP::kErrNoSessionsAvailable);
+
+	_collect_burst(&collector, _large_file_bytes, LARGE_FILE_SIZE);
+
+	for (int i = 0; i < MavlinkFTP::kMaxSessions; i++) {
+		_send_burst(sessions[i], 0, LARGE_FILE_SIZE);
+	}
+
+	_ftp_server->send();
+
+	constexpr int packets_per_session = LARGE_FILE_SIZE / MAX_DATA_LEN + 1;
+	ut_compare("Incorrect number of packets", collector.num_replies, MavlinkFTP::kMaxSessions * packets_per_session);
+
+	// the sessions are interleaved and each one gets the complete file in order
+	uint32_t next_offset[MavlinkFTP::kMaxSessions] {};
+
+	for (int i = 0; i < collector.num_replies; i++) {
+		const BurstReply &burst_reply = collector.replies[i];
+		ut_compare("Didn't get Ack back", burst_reply.opcode, MavlinkFTP::kRspAck);
+		ut_assert("File contents differ", burst_reply.data_valid);
+		ut_assert("Session out of range", burst_reply.session < MavlinkFTP::kMaxSessions);
+
+		if (i > 0 && MavlinkFTP::kMaxSessions > 1) {
+			ut_assert("Sessions not interleaved", burst_reply.session != collector.replies[i - 1].session);
+		}
+
+		ut_compare("Offset incorrect", burst_reply.offset, next_offset[burst_reply.session]);
+		next_offset[burst_reply.session] += burst_reply.size;
+		ut_compare("burst_complete incorrect", burst_reply.burst_complete,
+			   next_offset[burst_reply.session] == LARGE_FILE_SIZE);
+	}
+
+	for (int i = 0; i < MavlinkFTP::kMaxSessions; i++) {
+		ut_compare("File incomplete", next_offset[sessions[i]], LARGE_FILE_SIZE);
+	}
+
+	_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_generic, this);
+
+	return true;
+}
+
+/// @brief Tests a burst of a file that was truncated after it was opened
+bool MavlinkFtpTest::_burst_truncated_test()
+{
+	BurstCollector collector;
+	uint8_t session = 0;
+
+	ut_assert("create failed", _create_large_test_file(_large_file_bytes, LARGE_FILE_SIZE));
+	ut_assert("open failed", _open_session(_large_test_file, &session));
+
+	// e.g. a parameter file rewritten while it's downloaded
+	constexpr uint32_t truncated_size = 2 * MAX_DATA_LEN + 5;
+	ut_compare("truncate failed", ::truncate(_large_test_file, truncated_size), 0);
+
+	_collect_burst(&collector, _large_file_bytes, LARGE_FILE_SIZE);
+	_send_burst(session, 0, LARGE_FILE_SIZE);
+	_ftp_server->send();
+
+	ut_compare("Incorrect number of packets", collector.num_replies, 4);
+
+	for (int i = 0; i < 3; i++) {
+		const BurstReply &reply = collector.replies[i];
+		ut_compare("Didn't get Ack back", reply.opcode, MavlinkFTP::kRspAck);
+		ut_compare("Offset incorrect", reply.offset, i * MAX_DATA_LEN);
+		ut_compare("Payload size incorrect", reply.size, (i == 2) ? 5 : MAX_DATA_LEN);
+		ut_assert("File contents differ", reply.data_valid);
+	}
+
+	ut_compare("Didn't get Nak back", collector.replies[3].opcode, MavlinkFTP::kRspNak);
+	ut_compare("Incorrect error code", collector.replies[3].error, MavlinkFTP::kErrEOF);
+
+	_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_generic, this);
+
+	return true;
+}
+
 /// @brief Tests for correct reponse to a Read command on an invalid session.
 bool MavlinkFtpTest::_read_badsession_test()
 {
@@ -929,6 +1136,40 @@ bool MavlinkFtpTest::_receive_message_handler_burst(const mavlink_file_transfer_
 	return true;
 }
 
+/// Static method used as callback from MavlinkFTP to record the packets of one or several bursts.
+void MavlinkFtpTest::receive_message_handler_collect(const mavlink_file_transfer_protocol_t *ftp_req, void *worker_data)
+{
+	BurstCollector *collector = (BurstCollector *)worker_data;
+	collector->ftp_test_class->_receive_message_handler_collect(ftp_req, collector);
+}
+
+void MavlinkFtpTest::_receive_message_handler_collect(const mavlink_file_transfer_protocol_t *ftp_msg,
+		BurstCollector *collector)
+{
+	// stream packets continue the sequence of the burst request, don't check it here
+	const MavlinkFTP::PayloadHeader *reply = reinterpret_cast<const MavlinkFTP::PayloadHeader *>(ftp_msg->payload);
+
+	if (collector->num_replies < kMaxBurstReplies) {
+		BurstReply &burst_reply = collector->replies[collector->num_replies];
+		burst_reply.session = reply->session;
+		burst_reply.opcode = reply->opcode;
+		burst_reply.size = reply->size;
+		burst_reply.error = (reply->opcode == MavlinkFTP::kRspNak) ? reply->data[0] : 0;
+		burst_reply.burst_complete = reply->burst_complete;
+		burst_reply.offset = reply->offset;
+		burst_reply.data_valid = reply->opcode == MavlinkFTP::kRspAck
+					 && reply->offset + reply->size <= collector->file_size
+					 && memcmp(reply->data, &collector->file_bytes[reply->offset], reply->size) == 0;
+	}
+
+	collector->num_replies++;
+
+	if (collector->num_replies == collector->request_after) {
+		// e.g. a retransmission request of the client while the burst is streamed
+		_send_burst(collector->request_session, collector->request_offset, collector->request_length);
+	}
+}
+
 /// @brief Decode and validate the incoming message
 bool MavlinkFtpTest::_decode_message(const mavlink_file_transfer_protocol_t	*ftp_msg,	///< Incoming FTP message
 				     const MavlinkFTP::PayloadHeader		**payload)	///< Payload inside FTP message response
@@ -996,6 +1237,72 @@ bool MavlinkFtpTest::_send_receive_msg(MavlinkFTP::PayloadHeader	*payload_header
 	return _decode_message(&_reply_msg, payload_reply);
 }
 
+/// @brief Creates the large test file and returns its contents in bytes
+bool MavlinkFtpTest::_create_large_test_file(uint8_t *bytes, uint32_t size)
+{
+	for (uint32_t i = 0; i < size; i++) {
+		bytes[i] = (i * 7 + i / 256) & 0xff;
+	}
+
+	int fd = ::open(_large_test_file, O_CREAT | O_TRUNC | O_WRONLY, S_IRWXU | S_IRWXG | S_IRWXO);
+	ut_assert("Open failed", fd != -1);
+
+	int bytes_written = ::write(fd, bytes, size);
+	::close(fd);
+
+	ut_compare("Could not write test file", bytes_written, size);
+
+	return true;
+}
+
+/// @brief Opens a file for reading and returns its session
+bool MavlinkFtpTest::_open_session(const char *file, uint8_t *session)
+{
+	MavlinkFTP::PayloadHeader		payload {};
+	const MavlinkFTP::PayloadHeader		*reply;
+
+	payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+	payload.offset = 0;
+	payload.size = strlen(file) + 1;
+
+	bool success = _send_receive_msg(&payload, (const uint8_t *)file, payload.size, &reply);
+
+	if (!success) {
+		return false;
+	}
+
+	ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	*session = reply->session;
+
+	return true;
+}
+
+/// @brief Sends a burst request, replies are handled by the installed worker
+void MavlinkFtpTest::_send_burst(uint8_t session, uint32_t offset, uint32_t length)
+{
+	MavlinkFTP::PayloadHeader payload {};
+	mavlink_message_t msg;
+
+	payload.opcode = MavlinkFTP::kCmdBurstReadFile;
+	payload.session = session;
+	payload.offset = offset;
+	payload.size = sizeof(length);
+
+	_setup_ftp_msg(&payload, (const uint8_t *)&length, sizeof(length), &msg);
+	_ftp_server->handle_message(&msg);
+}
+
+/// @brief Installs the collect handler for bursts of a file
+void MavlinkFtpTest::_collect_burst(BurstCollector *collector, const uint8_t *bytes, uint32_t size)
+{
+	*collector = BurstCollector{};
+	collector->ftp_test_class = this;
+	collector->file_bytes = bytes;
+	collector->file_size = size;
+	collector->request_after = -1;
+	_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_collect, collector);
+}
+
 /// @brief Cleans up an files created on microsd during testing
 void MavlinkFtpTest::_cleanup_microsd()
 {
@@ -1017,6 +1324,10 @@ bool MavlinkFtpTest::run_tests()
 	ut_run_test(_read_test);
 	ut_run_test(_read_badsession_test);
 	ut_run_test(_burst_test);
+	ut_run_test(_burst_window_test);
+	ut_run_test(_burst_retransmit_test);
+	ut_run_test(_burst_concurrent_test);
+	ut_run_test(_burst_truncated_test);
 	ut_run_test(_removedirectory_test);
 	ut_run_test(_createdirectory_test);
 	ut_run_test(_removefile_test);
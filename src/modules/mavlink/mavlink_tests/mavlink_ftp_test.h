@@ -62,6 +62,34 @@ public:
 
 	static void receive_message_handler_burst(const mavlink_file_transfer_protocol_t *ftp_req, void *worker_data);
 
+	/// A burst reply recorded by the collect handler
+	struct BurstReply {
+		uint8_t		session;
+		uint8_t		opcode;
+		uint8_t		size;
+		uint8_t		error;
+		bool		burst_complete;
+		bool		data_valid;	///< Ack data matches the file contents at offset
+		uint32_t	offset;
+	};
+
+	static constexpr int kMaxBurstReplies = 48;
+
+	/// Worker data for the collect handler
+	struct BurstCollector {
+		MavlinkFtpTest		*ftp_test_class;
+		const uint8_t		*file_bytes;
+		uint32_t		file_size;
+		BurstReply		replies[kMaxBurstReplies];
+		int			num_replies;
+		int			request_after;	///< Send a burst request after this number of replies, -1 for none
+		uint8_t			request_session;
+		uint32_t		request_offset;
+		uint32_t		request_length;
+	};
+
+	static void receive_message_handler_collect(const mavlink_file_transfer_protocol_t *ftp_req, void *worker_data);
+
 	static const uint8_t serverSystemId = 50;	///< System ID for server
 	static const uint8_t serverComponentId = 1;	///< Component ID for server
 	static const uint8_t serverChannel = 0;		///< Channel to send to
@@ -90,6 +118,10 @@ private:
 	bool _read_test(void);
 	bool _read_badsession_test(void);
 	bool _burst_test(void);
+	bool _burst_window_test(void);
+	bool _burst_retransmit_test(void);
+	bool _burst_concurrent_test(void);
+	bool _burst_truncated_test(void);
 	bool _removedirectory_test(void);
 	bool _createdirectory_test(void);
 	bool _removefile_test(void);
@@ -104,6 +136,10 @@ private:
 			       const size_t			data_len,
 			       const MavlinkFTP::PayloadHeader	**payload_reply);
 	void _cleanup_microsd(void);
+	bool _create_large_test_file(uint8_t *bytes, uint32_t size);
+	bool _open_session(const char *file, uint8_t *session);
+	void _send_burst(uint8_t session, uint32_t offset, uint32_t length);
+	void _collect_burst(BurstCollector *collector, const uint8_t *bytes, uint32_t size);
 
 	/// A single download test case
 	struct DownloadTestCase {
@@ -125,6 +161,7 @@ private:
 	};
 
 	bool _receive_message_handler_burst(const mavlink_file_transfer_protocol_t *ftp_req, BurstInfo *burst_info);
+	void _receive_message_handler_collect(const mavlink_file_transfer_protocol_t *ftp_req, BurstCollector *collector);
 
 	MavlinkFTP	*_ftp_server;
 	Mavlink _mavlink;
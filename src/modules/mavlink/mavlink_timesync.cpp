@@ -73,6 +73,13 @@ MavlinkTimesync::handle_message(const mavlink_message_t *msg)
 			} else if (tsync.tc1 > 0) {		// Message originating from this system, compute time offset from it
 
 				_timesync.update(now, tsync.tc1, tsync.ts1);
+
+				// round trip time feedback for the rate controller
+				const uint64_t originate_us = tsync.ts1 / 1000ULL;
+
+				if ((tsync.ts1 > 0) && (originate_us <= now)) {
+					_mavlink.update_timesync_rtt(now - originate_us);
+				}
 			}
 
 			break;
@@ -52,6 +52,9 @@ public:
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
 
+	// update_data() collects data at every iteration
+	bool high_rate_update() const override { return true; }
+
 	unsigned get_size() override
 	{
 		return _had_dynamic_update ? MAVLINK_MSG_ID_AVAILABLE_MODES_MONITOR_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES : 0;
@@ -51,6 +51,8 @@ public:
 
 	bool const_rate() override { return true; }
 
+	Priority priority() const override { return Priority::High; }
+
 	unsigned get_size() override
 	{
 		return MAVLINK_MSG_ID_HEARTBEAT_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
@@ -72,6 +72,11 @@ public:
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
 
+	Priority priority() const override { return Priority::High; }
+
+	// update_data() collects data at every iteration
+	bool high_rate_update() const override { return true; }
+
 	unsigned get_size() override
 	{
 		return MAVLINK_MSG_ID_HIGH_LATENCY2_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
@@ -79,7 +84,7 @@ public:
 
 	bool const_rate() override { return true; }
 
-private:
+protected:
 	explicit MavlinkStreamHighLatency2(Mavlink *mavlink) :
 		MavlinkStream(mavlink),
 		_airspeed(SimpleAnalyzer::AVERAGE),
@@ -95,6 +100,35 @@ private:
 		reset_last_sent();
 	}
 
+	/**
+	 * Send a report, called at the stream rate when transmitting is allowed and the data was updated
+	 */
+	virtual void transmit(const mavlink_high_latency2_t &msg)
+	{
+		mavlink_msg_high_latency2_send_struct(_mavlink->get_channel(), &msg);
+	}
+
+	void update_data() override
+	{
+		const hrt_abstime t = hrt_absolute_time();
+
+		if (t > _last_update_time) {
+			// first order low pass filter for the update rate
+			_update_rate_filtered = 0.97f * _update_rate_filtered + 0.03f / ((t - _last_update_time) * 1e-6f);
+			_last_update_time = t;
+		}
+
+		update_airspeed();
+		update_tecs_status();
+		update_battery_status();
+		update_local_position();
+		update_gps();
+		update_vehicle_status();
+		update_wind();
+		update_vehicle_air_data();
+	}
+
+private:
 	struct PerBatteryData {
 		PerBatteryData(uint8_t instance) : subscription(ORB_ID(battery_status), instance) {}
 		uORB::Subscription subscription;
@@ -208,7 +242,7 @@ private:
 
 				reset_analysers(t);
 
-				mavlink_msg_high_latency2_send_struct(_mavlink->get_channel(), &msg);
+				transmit(msg);
 			}
 
 			return updated;
@@ -505,26 +539,6 @@ private:
 		return false;
 	}
 
-	void update_data() override
-	{
-		const hrt_abstime t = hrt_absolute_time();
-
-		if (t > _last_update_time) {
-			// first order low pass filter for the update rate
-			_update_rate_filtered = 0.97f * _update_rate_filtered + 0.03f / ((t - _last_update_time) * 1e-6f);
-			_last_update_time = t;
-		}
-
-		update_airspeed();
-		update_tecs_status();
-		update_battery_status();
-		update_local_position();
-		update_gps();
-		update_vehicle_status();
-		update_wind();
-		update_vehicle_air_data();
-	}
-
 	void update_airspeed()
 	{
 		airspeed_s airspeed;
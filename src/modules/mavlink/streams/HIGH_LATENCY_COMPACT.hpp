@@ -0,0 +1,165 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#ifndef HIGH_LATENCY_COMPACT_HPP
+#define HIGH_LATENCY_COMPACT_HPP
+
+#include "HIGH_LATENCY2.hpp"
+#include "../HighLatencyCodec.hpp"
+
+/**
+ * HIGH_LATENCY2 data delta encoded with high_latency::Encoder and sent as HIGH_LATENCY_COMPACT
+ * message, together with the flight mode changes and failures that occurred between the reports.
+ * The ground station acknowledges the decoded reports with HIGH_LATENCY_COMPACT_ACK.
+ */
+class MavlinkStreamHighLatencyCompact : public MavlinkStreamHighLatency2
+{
+public:
+	static MavlinkStream *new_instance(Mavlink *mavlink) { return new MavlinkStreamHighLatencyCompact(mavlink); }
+
+	static constexpr const char *get_name_static() { return "HIGH_LATENCY_COMPACT"; }
+	static constexpr uint16_t get_id_static() { return MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT; }
+
+	const char *get_name() const override { return get_name_static(); }
+	uint16_t get_id() override { return get_id_static(); }
+
+	unsigned get_size() override
+	{
+		return MAVLINK_MSG_ID_HIGH_LATENCY_COMPACT_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+	}
+
+private:
+	explicit MavlinkStreamHighLatencyCompact(Mavlink *mavlink) : MavlinkStreamHighLatency2(mavlink) {}
+
+	void transmit(const mavlink_high_latency2_t &msg) override
+	{
+		using high_latency::Field;
+
+		const int ack = _mavlink->take_high_latency_ack();
+
+		if (ack >= 0) {
+			_encoder.acknowledge(ack);
+		}
+
+		_encoder.set_keyframe_interval(_mavlink->get_high_latency_keyframe_interval());
+
+		high_latency::Report report{};
+		report[Field::Timestamp] = static_cast<int32_t>(msg.timestamp);
+		report[Field::Latitude] = msg.latitude;
+		report[Field::Longitude] = msg.longitude;
+		report[Field::Altitude] = msg.altitude;
+		report[Field::TargetAltitude] = msg.target_altitude;
+		report[Field::TargetDistance] = msg.target_distance;
+		report[Field::Heading] = msg.heading;
+		report[Field::TargetHeading] = msg.target_heading;
+		report[Field::WpNum] = msg.wp_num;
+		report[Field::CustomMode] = msg.custom_mode;
+		report[Field::FailureFlags] = msg.failure_flags;
+		report[Field::Type] = msg.type;
+		report[Field::Autopilot] = msg.autopilot;
+		report[Field::Airspeed] = msg.airspeed;
+		report[Field::AirspeedSp] = msg.airspeed_sp;
+		report[Field::Groundspeed] = msg.groundspeed;
+		report[Field::Windspeed] = msg.windspeed;
+		report[Field::WindHeading] = msg.wind_heading;
+		report[Field::Eph] = msg.eph;
+		report[Field::Epv] = msg.epv;
+		report[Field::TemperatureAir] = msg.temperature_air;
+		report[Field::ClimbRate] = msg.climb_rate;
+		report[Field::Throttle] = msg.throttle;
+		report[Field::Battery] = msg.battery;
+		report[Field::ModeChanges] = _mode_changes;
+		// failures that were cleared again before this report
+		report[Field::FailureEvents] = _failure_events & ~msg.failure_flags;
+
+		mavlink_high_latency_compact_t compact{};
+		compact.length = _encoder.encode(report, compact.data, sizeof(compact.data));
+
+		if (compact.length > 0) {
+			mavlink_msg_high_latency_compact_send_struct(_mavlink->get_channel(), &compact);
+		}
+
+		_mode_changes = 0;
+		_failure_events = 0;
+	}
+
+	void update_data() override
+	{
+		MavlinkStreamHighLatency2::update_data();
+
+		// aggregate the events between the reports
+		vehicle_status_s status;
+
+		if (_event_status_sub.update(&status)) {
+			if (_nav_state_valid && status.nav_state != _nav_state && _mode_changes < UINT8_MAX) {
+				_mode_changes++;
+			}
+
+			_nav_state = status.nav_state;
+			_nav_state_valid = true;
+
+			if (status.failure_detector_status & vehicle_status_s::FAILURE_MOTOR) {
+				_failure_events |= HL_FAILURE_FLAG_ENGINE;
+			}
+		}
+
+		failsafe_flags_s failsafe_flags;
+
+		if (_event_failsafe_flags_sub.update(&failsafe_flags)) {
+			if (failsafe_flags.offboard_control_signal_lost) {
+				_failure_events |= HL_FAILURE_FLAG_OFFBOARD_LINK;
+			}
+
+			if (failsafe_flags.mission_failure) {
+				_failure_events |= HL_FAILURE_FLAG_MISSION;
+			}
+
+			if (failsafe_flags.manual_control_signal_lost) {
+				_failure_events |= HL_FAILURE_FLAG_RC_RECEIVER;
+			}
+		}
+	}
+
+	uORB::Subscription _event_status_sub{ORB_ID(vehicle_status)};
+	uORB::Subscription _event_failsafe_flags_sub{ORB_ID(failsafe_flags)};
+
+	high_latency::Encoder _encoder{};
+
+	uint16_t _failure_events{0};
+	uint8_t _mode_changes{0};
+	uint8_t _nav_state{0};
+	bool _nav_state_valid{false};
+};
+
+#endif // HIGH_LATENCY_COMPACT_HPP
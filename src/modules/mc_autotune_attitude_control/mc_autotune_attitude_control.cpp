@@ -549,33 +549,39 @@ void McAutotuneAttitudeControl::saveGainsToParams()
 	_param_mc_rollrate_i.set(_rate_k(0) * _rate_i(0));
 	_param_mc_rollrate_d.set(_rate_k(0) * _rate_d(0));
 	_param_mc_roll_p.set(_att_p(0));
-	_param_mc_rollrate_p.commit_no_notification();
-	_param_mc_rollrate_k.commit_no_notification();
-	_param_mc_rollrate_i.commit_no_notification();
-	_param_mc_rollrate_d.commit_no_notification();
-	_param_mc_roll_p.commit_no_notification();
 
 	_param_mc_pitchrate_p.set(_rate_k(1));
 	_param_mc_pitchrate_k.set(1.f);
 	_param_mc_pitchrate_i.set(_rate_k(1) * _rate_i(1));
 	_param_mc_pitchrate_d.set(_rate_k(1) * _rate_d(1));
 	_param_mc_pitch_p.set(_att_p(1));
-	_param_mc_pitchrate_p.commit_no_notification();
-	_param_mc_pitchrate_k.commit_no_notification();
-	_param_mc_pitchrate_i.commit_no_notification();
-	_param_mc_pitchrate_d.commit_no_notification();
-	_param_mc_pitch_p.commit_no_notification();
 
 	_param_mc_yawrate_p.set(_rate_k(2));
 	_param_mc_yawrate_k.set(1.f);
 	_param_mc_yawrate_i.set(_rate_k(2) * _rate_i(2));
 	_param_mc_yawrate_d.set(_rate_k(2) * _rate_d(2));
 	_param_mc_yaw_p.set(_att_p(2));
-	_param_mc_yawrate_p.commit_no_notification();
-	_param_mc_yawrate_k.commit_no_notification();
-	_param_mc_yawrate_i.commit_no_notification();
-	_param_mc_yawrate_d.commit_no_notification();
-	_param_mc_yaw_p.commit();
+
+	// store all the gains with a single notification
+	const param_batch_entry_t gains[] {
+		{_param_mc_rollrate_p.handle(), &_param_mc_rollrate_p.reference()},
+		{_param_mc_rollrate_k.handle(), &_param_mc_rollrate_k.reference()},
+		{_param_mc_rollrate_i.handle(), &_param_mc_rollrate_i.reference()},
+		{_param_mc_rollrate_d.handle(), &_param_mc_rollrate_d.reference()},
+		{_param_mc_roll_p.handle(), &_param_mc_roll_p.reference()},
+		{_param_mc_pitchrate_p.handle(), &_param_mc_pitchrate_p.reference()},
+		{_param_mc_pitchrate_k.handle(), &_param_mc_pitchrate_k.reference()},
+		{_param_mc_pitchrate_i.handle(), &_param_mc_pitchrate_i.reference()},
+		{_param_mc_pitchrate_d.handle(), &_param_mc_pitchrate_d.reference()},
+		{_param_mc_pitch_p.handle(), &_param_mc_pitch_p.reference()},
+		{_param_mc_yawrate_p.handle(), &_param_mc_yawrate_p.reference()},
+		{_param_mc_yawrate_k.handle(), &_param_mc_yawrate_k.reference()},
+		{_param_mc_yawrate_i.handle(), &_param_mc_yawrate_i.reference()},
+		{_param_mc_yawrate_d.handle(), &_param_mc_yawrate_d.reference()},
+		{_param_mc_yaw_p.handle(), &_param_mc_yaw_p.reference()},
+	};
+
+	param_set_batch(gains, sizeof(gains) / sizeof(gains[0]));
 }
 
 void McAutotuneAttitudeControl::stopAutotune()
@@ -57,6 +57,8 @@ public:
 	static constexpr float DT_MIN{1e-6f}; // 1 microsecond
 	static constexpr float DT_MAX{static_cast<float>(UINT32_MAX) * 1e-6f};
 
+	static constexpr int MAX_BATCH_SAMPLES{32}; // sensor_gyro_fifo/sensor_accel_fifo size
+
 	/**
 	 * Put an item into the integral.
 	 *
@@ -75,6 +77,45 @@ public:
 		}
 	}
 
+	/**
+	 * Put a FIFO batch of equally spaced raw samples into the integral.
+	 * The batch counts as a single sample for integral_ready().
+	 *
+	 * @param x, y, z	raw samples
+	 * @param N		number of samples
+	 * @param scale	raw to sensor units
+	 * @param dt		interval between samples in seconds
+	 */
+	inline void put(const int16_t x[], const int16_t y[], const int16_t z[], int N, float scale, float dt)
+	{
+		if ((N <= 0) || (N > MAX_BATCH_SAMPLES)) {
+			return;
+		}
+
+		if ((dt > DT_MIN) && (_integral_dt + N * dt < DT_MAX)) {
+			// trapezoidal integration, the inner samples have full weight: sum them as integers
+			int32_t sum[3] {0, 0, 0};
+
+			for (int n = 0; n < N - 1; n++) {
+				sum[0] += x[n];
+				sum[1] += y[n];
+				sum[2] += z[n];
+			}
+
+			const matrix::Vector3f last{x[N - 1] *scale, y[N - 1] *scale, z[N - 1] *scale};
+			const matrix::Vector3f inner{sum[0] *scale, sum[1] *scale, sum[2] *scale};
+
+			_alpha += (inner + (_last_val + last) * 0.5f) * dt;
+			_last_val = last;
+			_integral_dt += N * dt;
+			_integrated_samples++;
+
+		} else {
+			reset();
+			_last_val = matrix::Vector3f{x[N - 1] *scale, y[N - 1] *scale, z[N - 1] *scale};
+		}
+	}
+
 	/**
 	 * Set reset interval during runtime. This won't reset the integrator.
 	 *
@@ -186,6 +227,86 @@ public:
 		}
 	}
 
+	/**
+	 * Put a FIFO batch of equally spaced raw samples into the integral with the coning corrections
+	 * of every sample. Same result as put() for each sample up to rounding, but the integrator state
+	 * is kept in registers for the whole batch and the range checks are done once per batch.
+	 * The batch counts as a single sample for integral_ready().
+	 *
+	 * @param x, y, z	raw samples
+	 * @param N		number of samples
+	 * @param scale	raw to sensor units
+	 * @param dt		interval between samples in seconds
+	 */
+	inline void put(const int16_t x[], const int16_t y[], const int16_t z[], int N, float scale, float dt)
+	{
+		if ((N <= 0) || (N > MAX_BATCH_SAMPLES)) {
+			return;
+		}
+
+		if ((dt > DT_MIN) && (_integral_dt + N * dt < DT_MAX)) {
+			const float k = 0.5f * dt * scale;
+
+			// first sample, the previous input is already scaled, see put()
+			float d0 = 0.5f * dt * _last_val(0) + k * x[0];
+			float d1 = 0.5f * dt * _last_val(1) + k * y[0];
+			float d2 = 0.5f * dt * _last_val(2) + k * z[0];
+
+			const matrix::Vector3f ref{_last_alpha + _last_delta_alpha * (1.f / 6.f)};
+
+			float beta0 = ref(1) * d2 - ref(2) * d1;
+			float beta1 = ref(2) * d0 - ref(0) * d2;
+			float beta2 = ref(0) * d1 - ref(1) * d0;
+
+			_last_alpha = _alpha;
+
+			float alpha0 = _alpha(0) + d0;
+			float alpha1 = _alpha(1) + d1;
+			float alpha2 = _alpha(2) + d2;
+
+			// remaining samples, the previous integral is not kept: alpha - delta
+			for (int n = 1; n < N; n++) {
+				// raw samples are summed as integers before scaling
+				const float e0 = k * (x[n - 1] + x[n]);
+				const float e1 = k * (y[n - 1] + y[n]);
+				const float e2 = k * (z[n - 1] + z[n]);
+
+				// coning reference: previous integral + previous delta / 6
+				const float r0 = alpha0 - d0 * (5.f / 6.f);
+				const float r1 = alpha1 - d1 * (5.f / 6.f);
+				const float r2 = alpha2 - d2 * (5.f / 6.f);
+
+				beta0 += r1 * e2 - r2 * e1;
+				beta1 += r2 * e0 - r0 * e2;
+				beta2 += r0 * e1 - r1 * e0;
+
+				d0 = e0;
+				d1 = e1;
+				d2 = e2;
+
+				alpha0 += d0;
+				alpha1 += d1;
+				alpha2 += d2;
+			}
+
+			if (N > 1) {
+				_last_alpha = matrix::Vector3f{alpha0 - d0, alpha1 - d1, alpha2 - d2};
+			}
+
+			_alpha = matrix::Vector3f{alpha0, alpha1, alpha2};
+			_last_delta_alpha = matrix::Vector3f{d0, d1, d2};
+			_beta += matrix::Vector3f{beta0, beta1, beta2} * 0.5f;
+			_last_val = matrix::Vector3f{x[N - 1] *scale, y[N - 1] *scale, z[N - 1] *scale};
+
+			_integral_dt += N * dt;
+			_integrated_samples++;
+
+		} else {
+			reset();
+			_last_val = matrix::Vector3f{x[N - 1] *scale, y[N - 1] *scale, z[N - 1] *scale};
+		}
+	}
+
 	void reset()
 	{
 		Integrator::reset();
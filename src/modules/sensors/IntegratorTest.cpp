@@ -0,0 +1,238 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+
+#include <px4_platform_common/defines.h>
+
+#include "Integrator.hpp"
+
+using namespace sensors;
+using matrix::Vector3f;
+
+class IntegratorTest : public ::testing::Test
+{
+public:
+	static constexpr int MAX_N = Integrator::MAX_BATCH_SAMPLES;
+	static constexpr float SCALE = 1e-3f; // raw to rad/s
+	static constexpr float DT = 125e-6f;  // 8 kHz
+
+	// coning motion (x and y rotating in quadrature) with noise
+	void generate(int16_t x[], int16_t y[], int16_t z[], int N)
+	{
+		for (int n = 0; n < N; n++) {
+			_t += DT;
+			x[n] = roundf((2.f * cosf(2.f * M_PI_F * 40.f * _t) + _noise(_generator)) / SCALE);
+			y[n] = roundf((2.f * sinf(2.f * M_PI_F * 40.f * _t) + _noise(_generator)) / SCALE);
+			z[n] = roundf((0.5f + _noise(_generator)) / SCALE);
+		}
+	}
+
+	template<typename I>
+	static void putEach(I &integrator, const int16_t x[], const int16_t y[], const int16_t z[], int N)
+	{
+		for (int n = 0; n < N; n++) {
+			integrator.put(Vector3f{x[n] * SCALE, y[n] * SCALE, z[n] * SCALE}, DT);
+		}
+	}
+
+	template<typename I>
+	void compare(int N)
+	{
+		I reference;
+		I batch;
+
+		// publish every 4 batches
+		reference.set_reset_interval(1e6f * 4 * N * DT - 1);
+		batch.set_reset_interval(1e6f * 4 * N * DT - 1);
+		reference.set_reset_samples(UINT8_MAX);
+		batch.set_reset_samples(UINT8_MAX);
+
+		int resets = 0;
+
+		for (int i = 0; i < 100; i++) {
+			int16_t x[MAX_N], y[MAX_N], z[MAX_N];
+			generate(x, y, z, N);
+
+			putEach(reference, x, y, z, N);
+			batch.put(x, y, z, N, SCALE, DT);
+
+			ASSERT_EQ(reference.integral_ready(), batch.integral_ready());
+
+			if (batch.integral_ready()) {
+				Vector3f integral_reference;
+				Vector3f integral_batch;
+				uint32_t integral_dt_reference = 0;
+				uint32_t integral_dt_batch = 0;
+
+				ASSERT_TRUE(reference.reset(integral_reference, integral_dt_reference));
+				ASSERT_TRUE(batch.reset(integral_batch, integral_dt_batch));
+
+				EXPECT_EQ(integral_dt_batch, integral_dt_reference);
+
+				for (int axis = 0; axis < 3; axis++) {
+					EXPECT_NEAR(integral_batch(axis), integral_reference(axis), 1e-6f) << "N " << N << " batch " << i;
+				}
+
+				resets++;
+			}
+		}
+
+		EXPECT_EQ(resets, 25);
+	}
+
+	std::mt19937 _generator{1};
+	std::normal_distribution<float> _noise{0.f, 0.2f};
+	float _t{0.f};
+};
+
+TEST_F(IntegratorTest, batchMatchesSamples)
+{
+	for (int N : {1, 2, 8, 32}) {
+		compare<Integrator>(N);
+	}
+}
+
+TEST_F(IntegratorTest, batchConingMatchesSamples)
+{
+	for (int N : {1, 2, 8, 32}) {
+		compare<IntegratorConing>(N);
+	}
+}
+
+TEST_F(IntegratorTest, batchConingCorrections)
+{
+	IntegratorConing reference;
+	IntegratorConing batch;
+
+	for (int i = 0; i < 4; i++) {
+		int16_t x[8], y[8], z[8];
+		generate(x, y, z, 8);
+
+		putEach(reference, x, y, z, 8);
+		batch.put(x, y, z, 8, SCALE, DT);
+	}
+
+	// the 40 Hz coning motion produces a correction along z
+	const Vector3f beta_reference = reference.accumulated_coning_corrections();
+	const Vector3f beta_batch = batch.accumulated_coning_corrections();
+
+	EXPECT_GT(beta_reference(2), 1e-6f);
+
+	for (int axis = 0; axis < 3; axis++) {
+		EXPECT_NEAR(beta_batch(axis), beta_reference(axis), 1e-4f * beta_reference.norm());
+	}
+}
+
+TEST_F(IntegratorTest, batchResetSamples)
+{
+	// a batch counts as a single sample
+	Integrator integrator;
+	integrator.set_reset_samples(2);
+	integrator.set_reset_interval(10000);
+
+	int16_t x[8], y[8], z[8];
+	generate(x, y, z, 8);
+
+	integrator.put(x, y, z, 8, SCALE, DT);
+	EXPECT_FALSE(integrator.integral_ready());
+
+	integrator.put(x, y, z, 8, SCALE, DT);
+	EXPECT_TRUE(integrator.integral_ready());
+
+	Vector3f integral;
+	uint32_t integral_dt = 0;
+	EXPECT_TRUE(integrator.reset(integral, integral_dt));
+	EXPECT_EQ(integral_dt, 2000u);
+}
+
+TEST_F(IntegratorTest, benchmark)
+{
+	static constexpr int BATCHES = 1000;
+	static constexpr int ROUNDS = 20;
+
+	for (int N : {8, 32}) {
+		static int16_t x[BATCHES][MAX_N], y[BATCHES][MAX_N], z[BATCHES][MAX_N];
+
+		for (int i = 0; i < BATCHES; i++) {
+			generate(x[i], y[i], z[i], N);
+		}
+
+		IntegratorConing per_sample;
+		IntegratorConing batch;
+		per_sample.set_reset_samples(UINT8_MAX);
+		batch.set_reset_samples(UINT8_MAX);
+
+		float sum = 0.f;
+		double per_sample_us = INFINITY;
+		double batch_us = INFINITY;
+
+		// best of several rounds to reject scheduling noise
+		for (int round = 0; round < ROUNDS; round++) {
+			Vector3f integral;
+			uint32_t integral_dt;
+
+			const auto per_sample_start = std::chrono::steady_clock::now();
+
+			for (int i = 0; i < BATCHES; i++) {
+				putEach(per_sample, x[i], y[i], z[i], N);
+
+				if (per_sample.reset(integral, integral_dt)) {
+					sum += integral(0);
+				}
+			}
+
+			const auto batch_start = std::chrono::steady_clock::now();
+
+			for (int i = 0; i < BATCHES; i++) {
+				batch.put(x[i], y[i], z[i], N, SCALE, DT);
+
+				if (batch.reset(integral, integral_dt)) {
+					sum += integral(0);
+				}
+			}
+
+			const auto end = std::chrono::steady_clock::now();
+
+			per_sample_us = fmin(per_sample_us, std::chrono::duration<double, std::micro>(batch_start - per_sample_start).count() / BATCHES);
+			batch_us = fmin(batch_us, std::chrono::duration<double, std::micro>(end - batch_start).count() / BATCHES);
+		}
+
+		printf("coning integration (%d samples): per sample %.3f us, batch %.3f us\n", N, per_sample_us, batch_us);
+
+		EXPECT_TRUE(PX4_ISFINITE(sum));
+	}
+}
@@ -0,0 +1,494 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "SensorsPipelineBenchmark.hpp"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
+
+using namespace time_literals;
+using ulog::ULogReader;
+
+namespace sensors
+{
+
+SensorsPipelineBenchmark::~SensorsPipelineBenchmark()
+{
+	// stages first, they unsubscribe from the driver topics
+	delete _voted_sensors_update;
+
+#if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
+	delete _vehicle_air_data;
+#endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
+#if defined(CONFIG_SENSORS_VEHICLE_MAGNETOMETER)
+	delete _vehicle_magnetometer;
+#endif // CONFIG_SENSORS_VEHICLE_MAGNETOMETER
+#if defined(CONFIG_SENSORS_VEHICLE_ACCELERATION)
+	delete _vehicle_acceleration;
+#endif // CONFIG_SENSORS_VEHICLE_ACCELERATION
+#if defined(CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY)
+	delete _vehicle_angular_velocity;
+#endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
+
+	for (int i = 0; i < MAX_INSTANCES; i++) {
+		delete _vehicle_imu[i];
+		delete _gyro[i];
+		delete _accel[i];
+		delete _mag_pub[i];
+		delete _baro_pub[i];
+	}
+}
+
+const char *SensorsPipelineBenchmark::stageName(Stage stage)
+{
+	switch (stage) {
+	case Stage::Drivers: return "drivers (publication)";
+
+	case Stage::VehicleIMU: return "VehicleIMU";
+
+	case Stage::VehicleAngularVelocity: return "VehicleAngularVelocity";
+
+	case Stage::VehicleAcceleration: return "VehicleAcceleration";
+
+	case Stage::VehicleMagnetometer: return "VehicleMagnetometer";
+
+	case Stage::VehicleAirData: return "VehicleAirData";
+
+	case Stage::VotedSensorsUpdate: return "VotedSensorsUpdate";
+
+	default: return "unknown";
+	}
+}
+
+uint64_t SensorsPipelineBenchmark::timeNs()
+{
+	timespec ts{};
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+}
+
+int SensorsPipelineBenchmark::subscribe(ULogReader &reader, const char *topic_name, uint8_t instance, Source source)
+{
+	const int sub = reader.subscribe(topic_name, instance);
+
+	if ((sub >= 0) && (sub < (int)(sizeof(_sources) / sizeof(_sources[0])))) {
+		_sources[sub].source = source;
+		_sources[sub].instance = instance;
+		return sub;
+	}
+
+	return -1;
+}
+
+bool SensorsPipelineBenchmark::run(const char *log_path)
+{
+	ULogReader reader;
+
+	if (!reader.open(log_path)) {
+		_error = "can't open log";
+		return false;
+	}
+
+	// instances are numbered in the order of advertisement, only use consecutive instances
+	for (uint8_t i = 0; i < MAX_INSTANCES; i++) {
+		const int gyro_sub = subscribe(reader, "sensor_gyro_fifo", i, Source::GyroFifo);
+		const int accel_sub = subscribe(reader, "sensor_accel_fifo", i, Source::AccelFifo);
+
+		if ((gyro_sub < 0) || (accel_sub < 0) || (i != _statistics.imu_count)) {
+			break;
+		}
+
+		for (int k = 0; k < 2; k++) {
+			const int sub = (k == 0) ? gyro_sub : accel_sub;
+			FifoFields &f = (k == 0) ? _gyro_fields[i] : _accel_fields[i];
+			f.timestamp_sample = reader.field(sub, "timestamp_sample");
+			f.device_id = reader.field(sub, "device_id");
+			f.dt = reader.field(sub, "dt");
+			f.scale = reader.field(sub, "scale");
+			f.samples = reader.field(sub, "samples");
+			f.x = reader.field(sub, "x");
+			f.y = reader.field(sub, "y");
+			f.z = reader.field(sub, "z");
+		}
+
+		_statistics.imu_count++;
+	}
+
+	for (uint8_t i = 0; i < MAX_INSTANCES; i++) {
+		const int sub = subscribe(reader, "sensor_mag", i, Source::Mag);
+
+		if (sub < 0) {
+			break;
+		}
+
+		MagFields &f = _mag_fields[i];
+		f.timestamp_sample = reader.field(sub, "timestamp_sample");
+		f.device_id = reader.field(sub, "device_id");
+		f.x = reader.field(sub, "x");
+		f.y = reader.field(sub, "y");
+		f.z = reader.field(sub, "z");
+		f.temperature = reader.field(sub, "temperature");
+		f.error_count = reader.field(sub, "error_count");
+		_statistics.mag_count++;
+	}
+
+	for (uint8_t i = 0; i < MAX_INSTANCES; i++) {
+		const int sub = subscribe(reader, "sensor_baro", i, Source::Baro);
+
+		if (sub < 0) {
+			break;
+		}
+
+		BaroFields &f = _baro_fields[i];
+		f.timestamp_sample = reader.field(sub, "timestamp_sample");
+		f.device_id = reader.field(sub, "device_id");
+		f.pressure = reader.field(sub, "pressure");
+		f.temperature = reader.field(sub, "temperature");
+		f.error_count = reader.field(sub, "error_count");
+		_statistics.baro_count++;
+	}
+
+	if ((_statistics.imu_count == 0) || !_gyro_fields[0].x.valid() || !_accel_fields[0].x.valid()) {
+		_error = "no sensor_gyro_fifo and sensor_accel_fifo data (logged with the high rate IMU profile)";
+		return false;
+	}
+
+	createStages();
+
+	ULogReader::Message msg;
+
+	while (reader.next(msg)) {
+		if ((msg.subscription < 0) || (msg.subscription >= (int)(sizeof(_sources) / sizeof(_sources[0])))) {
+			continue;
+		}
+
+		const SourceInfo &source = _sources[msg.subscription];
+
+		if (_first_timestamp == 0) {
+			// the replay starts now
+			_first_timestamp = msg.timestamp;
+			_time_offset = hrt_absolute_time() - msg.timestamp;
+		}
+
+		_last_timestamp = math::max(_last_timestamp, msg.timestamp);
+		_statistics.messages++;
+
+		switch (source.source) {
+		case Source::GyroFifo:
+			handleGyroFifo(msg, source.instance);
+			break;
+
+		case Source::AccelFifo:
+			handleAccelFifo(msg, source.instance);
+			break;
+
+		case Source::Mag:
+			handleMag(msg, source.instance);
+			break;
+
+		case Source::Baro:
+			handleBaro(msg, source.instance);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	_statistics.log_duration_us = _last_timestamp - _first_timestamp;
+
+	if (_statistics.messages == 0) {
+		_error = "no sensor data";
+		return false;
+	}
+
+	return true;
+}
+
+void SensorsPipelineBenchmark::createStages()
+{
+	// drivers, advertised in instance order
+	for (uint8_t i = 0; i < _statistics.imu_count; i++) {
+		_accel[i] = new PX4Accelerometer(0);
+		_gyro[i] = new PX4Gyroscope(0);
+	}
+
+	for (uint8_t i = 0; i < _statistics.mag_count; i++) {
+		_mag_pub[i] = new uORB::PublicationMulti<sensor_mag_s>{ORB_ID(sensor_mag)};
+		_mag_pub[i]->advertise();
+	}
+
+	for (uint8_t i = 0; i < _statistics.baro_count; i++) {
+		_baro_pub[i] = new uORB::PublicationMulti<sensor_baro_s>{ORB_ID(sensor_baro)};
+		_baro_pub[i]->advertise();
+	}
+
+	// stages, created and started the same way as by the sensors module
+	for (uint8_t i = 0; i < _statistics.imu_count; i++) {
+		_vehicle_imu[i] = new StageItem<VehicleIMU>(i, i, i, px4::wq_configurations::INS0);
+		_vehicle_imu[i]->Start();
+	}
+
+	_voted_sensors_update = new VotedSensorsUpdate(false, _sensors_vehicle_imu_sub);
+
+#if defined(CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY)
+	_vehicle_angular_velocity = new StageItem<VehicleAngularVelocity>();
+	_vehicle_angular_velocity->Start();
+#endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
+
+#if defined(CONFIG_SENSORS_VEHICLE_ACCELERATION)
+	_vehicle_acceleration = new StageItem<VehicleAcceleration>();
+	_vehicle_acceleration->Start();
+#endif // CONFIG_SENSORS_VEHICLE_ACCELERATION
+
+#if defined(CONFIG_SENSORS_VEHICLE_MAGNETOMETER)
+
+	if (_statistics.mag_count > 0) {
+		_vehicle_magnetometer = new StageItem<VehicleMagnetometer>();
+		_vehicle_magnetometer->Start();
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_MAGNETOMETER
+
+#if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
+
+	if (_statistics.baro_count > 0) {
+		_vehicle_air_data = new StageItem<VehicleAirData>();
+		_vehicle_air_data->Start();
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
+}
+
+template<typename T>
+bool SensorsPipelineBenchmark::readFifo(const ULogReader::Message &msg, const FifoFields &fields, T &fifo)
+{
+	const uint8_t samples = ULogReader::get<uint8_t>(msg, fields.samples);
+
+	if ((samples == 0) || (samples > (sizeof(fifo.x) / sizeof(fifo.x[0])))) {
+		return false;
+	}
+
+	fifo.timestamp_sample = toLocalTime(ULogReader::get<uint64_t>(msg, fields.timestamp_sample, msg.timestamp));
+	fifo.device_id = ULogReader::get<uint32_t>(msg, fields.device_id);
+	fifo.dt = ULogReader::get<float>(msg, fields.dt);
+	fifo.scale = ULogReader::get<float>(msg, fields.scale);
+	fifo.samples = samples;
+
+	for (int n = 0; n < samples; n++) {
+		fifo.x[n] = ULogReader::get<int16_t>(msg, fields.x, 0, n);
+		fifo.y[n] = ULogReader::get<int16_t>(msg, fields.y, 0, n);
+		fifo.z[n] = ULogReader::get<int16_t>(msg, fields.z, 0, n);
+	}
+
+	return true;
+}
+
+void SensorsPipelineBenchmark::handleGyroFifo(const ULogReader::Message &msg, uint8_t instance)
+{
+	sensor_gyro_fifo_s fifo{};
+
+	if (!readFifo(msg, _gyro_fields[instance], fifo)) {
+		return;
+	}
+
+	// the logged samples are already rotated to the board frame
+	PX4Gyroscope &gyro = *_gyro[instance];
+	gyro.set_device_id(fifo.device_id);
+	gyro.set_scale(fifo.scale);
+
+	measure(Stage::Drivers, [&]() { gyro.updateFIFO(fifo); });
+
+	// VehicleIMU is scheduled by sensor_gyro
+	runVehicleIMU(instance);
+
+#if defined(CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY)
+
+	// VehicleAngularVelocity is scheduled by the selected gyro
+	if ((_sensor_selection.gyro_device_id == 0) || (_sensor_selection.gyro_device_id == fifo.device_id)) {
+		measure(Stage::VehicleAngularVelocity, [&]() { _vehicle_angular_velocity->RunOnce(); });
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
+}
+
+void SensorsPipelineBenchmark::handleAccelFifo(const ULogReader::Message &msg, uint8_t instance)
+{
+	sensor_accel_fifo_s fifo{};
+
+	if (!readFifo(msg, _accel_fields[instance], fifo)) {
+		return;
+	}
+
+	PX4Accelerometer &accel = *_accel[instance];
+	accel.set_device_id(fifo.device_id);
+	accel.set_scale(fifo.scale);
+
+	measure(Stage::Drivers, [&]() { accel.updateFIFO(fifo); });
+
+#if defined(CONFIG_SENSORS_VEHICLE_ACCELERATION)
+
+	// VehicleAcceleration is scheduled by the selected accel
+	if ((_sensor_selection.accel_device_id == 0) || (_sensor_selection.accel_device_id == fifo.device_id)) {
+		measure(Stage::VehicleAcceleration, [&]() { _vehicle_acceleration->RunOnce(); });
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_ACCELERATION
+}
+
+void SensorsPipelineBenchmark::handleMag(const ULogReader::Message &msg, uint8_t instance)
+{
+	const MagFields &f = _mag_fields[instance];
+
+	sensor_mag_s mag{};
+	mag.timestamp_sample = toLocalTime(ULogReader::get<uint64_t>(msg, f.timestamp_sample, msg.timestamp));
+	mag.device_id = ULogReader::get<uint32_t>(msg, f.device_id);
+	mag.x = ULogReader::get<float>(msg, f.x);
+	mag.y = ULogReader::get<float>(msg, f.y);
+	mag.z = ULogReader::get<float>(msg, f.z);
+	mag.temperature = ULogReader::get<float>(msg, f.temperature, NAN);
+	mag.error_count = ULogReader::get<uint32_t>(msg, f.error_count);
+
+	measure(Stage::Drivers, [&]() {
+		mag.timestamp = hrt_absolute_time();
+		_mag_pub[instance]->publish(mag);
+	});
+
+#if defined(CONFIG_SENSORS_VEHICLE_MAGNETOMETER)
+
+	if (_vehicle_magnetometer) {
+		measure(Stage::VehicleMagnetometer, [&]() { _vehicle_magnetometer->RunOnce(); });
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_MAGNETOMETER
+}
+
+void SensorsPipelineBenchmark::handleBaro(const ULogReader::Message &msg, uint8_t instance)
+{
+	const BaroFields &f = _baro_fields[instance];
+
+	sensor_baro_s baro{};
+	baro.timestamp_sample = toLocalTime(ULogReader::get<uint64_t>(msg, f.timestamp_sample, msg.timestamp));
+	baro.device_id = ULogReader::get<uint32_t>(msg, f.device_id);
+	baro.pressure = ULogReader::get<float>(msg, f.pressure);
+	baro.temperature = ULogReader::get<float>(msg, f.temperature, NAN);
+	baro.error_count = ULogReader::get<uint32_t>(msg, f.error_count);
+
+	measure(Stage::Drivers, [&]() {
+		baro.timestamp = hrt_absolute_time();
+		_baro_pub[instance]->publish(baro);
+	});
+
+#if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
+
+	if (_vehicle_air_data) {
+		measure(Stage::VehicleAirData, [&]() { _vehicle_air_data->RunOnce(); });
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
+}
+
+void SensorsPipelineBenchmark::runVehicleIMU(uint8_t instance)
+{
+	measure(Stage::VehicleIMU, [&]() { _vehicle_imu[instance]->RunOnce(); });
+
+	vehicle_imu_s imu;
+
+	if (_vehicle_imu_sub[instance].update(&imu)) {
+		_statistics.vehicle_imu++;
+
+		// the sensors module is scheduled by the selected vehicle_imu
+		if ((_sensor_selection.gyro_device_id == 0) || (_sensor_selection.gyro_device_id == imu.gyro_device_id)) {
+			runSensors();
+		}
+	}
+}
+
+void SensorsPipelineBenchmark::runSensors()
+{
+	measure(Stage::VotedSensorsUpdate, [&]() {
+		// the sensors module looks for new sensors every 500 ms while disarmed
+		const hrt_abstime now = hrt_absolute_time();
+
+		if (now > _last_sensors_initialize + 500_ms) {
+			_voted_sensors_update->initializeSensors();
+			_last_sensors_initialize = now;
+		}
+
+		_voted_sensors_update->sensorsPoll(_sensor_combined);
+
+		if (_sensor_combined.timestamp != _sensor_combined_prev_timestamp) {
+			_voted_sensors_update->setRelativeTimestamps(_sensor_combined);
+			_sensor_combined_pub.publish(_sensor_combined);
+			_sensor_combined_prev_timestamp = _sensor_combined.timestamp;
+			_statistics.sensor_combined++;
+		}
+	});
+
+	_sensor_selection_sub.update(&_sensor_selection);
+}
+
+void SensorsPipelineBenchmark::print() const
+{
+	const double duration_s = _statistics.log_duration_us * 1e-6;
+
+	printf("sensors pipeline: %.1f s of flight data, %" PRIu8 " IMU, %" PRIu8 " mag, %" PRIu8 " baro, %" PRIu64
+	       " messages\n", duration_s, _statistics.imu_count, _statistics.mag_count, _statistics.baro_count,
+	       _statistics.messages);
+	printf("%-24s %10s %12s %10s %16s %8s\n", "stage", "runs", "total [ms]", "run [us]", "per flight s [us]", "CPU [%]");
+
+	uint64_t total_ns = 0;
+
+	for (int i = 0; i < STAGE_COUNT; i++) {
+		const StageStatistics &s = _statistics.stage[i];
+		const double per_second_us = (duration_s > 0.) ? s.elapsed_ns * 1e-3 / duration_s : 0.;
+
+		printf("%-24s %10" PRIu64 " %12.2f %10.3f %16.1f %8.3f\n", stageName(static_cast<Stage>(i)), s.runs,
+		       s.elapsed_ns * 1e-6, (s.runs > 0) ? s.elapsed_ns * 1e-3 / s.runs : 0., per_second_us, per_second_us * 1e-4);
+
+		total_ns += s.elapsed_ns;
+	}
+
+	const double total_per_second_us = (duration_s > 0.) ? total_ns * 1e-3 / duration_s : 0.;
+	printf("%-24s %10s %12.2f %10s %16.1f %8.3f\n", "total", "", total_ns * 1e-6, "", total_per_second_us,
+	       total_per_second_us * 1e-4);
+	printf("outputs: %" PRIu64 " vehicle_imu, %" PRIu64 " sensor_combined\n", _statistics.vehicle_imu,
+	       _statistics.sensor_combined);
+}
+
+} // namespace sensors
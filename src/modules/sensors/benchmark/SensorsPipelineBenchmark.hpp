@@ -0,0 +1,284 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file SensorsPipelineBenchmark.hpp
+ * Measure the CPU cost of the sensors module chain on recorded sensor data.
+ *
+ * The raw sensor_gyro_fifo, sensor_accel_fifo, sensor_mag and sensor_baro messages of a ULog are
+ * published in file order through the driver libraries (PX4Gyroscope, PX4Accelerometer) or directly,
+ * and the work items consuming them (VehicleIMU, VehicleAngularVelocity, VehicleAcceleration,
+ * VehicleMagnetometer, VehicleAirData and the sensors voting) are run synchronously instead of by the
+ * work queues. A stage runs after every publication it would have been scheduled by, so the log is
+ * processed as fast as possible and the result doesn't depend on the scheduler.
+ *
+ * The sample timestamps are shifted to the current time when the replay starts. The rate limits
+ * based on the current time (vehicle_air_data publication interval) are therefore reached less often
+ * than in flight.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <utility>
+
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/PublicationMulti.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/sensor_baro.h>
+#include <uORB/topics/sensor_combined.h>
+#include <uORB/topics/sensor_mag.h>
+#include <uORB/topics/sensor_selection.h>
+#include <uORB/topics/vehicle_imu.h>
+
+#include <lib/drivers/accelerometer/PX4Accelerometer.hpp>
+#include <lib/drivers/gyroscope/PX4Gyroscope.hpp>
+
+#include <ULogReader.hpp>
+
+#include "voted_sensors_update.h"
+#include "vehicle_imu/VehicleIMU.hpp"
+
+#if defined(CONFIG_SENSORS_VEHICLE_ACCELERATION)
+# include "vehicle_acceleration/VehicleAcceleration.hpp"
+#endif // CONFIG_SENSORS_VEHICLE_ACCELERATION
+
+#if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
+# include "vehicle_air_data/VehicleAirData.hpp"
+#endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
+
+#if defined(CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY)
+# include "vehicle_angular_velocity/VehicleAngularVelocity.hpp"
+#endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
+
+#if defined(CONFIG_SENSORS_VEHICLE_MAGNETOMETER)
+# include "vehicle_magnetometer/VehicleMagnetometer.hpp"
+#endif // CONFIG_SENSORS_VEHICLE_MAGNETOMETER
+
+namespace sensors
+{
+
+class SensorsPipelineBenchmark
+{
+public:
+	enum class Stage : uint8_t {
+		Drivers,
+		VehicleIMU,
+		VehicleAngularVelocity,
+		VehicleAcceleration,
+		VehicleMagnetometer,
+		VehicleAirData,
+		VotedSensorsUpdate,
+		Count
+	};
+
+	static constexpr int STAGE_COUNT = static_cast<int>(Stage::Count);
+
+	struct StageStatistics {
+		uint64_t runs{0};
+		uint64_t elapsed_ns{0};
+	};
+
+	struct Statistics {
+		StageStatistics stage[STAGE_COUNT] {};
+
+		uint64_t log_duration_us{0};
+		uint64_t messages{0};
+
+		uint8_t imu_count{0};
+		uint8_t mag_count{0};
+		uint8_t baro_count{0};
+
+		// publications of the pipeline outputs
+		uint64_t vehicle_imu{0};
+		uint64_t sensor_combined{0};
+	};
+
+	SensorsPipelineBenchmark() = default;
+	~SensorsPipelineBenchmark();
+
+	/**
+	 * Replay the raw sensor data of a log through the sensors pipeline.
+	 * Must only be called once per instance, with the work queues not running.
+	 * @return false if the log can't be read or has no IMU FIFO data
+	 */
+	bool run(const char *log_path);
+
+	const Statistics &statistics() const { return _statistics; }
+	const char *error() const { return _error; }
+
+	/**
+	 * Print the CPU time of every stage per second of flight data
+	 */
+	void print() const;
+
+	static const char *stageName(Stage stage);
+
+private:
+	static constexpr int MAX_INSTANCES = MAX_SENSOR_COUNT;
+
+	// expose Run() to drive a work item without its work queue
+	template<typename T>
+	class StageItem : public T
+	{
+	public:
+		template<typename... Args>
+		explicit StageItem(Args &&... args) : T(std::forward<Args>(args)...) {}
+
+		void RunOnce() { T::Run(); }
+	};
+
+	// owner of the vehicle_imu callbacks of the sensors voting, never scheduled
+	class SensorsWorkItem : public px4::ScheduledWorkItem
+	{
+	public:
+		SensorsWorkItem() : ScheduledWorkItem("sensors_benchmark", px4::wq_configurations::INS0) {}
+	private:
+		void Run() override {}
+	};
+
+	enum class Source : uint8_t {
+		None,
+		GyroFifo,
+		AccelFifo,
+		Mag,
+		Baro,
+	};
+
+	struct FifoFields {
+		ulog::ULogReader::Field timestamp_sample, device_id, dt, scale, samples, x, y, z;
+	};
+
+	struct MagFields {
+		ulog::ULogReader::Field timestamp_sample, device_id, x, y, z, temperature, error_count;
+	};
+
+	struct BaroFields {
+		ulog::ULogReader::Field timestamp_sample, device_id, pressure, temperature, error_count;
+	};
+
+	struct SourceInfo {
+		Source source{Source::None};
+		uint8_t instance{0};
+	};
+
+	template<typename F>
+	void measure(Stage stage, F &&f)
+	{
+		const uint64_t start_ns = timeNs();
+		f();
+		StageStatistics &s = _statistics.stage[static_cast<int>(stage)];
+		s.elapsed_ns += timeNs() - start_ns;
+		s.runs++;
+	}
+
+	static uint64_t timeNs();
+
+	int subscribe(ulog::ULogReader &reader, const char *topic_name, uint8_t instance, Source source);
+	void createStages();
+
+	template<typename T>
+	bool readFifo(const ulog::ULogReader::Message &msg, const FifoFields &fields, T &fifo);
+
+	void handleGyroFifo(const ulog::ULogReader::Message &msg, uint8_t instance);
+	void handleAccelFifo(const ulog::ULogReader::Message &msg, uint8_t instance);
+	void handleMag(const ulog::ULogReader::Message &msg, uint8_t instance);
+	void handleBaro(const ulog::ULogReader::Message &msg, uint8_t instance);
+
+	void runVehicleIMU(uint8_t instance);
+	void runSensors();
+
+	uint64_t toLocalTime(uint64_t timestamp_sample) const { return timestamp_sample + _time_offset; }
+
+	SourceInfo _sources[4 * MAX_INSTANCES] {}; ///< indexed by the log subscription
+
+	FifoFields _gyro_fields[MAX_INSTANCES] {};
+	FifoFields _accel_fields[MAX_INSTANCES] {};
+	MagFields _mag_fields[MAX_INSTANCES] {};
+	BaroFields _baro_fields[MAX_INSTANCES] {};
+
+	// drivers
+	PX4Gyroscope *_gyro[MAX_INSTANCES] {};
+	PX4Accelerometer *_accel[MAX_INSTANCES] {};
+	uORB::PublicationMulti<sensor_mag_s> *_mag_pub[MAX_INSTANCES] {};
+	uORB::PublicationMulti<sensor_baro_s> *_baro_pub[MAX_INSTANCES] {};
+
+	// stages
+	StageItem<VehicleIMU> *_vehicle_imu[MAX_INSTANCES] {};
+#if defined(CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY)
+	StageItem<VehicleAngularVelocity> *_vehicle_angular_velocity {nullptr};
+#endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
+#if defined(CONFIG_SENSORS_VEHICLE_ACCELERATION)
+	StageItem<VehicleAcceleration> *_vehicle_acceleration {nullptr};
+#endif // CONFIG_SENSORS_VEHICLE_ACCELERATION
+#if defined(CONFIG_SENSORS_VEHICLE_MAGNETOMETER)
+	StageItem<VehicleMagnetometer> *_vehicle_magnetometer {nullptr};
+#endif // CONFIG_SENSORS_VEHICLE_MAGNETOMETER
+#if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
+	StageItem<VehicleAirData> *_vehicle_air_data {nullptr};
+#endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
+
+	// sensors voting, as run by the sensors module
+	SensorsWorkItem _sensors_work_item{};
+	uORB::SubscriptionCallbackWorkItem _sensors_vehicle_imu_sub[MAX_SENSOR_COUNT] {
+		{&_sensors_work_item, ORB_ID(vehicle_imu), 0},
+		{&_sensors_work_item, ORB_ID(vehicle_imu), 1},
+		{&_sensors_work_item, ORB_ID(vehicle_imu), 2},
+		{&_sensors_work_item, ORB_ID(vehicle_imu), 3}
+	};
+	VotedSensorsUpdate *_voted_sensors_update{nullptr};
+
+	sensor_combined_s _sensor_combined{};
+	uint64_t _sensor_combined_prev_timestamp{0};
+	uint64_t _last_sensors_initialize{0};
+	uORB::Publication<sensor_combined_s> _sensor_combined_pub{ORB_ID(sensor_combined)};
+
+	// outputs used to trigger the next stages
+	uORB::Subscription _vehicle_imu_sub[MAX_INSTANCES] {
+		{ORB_ID(vehicle_imu), 0}, {ORB_ID(vehicle_imu), 1}, {ORB_ID(vehicle_imu), 2}, {ORB_ID(vehicle_imu), 3}
+	};
+	uORB::Subscription _sensor_selection_sub{ORB_ID(sensor_selection)};
+	sensor_selection_s _sensor_selection{};
+
+	uint64_t _time_offset{0};
+	uint64_t _first_timestamp{0};
+	uint64_t _last_timestamp{0};
+
+	Statistics _statistics{};
+	const char *_error{""};
+};
+
+} // namespace sensors
@@ -0,0 +1,237 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+#include <lib/geo/geo.h>
+#include <lib/mathlib/mathlib.h>
+#include <ULogWriter.hpp>
+
+#include "SensorsPipelineBenchmark.hpp"
+
+using sensors::SensorsPipelineBenchmark;
+using ulog::ULogWriter;
+
+#pragma pack(push, 1)
+struct SensorFifoRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	uint32_t device_id;
+	float dt;
+	float scale;
+	uint8_t samples;
+	int16_t x[32];
+	int16_t y[32];
+	int16_t z[32];
+};
+
+struct SensorMagRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	uint32_t device_id;
+	float x;
+	float y;
+	float z;
+	float temperature;
+	uint32_t error_count;
+};
+
+struct SensorBaroRecord {
+	uint64_t timestamp;
+	uint64_t timestamp_sample;
+	uint32_t device_id;
+	float pressure;
+	float temperature;
+	uint32_t error_count;
+};
+#pragma pack(pop)
+
+class SensorsPipelineBenchmarkTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		_log_path = std::string("/tmp/sensors_pipeline_benchmark_") + std::to_string(getpid()) + ".ulg";
+	}
+
+	void TearDown() override
+	{
+		remove(_log_path.c_str());
+	}
+
+	// write a log of a vehicle at rest with 2 IMUs sampled at 8 kHz (1 kHz FIFO reads), mag at 100 Hz and baro at 50 Hz
+	void writeLog(float duration_s)
+	{
+		ULogWriter writer;
+		ASSERT_TRUE(writer.open(_log_path.c_str(), 0));
+
+		const char *fifo_fields = "uint64_t timestamp;uint64_t timestamp_sample;uint32_t device_id;float dt;float scale;"
+					  "uint8_t samples;int16_t[32] x;int16_t[32] y;int16_t[32] z;";
+		writer.addFormat((std::string("sensor_gyro_fifo:") + fifo_fields).c_str());
+		writer.addFormat((std::string("sensor_accel_fifo:") + fifo_fields).c_str());
+		writer.addFormat("sensor_mag:uint64_t timestamp;uint64_t timestamp_sample;uint32_t device_id;float x;float y;"
+				 "float z;float temperature;uint32_t error_count;");
+		writer.addFormat("sensor_baro:uint64_t timestamp;uint64_t timestamp_sample;uint32_t device_id;float pressure;"
+				 "float temperature;uint32_t error_count;");
+
+		uint16_t gyro_id[IMU_COUNT];
+		uint16_t accel_id[IMU_COUNT];
+
+		for (uint8_t i = 0; i < IMU_COUNT; i++) {
+			gyro_id[i] = writer.addLoggedMessage("sensor_gyro_fifo", i);
+			accel_id[i] = writer.addLoggedMessage("sensor_accel_fifo", i);
+		}
+
+		const uint16_t mag_id = writer.addLoggedMessage("sensor_mag");
+		const uint16_t baro_id = writer.addLoggedMessage("sensor_baro");
+
+		const float gyro_scale = math::radians(2000.f) / 32768.f;
+		const float accel_scale = 16.f * CONSTANTS_ONE_G / 32768.f;
+		const uint64_t dt_us = 1000;
+
+		for (uint64_t t = dt_us; t <= (uint64_t)(duration_s * 1e6f); t += dt_us) {
+			for (uint8_t i = 0; i < IMU_COUNT; i++) {
+				SensorFifoRecord gyro{};
+				gyro.timestamp = t;
+				gyro.timestamp_sample = t;
+				gyro.device_id = 0x00210000 + i;
+				gyro.dt = dt_us / (float)SAMPLES;
+				gyro.scale = gyro_scale;
+				gyro.samples = SAMPLES;
+
+				SensorFifoRecord accel{gyro};
+				accel.device_id = 0x00110000 + i;
+				accel.scale = accel_scale;
+
+				for (int n = 0; n < SAMPLES; n++) {
+					// sensor noise of a few LSB
+					gyro.x[n] = (rand() % 7) - 3;
+					gyro.y[n] = (rand() % 7) - 3;
+					gyro.z[n] = (rand() % 7) - 3;
+					accel.x[n] = (rand() % 7) - 3;
+					accel.y[n] = (rand() % 7) - 3;
+					accel.z[n] = (int16_t)(-CONSTANTS_ONE_G / accel_scale) + (rand() % 7) - 3;
+				}
+
+				writer.writeData(accel_id[i], &accel, sizeof(accel));
+				writer.writeData(gyro_id[i], &gyro, sizeof(gyro));
+			}
+
+			if (t % 10000 == 0) {
+				SensorMagRecord mag{};
+				mag.timestamp = t;
+				mag.timestamp_sample = t;
+				mag.device_id = 0x00310000;
+				mag.x = 0.2f;
+				mag.z = 0.4f;
+				mag.temperature = 25.f;
+				writer.writeData(mag_id, &mag, sizeof(mag));
+			}
+
+			if (t % 20000 == 0) {
+				SensorBaroRecord baro{};
+				baro.timestamp = t;
+				baro.timestamp_sample = t;
+				baro.device_id = 0x00410000;
+				baro.pressure = 101325.f;
+				baro.temperature = 25.f;
+				writer.writeData(baro_id, &baro, sizeof(baro));
+			}
+		}
+
+		ASSERT_TRUE(writer.close());
+	}
+
+	static constexpr uint8_t IMU_COUNT = 2;
+	static constexpr int SAMPLES = 8;
+
+	std::string _log_path;
+};
+
+TEST_F(SensorsPipelineBenchmarkTest, syntheticLog)
+{
+	writeLog(5.f);
+
+	SensorsPipelineBenchmark benchmark;
+	ASSERT_TRUE(benchmark.run(_log_path.c_str())) << benchmark.error();
+	benchmark.print();
+
+	const SensorsPipelineBenchmark::Statistics &stats = benchmark.statistics();
+	EXPECT_EQ(stats.imu_count, IMU_COUNT);
+	EXPECT_EQ(stats.mag_count, 1);
+	EXPECT_EQ(stats.baro_count, 1);
+	EXPECT_NEAR(stats.log_duration_us, 5e6, 1000);
+
+	// every stage built in was run and the pipeline produced its outputs
+	using Stage = SensorsPipelineBenchmark::Stage;
+	EXPECT_GT(stats.stage[(int)Stage::Drivers].runs, 0u);
+	EXPECT_GT(stats.stage[(int)Stage::VehicleIMU].runs, 0u);
+	EXPECT_GT(stats.stage[(int)Stage::VotedSensorsUpdate].runs, 0u);
+#if defined(CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY)
+	EXPECT_GT(stats.stage[(int)Stage::VehicleAngularVelocity].runs, 0u);
+#endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
+#if defined(CONFIG_SENSORS_VEHICLE_ACCELERATION)
+	EXPECT_GT(stats.stage[(int)Stage::VehicleAcceleration].runs, 0u);
+#endif // CONFIG_SENSORS_VEHICLE_ACCELERATION
+#if defined(CONFIG_SENSORS_VEHICLE_MAGNETOMETER)
+	EXPECT_GT(stats.stage[(int)Stage::VehicleMagnetometer].runs, 0u);
+#endif // CONFIG_SENSORS_VEHICLE_MAGNETOMETER
+#if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
+	EXPECT_GT(stats.stage[(int)Stage::VehicleAirData].runs, 0u);
+#endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
+
+	EXPECT_GT(stats.vehicle_imu, 0u);
+	EXPECT_GT(stats.sensor_combined, 0u);
+}
+
+TEST_F(SensorsPipelineBenchmarkTest, recordedLog)
+{
+	// a flight log recorded with the high rate IMU logging profile (SDLOG_PROFILE)
+	const char *log_path = getenv("PX4_SENSORS_BENCHMARK_LOG");
+
+	if (log_path == nullptr) {
+		GTEST_SKIP() << "PX4_SENSORS_BENCHMARK_LOG not set";
+	}
+
+	SensorsPipelineBenchmark benchmark;
+	ASSERT_TRUE(benchmark.run(log_path)) << benchmark.error();
+	benchmark.print();
+
+	EXPECT_GT(benchmark.statistics().sensor_combined, 0u);
+}
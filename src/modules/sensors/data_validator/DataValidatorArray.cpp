@@ -0,0 +1,323 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file DataValidatorArray.cpp
+ *
+ * Fixed capacity data validation group, structure of arrays layout
+ */
+
+#include "DataValidatorArray.hpp"
+
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/log.h>
+#include <drivers/drv_hrt.h>
+
+#include <float.h>
+
+DataValidatorArray::DataValidatorArray(unsigned instances) :
+	_instances((instances > MAX_INSTANCES) ? MAX_INSTANCES : instances)
+{
+}
+
+bool DataValidatorArray::add_new_validator()
+{
+	if (_instances >= MAX_INSTANCES) {
+		return false;
+	}
+
+	_instances++;
+	return true;
+}
+
+inline void DataValidatorArray::update(unsigned i, uint64_t timestamp, const float val[dimensions],
+				       uint32_t error_count, uint8_t priority)
+{
+	_event_count[i]++;
+
+	if (error_count > _error_count[i]) {
+		_error_density[i] += (error_count - _error_count[i]);
+
+	} else if (_error_density[i] > 0) {
+		_error_density[i]--;
+	}
+
+	_error_count[i] = error_count;
+	_priority[i] = priority;
+
+	const bool first = (_time_last[i] == 0);
+	const float event_count_inv = 1.f / _event_count[i];
+
+	for (unsigned axis = 0; axis < dimensions; axis++) {
+		if (PX4_ISFINITE(val[axis])) {
+			if (first) {
+				_mean[axis][i] = 0.f;
+				_lp[axis][i] = val[axis];
+				_M2[axis][i] = 0.f;
+
+			} else {
+				const float lp_val = val[axis] - _lp[axis][i];
+
+				const float delta_val = lp_val - _mean[axis][i];
+				_mean[axis][i] += delta_val * event_count_inv;
+				_M2[axis][i] += delta_val * (lp_val - _mean[axis][i]);
+
+				if (fabsf(_value[i][axis] - val[axis]) < 0.000001f) {
+					_value_equal_count[i]++;
+
+				} else {
+					_value_equal_count[i] = 0;
+				}
+			}
+
+			_lp[axis][i] = _lp[axis][i] * 0.99f + 0.01f * val[axis];
+
+			_value[i][axis] = val[axis];
+		}
+	}
+
+	_time_last[i] = timestamp;
+}
+
+void DataValidatorArray::put(unsigned index, uint64_t timestamp, const float val[dimensions], uint32_t error_count,
+			     uint8_t priority)
+{
+	if (index < _instances) {
+		update(index, timestamp, val, error_count, priority);
+	}
+}
+
+void DataValidatorArray::put(uint32_t updated_mask, const uint64_t timestamp[MAX_INSTANCES],
+			     const float val[MAX_INSTANCES][dimensions], const uint32_t error_count[MAX_INSTANCES],
+			     const uint8_t priority[MAX_INSTANCES])
+{
+	for (unsigned i = 0; i < _instances; i++) {
+		if (updated_mask & (1u << i)) {
+			update(i, timestamp[i], val[i], error_count[i], priority[i]);
+		}
+	}
+}
+
+float DataValidatorArray::confidence(unsigned index, uint64_t timestamp)
+{
+	if (index >= _instances) {
+		return 0.f;
+	}
+
+	update_confidence(timestamp);
+	return _confidence[index];
+}
+
+void DataValidatorArray::update_confidence(uint64_t timestamp)
+{
+	for (unsigned i = 0; i < _instances; i++) {
+		float ret = 1.f;
+
+		if (_time_last[i] == 0) {
+			// no data
+			_error_mask[i] |= DataValidator::ERROR_FLAG_NO_DATA;
+			ret = 0.f;
+
+		} else if (timestamp > _time_last[i] + _timeout_interval_us) {
+			_error_mask[i] |= DataValidator::ERROR_FLAG_TIMEOUT;
+			ret = 0.f;
+
+		} else if (_value_equal_count[i] > _value_equal_count_threshold) {
+			// the exact same sensor value N times in a row
+			_error_mask[i] |= DataValidator::ERROR_FLAG_STALE_DATA;
+			ret = 0.f;
+
+		} else if (_error_count[i] > NORETURN_ERRCOUNT) {
+			_error_mask[i] |= DataValidator::ERROR_FLAG_HIGH_ERRCOUNT;
+			ret = 0.f;
+
+		} else if (_error_density[i] > ERROR_DENSITY_WINDOW) {
+			// cap error density counter at window size
+			_error_mask[i] |= DataValidator::ERROR_FLAG_HIGH_ERRDENSITY;
+			_error_density[i] = (int32_t)ERROR_DENSITY_WINDOW;
+		}
+
+		if (ret > 0.f) {
+			// local error density for the last N measurements
+			ret = 1.f - (_error_density[i] / ERROR_DENSITY_WINDOW);
+
+			if (ret > 0.f) {
+				_error_mask[i] = DataValidator::ERROR_FLAG_NO_ERROR;
+			}
+		}
+
+		_confidence[i] = ret;
+	}
+}
+
+float *DataValidatorArray::get_best(uint64_t timestamp, int *index)
+{
+	update_confidence(timestamp);
+
+	const int pre_check_best = _curr_best;
+	float pre_check_confidence = 1.f;
+	int pre_check_prio = -1;
+	float max_confidence = -1.f;
+	int max_priority = -1000;
+	int max_index = -1;
+
+	// start from the currently selected sensor
+	if ((pre_check_best >= 0) && (pre_check_best < (int)_instances)) {
+		pre_check_prio = _priority[pre_check_best];
+		pre_check_confidence = _confidence[pre_check_best];
+
+		max_index = pre_check_best;
+		max_confidence = pre_check_confidence;
+		max_priority = pre_check_prio;
+	}
+
+	for (unsigned i = 0; i < _instances; i++) {
+		const float confidence = _confidence[i];
+		const int priority = _priority[i];
+
+		/*
+		 * Switch if:
+		 * 1) the confidence is higher and priority is equal or higher
+		 * 2) the confidence is less than 1% different and the priority is higher
+		 */
+		if ((((max_confidence < MIN_REGULAR_CONFIDENCE) && (confidence >= MIN_REGULAR_CONFIDENCE)) ||
+		     (confidence > max_confidence && (priority >= max_priority)) ||
+		     (fabsf(confidence - max_confidence) < 0.01f && (priority > max_priority))) &&
+		    (confidence > 0.f)) {
+			max_index = i;
+			max_confidence = confidence;
+			max_priority = priority;
+		}
+	}
+
+	const int best = max_index;
+
+	// the current best sensor is not matching the previous best sensor, or the only sensor went bad
+	if (max_index != _curr_best || ((max_confidence < FLT_EPSILON) && (_curr_best >= 0))) {
+		bool true_failsafe = true;
+
+		// check whether the switch was a failsafe or preferring a higher priority sensor
+		if (pre_check_prio != -1 && pre_check_prio < max_priority &&
+		    fabsf(pre_check_confidence - max_confidence) < 0.1f) {
+			// this is not a failover
+			true_failsafe = false;
+
+			// reset error flags, this is likely a hotplug sensor coming online late
+			if (best >= 0) {
+				_error_mask[best] = DataValidator::ERROR_FLAG_NO_ERROR;
+			}
+		}
+
+		if (_curr_best < 0) {
+			// initialize the bookkeeping but do not count a failsafe
+			_prev_best = max_index;
+
+		} else {
+			// we were initialized before, this is a real failsafe
+			_prev_best = pre_check_best;
+
+			if (true_failsafe) {
+				_toggle_count++;
+
+				// if this is the first time, log when we failed
+				if (_first_failover_time == 0) {
+					_first_failover_time = timestamp;
+				}
+
+				if (max_confidence < FLT_EPSILON) {
+					max_index = -1;
+				}
+			}
+		}
+
+		// for all cases we want to keep a record of the best index
+		_curr_best = max_index;
+	}
+
+	*index = max_index;
+	return (best >= 0) ? _value[best] : nullptr;
+}
+
+int DataValidatorArray::failover_index() const
+{
+	if ((_prev_best >= 0) && used(_prev_best) && (_error_mask[_prev_best] != DataValidator::ERROR_FLAG_NO_ERROR)) {
+		return _prev_best;
+	}
+
+	return -1;
+}
+
+uint32_t DataValidatorArray::failover_state() const
+{
+	const int index = failover_index();
+
+	return (index >= 0) ? _error_mask[index] : DataValidator::ERROR_FLAG_NO_ERROR;
+}
+
+void DataValidatorArray::rms(unsigned index, float rms[dimensions]) const
+{
+	for (unsigned axis = 0; axis < dimensions; axis++) {
+		rms[axis] = ((index < _instances) && (_event_count[index] > 1)) ?
+			    sqrtf(_M2[axis][index] / (_event_count[index] - 1)) : 0.f;
+	}
+}
+
+void DataValidatorArray::print()
+{
+	PX4_INFO_RAW("validator: best: %d, prev best: %d, failsafe: %s (%u events)\n", _curr_best, _prev_best,
+		     (_toggle_count > 0) ? "YES" : "NO", _toggle_count);
+
+	update_confidence(hrt_absolute_time());
+
+	for (unsigned i = 0; i < _instances; i++) {
+		if (used(i)) {
+			const uint32_t flags = _error_mask[i];
+
+			PX4_INFO_RAW("sensor #%u, prio: %d, state:%s%s%s%s%s%s\n", i, _priority[i],
+				     ((flags & DataValidator::ERROR_FLAG_NO_DATA) ? " OFF" : ""),
+				     ((flags & DataValidator::ERROR_FLAG_STALE_DATA) ? " STALE" : ""),
+				     ((flags & DataValidator::ERROR_FLAG_TIMEOUT) ? " TOUT" : ""),
+				     ((flags & DataValidator::ERROR_FLAG_HIGH_ERRCOUNT) ? " ECNT" : ""),
+				     ((flags & DataValidator::ERROR_FLAG_HIGH_ERRDENSITY) ? " EDNST" : ""),
+				     ((flags == DataValidator::ERROR_FLAG_NO_ERROR) ? " OK" : ""));
+
+			float rms_error[dimensions];
+			rms(i, rms_error);
+
+			for (unsigned axis = 0; axis < dimensions; axis++) {
+				PX4_INFO_RAW("\tval: %8.4f, lp: %8.4f mean dev: %8.4f RMS: %8.4f conf: %8.4f\n", (double)_value[i][axis],
+					     (double)_lp[axis][i], (double)_mean[axis][i], (double)rms_error[axis], (double)_confidence[i]);
+			}
+		}
+	}
+}
@@ -0,0 +1,208 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file DataValidatorArray.hpp
+ *
+ * Fixed capacity data validation group with the per instance state stored as
+ * structure of arrays. Selects the same sensor as DataValidatorGroup, but all
+ * instances are updated and checked in a single pass over flat arrays.
+ */
+
+#pragma once
+
+#include "DataValidator.hpp"
+
+class DataValidatorArray
+{
+public:
+	static constexpr unsigned MAX_INSTANCES = 4;
+	static constexpr unsigned dimensions = DataValidator::dimensions;
+
+	/**
+	 * @param instances initial number of validated instances. Must be > 0.
+	 */
+	explicit DataValidatorArray(unsigned instances = 1);
+	~DataValidatorArray() = default;
+
+	// no copy, assignment, move, move assignment
+	DataValidatorArray(const DataValidatorArray &) = delete;
+	DataValidatorArray &operator=(const DataValidatorArray &) = delete;
+	DataValidatorArray(DataValidatorArray &&) = delete;
+	DataValidatorArray &operator=(DataValidatorArray &&) = delete;
+
+	/**
+	 * Add an instance (with index equal to the number of current instances)
+	 * @return false if the array is full
+	 */
+	bool add_new_validator();
+
+	unsigned instances() const { return _instances; }
+
+	/**
+	 * Put an item into the validator of a single instance.
+	 *
+	 * @param index		Sensor index
+	 * @param timestamp	The timestamp of the measurement
+	 * @param val		The 3D vector
+	 * @param error_count	The current error count of the sensor
+	 * @param priority	The priority of the sensor
+	 */
+	void put(unsigned index, uint64_t timestamp, const float val[dimensions], uint32_t error_count, uint8_t priority);
+
+	/**
+	 * Put one item for every instance set in updated_mask (bit i for instance i).
+	 * The arrays are indexed by instance.
+	 */
+	void put(uint32_t updated_mask, const uint64_t timestamp[MAX_INSTANCES], const float val[MAX_INSTANCES][dimensions],
+		 const uint32_t error_count[MAX_INSTANCES], const uint8_t priority[MAX_INSTANCES]);
+
+	/**
+	 * Get the best data triplet of the group
+	 *
+	 * @return		pointer to the array of best values
+	 */
+	float *get_best(uint64_t timestamp, int *index);
+
+	/**
+	 * Get the number of failover events
+	 *
+	 * @return		the number of failovers
+	 */
+	unsigned failover_count() const { return _toggle_count; }
+
+	/**
+	 * Get the index of the failed sensor in the group
+	 *
+	 * @return		index of the failed sensor
+	 */
+	int failover_index() const;
+
+	/**
+	 * Get the error state of the failed sensor in the group
+	 *
+	 * @return		bitmask with error states of the failed sensor
+	 */
+	uint32_t failover_state() const;
+
+	/**
+	 * Get the error state of the sensor with the specified index
+	 *
+	 * @return		bitmask with error states of the sensor
+	 */
+	uint32_t get_sensor_state(unsigned index) const { return (index < _instances) ? _error_mask[index] : UINT32_MAX; }
+
+	/**
+	 * Get the priority of the sensor with the specified index
+	 *
+	 * @return		priority
+	 */
+	uint8_t get_sensor_priority(unsigned index) const { return (index < _instances) ? _priority[index] : 0; }
+
+	/**
+	 * Get the confidence of the sensor with the specified index, this updates the error state.
+	 * @return		the confidence between 0 and 1
+	 */
+	float confidence(unsigned index, uint64_t timestamp);
+
+	uint32_t error_count(unsigned index) const { return (index < _instances) ? _error_count[index] : 0; }
+	const float *value(unsigned index) const { return (index < _instances) ? _value[index] : nullptr; }
+	bool used(unsigned index) const { return (index < _instances) && (_time_last[index] > 0); }
+
+	/**
+	 * Get the RMS error of the sensor with the specified index
+	 *
+	 * @param rms (out) RMS error per axis
+	 */
+	void rms(unsigned index, float rms[dimensions]) const;
+
+	/**
+	 * Print the validator value
+	 *
+	 */
+	void print();
+
+	/**
+	 * Set the timeout value for all instances, including those added later
+	 *
+	 * @param timeout_interval_us The timeout interval in microseconds
+	 */
+	void set_timeout(uint32_t timeout_interval_us) { _timeout_interval_us = timeout_interval_us; }
+
+	/**
+	 * Set the equal count threshold for all instances, including those added later
+	 *
+	 * @param threshold The number of equal values before considering the sensor stale
+	 */
+	void set_equal_value_threshold(uint32_t threshold) { _value_equal_count_threshold = threshold; }
+
+private:
+	void update(unsigned i, uint64_t timestamp, const float val[dimensions], uint32_t error_count, uint8_t priority);
+	void update_confidence(uint64_t timestamp);
+
+	unsigned _instances{1};
+
+	uint32_t _timeout_interval_us{40000};
+	uint32_t _value_equal_count_threshold{VALUE_EQUAL_COUNT_DEFAULT};
+
+	// per instance state
+	uint64_t _time_last[MAX_INSTANCES] {};
+	uint32_t _event_count[MAX_INSTANCES] {};
+	uint32_t _error_count[MAX_INSTANCES] {};
+	int32_t _error_density[MAX_INSTANCES] {};
+	uint32_t _error_mask[MAX_INSTANCES] {};
+	uint32_t _value_equal_count[MAX_INSTANCES] {};
+	uint8_t _priority[MAX_INSTANCES] {};
+
+	// per axis state, the RMS is only computed from _M2 on request
+	float _mean[dimensions][MAX_INSTANCES] {};
+	float _lp[dimensions][MAX_INSTANCES] {};
+	float _M2[dimensions][MAX_INSTANCES] {};
+
+	float _value[MAX_INSTANCES][dimensions] {}; /**< last value, contiguous per instance for get_best() */
+
+	float _confidence[MAX_INSTANCES] {};
+
+	int _curr_best{-1}; /**< currently best index */
+	int _prev_best{-1}; /**< the previous best index */
+
+	uint64_t _first_failover_time{0}; /**< timestamp where the first failover occured or zero if none occured */
+
+	unsigned _toggle_count{0}; /**< number of back and forth switches between two sensors */
+
+	static constexpr float MIN_REGULAR_CONFIDENCE = 0.9f;
+
+	static constexpr uint32_t NORETURN_ERRCOUNT = 10000;
+	static constexpr float ERROR_DENSITY_WINDOW = 100.0f;
+	static constexpr uint32_t VALUE_EQUAL_COUNT_DEFAULT = 100;
+};
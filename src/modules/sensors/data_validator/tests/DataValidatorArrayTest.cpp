@@ -0,0 +1,259 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * Test DataValidatorArray against DataValidatorGroup and measure the throughput of both
+ * Run this test only using make tests TESTFILTER=DataValidatorArray
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <math.h>
+#include <stdlib.h>
+
+#include "../DataValidatorArray.hpp"
+#include "../DataValidatorGroup.hpp"
+
+static constexpr unsigned INSTANCES = DataValidatorArray::MAX_INSTANCES;
+static constexpr uint64_t DT_US = 1000; // 1 kHz
+static constexpr uint32_t TIMEOUT_US = 20000;
+
+class DataValidatorArrayTest : public ::testing::Test
+{
+public:
+	struct Sample {
+		uint32_t updated_mask;
+		uint64_t timestamp[INSTANCES];
+		float value[INSTANCES][3];
+		uint32_t error_count[INSTANCES];
+		uint8_t priority[INSTANCES];
+	};
+
+	// 4 noisy IMUs with a dropout of the primary, an error burst, a stuck sensor, NaN and a priority change
+	static void generate(Sample *samples, int count)
+	{
+		uint32_t error_count[INSTANCES] {};
+		srand(0);
+
+		for (int n = 0; n < count; n++) {
+			Sample &s = samples[n];
+			s.updated_mask = 0;
+
+			for (unsigned i = 0; i < INSTANCES; i++) {
+				const bool dropout = (i == 0) && (n > count / 4) && (n < count / 4 + 50);
+
+				if (!dropout) {
+					s.updated_mask |= 1u << i;
+				}
+
+				if ((i == 2) && (n > count / 2) && (n < count / 2 + 200)) {
+					error_count[i]++;
+				}
+
+				for (int axis = 0; axis < 3; axis++) {
+					const float noise = 0.05f * ((float)rand() / (float)RAND_MAX - 0.5f);
+					const bool stuck = (i == 3) && (n > 3 * count / 4);
+					s.value[i][axis] = stuck ? 1.f : 9.81f * (axis == 2) + noise;
+				}
+
+				if ((i == 0) && (n == count / 8)) {
+					s.value[i][1] = NAN;
+				}
+
+				s.timestamp[i] = (n + 1) * DT_US;
+				s.error_count[i] = error_count[i];
+				s.priority[i] = ((i == 1) && (n > count / 2)) ? 75 : 50;
+			}
+		}
+	}
+};
+
+TEST_F(DataValidatorArrayTest, capacity)
+{
+	DataValidatorArray array{1};
+	EXPECT_EQ(array.instances(), 1u);
+
+	for (unsigned i = 1; i < INSTANCES; i++) {
+		EXPECT_TRUE(array.add_new_validator());
+	}
+
+	EXPECT_FALSE(array.add_new_validator());
+	EXPECT_EQ(array.instances(), INSTANCES);
+
+	int best_index = 0;
+	EXPECT_EQ(array.get_best(DT_US, &best_index), nullptr);
+	EXPECT_EQ(best_index, -1);
+	EXPECT_EQ(array.get_sensor_state(0), DataValidator::ERROR_FLAG_NO_DATA);
+}
+
+TEST_F(DataValidatorArrayTest, equalThresholdAppliesToAddedInstances)
+{
+	DataValidatorArray array{1};
+	array.set_equal_value_threshold(30);
+	array.add_new_validator();
+
+	const float value[3] {1.f, 2.f, 3.f};
+
+	// the equal count accumulates over all axes
+	for (int n = 1; n <= 11; n++) {
+		array.put(1, n * DT_US, value, 0, 50);
+	}
+
+	EXPECT_GT(array.confidence(1, 11 * DT_US), 0.f);
+
+	array.put(1, 12 * DT_US, value, 0, 50);
+	EXPECT_EQ(array.confidence(1, 12 * DT_US), 0.f);
+	EXPECT_EQ(array.get_sensor_state(1), DataValidator::ERROR_FLAG_STALE_DATA);
+}
+
+TEST_F(DataValidatorArrayTest, matchesDataValidatorGroup)
+{
+	static constexpr int COUNT = 4000;
+	static Sample samples[COUNT];
+	generate(samples, COUNT);
+
+	DataValidatorGroup group{1};
+	DataValidatorArray array{1};
+
+	for (unsigned i = 1; i < INSTANCES; i++) {
+		group.add_new_validator();
+		array.add_new_validator();
+	}
+
+	group.set_timeout(TIMEOUT_US);
+	array.set_timeout(TIMEOUT_US);
+
+	for (int n = 0; n < COUNT; n++) {
+		const Sample &s = samples[n];
+
+		for (unsigned i = 0; i < INSTANCES; i++) {
+			if (s.updated_mask & (1u << i)) {
+				group.put(i, s.timestamp[i], s.value[i], s.error_count[i], s.priority[i]);
+			}
+		}
+
+		array.put(s.updated_mask, s.timestamp, s.value, s.error_count, s.priority);
+
+		int group_index = -1;
+		int array_index = -1;
+		const float *group_best = group.get_best(s.timestamp[0], &group_index);
+		const float *array_best = array.get_best(s.timestamp[0], &array_index);
+
+		ASSERT_EQ(group_index, array_index) << "sample " << n;
+		ASSERT_EQ(group_best == nullptr, array_best == nullptr);
+
+		if (group_best) {
+			for (int axis = 0; axis < 3; axis++) {
+				EXPECT_EQ(group_best[axis], array_best[axis]);
+			}
+		}
+
+		ASSERT_EQ(group.failover_count(), array.failover_count());
+		ASSERT_EQ(group.failover_index(), array.failover_index());
+		ASSERT_EQ(group.failover_state(), array.failover_state());
+
+		for (unsigned i = 0; i < INSTANCES; i++) {
+			ASSERT_EQ(group.get_sensor_state(i), array.get_sensor_state(i)) << "sample " << n << " instance " << i;
+			ASSERT_EQ(group.get_sensor_priority(i), array.get_sensor_priority(i));
+		}
+	}
+
+	// the scenario must have exercised failovers and error states
+	EXPECT_GT(array.failover_count(), 0u);
+	EXPECT_NE(array.get_sensor_state(3), DataValidator::ERROR_FLAG_NO_ERROR);
+}
+
+TEST_F(DataValidatorArrayTest, throughput)
+{
+	// 4 instances at 1 kHz for 10 s
+	static constexpr int COUNT = 10000;
+	static constexpr int ROUNDS = 5;
+	static Sample samples[COUNT];
+	generate(samples, COUNT);
+
+	double group_us = INFINITY;
+	double array_us = INFINITY;
+	int index_sum = 0;
+
+	// best of several rounds to reject scheduling noise
+	for (int round = 0; round < ROUNDS; round++) {
+		DataValidatorGroup group{1};
+		DataValidatorArray array{1};
+
+		for (unsigned i = 1; i < INSTANCES; i++) {
+			group.add_new_validator();
+			array.add_new_validator();
+		}
+
+		const auto group_start = std::chrono::steady_clock::now();
+
+		for (int n = 0; n < COUNT; n++) {
+			const Sample &s = samples[n];
+
+			for (unsigned i = 0; i < INSTANCES; i++) {
+				if (s.updated_mask & (1u << i)) {
+					group.put(i, s.timestamp[i], s.value[i], s.error_count[i], s.priority[i]);
+				}
+			}
+
+			int index;
+			group.get_best(s.timestamp[0], &index);
+			index_sum += index;
+		}
+
+		const auto array_start = std::chrono::steady_clock::now();
+
+		for (int n = 0; n < COUNT; n++) {
+			const Sample &s = samples[n];
+			array.put(s.updated_mask, s.timestamp, s.value, s.error_count, s.priority);
+
+			int index;
+			array.get_best(s.timestamp[0], &index);
+			index_sum += index;
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		group_us = fmin(group_us, std::chrono::duration<double, std::micro>(array_start - group_start).count() / COUNT);
+		array_us = fmin(array_us, std::chrono::duration<double, std::micro>(end - array_start).count() / COUNT);
+	}
+
+	printf("voting %u instances at 1 kHz: DataValidatorGroup %.3f us, DataValidatorArray %.3f us per update\n",
+	       INSTANCES, group_us, array_us);
+
+	EXPECT_NE(index_sum, 0);
+
+	// must keep up with the IMU rate with a wide margin
+	EXPECT_LT(array_us, 0.1 * DT_US);
+}
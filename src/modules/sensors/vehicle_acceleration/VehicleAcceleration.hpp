@@ -67,9 +67,10 @@ public:
 
 	void PrintStatus();
 
-private:
+protected:
 	void Run() override;
 
+private:
 	void CheckAndUpdateFilters();
 	void ParametersUpdate(bool force = false);
 	void SensorBiasUpdate(bool force = false);
@@ -72,6 +72,9 @@ public:
 
 	void PrintStatus();
 
+protected:
+	void Run() override;
+
 private:
 	enum TemperatureSource {
 		DEFAULT_TEMP = 0,
@@ -79,8 +82,6 @@ private:
 		AIRSPEED = 2,
 	};
 
-	void Run() override;
-
 	float AirTemperatureUpdate(const float temperature_baro, TemperatureSource &source, const hrt_abstime time_now_us);
 	void CheckFailover(const hrt_abstime &time_now_us);
 	bool ParametersUpdate(bool force = false);
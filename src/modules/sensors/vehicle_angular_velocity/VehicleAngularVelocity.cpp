@@ -722,7 +722,7 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 #endif // !CONSTRAINED_FLASH
 }
 
-float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N)
+Vector3f VehicleAngularVelocity::FilterAngularVelocity()
 {
 #if !defined(CONSTRAINED_FLASH)
 
@@ -731,9 +731,8 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 		for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
 			if (_esc_available[esc]) {
 				for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-					if (_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
-						_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].applyArray(data, N);
-					}
+					auto &nf = _dynamic_notch_filter_esc_rpm[harmonic];
+					_filter_bank.add(nf[0][esc], nf[1][esc], nf[2][esc]);
 				}
 			}
 		}
@@ -742,40 +741,38 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 	// Apply dynamic notch filter from FFT
 	if (_dynamic_notch_fft_available) {
 		for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
-			if (_dynamic_notch_filter_fft[axis][peak].getNotchFreq() > 0.f) {
-				_dynamic_notch_filter_fft[axis][peak].applyArray(data, N);
-			}
+			_filter_bank.add(_dynamic_notch_filter_fft[0][peak], _dynamic_notch_filter_fft[1][peak],
+					 _dynamic_notch_filter_fft[2][peak]);
 		}
 	}
 
 #endif // !CONSTRAINED_FLASH
 
 	// Apply general notch filter 0 (IMU_GYRO_NF0_FRQ)
-	if (_notch_filter0_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter0_velocity[axis].applyArray(data, N);
-	}
+	_filter_bank.add(_notch_filter0_velocity);
 
 	// Apply general notch filter 1 (IMU_GYRO_NF1_FRQ)
-	if (_notch_filter1_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter1_velocity[axis].applyArray(data, N);
-	}
+	_filter_bank.add(_notch_filter1_velocity);
 
 	// Apply general low-pass filter (IMU_GYRO_CUTOFF)
-	_lp_filter_velocity[axis].applyArray(data, N);
+	_filter_bank.add(_lp_filter_velocity);
+
+	_filter_bank.run();
 
 	// return last filtered sample
-	return data[N - 1];
+	return Vector3f{_filter_bank.last(0), _filter_bank.last(1), _filter_bank.last(2)};
 }
 
-float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N)
+float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s)
 {
 	// angular acceleration: Differentiate & apply specific angular acceleration (D-term) low-pass (IMU_DGYRO_CUTOFF)
 	float angular_acceleration_filtered = 0.f;
 
-	for (int n = 0; n < N; n++) {
-		const float angular_acceleration = (data[n] - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
+	for (int n = 0; n < _filter_bank.sampleCount(); n++) {
+		const float angular_velocity = _filter_bank.sample(n, axis);
+		const float angular_acceleration = (angular_velocity - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
 		angular_acceleration_filtered = _lp_filter_acceleration[axis].update(angular_acceleration);
-		_angular_velocity_raw_prev(axis) = data[n];
+		_angular_velocity_raw_prev(axis) = angular_velocity;
 	}
 
 	return angular_acceleration_filtered;
@@ -830,25 +827,22 @@ void VehicleAngularVelocity::Run()
 
 			const float inverse_dt_s = 1e6f / sensor_fifo_data.dt;
 			const int N = sensor_fifo_data.samples;
-			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
 
-			if ((sensor_fifo_data.dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
+			if ((sensor_fifo_data.dt > 0) && _filter_bank.setSampleCount(N)) {
+				// copy raw int16 sensor samples to float for filtering
+				for (int n = 0; n < N; n++) {
+					_filter_bank.setSample(n,
+							       sensor_fifo_data.scale * sensor_fifo_data.x[n],
+							       sensor_fifo_data.scale * sensor_fifo_data.y[n],
+							       sensor_fifo_data.scale * sensor_fifo_data.z[n]);
+				}
 
-				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity()};
+				Vector3f angular_acceleration_uncalibrated;
 
 				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
-					float data[FIFO_SIZE_MAX];
-
-					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
-					}
-
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s);
 				}
 
 				// Publish
@@ -882,18 +876,15 @@ void VehicleAngularVelocity::Run()
 							   0.00002f, 0.02f);
 				_timestamp_sample_last = sensor_data.timestamp_sample;
 
-				Vector3f angular_velocity_uncalibrated;
-				Vector3f angular_acceleration_uncalibrated;
+				_filter_bank.setSampleCount(1);
+				_filter_bank.setSample(0, sensor_data.x, sensor_data.y, sensor_data.z);
 
-				float raw_data_array[] {sensor_data.x, sensor_data.y, sensor_data.z};
+				// save last filtered sample
+				const Vector3f angular_velocity_uncalibrated{FilterAngularVelocity()};
+				Vector3f angular_acceleration_uncalibrated;
 
 				for (int axis = 0; axis < 3; axis++) {
-					// copy sensor sample to float array for filtering
-					float data[1] {raw_data_array[axis]};
-
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data);
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s);
 				}
 
 				// Publish
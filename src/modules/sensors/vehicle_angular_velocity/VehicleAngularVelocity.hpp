@@ -39,6 +39,7 @@
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/mathlib/math/filter/AlphaFilter.hpp>
 #include <lib/mathlib/math/filter/LowPassFilter2p.hpp>
+#include <lib/mathlib/math/filter/MultiAxisFilterBank.hpp>
 #include <lib/mathlib/math/filter/NotchFilter.hpp>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/module_params.h>
@@ -72,14 +73,15 @@ public:
 	bool Start();
 	void Stop();
 
-private:
+protected:
 	void Run() override;
 
+private:
 	bool CalibrateAndPublish(const hrt_abstime &timestamp_sample, const matrix::Vector3f &angular_velocity_uncalibrated,
 				 const matrix::Vector3f &angular_acceleration_uncalibrated);
 
-	inline float FilterAngularVelocity(int axis, float data[], int N = 1);
-	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1);
+	inline matrix::Vector3f FilterAngularVelocity();
+	inline float FilterAngularAcceleration(int axis, float inverse_dt_s);
 
 	void DisableDynamicNotchEscRpm();
 	void DisableDynamicNotchFFT();
@@ -128,6 +130,11 @@ private:
 
 	float _filter_sample_rate_hz{NAN};
 
+	static constexpr int FIFO_SIZE_MAX = sizeof(sensor_gyro_fifo_s::x) / sizeof(sensor_gyro_fifo_s::x[0]);
+
+	// samples of the current batch, filtered in place on all axes
+	math::MultiAxisFilterBank<FIFO_SIZE_MAX> _filter_bank{};
+
 	// angular velocity filters
 	math::LowPassFilter2p<float> _lp_filter_velocity[3] {};
 	math::NotchFilter<float> _notch_filter0_velocity[3] {};
@@ -125,6 +125,7 @@ bool VehicleIMU::ParametersUpdate(bool force)
 		_gyro_calibration.ParametersUpdate();
 
 		_notify_clipping = _param_sens_imu_notify_clipping.get();
+		_integrate_fifo = _param_imu_integ_fifo.get();
 
 		if (accel_calibration_count != _accel_calibration.calibration_count()) {
 			// if calibration changed reset any existing learned calibration
@@ -353,7 +354,10 @@ bool VehicleIMU::UpdateAccel()
 
 		const Vector3f accel_raw{accel.x, accel.y, accel.z};
 		_raw_accel_mean.update(accel_raw);
-		_accel_integrator.put(accel_raw, dt);
+
+		if (!_integrate_fifo || !IntegrateAccelFifo(accel, dt)) {
+			_accel_integrator.put(accel_raw, dt);
+		}
 
 		updated = true;
 
@@ -482,7 +486,10 @@ bool VehicleIMU::UpdateGyro()
 
 		const Vector3f gyro_raw{gyro.x, gyro.y, gyro.z};
 		_raw_gyro_mean.update(gyro_raw);
-		_gyro_integrator.put(gyro_raw, dt);
+
+		if (!_integrate_fifo || !IntegrateGyroFifo(gyro, dt)) {
+			_gyro_integrator.put(gyro_raw, dt);
+		}
 
 		updated = true;
 
@@ -536,6 +543,63 @@ bool VehicleIMU::UpdateGyro()
 	return updated;
 }
 
+template<typename T>
+bool VehicleIMU::FifoUpdate(uORB::Subscription &fifo_sub, T &fifo, uint32_t &fifo_device_id, hrt_abstime &fifo_lookup,
+			    uint32_t device_id, hrt_abstime timestamp_sample)
+{
+	if ((fifo_device_id != device_id) && ((fifo_lookup == 0) || (timestamp_sample >= fifo_lookup + 1_s))) {
+		// find the FIFO instance of the sensor, retried until the driver has advertised it
+		fifo_lookup = timestamp_sample;
+
+		for (uint8_t i = 0; i < ORB_MULTI_MAX_INSTANCES; i++) {
+			uORB::SubscriptionData<T> sub{fifo_sub.get_topic(), i};
+
+			if (sub.advertised() && (sub.get().device_id == device_id) && fifo_sub.ChangeInstance(i)) {
+				fifo_device_id = device_id;
+				fifo = {};
+				break;
+			}
+		}
+	}
+
+	if (fifo_device_id != device_id) {
+		return false;
+	}
+
+	// the drivers publish the raw FIFO right before the integrated sample of the same transfer
+	while ((fifo.timestamp_sample < timestamp_sample) && fifo_sub.update(&fifo)) {}
+
+	return (fifo.device_id == device_id) && (fifo.timestamp_sample == timestamp_sample)
+	       && (fifo.samples > 0) && (fifo.samples <= Integrator::MAX_BATCH_SAMPLES);
+}
+
+bool VehicleIMU::IntegrateAccelFifo(const sensor_accel_s &accel, float dt)
+{
+	if (FifoUpdate(_sensor_accel_fifo_sub, _sensor_accel_fifo, _accel_fifo_device_id, _accel_fifo_lookup,
+		       accel.device_id, accel.timestamp_sample)) {
+
+		const sensor_accel_fifo_s &fifo = _sensor_accel_fifo;
+		_accel_integrator.put(fifo.x, fifo.y, fifo.z, fifo.samples, fifo.scale, dt / fifo.samples);
+		return true;
+	}
+
+	return false;
+}
+
+bool VehicleIMU::IntegrateGyroFifo(const sensor_gyro_s &gyro, float dt)
+{
+	if (FifoUpdate(_sensor_gyro_fifo_sub, _sensor_gyro_fifo, _gyro_fifo_device_id, _gyro_fifo_lookup,
+		       gyro.device_id, gyro.timestamp_sample)) {
+
+		// coning corrections with every raw sample
+		const sensor_gyro_fifo_s &fifo = _sensor_gyro_fifo;
+		_gyro_integrator.put(fifo.x, fifo.y, fifo.z, fifo.samples, fifo.scale, dt / fifo.samples);
+		return true;
+	}
+
+	return false;
+}
+
 bool VehicleIMU::Publish()
 {
 	bool updated = false;
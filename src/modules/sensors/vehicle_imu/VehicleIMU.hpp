@@ -53,7 +53,9 @@
 #include <uORB/topics/estimator_sensor_bias.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_accel.h>
+#include <uORB/topics/sensor_accel_fifo.h>
 #include <uORB/topics/sensor_gyro.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/vehicle_control_mode.h>
 #include <uORB/topics/vehicle_imu.h>
 #include <uORB/topics/vehicle_imu_status.h>
@@ -76,14 +78,23 @@ public:
 
 	void PrintStatus();
 
+protected:
+	void Run() override;
+
 private:
 	bool ParametersUpdate(bool force = false);
 	bool Publish();
-	void Run() override;
 
 	bool UpdateAccel();
 	bool UpdateGyro();
 
+	bool IntegrateAccelFifo(const sensor_accel_s &accel, float dt);
+	bool IntegrateGyroFifo(const sensor_gyro_s &gyro, float dt);
+
+	template<typename T>
+	static bool FifoUpdate(uORB::Subscription &fifo_sub, T &fifo, uint32_t &fifo_device_id, hrt_abstime &fifo_lookup,
+			       uint32_t device_id, hrt_abstime timestamp_sample);
+
 	void UpdateIntegratorConfiguration();
 
 	inline void UpdateAccelVibrationMetrics(const matrix::Vector3f &acceleration);
@@ -111,6 +122,19 @@ private:
 
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 
+	// raw FIFO samples of the selected accel & gyro (IMU_INTEG_FIFO)
+	uORB::Subscription _sensor_accel_fifo_sub{ORB_ID(sensor_accel_fifo)};
+	uORB::Subscription _sensor_gyro_fifo_sub{ORB_ID(sensor_gyro_fifo)};
+
+	sensor_accel_fifo_s _sensor_accel_fifo{};
+	sensor_gyro_fifo_s _sensor_gyro_fifo{};
+
+	uint32_t _accel_fifo_device_id{0};
+	uint32_t _gyro_fifo_device_id{0};
+
+	hrt_abstime _accel_fifo_lookup{0};
+	hrt_abstime _gyro_fifo_lookup{0};
+
 	calibration::Accelerometer _accel_calibration{};
 	calibration::Gyroscope _gyro_calibration{};
 
@@ -159,6 +183,7 @@ private:
 	uint8_t     _delta_velocity_clipping{0};
 
 	bool _notify_clipping{true};
+	bool _integrate_fifo{false};
 
 	hrt_abstime _last_accel_clipping_notify_time{0};
 	hrt_abstime _last_gyro_clipping_notify_time{0};
@@ -200,6 +225,7 @@ private:
 
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::IMU_INTEG_RATE>) _param_imu_integ_rate,
+		(ParamBool<px4::params::IMU_INTEG_FIFO>) _param_imu_integ_fifo,
 		(ParamBool<px4::params::SENS_IMU_AUTOCAL>) _param_sens_imu_autocal,
 		(ParamBool<px4::params::SENS_IMU_CLPNOTI>) _param_sens_imu_notify_clipping
 	)
@@ -72,3 +72,18 @@ PARAM_DEFINE_INT32(SENS_IMU_AUTOCAL, 1);
  * @group Sensors
  */
 PARAM_DEFINE_INT32(SENS_IMU_CLPNOTI, 1);
+
+/**
+ * IMU integrate raw FIFO samples
+ *
+ * Integrate the raw FIFO samples (sensor_accel_fifo, sensor_gyro_fifo) of the IMU
+ * instead of the averaged sensor_accel and sensor_gyro samples, with the delta angle
+ * coning corrections computed at the full sensor rate.
+ * Only applies to sensors that publish their FIFO.
+ *
+ * @boolean
+ *
+ * @category system
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(IMU_INTEG_FIFO, 0);
@@ -77,9 +77,10 @@ public:
 
 	void PrintStatus();
 
-private:
+protected:
 	void Run() override;
 
+private:
 	void CheckFailover(const hrt_abstime &time_now_us);
 	bool ParametersUpdate(bool force = false);
 	void UpdateStatus();
@@ -140,6 +140,18 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 {
 	const hrt_abstime time_now_us = hrt_absolute_time();
 
+	static_assert(MAX_SENSOR_COUNT <= DataValidatorArray::MAX_INSTANCES, "too many sensors for the voter");
+
+	// collect all updated instances, then vote in a single pass
+	uint32_t updated_mask = 0;
+	uint64_t timestamp[DataValidatorArray::MAX_INSTANCES] {};
+	uint32_t accel_error_count[DataValidatorArray::MAX_INSTANCES] {};
+	uint32_t gyro_error_count[DataValidatorArray::MAX_INSTANCES] {};
+	uint8_t accel_priority[DataValidatorArray::MAX_INSTANCES] {};
+	uint8_t gyro_priority[DataValidatorArray::MAX_INSTANCES] {};
+	float accel_value[DataValidatorArray::MAX_INSTANCES][3] {};
+	float gyro_value[DataValidatorArray::MAX_INSTANCES][3] {};
+
 	for (int uorb_index = 0; uorb_index < MAX_SENSOR_COUNT; uorb_index++) {
 		vehicle_imu_s imu_report;
 
@@ -178,14 +190,22 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 
 			_last_accel_timestamp[uorb_index] = imu_report.timestamp_sample;
 
-			_accel.voter.put(uorb_index, imu_report.timestamp, _last_sensor_data[uorb_index].accelerometer_m_s2,
-					 imu_status.accel_error_count, _accel.priority[uorb_index]);
-
-			_gyro.voter.put(uorb_index, imu_report.timestamp, _last_sensor_data[uorb_index].gyro_rad,
-					imu_status.gyro_error_count, _gyro.priority[uorb_index]);
+			updated_mask |= 1u << uorb_index;
+			timestamp[uorb_index] = imu_report.timestamp;
+			accel_error_count[uorb_index] = imu_status.accel_error_count;
+			gyro_error_count[uorb_index] = imu_status.gyro_error_count;
+			accel_priority[uorb_index] = _accel.priority[uorb_index];
+			gyro_priority[uorb_index] = _gyro.priority[uorb_index];
+			accel_data.copyTo(accel_value[uorb_index]);
+			gyro_rate.copyTo(gyro_value[uorb_index]);
 		}
 	}
 
+	if (updated_mask != 0) {
+		_accel.voter.put(updated_mask, timestamp, accel_value, accel_error_count, accel_priority);
+		_gyro.voter.put(updated_mask, timestamp, gyro_value, gyro_error_count, gyro_priority);
+	}
+
 	// find the best sensor
 	int accel_best_index = _accel.last_best_vote;
 	int gyro_best_index = _gyro.last_best_vote;
@@ -40,7 +40,7 @@
  */
 
 #include "data_validator/DataValidator.hpp"
-#include "data_validator/DataValidatorGroup.hpp"
+#include "data_validator/DataValidatorArray.hpp"
 
 #include <px4_platform_common/events.h>
 #include <px4_platform_common/module_params.h>
@@ -111,7 +111,7 @@ private:
 		explicit SensorData(ORB_ID meta) : subscription{{meta, 0}, {meta, 1}, {meta, 2}, {meta, 3}} {}
 
 		uORB::Subscription subscription[MAX_SENSOR_COUNT]; /**< raw sensor data subscription */
-		DataValidatorGroup voter{1};
+		DataValidatorArray voter{1};
 		unsigned int last_failover_count{0};
 		int32_t priority[MAX_SENSOR_COUNT] {};
 		int32_t priority_configured[MAX_SENSOR_COUNT] {};
@@ -173,6 +173,8 @@ int TemperatureCompensation::initialize_parameter_handles(ParameterHandles &para
 		}
 	}
 
+	parameter_handles.lut_enable = param_find("TC_LUT_EN");
+
 	return PX4_OK;
 }
 
@@ -292,6 +294,9 @@ int TemperatureCompensation::parameters_update()
 		}
 	}
 
+	param_get(parameter_handles.lut_enable, &_parameters.lut_enable);
+	update_tables();
+
 	/* the offsets might have changed, so make sure to report that change later when applying the
 	 * next corrections
 	 */
@@ -302,6 +307,46 @@ int TemperatureCompensation::parameters_update()
 	return ret;
 }
 
+void TemperatureCompensation::update_tables()
+{
+	if (_parameters.lut_enable != 1) {
+		delete _tables;
+		_tables = nullptr;
+		return;
+	}
+
+	if (_tables == nullptr) {
+		_tables = new Tables{};
+
+		if (_tables == nullptr) {
+			PX4_ERR("lookup table alloc failed");
+			return;
+		}
+	}
+
+	for (int i = 0; i < SENSOR_COUNT_MAX; i++) {
+		const SensorCalData3D &accel = _parameters.accel_cal_data[i];
+		_tables->accel[i].build(accel.min_temp, accel.max_temp, [this, &accel](float temperature, float offset[3]) {
+			calc_thermal_offsets_3D(accel, temperature, offset);
+		});
+
+		const SensorCalData3D &gyro = _parameters.gyro_cal_data[i];
+		_tables->gyro[i].build(gyro.min_temp, gyro.max_temp, [this, &gyro](float temperature, float offset[3]) {
+			calc_thermal_offsets_3D(gyro, temperature, offset);
+		});
+
+		const SensorCalData3D &mag = _parameters.mag_cal_data[i];
+		_tables->mag[i].build(mag.min_temp, mag.max_temp, [this, &mag](float temperature, float offset[3]) {
+			calc_thermal_offsets_3D(mag, temperature, offset);
+		});
+
+		SensorCalData1D &baro = _parameters.baro_cal_data[i];
+		_tables->baro[i].build(baro.min_temp, baro.max_temp, [this, &baro](float temperature, float offset[1]) {
+			calc_thermal_offsets_1D(baro, temperature, offset[0]);
+		});
+	}
+}
+
 bool TemperatureCompensation::calc_thermal_offsets_1D(SensorCalData1D &coef, float measured_temp, float &offset)
 {
 	bool ret = true;
@@ -434,7 +479,12 @@ int TemperatureCompensation::update_offsets_accel(int topic_instance, float temp
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
+	if (_tables) {
+		_tables->accel[mapping].lookup(temperature, offsets);
+
+	} else {
+		calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f) {
@@ -460,7 +510,12 @@ int TemperatureCompensation::update_offsets_gyro(int topic_instance, float tempe
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
+	if (_tables) {
+		_tables->gyro[mapping].lookup(temperature, offsets);
+
+	} else {
+		calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f) {
@@ -486,7 +541,12 @@ int TemperatureCompensation::update_offsets_mag(int topic_instance, float temper
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
+	if (_tables) {
+		_tables->mag[mapping].lookup(temperature, offsets);
+
+	} else {
+		calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) > 1.0f) {
@@ -512,7 +572,12 @@ int TemperatureCompensation::update_offsets_baro(int topic_instance, float tempe
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
+	if (_tables) {
+		_tables->baro[mapping].lookup(temperature, offsets);
+
+	} else {
+		calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f) {
@@ -527,6 +592,8 @@ void TemperatureCompensation::print_status()
 {
 	PX4_INFO("Temperature Compensation:");
 
+	PX4_INFO(" lookup tables: %s", _tables ? "enabled" : "disabled");
+
 	PX4_INFO(" accel: enabled: %" PRId32, _parameters.accel_tc_enable);
 
 	if (_parameters.accel_tc_enable == 1) {
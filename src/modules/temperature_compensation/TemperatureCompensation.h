@@ -46,6 +46,8 @@
 #include <mathlib/mathlib.h>
 #include <matrix/math.hpp>
 
+#include "ThermalOffsetTable.hpp"
+
 namespace temperature_compensation
 {
 
@@ -69,6 +71,14 @@ static constexpr uint8_t SENSOR_COUNT_MAX = 4;
 class TemperatureCompensation
 {
 public:
+	TemperatureCompensation() = default;
+	~TemperatureCompensation() { delete _tables; }
+
+	// no copy, assignment, move, move assignment
+	TemperatureCompensation(const TemperatureCompensation &) = delete;
+	TemperatureCompensation &operator=(const TemperatureCompensation &) = delete;
+	TemperatureCompensation(TemperatureCompensation &&) = delete;
+	TemperatureCompensation &operator=(TemperatureCompensation &&) = delete;
 
 	/** (re)load the parameters. Make sure to call this on startup as well */
 	int parameters_update();
@@ -193,6 +203,8 @@ private:
 
 		int32_t baro_tc_enable{0};
 		SensorCalData1D baro_cal_data[BARO_COUNT_MAX] {};
+
+		int32_t lut_enable{0};
 	};
 
 	// create a struct containing the handles required to access all calibration parameters
@@ -208,6 +220,8 @@ private:
 
 		param_t baro_tc_enable{PARAM_INVALID};
 		SensorCalHandles1D baro_cal_handles[BARO_COUNT_MAX] {};
+
+		param_t lut_enable{PARAM_INVALID};
 	};
 
 
@@ -257,8 +271,21 @@ private:
 	bool calc_thermal_offsets_3D(const SensorCalData3D &coef, float measured_temp, float offset[]);
 
 
+	/** sample the polynomials of all enabled sensors into the lookup tables (TC_LUT_EN) */
+	void update_tables();
+
 	Parameters _parameters;
 
+	// piecewise linear offsets over the calibrated temperature range, per parameter index
+	struct Tables {
+		ThermalOffsetTable<3> accel[ACCEL_COUNT_MAX];
+		ThermalOffsetTable<3> gyro[GYRO_COUNT_MAX];
+		ThermalOffsetTable<3> mag[MAG_COUNT_MAX];
+		ThermalOffsetTable<1> baro[BARO_COUNT_MAX];
+	};
+
+	Tables *_tables{nullptr};
+
 
 	struct PerSensorData {
 
@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ThermalOffsetTable.hpp
+ *
+ * Piecewise linear lookup table of the thermal offsets of a sensor, sampled at equally spaced
+ * temperatures over the calibrated range. Replaces the polynomial evaluation by one interpolation
+ * per axis.
+ */
+
+#pragma once
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+
+namespace temperature_compensation
+{
+
+template<int AXES, int POINTS = 33>
+class ThermalOffsetTable
+{
+public:
+	static_assert(POINTS >= 2, "at least one segment");
+
+	ThermalOffsetTable() = default;
+	~ThermalOffsetTable() = default;
+
+	/**
+	 * Sample the offsets over [min_temp, max_temp]
+	 * @param offsets_at callable (float temperature, float offset[AXES]) evaluating the reference model
+	 */
+	template<typename F>
+	void build(float min_temp, float max_temp, F offsets_at)
+	{
+		_min_temp = min_temp;
+		_max_temp = fmaxf(min_temp, max_temp);
+
+		const float step = (_max_temp - _min_temp) / (POINTS - 1);
+		_inv_step = (step > FLT_EPSILON) ? 1.f / step : 0.f;
+
+		for (int i = 0; i < POINTS; i++) {
+			// evaluate the last point exactly at the maximum
+			const float temperature = (i == POINTS - 1) ? _max_temp : _min_temp + i * step;
+			offsets_at(temperature, _offsets[i]);
+		}
+	}
+
+	/**
+	 * Interpolate the offsets, the temperature is clipped to the table range
+	 * @return true if the temperature is inside the table range
+	 */
+	bool lookup(float temperature, float offset[AXES]) const
+	{
+		const bool in_range = (temperature >= _min_temp) && (temperature <= _max_temp);
+
+		const float position = fminf(fmaxf((temperature - _min_temp) * _inv_step, 0.f), (float)(POINTS - 1));
+		const int index = segment_index((int)position);
+		const float fraction = position - index;
+
+		const float *lower = _offsets[index];
+		const float *upper = _offsets[index + 1];
+
+		for (int axis = 0; axis < AXES; axis++) {
+			offset[axis] = lower[axis] + fraction * (upper[axis] - lower[axis]);
+		}
+
+		return in_range;
+	}
+
+	float min_temp() const { return _min_temp; }
+	float max_temp() const { return _max_temp; }
+
+private:
+	// last segment for the maximum temperature
+	static int segment_index(int index) { return (index < POINTS - 2) ? index : POINTS - 2; }
+
+	float _min_temp{0.f};
+	float _max_temp{0.f};
+	float _inv_step{0.f};
+
+	float _offsets[POINTS][AXES] {};
+};
+
+} // namespace temperature_compensation
@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ThermalOffsetTableTest.cpp
+ *
+ * Accuracy of the thermal offset lookup tables against the compensation polynomials,
+ * with coefficients of typical temperature calibrations.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ThermalOffsetTable.hpp"
+
+using namespace temperature_compensation;
+
+// 3rd order polynomial per axis (accel, gyro, mag), same as TemperatureCompensation::calc_thermal_offsets_3D()
+struct Polynomial3D {
+	float x3[3];
+	float x2[3];
+	float x1[3];
+	float x0[3];
+	float ref_temp;
+	float min_temp;
+	float max_temp;
+
+	void operator()(float temperature, float offset[3]) const
+	{
+		const float delta_temp = fminf(fmaxf(temperature, min_temp), max_temp) - ref_temp;
+		const float delta_temp_2 = delta_temp * delta_temp;
+		const float delta_temp_3 = delta_temp_2 * delta_temp;
+
+		for (int i = 0; i < 3; i++) {
+			offset[i] = x0[i] + x1[i] * delta_temp + x2[i] * delta_temp_2 + x3[i] * delta_temp_3;
+		}
+	}
+};
+
+// 5th order polynomial (baro), same as TemperatureCompensation::calc_thermal_offsets_1D()
+struct Polynomial1D {
+	float x5, x4, x3, x2, x1, x0;
+	float ref_temp;
+	float min_temp;
+	float max_temp;
+
+	void operator()(float temperature, float offset[1]) const
+	{
+		const float t = fminf(fmaxf(temperature, min_temp), max_temp) - ref_temp;
+		offset[0] = x0 + t * (x1 + t * (x2 + t * (x3 + t * (x4 + t * x5))));
+	}
+};
+
+// maximum absolute interpolation error over the range and beyond
+template<int AXES, typename P>
+static float maxError(const ThermalOffsetTable<AXES> &table, const P &polynomial, float min_temp, float max_temp)
+{
+	float max_error = 0.f;
+
+	for (float temperature = min_temp - 10.f; temperature <= max_temp + 10.f; temperature += 0.01f) {
+		float expected[AXES];
+		float offset[AXES];
+		polynomial(temperature, expected);
+		table.lookup(temperature, offset);
+
+		for (int axis = 0; axis < AXES; axis++) {
+			max_error = fmaxf(max_error, fabsf(offset[axis] - expected[axis]));
+		}
+	}
+
+	return max_error;
+}
+
+TEST(ThermalOffsetTableTest, gyro)
+{
+	// rad/s
+	const Polynomial3D gyro{
+		{-4.1e-8f, 2.2e-8f, 6.5e-8f},
+		{3.3e-6f, -1.9e-6f, -4.8e-6f},
+		{2.4e-4f, -1.1e-4f, 3.1e-4f},
+		{1.2e-3f, -3.6e-3f, 8.0e-4f},
+		25.f, -10.f, 70.f
+	};
+
+	ThermalOffsetTable<3> table;
+	table.build(gyro.min_temp, gyro.max_temp, gyro);
+
+	const float max_error = maxError(table, gyro, gyro.min_temp, gyro.max_temp);
+	printf("gyro: max error %.2e rad/s\n", (double)max_error);
+
+	// well below the gyro bias stability
+	EXPECT_LT(max_error, 2.5e-5f);
+}
+
+TEST(ThermalOffsetTableTest, accel)
+{
+	// m/s^2
+	const Polynomial3D accel{
+		{2.1e-6f, -1.4e-6f, 5.2e-6f},
+		{-1.6e-4f, 9.0e-5f, -3.3e-4f},
+		{4.5e-3f, -2.9e-3f, 1.1e-2f},
+		{-0.05f, 0.08f, 0.21f},
+		25.f, -10.f, 70.f
+	};
+
+	ThermalOffsetTable<3> table;
+	table.build(accel.min_temp, accel.max_temp, accel);
+
+	const float max_error = maxError(table, accel, accel.min_temp, accel.max_temp);
+	printf("accel: max error %.2e m/s^2\n", (double)max_error);
+
+	// ~0.15 mg
+	EXPECT_LT(max_error, 1.5e-3f);
+}
+
+TEST(ThermalOffsetTableTest, baro)
+{
+	// Pa
+	const Polynomial1D baro{3.1e-7f, -2.0e-5f, 4.4e-4f, 1.8e-2f, -4.6f, 12.f, 30.f, 0.f, 65.f};
+
+	ThermalOffsetTable<1> table;
+	table.build(baro.min_temp, baro.max_temp, baro);
+
+	const float max_error = maxError(table, baro, baro.min_temp, baro.max_temp);
+	printf("baro: max error %.3f Pa\n", (double)max_error);
+
+	// ~2 cm of altitude
+	EXPECT_LT(max_error, 0.25f);
+}
+
+TEST(ThermalOffsetTableTest, nodesExact)
+{
+	const Polynomial3D mag{
+		{1e-7f, 0.f, -1e-7f},
+		{-2e-5f, 1e-5f, 3e-6f},
+		{1e-3f, -2e-3f, 5e-4f},
+		{0.01f, -0.02f, 0.f},
+		30.f, 5.f, 60.f
+	};
+
+	ThermalOffsetTable<3> table;
+	table.build(mag.min_temp, mag.max_temp, mag);
+
+	for (int i = 0; i < 33; i++) {
+		const float temperature = (i == 32) ? mag.max_temp : mag.min_temp + i * (mag.max_temp - mag.min_temp) / 32.f;
+		float expected[3];
+		float offset[3];
+		mag(temperature, expected);
+		EXPECT_TRUE(table.lookup(temperature, offset));
+
+		for (int axis = 0; axis < 3; axis++) {
+			EXPECT_NEAR(offset[axis], expected[axis], 1e-6f) << "node " << i;
+		}
+	}
+}
+
+TEST(ThermalOffsetTableTest, clipped)
+{
+	const Polynomial1D baro{0.f, 0.f, 0.f, 0.01f, -2.f, 5.f, 25.f, 0.f, 50.f};
+
+	ThermalOffsetTable<1> table;
+	table.build(baro.min_temp, baro.max_temp, baro);
+
+	// held at the range limits like the polynomial, and reported out of range
+	float offset[1];
+	float expected[1];
+
+	EXPECT_FALSE(table.lookup(-20.f, offset));
+	baro(baro.min_temp, expected);
+	EXPECT_FLOAT_EQ(offset[0], expected[0]);
+
+	EXPECT_FALSE(table.lookup(80.f, offset));
+	baro(baro.max_temp, expected);
+	EXPECT_FLOAT_EQ(offset[0], expected[0]);
+
+	EXPECT_TRUE(table.lookup(baro.max_temp, offset));
+	EXPECT_FLOAT_EQ(offset[0], expected[0]);
+}
+
+TEST(ThermalOffsetTableTest, emptyRange)
+{
+	// uncalibrated sensor (all parameters 0)
+	const Polynomial3D zero{};
+
+	ThermalOffsetTable<3> table;
+	table.build(zero.min_temp, zero.max_temp, zero);
+
+	float offset[3] {1.f, 1.f, 1.f};
+	EXPECT_FALSE(table.lookup(25.f, offset));
+
+	for (int axis = 0; axis < 3; axis++) {
+		EXPECT_EQ(offset[axis], 0.f);
+	}
+}
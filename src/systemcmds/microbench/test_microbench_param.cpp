@@ -0,0 +1,179 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_param.cpp
+ * Tests for microbench parameter lookup.
+ */
+
+#include <unit_test.h>
+
+#include <string.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <parameters/param.h>
+
+namespace MicroBenchParam
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+class MicroBenchParam : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+
+	bool time_param_find();
+	bool time_param_find_all();
+};
+
+bool MicroBenchParam::run_tests()
+{
+	ut_run_test(time_param_find);
+	ut_run_test(time_param_find_all);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_param, MicroBenchParam)
+
+// reference: binary search over the sorted parameter names
+static param_t param_find_bsearch(const char *name)
+{
+	param_t front = 0;
+	param_t last = param_count();
+
+	while (front < last) {
+		const param_t middle = front + (last - front) / 2;
+		const int ret = strcmp(name, param_name(middle));
+
+		if (ret == 0) {
+			return middle;
+
+		} else if (ret < 0) {
+			last = middle;
+
+		} else {
+			front = middle + 1;
+		}
+	}
+
+	return PARAM_INVALID;
+}
+
+bool MicroBenchParam::time_param_find()
+{
+	const unsigned count = param_count();
+	ut_assert_true(count > 0);
+
+	const char *first = param_name(0);
+	const char *middle = param_name(count / 2);
+	const char *last = param_name(count - 1);
+
+	param_t ret = PARAM_INVALID;
+
+	PERF("param_find first", ret = param_find_no_notification(first), 100);
+	PERF("param_find middle", ret = param_find_no_notification(middle), 100);
+	PERF("param_find last", ret = param_find_no_notification(last), 100);
+	PERF("param_find unknown", ret = param_find_no_notification("MB_UNKNOWN"), 100);
+
+	printf("\n");
+
+	PERF("bsearch first", ret = param_find_bsearch(first), 100);
+	PERF("bsearch middle", ret = param_find_bsearch(middle), 100);
+	PERF("bsearch last", ret = param_find_bsearch(last), 100);
+	PERF("bsearch unknown", ret = param_find_bsearch("MB_UNKNOWN"), 100);
+
+	return true;
+}
+
+bool MicroBenchParam::time_param_find_all()
+{
+	const unsigned count = param_count();
+
+	// every name must resolve to its own handle
+	for (unsigned i = 0; i < count; i++) {
+		ut_compare("param_find", param_find_no_notification(param_name(i)), i);
+	}
+
+	ut_compare("param_find unknown", param_find_no_notification("MB_UNKNOWN"), PARAM_INVALID);
+
+	unsigned found = 0;
+
+	PERF("param_find all", for (unsigned n = 0; n < count; n++) { found += param_find_no_notification(param_name(n)) != PARAM_INVALID; }, 10);
+	PERF("bsearch all", for (unsigned n = 0; n < count; n++) { found += param_find_bsearch(param_name(n)) != PARAM_INVALID; }, 10);
+
+	return true;
+}
+
+} // namespace MicroBenchParam
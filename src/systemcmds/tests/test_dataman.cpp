@@ -76,6 +76,7 @@ private:
 	bool testSyncMutipleClients();
 	bool testSyncWriteReadAllItemsMaxSize();
 	bool testSyncClearAll();
+	bool testSyncWriteBulk();
 
 	//Async
 	bool testAsyncReadInvalidItem();
@@ -283,6 +284,53 @@ DatamanTest::testSyncWriteReadAllItemsMaxSize()
 	return true;
 }
 
+bool
+DatamanTest::testSyncWriteBulk()
+{
+	static constexpr uint32_t COUNT = 10;
+	static constexpr uint32_t FIRST_INDEX = 5;
+	uint8_t buffer[COUNT * DM_MAX_DATA_SIZE];
+
+	for (uint32_t i = 0; i < sizeof(buffer); ++i) {
+		buffer[i] = (uint8_t)(i / DM_MAX_DATA_SIZE + 1);
+	}
+
+	bool success = _dataman_client1.writeBulkSync(DM_KEY_WAYPOINTS_OFFBOARD_1, FIRST_INDEX, buffer, DM_MAX_DATA_SIZE, COUNT);
+
+	if (!success) {
+		PX4_ERR("writeBulkSync failed");
+		return false;
+	}
+
+	for (uint32_t index = 0; index < COUNT; ++index) {
+
+		success = _dataman_client2.readSync(DM_KEY_WAYPOINTS_OFFBOARD_1, FIRST_INDEX + index, _buffer_read, DM_MAX_DATA_SIZE);
+
+		if (!success) {
+			PX4_ERR("readSync failed at index = %" PRIu32, FIRST_INDEX + index);
+			return false;
+		}
+
+		for (uint32_t i = 0U; i < DM_MAX_DATA_SIZE; ++i) {
+			if (_buffer_read[i] != (uint8_t)(index + 1)) {
+				PX4_ERR("writeBulkSync failed at index = %" PRIu32 ", element = %" PRIu32 ", expected: %" PRIu8 ", received: %" PRIu8,
+					FIRST_INDEX + index, i, (uint8_t)(index + 1), _buffer_read[i]);
+				return false;
+			}
+		}
+	}
+
+	// the whole range must be valid
+	success = _dataman_client1.writeBulkSync(DM_KEY_SAFE_POINTS_0, DM_KEY_SAFE_POINTS_MAX - 1, buffer, 2, 2);
+
+	if (success) {
+		PX4_ERR("writeBulkSync past the last index succeeded");
+		return false;
+	}
+
+	return true;
+}
+
 bool
 DatamanTest::testSyncClearAll()
 {
@@ -1129,6 +1177,7 @@ bool DatamanTest::run_tests()
 	ut_run_test(testSyncMutipleClients);
 	ut_run_test(testSyncWriteReadAllItemsMaxSize);
 	ut_run_test(testSyncClearAll);
+	ut_run_test(testSyncWriteBulk);
 
 	ut_run_test(testAsyncReadInvalidItem);
 	ut_run_test(testAsyncWriteInvalidItem);